@@ -0,0 +1,29 @@
+/**
+ * @author Marcel Breyer
+ * @copyright 2024-today All Rights Reserved
+ * @license This file is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ */
+
+#include "hws/burst_capture.hpp"  // hws::burst_capture
+
+#include "fmt/chrono.h"         // direct formatting of std::chrono types
+#include "fmt/format.h"         // fmt::format
+#include "pybind11/chrono.h"    // bind std::chrono types
+#include "pybind11/pybind11.h"  // py::module_, py::class_
+#include "pybind11/stl.h"       // bind STL types
+
+namespace py = pybind11;
+
+void init_burst_capture(py::module_ &m) {
+    // bind a single capture of the hardware samples around a fired trigger
+    py::class_<hws::burst_capture>(m, "BurstCapture")
+        .def_readonly("trigger", &hws::burst_capture::trigger, "read the name of the trigger that fired")
+        .def_readonly("trigger_time_point", &hws::burst_capture::trigger_time_point, "read the time point of the tick in which the trigger fired")
+        .def_readonly("time_points", &hws::burst_capture::time_points, "read the time points of all captured ticks")
+        .def_readonly("samples", &hws::burst_capture::samples, "read the captured numeric hardware samples (one list of values per name, NaN if not retrieved in a tick)")
+        .def("duration", &hws::burst_capture::duration, "get the duration covered by the captured samples")
+        .def("__repr__", [](const hws::burst_capture &self) {
+            return fmt::format("<HardwareSampling.BurstCapture with {{ trigger: {}, num_time_points: {}, duration: {} }}>", self.trigger, self.time_points.size(), self.duration());
+        });
+}
@@ -0,0 +1,42 @@
+/**
+ * @author Marcel Breyer
+ * @copyright 2024-today All Rights Reserved
+ * @license This file is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ */
+
+#include "hws/energy_region.hpp"  // hws::energy_region
+
+#include "fmt/chrono.h"         // direct formatting of std::chrono types
+#include "fmt/format.h"         // fmt::format
+#include "pybind11/chrono.h"    // bind std::chrono types
+#include "pybind11/pybind11.h"  // py::module_, py::class_
+#include "pybind11/stl.h"       // bind STL types
+
+#include <optional>  // std::optional
+#include <string>    // std::string
+
+namespace py = pybind11;
+
+void init_energy_region(py::module_ &m) {
+    // bind a single region measured via energy counter snapshots
+    py::class_<hws::energy_region>(m, "EnergyRegion")
+        .def_readonly("name", &hws::energy_region::name, "read the name of this region")
+        .def_readonly("begin_time_point", &hws::energy_region::begin_time_point, "read the time point this region began at")
+        .def_readonly("end_time_point", &hws::energy_region::end_time_point, "read the time point this region ended at, None if the region is still open")
+        .def_readonly("begin_energy", &hws::energy_region::begin_energy, "read the cumulative energy counter in J when this region began")
+        .def_readonly("end_energy", &hws::energy_region::end_energy, "read the cumulative energy counter in J when this region ended")
+        .def_readonly("depth", &hws::energy_region::depth, "read the number of regions that were still open when this region began")
+        .def_readonly("num_samples", &hws::energy_region::num_samples, "read the number of ticks of the sampling loop during this region")
+        .def_readonly("max_power", &hws::energy_region::max_power, "read the maximum power draw in W during this region")
+        .def_readonly("max_temperature", &hws::energy_region::max_temperature, "read the maximum temperature in °C during this region")
+        .def("finished", &hws::energy_region::finished, "check whether this region has already been ended")
+        .def("duration", &hws::energy_region::duration, "get the duration of this region")
+        .def("energy", &hws::energy_region::energy, "get the energy in J consumed during this region")
+        .def("average_power", &hws::energy_region::average_power, "get the average power draw in W during this region")
+        .def("mean_power", &hws::energy_region::mean_power, "get the mean power draw in W of the power samples retrieved during this region")
+        .def("__repr__", [](const hws::energy_region &self) {
+            const auto value_or_none = [](const std::optional<double> &value) { return value.has_value() ? fmt::format("{}", value.value()) : std::string{ "None" }; };
+            return fmt::format("<HardwareSampling.EnergyRegion with {{ name: {}, duration: {}, energy: {}, average_power: {} }}>", self.name, self.duration(), value_or_none(self.energy()), value_or_none(self.average_power()));
+        });
+}
@@ -7,8 +7,10 @@
 
 #include "hws/hardware_sampler.hpp"  // hws::hardware_sampler
 
-#include "hws/event.hpp"    // hws::event
-#include "hws/utility.hpp"  // hws::detail::durations_from_reference_time
+#include "hws/event.hpp"            // hws::event
+#include "hws/overrun_policy.hpp"   // hws::overrun_policy
+#include "hws/sample_category.hpp"  // hws::sample_category
+#include "hws/utility.hpp"          // hws::detail::durations_from_reference_time
 
 #if defined(HWS_FOR_CPUS_ENABLED)
     #include "hws/cpu/hardware_sampler.hpp"  // hws::cpu_hardware_sampler
@@ -23,13 +25,19 @@
     #include "hws/gpu_intel/hardware_sampler.hpp"  // hws::gpu_intel_hardware_sampler
 #endif
 
-#include "fmt/format.h"         // fmt::format
-#include "pybind11/chrono.h"    // bind std::chrono types
-#include "pybind11/pybind11.h"  // py::module_, py::class_
-#include "pybind11/stl.h"       // bind STL types
+#include "fmt/format.h"           // fmt::format
+#include "pybind11/chrono.h"      // bind std::chrono types
+#include "pybind11/functional.h"  // bind std::function
+#include "pybind11/pybind11.h"    // py::module_, py::class_, py::call_guard, py::gil_scoped_release
+#include "pybind11/stl.h"         // bind STL types
 
 #include "relative_event.hpp"  // hws::detail::relative_event
-#include <string>              // std::string
+
+#include <chrono>    // std::chrono::nanoseconds
+#include <cstddef>   // std::size_t
+#include <optional>  // std::optional
+#include <string>    // std::string
+#include <vector>    // std::vector
 
 namespace py = pybind11;
 
@@ -39,28 +47,75 @@ void init_hardware_sampler(py::module_ &m) {
     // bind the pure virtual hardware sampler base class
     py::class_<hws::hardware_sampler> pyhardware_sampler(pure_virtual_module, "__pure_virtual_base_HardwareSampler");
     pyhardware_sampler.def("start", &hws::hardware_sampler::start_sampling, "start the current hardware sampling")
-        .def("stop", &hws::hardware_sampler::stop_sampling, "stop the current hardware sampling")
+        .def("stop", &hws::hardware_sampler::stop_sampling, py::call_guard<py::gil_scoped_release>(), "stop the current hardware sampling")
         .def("pause", &hws::hardware_sampler::pause_sampling, "pause the current hardware sampling")
         .def("resume", &hws::hardware_sampler::resume_sampling, "resume the current hardware sampling")
         .def("has_started", &hws::hardware_sampler::has_sampling_started, "check whether hardware sampling has already been started")
         .def("is_sampling", &hws::hardware_sampler::is_sampling, "check whether the hardware sampling is currently active")
         .def("has_stopped", &hws::hardware_sampler::has_sampling_stopped, "check whether hardware sampling has already been stopped")
+        .def("samples_accessible", &hws::hardware_sampler::samples_accessible, "check whether the hardware samples can safely be accessed while the sampling is still running")
         .def("add_event", py::overload_cast<hws::event>(&hws::hardware_sampler::add_event), "add a new event")
         .def("add_event", py::overload_cast<decltype(hws::event::time_point), decltype(hws::event::name)>(&hws::hardware_sampler::add_event), "add a new event using a time point and a name")
         .def("add_event", py::overload_cast<decltype(hws::event::name)>(&hws::hardware_sampler::add_event), "add a new event using a name, the current time is used as time point")
+        .def("add_event", py::overload_cast<decltype(hws::event::name), bool>(&hws::hardware_sampler::add_event), "add a new event using a name, the current time is used as time point; optionally retrieve an on-demand sample at the event boundary", py::arg("name"), py::arg("sample_immediately"))
+        .def("sample_now", &hws::hardware_sampler::sample_now, "request an on-demand sample without waiting for the next sampling interval")
+        .def("begin_region", &hws::hardware_sampler::begin_region, "begin a new region reading only the time and energy counter and return its ID")
+        .def("end_region", py::overload_cast<const std::string &>(&hws::hardware_sampler::end_region), "end the most recently begun open region with the given name")
+        .def("end_region", py::overload_cast<std::size_t>(&hws::hardware_sampler::end_region), "end the region with the given ID")
+        .def("energy_regions", &hws::hardware_sampler::energy_regions, "get all regions in the order they have been begun")
+        .def("set_marker_only_mode", &hws::hardware_sampler::set_marker_only_mode, "enable or disable the marker-only mode without a sampling thread")
+        .def("uses_marker_only_mode", &hws::hardware_sampler::uses_marker_only_mode, "check whether the marker-only mode is enabled")
+        .def("add_trigger", &hws::hardware_sampler::add_trigger, "add a trigger whose predicate is evaluated in the sampling thread after every tick", py::arg("name"), py::arg("predicate"))
+        .def("set_burst_window", &hws::hardware_sampler::set_burst_window, "set the windows captured before and after a trigger fired and the sampling interval used in the burst mode", py::arg("pre_trigger"), py::arg("post_trigger"), py::arg("burst_interval") = std::optional<std::chrono::nanoseconds>{})
+        .def("uses_triggers", &hws::hardware_sampler::uses_triggers, "check whether any trigger has been added")
+        .def("burst_captures", &hws::hardware_sampler::burst_captures, "get all burst captures in the order their triggers fired")
+        .def("add_tick_callback", &hws::hardware_sampler::add_tick_callback, py::call_guard<py::gil_scoped_release>(), "add a callback called in the sampling thread with a view of every tick and return its ID", py::arg("callback"))
+        .def("remove_tick_callback", &hws::hardware_sampler::remove_tick_callback, py::call_guard<py::gil_scoped_release>(), "remove the tick callback with the given ID", py::arg("id"))
         .def("num_events", &hws::hardware_sampler::num_events, "get the number of events")
         .def("get_events", &hws::hardware_sampler::get_events, "get all events")
         .def("get_relative_events", [](const hws::hardware_sampler &self) {
+            const std::vector<hws::event> events = self.get_events();
             std::vector<hws::detail::relative_event> relative_events{};
-            for (const hws::event &e : self.get_events()) {
-                relative_events.emplace_back(hws::detail::duration_from_reference_time(e.time_point, self.get_event(0).time_point), e.name);
+            for (const hws::event &e : events) {
+                relative_events.emplace_back(hws::detail::duration_from_reference_time(e.time_point, events[0].time_point), e.name);
             }
             return relative_events; }, "get all relative events")
         .def("get_event", &hws::hardware_sampler::get_event, "get a specific event")
         .def("get_relative_event", [](const hws::hardware_sampler &self, const std::size_t idx) { return hws::detail::relative_event{ hws::detail::duration_from_reference_time(self.get_event(idx).time_point, self.get_event(0).time_point), self.get_event(idx).name }; }, "get a specific relative event")
-        .def("time_points", &hws::hardware_sampler::sampling_time_points, "get the time points of the respective hardware samples")
+        .def("set_sample_metrics", &hws::hardware_sampler::set_sample_metrics, "select the hardware samples to retrieve by their names (an empty list selects all hardware samples)", py::arg("metrics"))
+        .def("sample_metrics", &hws::hardware_sampler::sample_metrics, "get the names of the selected hardware samples (empty if all hardware samples are selected)")
+        .def("uses_sample_metric_selection", &hws::hardware_sampler::uses_sample_metric_selection, "check whether only a subset of the hardware samples has been selected")
+        .def("sample_metric_selected", &hws::hardware_sampler::sample_metric_selected, "check whether the hardware sample with the given name has been selected", py::arg("metric"))
+        .def("time_points", py::overload_cast<>(&hws::hardware_sampler::sampling_time_points, py::const_), "get the time points of the respective hardware samples")
+        .def("time_points", py::overload_cast<hws::sample_category>(&hws::hardware_sampler::sampling_time_points, py::const_), "get the time points of the hardware samples of the provided sample_category")
         .def("relative_time_points", [](const hws::hardware_sampler &self) { return hws::detail::durations_from_reference_time(self.sampling_time_points(), self.get_event(0).time_point); }, "get the relative durations of the respective hardware samples in seconds (as \"normal\" number)")
-        .def("sampling_interval", &hws::hardware_sampler::sampling_interval, "get the sampling interval of this hardware sampler (in ms)")
+        .def("query_begin_time_points", py::overload_cast<>(&hws::hardware_sampler::sampling_query_begin_time_points, py::const_), "get the time points at which the query of the hardware samples of each tick started")
+        .def("query_begin_time_points", py::overload_cast<hws::sample_category>(&hws::hardware_sampler::sampling_query_begin_time_points, py::const_), "get the time points at which the query of the hardware samples of the provided sample_category started")
+        .def("query_end_time_points", py::overload_cast<>(&hws::hardware_sampler::sampling_query_end_time_points, py::const_), "get the time points at which the query of the hardware samples of each tick ended")
+        .def("query_end_time_points", py::overload_cast<hws::sample_category>(&hws::hardware_sampler::sampling_query_end_time_points, py::const_), "get the time points at which the query of the hardware samples of the provided sample_category ended")
+        .def("query_latencies", py::overload_cast<>(&hws::hardware_sampler::sampling_query_latencies, py::const_), "get the time needed to query the hardware samples of each tick")
+        .def("query_latencies", py::overload_cast<hws::sample_category>(&hws::hardware_sampler::sampling_query_latencies, py::const_), "get the time needed to query the hardware samples of the ticks of the provided sample_category")
+        .def("sampling_interval", py::overload_cast<>(&hws::hardware_sampler::sampling_interval, py::const_), "get the sampling interval of this hardware sampler")
+        .def("sampling_interval", py::overload_cast<hws::sample_category>(&hws::hardware_sampler::sampling_interval, py::const_), "get the sampling interval of the provided sample_category")
+        .def("set_sampling_interval", &hws::hardware_sampler::set_sampling_interval, "set the sampling interval of the provided sample_category (must be a multiple of the base sampling interval)")
+        .def("set_adaptive_sampling", &hws::hardware_sampler::set_adaptive_sampling, "enable the adaptive sampling rate with the provided maximum sampling interval (must be a multiple of the base sampling interval)")
+        .def("uses_adaptive_sampling", &hws::hardware_sampler::uses_adaptive_sampling, "check whether the adaptive sampling rate is enabled")
+        .def("max_sampling_interval", &hws::hardware_sampler::max_sampling_interval, "get the maximum sampling interval of the adaptive sampling rate")
+        .def("adaptive_sampling_threshold", &hws::hardware_sampler::adaptive_sampling_threshold, "get the relative change of the provided sample_category that resets the adaptive sampling interval")
+        .def("set_adaptive_sampling_threshold", &hws::hardware_sampler::set_adaptive_sampling_threshold, "set the relative change of the provided sample_category that resets the adaptive sampling interval")
+        .def("set_sample_retention", py::overload_cast<std::size_t>(&hws::hardware_sampler::set_sample_retention), "retain only the provided number of last samples of every hardware sample")
+        .def("set_sample_retention", py::overload_cast<std::chrono::nanoseconds>(&hws::hardware_sampler::set_sample_retention), "retain only the samples of at least the provided last duration of every hardware sample")
+        .def("set_sample_compression", &hws::hardware_sampler::set_sample_compression, "enable or disable the compression of the hardware samples and time points")
+        .def("uses_sample_compression", &hws::hardware_sampler::uses_sample_compression, "check whether the hardware samples are compressed")
+        .def("set_streaming_statistics", &hws::hardware_sampler::set_streaming_statistics, "enable or disable the streaming statistics of the hardware samples retaining only the last two samples")
+        .def("uses_streaming_statistics", &hws::hardware_sampler::uses_streaming_statistics, "check whether the hardware samples are summarized by streaming statistics")
+        .def("set_expected_sampling_duration", &hws::hardware_sampler::set_expected_sampling_duration, "set the expected sampling duration used to preallocate the storage of the hardware samples")
+        .def("expected_sampling_duration", &hws::hardware_sampler::expected_sampling_duration, "get the expected sampling duration used to preallocate the storage of the hardware samples")
+        .def("uses_sample_retention", &hws::hardware_sampler::uses_sample_retention, "check whether only the last samples are retained")
+        .def("sample_retention", &hws::hardware_sampler::sample_retention, "get the number of retained samples per hardware sample (0 if all samples are retained)")
+        .def("overrun_policy", &hws::hardware_sampler::sampling_overrun_policy, "get the policy used if retrieving a sample takes longer than the sampling interval")
+        .def("set_overrun_policy", &hws::hardware_sampler::set_sampling_overrun_policy, "set the policy used if retrieving a sample takes longer than the sampling interval")
+        .def("sampling_statistics", &hws::hardware_sampler::sampling_statistics, "get the timing statistics, i.e., the jitter and missed deadlines, of the sampling loop")
         .def("dump_yaml", py::overload_cast<const std::string &>(&hws::hardware_sampler::dump_yaml, py::const_), "dump all hardware samples to the given YAML file")
         .def("as_yaml_string", &hws::hardware_sampler::as_yaml_string, "return all hardware samples including additional information like events as YAML string")
         .def("samples_only_as_yaml_string", &hws::hardware_sampler::samples_only_as_yaml_string, "return all hardware samples as YAML string")
@@ -15,8 +15,14 @@
 namespace py = pybind11;
 
 // forward declare binding functions
+void init_burst_capture(py::module_ &);
 void init_event(py::module_ &);
+void init_energy_region(py::module_ &);
 void init_sample_category(py::module_ &);
+void init_overrun_policy(py::module_ &);
+void init_sampling_statistics(py::module_ &);
+void init_scoped_region(py::module_ &);
+void init_tick_view(py::module_ &);
 void init_relative_event(py::module_ &);
 void init_hardware_sampler(py::module_ &);
 void init_system_hardware_sampler(py::module_ &);
@@ -29,11 +35,17 @@ void init_version(py::module_ &);
 PYBIND11_MODULE(HardwareSampling, m) {
     m.doc() = "Hardware Sampling for CPUs and GPUs";
 
+    init_burst_capture(m);
     init_event(m);
+    init_energy_region(m);
     init_sample_category(m);
+    init_overrun_policy(m);
+    init_sampling_statistics(m);
     init_relative_event(m);
+    init_tick_view(m);
     init_hardware_sampler(m);
     init_system_hardware_sampler(m);
+    init_scoped_region(m);
 
     // CPU sampling
 #if defined(HWS_FOR_CPUS_ENABLED)
@@ -0,0 +1,19 @@
+/**
+ * @author Marcel Breyer
+ * @copyright 2024-today All Rights Reserved
+ * @license This file is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ */
+
+#include "hws/overrun_policy.hpp"  // hws::overrun_policy
+
+#include "pybind11/pybind11.h"  // py::module_
+
+namespace py = pybind11;
+
+void init_overrun_policy(py::module_ &m) {
+    // overrun_policy enum
+    py::enum_<hws::overrun_policy>(m, "OverrunPolicy")
+        .value("CATCH_UP", hws::overrun_policy::catch_up, "Retrieve the samples of all missed deadlines back-to-back until the sampling loop is on schedule again.")
+        .value("SKIP", hws::overrun_policy::skip, "Drop all already missed deadlines and continue with the next deadline lying in the future (default).");
+}
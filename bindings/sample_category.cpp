@@ -23,6 +23,7 @@ void init_sample_category(py::module_ &m) {
         .value("GFX", hws::sample_category::gfx, "Gfx-related (iGPU) hardware samples. Only used in the cpu_hardware_sampler.")
         .value("IDLE_STATE", hws::sample_category::idle_state, "Idle-state-related hardware samples. Only used in the cpu_hardware_sampler.")
         .value("ALL", hws::sample_category::all, "Shortcut to enable all available hardware samples (default).")
+        .value("HIGH_FREQUENCY", hws::sample_category::high_frequency, "Shortcut to only enable the clock- and power-related hardware samples, which are cheap enough to be queried with sub-millisecond sampling intervals.")
         .def("__invert__", py::overload_cast<hws::sample_category>(&hws::operator~))
         .def("__and__", py::overload_cast<hws::sample_category, hws::sample_category>(&hws::operator&))
         .def("__or__", py::overload_cast<hws::sample_category, hws::sample_category>(&hws::operator|))
@@ -0,0 +1,86 @@
+/**
+ * @file
+ * @author Marcel Breyer
+ * @copyright 2024-today All Rights Reserved
+ * @license This file is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Defines pybind11 type casters converting a hws::sample_column to a Python list and a hws::sample_matrix to a Python list of lists.
+ */
+
+#ifndef HWS_BINDINGS_SAMPLE_COLUMN_CASTER_HPP_
+#define HWS_BINDINGS_SAMPLE_COLUMN_CASTER_HPP_
+
+#include "hws/sample_column.hpp"  // hws::sample_column
+#include "hws/sample_matrix.hpp"  // hws::sample_matrix
+
+#include "pybind11/pybind11.h"  // pybind11::{handle, return_value_policy}, pybind11::detail::{type_caster, make_caster}
+#include "pybind11/stl.h"       // bind STL types
+
+#include <vector>  // std::vector
+
+namespace pybind11::detail {
+
+/**
+ * @brief Convert a hws::sample_column to a Python list containing the currently published values.
+ * @details The values are first copied to a std::vector such that the size of the Python list matches the number of copied values,
+ *          even if the sampling std::thread appends new values concurrently.
+ * @tparam T the type of the values stored in the sample column
+ */
+template <typename T>
+struct type_caster<hws::sample_column<T>> {
+    /// The type caster used for the std::vector containing the copied values.
+    using vector_caster = make_caster<std::vector<T>>;
+
+    PYBIND11_TYPE_CASTER(hws::sample_column<T>, vector_caster::name);
+
+    /**
+     * @brief Python lists can't be converted to a hws::sample_column, since the sample columns are only filled by the hardware samplers.
+     * @return always `false`
+     */
+    bool load(handle, bool) { return false; }
+
+    /**
+     * @brief Convert the currently published values of the sample column @p src to a Python list.
+     * @param[in] src the sample column to convert
+     * @param[in] policy the return value policy
+     * @param[in] parent the parent Python object
+     * @return the Python list
+     */
+    static handle cast(const hws::sample_column<T> &src, const return_value_policy policy, const handle parent) {
+        return vector_caster::cast(src.to_vector(), policy, parent);
+    }
+};
+
+/**
+ * @brief Convert a hws::sample_matrix to a Python list containing one list per row (e.g., per logical CPU) with the currently published time points.
+ * @tparam T the type of the values stored in the sample matrix
+ */
+template <typename T>
+struct type_caster<hws::sample_matrix<T>> {
+    /// The type caster used for the std::vector containing the copied rows.
+    using vector_caster = make_caster<std::vector<std::vector<T>>>;
+
+    PYBIND11_TYPE_CASTER(hws::sample_matrix<T>, vector_caster::name);
+
+    /**
+     * @brief Python lists can't be converted to a hws::sample_matrix, since the sample matrices are only filled by the hardware samplers.
+     * @return always `false`
+     */
+    bool load(handle, bool) { return false; }
+
+    /**
+     * @brief Convert the currently published time points of the sample matrix @p src to a Python list of lists.
+     * @param[in] src the sample matrix to convert
+     * @param[in] policy the return value policy
+     * @param[in] parent the parent Python object
+     * @return the Python list of lists
+     */
+    static handle cast(const hws::sample_matrix<T> &src, const return_value_policy policy, const handle parent) {
+        return vector_caster::cast(src.to_vector(), policy, parent);
+    }
+};
+
+}  // namespace pybind11::detail
+
+#endif  // HWS_BINDINGS_SAMPLE_COLUMN_CASTER_HPP_
@@ -0,0 +1,62 @@
+/**
+ * @file
+ * @author Marcel Breyer
+ * @copyright 2024-today All Rights Reserved
+ * @license This file is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Defines a function binding the getters of all hardware samples described in the compile-time table of a sample class.
+ */
+
+#ifndef HWS_BINDINGS_SAMPLE_METRICS_HPP_
+#define HWS_BINDINGS_SAMPLE_METRICS_HPP_
+
+#include "hws/sample_metric.hpp"  // hws::detail::{for_each_sample_metric, is_sample_matrix_v}
+#include "hws/utility.hpp"        // hws::detail::remove_cvref_t
+
+#include "fmt/format.h"         // fmt::format
+#include "pybind11/pybind11.h"  // py::class_
+#include "pybind11/stl.h"       // bind STL types
+
+#include "sample_column_caster.hpp"  // convert hws::sample_column and hws::sample_matrix to Python lists
+
+#include <cstddef>   // std::size_t
+#include <optional>  // std::optional, std::nullopt
+#include <string>    // std::string
+#include <vector>    // std::vector
+
+namespace hws::detail {
+
+/**
+ * @brief Bind a `get_<name>` function for every hardware sample of the sample class @p Samples to @p cls, using its description as docstring.
+ * @details Additionally binds a `get_<name>_row_ids` function for every hardware sample stored in a hws::sample_matrix.
+ * @tparam Samples the sample class, e.g., hws::cpu_power_samples
+ * @param[in,out] cls the Python class to add the getters to
+ */
+template <typename Samples>
+void bind_sample_metrics(pybind11::class_<Samples> &cls) {
+    for_each_sample_metric<Samples>([&cls](const auto &metric) {
+        const std::string name = fmt::format("get_{}", metric.name);
+        const std::string description{ metric.description };
+        cls.def(name.c_str(), [metric](const Samples &self) -> const auto & { return metric.get(self); }, description.c_str());
+
+        // the IDs of the rows of a matrix, e.g., the IDs of the logical CPUs, are lost in the conversion to a list of lists
+        if constexpr (is_sample_matrix_v<typename remove_cvref_t<decltype(metric)>::value_type>) {
+            const std::string row_ids_name = fmt::format("get_{}_row_ids", metric.name);
+            const std::string row_ids_description = fmt::format("the IDs of the rows of {}", metric.name);
+            cls.def(
+                row_ids_name.c_str(), [metric](const Samples &self) -> std::optional<std::vector<std::size_t>> {
+                    const auto &values = metric.get(self);
+                    if (values.has_value()) {
+                        return values->row_ids();
+                    }
+                    return std::nullopt;
+                },
+                row_ids_description.c_str());
+        }
+    });
+}
+
+}  // namespace hws::detail
+
+#endif  // HWS_BINDINGS_SAMPLE_METRICS_HPP_
@@ -0,0 +1,33 @@
+/**
+ * @author Marcel Breyer
+ * @copyright 2024-today All Rights Reserved
+ * @license This file is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ */
+
+#include "hws/sampling_statistics.hpp"  // hws::sampling_statistics
+
+#include "fmt/chrono.h"          // direct formatting of std::chrono types
+#include "fmt/format.h"          // fmt::format
+#include "pybind11/chrono.h"     // bind std::chrono types
+#include "pybind11/pybind11.h"   // py::module_, py::class_
+
+namespace py = pybind11;
+
+void init_sampling_statistics(py::module_ &m) {
+    // bind the timing statistics of a sampling loop
+    py::class_<hws::sampling_statistics>(m, "SamplingStatistics")
+        .def_readonly("num_ticks", &hws::sampling_statistics::num_ticks, "read the number of ticks at which samples have been retrieved")
+        .def_readonly("num_missed_ticks", &hws::sampling_statistics::num_missed_ticks, "read the number of deadlines for which no sample has been retrieved within their sampling interval")
+        .def_readonly("num_on_demand_ticks", &hws::sampling_statistics::num_on_demand_ticks, "read the number of on-demand ticks requested via sample_now")
+        .def_readonly("min_jitter", &hws::sampling_statistics::min_jitter, "read the minimum deviation of a tick from its deadline")
+        .def_readonly("max_jitter", &hws::sampling_statistics::max_jitter, "read the maximum deviation of a tick from its deadline")
+        .def("mean_jitter", &hws::sampling_statistics::mean_jitter, "get the mean deviation of a tick from its deadline")
+        .def_readonly("num_queries", &hws::sampling_statistics::num_queries, "read the number of ticks whose hardware samples have been queried")
+        .def_readonly("min_query_latency", &hws::sampling_statistics::min_query_latency, "read the minimum time needed to query the hardware samples of a tick")
+        .def_readonly("max_query_latency", &hws::sampling_statistics::max_query_latency, "read the maximum time needed to query the hardware samples of a tick")
+        .def("mean_query_latency", &hws::sampling_statistics::mean_query_latency, "get the mean time needed to query the hardware samples of a tick")
+        .def("__repr__", [](const hws::sampling_statistics &self) {
+            return fmt::format("<HardwareSampling.SamplingStatistics with {{ num_ticks: {}, num_missed_ticks: {}, num_on_demand_ticks: {}, min_jitter: {}, max_jitter: {}, mean_jitter: {}, mean_query_latency: {} }}>", self.num_ticks, self.num_missed_ticks, self.num_on_demand_ticks, self.min_jitter, self.max_jitter, self.mean_jitter(), self.mean_query_latency());
+        });
+}
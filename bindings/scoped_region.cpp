@@ -0,0 +1,34 @@
+/**
+ * @author Marcel Breyer
+ * @copyright 2024-today All Rights Reserved
+ * @license This file is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ */
+
+#include "hws/scoped_region.hpp"  // hws::scoped_region
+
+#include "hws/hardware_sampler.hpp"         // hws::hardware_sampler
+#include "hws/system_hardware_sampler.hpp"  // hws::system_hardware_sampler
+
+#include "pybind11/pybind11.h"  // py::module_, py::class_, py::object, py::keep_alive
+#include "pybind11/stl.h"       // bind STL types
+
+#include <string>  // std::string
+
+namespace py = pybind11;
+
+void init_scoped_region(py::module_ &m) {
+    // bind the RAII region guard as Python context manager: with ScopedRegion(sampler, "name") as region: ...
+    py::class_<hws::scoped_region>(m, "ScopedRegion")
+        .def(py::init<hws::hardware_sampler &, const std::string &>(), "begin a new region on the hardware sampler", py::keep_alive<1, 2>())
+        .def(py::init<hws::system_hardware_sampler &, const std::string &>(), "begin a new region on all hardware samplers of the system hardware sampler", py::keep_alive<1, 2>())
+        .def("end", &hws::scoped_region::end, py::return_value_policy::copy, "end the region and get the ended region per hardware sampler")
+        .def("finished", &hws::scoped_region::finished, "check whether the region has already been ended")
+        .def("regions", &hws::scoped_region::regions, py::return_value_policy::copy, "get the ended region per hardware sampler, empty if the region hasn't been ended yet")
+        .def("__enter__", [](hws::scoped_region &self) -> hws::scoped_region & { return self; }, py::return_value_policy::reference)
+        .def("__exit__", [](hws::scoped_region &self, const py::object &, const py::object &, const py::object &) {
+            self.end();
+            // don't suppress exceptions raised in the with-block
+            return false;
+        });
+}
@@ -8,16 +8,21 @@
 #include "hws/system_hardware_sampler.hpp"  // hws::system_hardware_sampler
 
 #include "hws/event.hpp"            // hws::event
+#include "hws/overrun_policy.hpp"   // hws::overrun_policy
 #include "hws/sample_category.hpp"  // hws::sample_category
 #include "hws/utility.hpp"          // hws::detail::durations_from_reference_time
 
 #include "fmt/format.h"         // fmt::format
 #include "pybind11/chrono.h"    // bind std::chrono types
-#include "pybind11/pybind11.h"  // py::module_, py::class_
+#include "pybind11/pybind11.h"  // py::module_, py::class_, py::call_guard, py::gil_scoped_release
 #include "pybind11/stl.h"       // bind STL types
 
 #include "relative_event.hpp"  // hws::detail::relative_event
-#include <string>              // std::string
+
+#include <chrono>    // std::chrono::{steady_clock::time_point, nanoseconds}
+#include <optional>  // std::optional
+#include <string>    // std::string
+#include <vector>    // std::vector
 
 namespace py = pybind11;
 
@@ -26,10 +31,10 @@ void init_system_hardware_sampler(py::module_ &m) {
     py::class_<hws::system_hardware_sampler>(m, "SystemHardwareSampler")
         .def(py::init<>(), "construct a new system hardware sampler with the default sampling interval")
         .def(py::init<hws::sample_category>(), "construct a new system hardware sampler with the default sampling interval sampling only the provided sample_category samples")
-        .def(py::init<std::chrono::milliseconds>(), "construct a new system hardware sampler for with the specified sampling interval")
-        .def(py::init<std::chrono::milliseconds, hws::sample_category>(), "construct a new system hardware sampler for with the specified sampling interval sampling only the provided sample_category samples")
+        .def(py::init<std::chrono::nanoseconds>(), "construct a new system hardware sampler for with the specified sampling interval")
+        .def(py::init<std::chrono::nanoseconds, hws::sample_category>(), "construct a new system hardware sampler for with the specified sampling interval sampling only the provided sample_category samples")
         .def("start", &hws::system_hardware_sampler::start_sampling, "start hardware sampling for all available hardware samplers")
-        .def("stop", &hws::system_hardware_sampler::stop_sampling, "stop hardware sampling for all available hardware samplers")
+        .def("stop", &hws::system_hardware_sampler::stop_sampling, py::call_guard<py::gil_scoped_release>(), "stop hardware sampling for all available hardware samplers")
         .def("pause", &hws::system_hardware_sampler::pause_sampling, "pause hardware sampling for all available hardware samplers")
         .def("resume", &hws::system_hardware_sampler::resume_sampling, "resume hardware sampling for all available hardware samplers")
         .def("has_started", &hws::system_hardware_sampler::has_sampling_started, "check whether hardware sampling has already been started for all hardware samplers")
@@ -38,6 +43,15 @@ void init_system_hardware_sampler(py::module_ &m) {
         .def("add_event", py::overload_cast<hws::event>(&hws::system_hardware_sampler::add_event), "add a new event to all hardware samplers")
         .def("add_event", py::overload_cast<decltype(hws::event::time_point), decltype(hws::event::name)>(&hws::system_hardware_sampler::add_event), "add a new event using a time point and a name to all hardware samplers")
         .def("add_event", py::overload_cast<decltype(hws::event::name)>(&hws::system_hardware_sampler::add_event), "add a new event using a name, the current time is used as time point to all hardware samplers")
+        .def("add_event", py::overload_cast<decltype(hws::event::name), bool>(&hws::system_hardware_sampler::add_event), "add a new event using a name, the current time is used as time point to all hardware samplers; optionally retrieve an on-demand sample at the event boundary", py::arg("name"), py::arg("sample_immediately"))
+        .def("sample_now", &hws::system_hardware_sampler::sample_now, "request an on-demand sample from all hardware samplers without waiting for the next sampling interval")
+        .def("begin_region", &hws::system_hardware_sampler::begin_region, "begin a new region reading only the time and energy counter for all hardware samplers")
+        .def("end_region", &hws::system_hardware_sampler::end_region, "end the most recently begun open region with the given name for all hardware samplers")
+        .def("energy_regions", &hws::system_hardware_sampler::energy_regions, "get all regions separately for each hardware sampler")
+        .def("set_marker_only_mode", &hws::system_hardware_sampler::set_marker_only_mode, "enable or disable the marker-only mode without a sampling thread for all hardware samplers")
+        .def("set_burst_window", &hws::system_hardware_sampler::set_burst_window, "set the windows captured before and after a trigger fired for all hardware samplers and the sampling interval used in the burst mode", py::arg("pre_trigger"), py::arg("post_trigger"), py::arg("burst_interval") = std::optional<std::chrono::nanoseconds>{})
+        .def("set_sample_metrics", &hws::system_hardware_sampler::set_sample_metrics, "select the hardware samples to retrieve by their names for all hardware samplers (an empty list selects all hardware samples)", py::arg("metrics"))
+        .def("burst_captures", &hws::system_hardware_sampler::burst_captures, "get all burst captures separately for each hardware sampler")
         .def("num_events", &hws::system_hardware_sampler::num_events, "get the number of events separately for each hardware sampler")
         .def("get_events", &hws::system_hardware_sampler::get_events, "get all events separately for each hardware sampler")
         .def("get_relative_events", [](const hws::system_hardware_sampler &self) {
@@ -50,13 +64,29 @@ void init_system_hardware_sampler(py::module_ &m) {
              }
              return relative_events; }, "get all relative events separately for each hardware sampler")
         .def("time_points", &hws::system_hardware_sampler::sampling_time_points, "get the time points of the respective hardware samples separately for each hardware sampler")
+        .def("query_latencies", &hws::system_hardware_sampler::sampling_query_latencies, "get the time needed to query the hardware samples of each tick separately for each hardware sampler")
         .def("relative_time_points", [](const hws::system_hardware_sampler &self) {
+            const std::vector<std::vector<hws::event>> events = self.get_events();
+            const std::vector<std::vector<std::chrono::steady_clock::time_point>> time_points = self.sampling_time_points();
             std::vector<std::vector<double>> relative_time_points{};
             for (std::size_t s = 0; s < self.num_samplers(); ++s) {
-                relative_time_points.emplace_back(hws::detail::durations_from_reference_time(self.sampling_time_points()[s], self.get_events()[s][0].time_point));
+                relative_time_points.emplace_back(hws::detail::durations_from_reference_time(time_points[s], events[s][0].time_point));
             }
             return relative_time_points; }, "get the relative durations of the respective hardware samples in seconds (as \"normal\" number)")
-        .def("sampling_interval", &hws::system_hardware_sampler::sampling_interval, "get the sampling interval separately for each hardware sampler (in ms)")
+        .def("sampling_interval", py::overload_cast<>(&hws::system_hardware_sampler::sampling_interval, py::const_), "get the sampling interval separately for each hardware sampler")
+        .def("sampling_interval", py::overload_cast<hws::sample_category>(&hws::system_hardware_sampler::sampling_interval, py::const_), "get the sampling interval of the provided sample_category separately for each hardware sampler")
+        .def("set_sampling_interval", &hws::system_hardware_sampler::set_sampling_interval, "set the sampling interval of the provided sample_category (must be a multiple of the base sampling interval) for all hardware samplers")
+        .def("set_adaptive_sampling", &hws::system_hardware_sampler::set_adaptive_sampling, "enable the adaptive sampling rate with the provided maximum sampling interval for all hardware samplers")
+        .def("set_adaptive_sampling_threshold", &hws::system_hardware_sampler::set_adaptive_sampling_threshold, "set the relative change of the provided sample_category that resets the adaptive sampling interval for all hardware samplers")
+        .def("set_sample_retention", py::overload_cast<std::size_t>(&hws::system_hardware_sampler::set_sample_retention), "retain only the provided number of last samples of every hardware sample for all hardware samplers")
+        .def("set_sample_retention", py::overload_cast<std::chrono::nanoseconds>(&hws::system_hardware_sampler::set_sample_retention), "retain only the samples of at least the provided last duration of every hardware sample for all hardware samplers")
+        .def("set_sample_compression", &hws::system_hardware_sampler::set_sample_compression, "enable or disable the compression of the hardware samples and time points for all hardware samplers")
+        .def("set_streaming_statistics", &hws::system_hardware_sampler::set_streaming_statistics, "enable or disable the streaming statistics of the hardware samples for all hardware samplers")
+        .def("set_expected_sampling_duration", &hws::system_hardware_sampler::set_expected_sampling_duration, "set the expected sampling duration used to preallocate the storage of the hardware samples for all hardware samplers")
+        .def("set_shared_sampling_thread", &hws::system_hardware_sampler::set_shared_sampling_thread, "enable or disable the usage of a single shared sampling thread for all hardware samplers")
+        .def("uses_shared_sampling_thread", &hws::system_hardware_sampler::uses_shared_sampling_thread, "check whether a single shared sampling thread is used for all hardware samplers")
+        .def("set_overrun_policy", &hws::system_hardware_sampler::set_sampling_overrun_policy, "set the policy used if retrieving a sample takes longer than the sampling interval for all hardware samplers")
+        .def("sampling_statistics", &hws::system_hardware_sampler::sampling_statistics, "get the timing statistics of the sampling loop separately for each hardware sampler")
         .def("num_samplers", &hws::system_hardware_sampler::num_samplers, "get the number of hardware samplers available for the whole system")
         .def("samplers", [](hws::system_hardware_sampler &self) {
             std::vector<hws::hardware_sampler*> out{};
@@ -0,0 +1,33 @@
+/**
+ * @author Marcel Breyer
+ * @copyright 2024-today All Rights Reserved
+ * @license This file is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ */
+
+#include "hws/tick_view.hpp"  // hws::tick_view
+
+#include "fmt/format.h"         // fmt::format
+#include "pybind11/chrono.h"    // bind std::chrono types
+#include "pybind11/pybind11.h"  // py::module_, py::class_
+#include "pybind11/stl.h"       // bind STL types
+
+namespace py = pybind11;
+
+void init_tick_view(py::module_ &m) {
+    // bind the view of a single tick passed to the tick callbacks (copied into Python, without the reference to the hardware sampler)
+    py::class_<hws::tick_view>(m, "TickView")
+        .def_readonly("time_point", &hws::tick_view::time_point, "read the time point of the tick")
+        .def_readonly("query_latency", &hws::tick_view::query_latency, "read the time needed to query the hardware samples of the tick")
+        .def_readonly("tick", &hws::tick_view::tick, "read the index of the tick since the sampling has been started")
+        .def_readonly("on_demand", &hws::tick_view::on_demand, "read whether the tick retrieved an on-demand sample")
+        .def_readonly("sampled_categories", &hws::tick_view::sampled_categories, "read the sample categories whose samples have been retrieved in the tick")
+        .def_readonly("power_usage", &hws::tick_view::power_usage, "read the power draw retrieved in the tick in W")
+        .def_readonly("temperature", &hws::tick_view::temperature, "read the temperature retrieved in the tick in °C")
+        .def_property_readonly("numeric_sample_names", [](const hws::tick_view &self) { return self.numeric_sample_names; }, "read the names of the numeric hardware samples")
+        .def_property_readonly("numeric_sample_values", [](const hws::tick_view &self) { return self.numeric_sample_values; }, "read the numeric hardware samples retrieved in the tick (NaN if not retrieved in the tick)")
+        .def("sampled", &hws::tick_view::sampled, "check whether the samples of any of the sample categories have been retrieved in the tick")
+        .def("__repr__", [](const hws::tick_view &self) {
+            return fmt::format("<HardwareSampling.TickView with {{ tick: {}, on_demand: {} }}>", self.tick, self.on_demand);
+        });
+}
@@ -0,0 +1,21 @@
+## Authors: Marcel Breyer
+## Copyright (C): 2024-today All Rights Reserved
+## License: This file is released under the MIT license.
+##          See the LICENSE.md file in the project root for full license information.
+########################################################################################################################
+
+# parse the sampling interval given as natural number greater 0 optionally followed by one of the units ns, us, or ms (default unit if no unit is given)
+# sets <prefix>_VALID to ON if the sampling interval is valid and the value and unit in <prefix>_VALUE and <prefix>_UNIT
+function (hws_parse_sampling_interval interval prefix)
+    set(${prefix}_VALID OFF PARENT_SCOPE)
+    if (NOT "${interval}" MATCHES "^([0-9]+)(ns|us|ms)?$" OR CMAKE_MATCH_1 LESS_EQUAL 0)
+        return()
+    endif ()
+    set(unit ${CMAKE_MATCH_2})
+    if (NOT unit)
+        set(unit "ms")
+    endif ()
+    set(${prefix}_VALID ON PARENT_SCOPE)
+    set(${prefix}_VALUE ${CMAKE_MATCH_1} PARENT_SCOPE)
+    set(${prefix}_UNIT ${unit} PARENT_SCOPE)
+endfunction ()
@@ -0,0 +1,77 @@
+/**
+ * @author Marcel Breyer
+ * @copyright 2024-today All Rights Reserved
+ * @license This file is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ */
+
+#include "hws/core.hpp"
+
+#include "fmt/format.h"  // fmt::format
+
+#include <chrono>    // std::chrono::{steady_clock, duration_cast, nanoseconds}
+#include <cstddef>   // std::size_t
+#include <iostream>  // std::cout, std::endl
+#include <memory>    // std::unique_ptr, std::make_unique
+#include <string>    // std::string, std::to_string
+#include <thread>    // std::thread
+#include <vector>    // std::vector
+
+int main() {
+    constexpr std::size_t num_threads = 64;
+    constexpr std::size_t num_events_per_thread = 10000;
+
+    hws::system_hardware_sampler sampler{};
+    sampler.start_sampling();
+
+    // all threads record their events concurrently
+    std::vector<std::chrono::nanoseconds> durations(num_threads);
+    std::vector<std::chrono::nanoseconds> allocation_durations(num_threads);
+    std::vector<std::thread> threads{};
+    threads.reserve(num_threads);
+    for (std::size_t t = 0; t < num_threads; ++t) {
+        threads.emplace_back([&, t]() {
+            const std::string name = "thread_" + std::to_string(t);
+            const auto start = std::chrono::steady_clock::now();
+            for (std::size_t e = 0; e < num_events_per_thread; ++e) {
+                sampler.add_event(name);
+            }
+            durations[t] = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+
+            // each add_event call allocates a queue node holding a copy of the event name -> measure this allocation on its own
+            std::vector<std::unique_ptr<hws::event>> allocated_events(num_events_per_thread);
+            const auto allocation_start = std::chrono::steady_clock::now();
+            for (std::size_t e = 0; e < num_events_per_thread; ++e) {
+                allocated_events[e] = std::make_unique<hws::event>(std::chrono::steady_clock::now(), name);
+            }
+            allocation_durations[t] = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - allocation_start);
+        });
+    }
+    for (std::thread &thread : threads) {
+        thread.join();
+    }
+
+    sampler.stop_sampling();
+
+    // the events are merged and sorted by their time points during stop_sampling
+    const auto ns_per_event = [&](const std::vector<std::chrono::nanoseconds> &thread_durations) {
+        std::chrono::nanoseconds total_duration{ 0 };
+        for (const std::chrono::nanoseconds duration : thread_durations) {
+            total_duration += duration;
+        }
+        return static_cast<double>(total_duration.count()) / static_cast<double>(num_threads * num_events_per_thread);
+    };
+    const double add_event_ns = ns_per_event(durations);
+    const double allocation_ns = ns_per_event(allocation_durations);
+    std::cout << fmt::format("recorded {} events from {} threads in {} hardware samplers: {:.1f} ns per add_event call\n"
+                             "allocating an event with a copy of its name alone: {:.1f} ns ({:.0f}% of an add_event call per hardware sampler)",
+                             sampler.num_events().empty() ? 0 : sampler.num_events().front(),
+                             num_threads,
+                             sampler.num_samplers(),
+                             add_event_ns,
+                             allocation_ns,
+                             100.0 * allocation_ns * static_cast<double>(sampler.num_samplers()) / add_event_ns)
+              << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,125 @@
+/**
+ * @author Marcel Breyer
+ * @copyright 2024-today All Rights Reserved
+ * @license This file is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ */
+
+#include "hws/core.hpp"
+#include "hws/cpu/turbostat_columns.hpp"  // hws::detail::turbostat_column_table
+#include "hws/sample_column.hpp"          // hws::sample_column_config
+#include "hws/sample_metric.hpp"          // hws::detail::for_each_sample_metric
+#include "hws/utility.hpp"                // hws::detail::{split, split_as, convert_to}
+
+#include "fmt/format.h"  // fmt::format
+
+#include <chrono>         // std::chrono::{steady_clock, duration}
+#include <cstddef>        // std::size_t
+#include <iostream>       // std::cout, std::endl
+#include <optional>       // std::optional
+#include <string>         // std::string
+#include <string_view>    // std::string_view
+#include <unordered_map>  // std::unordered_map
+#include <vector>         // std::vector
+
+namespace {
+
+// a hand-written header and summary row in the format of "turbostat -i 0.1 -S -q" with the columns of a current Intel server CPU;
+// the CPU hardware sampler always passes -S, i.e., turbostat prints a single summary row per interval independent of the number of CPUs
+constexpr std::string_view turbostat_header = "Avg_MHz\tBusy%\tBzy_MHz\tTSC_MHz\tIPC\tIRQ\tSMI\tPOLL\tC1\tC1E\tC6\tPOLL%\tC1%\tC1E%\tC6%\tCPU%c1\tCPU%c6\tCoreTmp\tCoreThr\tPkgTmp\tPkg%pc2\tPkg%pc6\tPkgWatt\tRAMWatt\tPKG_%\tRAM_%\tUncMHz";
+constexpr std::string_view turbostat_row = "1187\t41.27\t2876\t1900\t1.42\t1843221\t0\t912\t48211\t301877\t1287344\t0.01\t0.52\t6.91\t51.36\t7.44\t51.29\t71\t0\t74\t12.81\t0.00\t612.47\t88.23\t0.00\t0.00\t2000";
+
+/// The hardware samples filled by both benchmarked variants.
+struct cpu_samples {
+    hws::cpu_general_samples general{};
+    hws::cpu_clock_samples clock{};
+    hws::cpu_power_samples power{};
+    hws::cpu_temperature_samples temperature{};
+    hws::cpu_idle_states_samples idle_state{};
+    std::optional<std::unordered_map<std::string, hws::sample_column<double>>> idle_states{};
+};
+
+/**
+ * @brief Call @p func @p num_rows times.
+ * @param[in] num_rows the number of calls
+ * @param[in] func the function to measure
+ * @return the mean time per call in ns
+ */
+template <typename Func>
+double measure(const std::size_t num_rows, Func &&func) {
+    const auto start = std::chrono::steady_clock::now();
+    for (std::size_t r = 0; r < num_rows; ++r) {
+        func();
+    }
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / static_cast<double>(num_rows);
+}
+
+}  // namespace
+
+int main() {
+    constexpr std::size_t num_rows = 100000;
+    const std::vector<std::string> header = hws::detail::split_as<std::string>(turbostat_header, '\t');
+    const auto select = [](std::string_view, hws::sample_category) { return true; };
+    const std::optional<hws::sample_column_config> config = hws::sample_column_config{};
+
+    // the column table is built once per header -> the idle state regex is only evaluated here
+    cpu_samples table_samples{};
+    std::optional<hws::detail::turbostat_column_table> table{};
+    const double build_ns = measure(1, [&]() {
+        table.emplace(header);
+        table->add_columns(table_samples.general, select, config);
+        table->add_columns(table_samples.clock, select, config);
+        table->add_columns(table_samples.power, select, config);
+        table->add_columns(table_samples.temperature, select, config);
+        table->add_columns(table_samples.idle_state, select, config);
+        table->add_idle_state_columns(table_samples.idle_states, config);
+    });
+    const double table_ns = measure(num_rows, [&]() { table->read_row(turbostat_row, hws::sample_category::all); });
+
+    // the baseline compares every header cell against the turbostat column names and looks up the remaining cells in the idle state map
+    std::vector<std::string_view> names{};
+    const auto add_names = [&](const auto &samples) {
+        hws::detail::for_each_sample_metric<hws::detail::remove_cvref_t<decltype(samples)>>([&](const auto &metric) {
+            if (!metric.turbostat_name.empty()) {
+                names.push_back(metric.turbostat_name);
+            }
+        });
+    };
+    cpu_samples chain_samples{};
+    add_names(chain_samples.general);
+    add_names(chain_samples.clock);
+    add_names(chain_samples.power);
+    add_names(chain_samples.temperature);
+    add_names(chain_samples.idle_state);
+    std::vector<hws::sample_column<double>> named_columns(names.size());
+    chain_samples.idle_states = table_samples.idle_states;
+    const double chain_ns = measure(num_rows, [&]() {
+        const std::vector<std::string_view> values = hws::detail::split(turbostat_row, '\t');
+        for (std::size_t i = 0; i < header.size(); ++i) {
+            std::size_t n = 0;
+            while (n < names.size() && header[i] != names[n]) {
+                ++n;
+            }
+            if (n < names.size()) {
+                named_columns[n].push_back(hws::detail::convert_to<double>(values[i]));
+            } else {
+                const auto it = chain_samples.idle_states->find(header[i]);
+                if (it != chain_samples.idle_states->end()) {
+                    it->second.push_back(hws::detail::convert_to<double>(values[i]));
+                }
+            }
+        }
+    });
+
+    std::cout << fmt::format("turbostat header with {} columns ({} read): built the column table once in {:.1f} us\n"
+                             "per summary row: {:.1f} ns with the column table, {:.1f} ns comparing the header cells ({:.2f}x)",
+                             header.size(),
+                             table->num_columns(),
+                             build_ns / 1000.0,
+                             table_ns,
+                             chain_ns,
+                             chain_ns / table_ns)
+              << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,65 @@
+/**
+ * @file
+ * @author Marcel Breyer
+ * @copyright 2024-today All Rights Reserved
+ * @license This file is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Defines a capture of the hardware samples around the time point a trigger fired.
+ */
+
+#ifndef HWS_BURST_CAPTURE_HPP_
+#define HWS_BURST_CAPTURE_HPP_
+#pragma once
+
+#include "fmt/ostream.h"  // fmt::formatter, fmt::ostream_formatter
+
+#include <chrono>  // std::chrono::{steady_clock::time_point, nanoseconds}
+#include <iosfwd>  // std::ostream forward declaration
+#include <map>     // std::map
+#include <string>  // std::string
+#include <vector>  // std::vector
+
+namespace hws {
+
+/**
+ * @brief A struct encapsulating the hardware samples retained around the time point a trigger added via `hardware_sampler::add_trigger` fired.
+ * @details The capture contains the numeric samples of the pre-trigger window (kept in a separate fixed-size ring before the trigger fired)
+ *          and of the post-trigger window (sampled afterward) as set via `hardware_sampler::set_burst_window`.
+ */
+struct burst_capture {
+    /**
+     * @brief Return the duration covered by the captured samples.
+     * @return the duration, zero if less than two samples have been captured (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::chrono::nanoseconds duration() const noexcept;
+
+    /// The name of the trigger that fired.
+    std::string trigger;
+    /// The time point of the tick in which the trigger fired.
+    std::chrono::steady_clock::time_point trigger_time_point{};
+    /// The time points of all captured ticks.
+    std::vector<std::chrono::steady_clock::time_point> time_points{};
+    /// The captured numeric hardware samples: one value per captured time point, NaN if the hardware sample hasn't been retrieved in a tick.
+    /// Hardware samples stored in a map are named `<key>_<name>`, the rows of a hardware sample matrix `<name>_<row>`.
+    std::map<std::string, std::vector<double>> samples{};
+};
+
+/**
+ * @brief Output the burst capture @p capture to the given output-stream @p out.
+ * @param[in,out] out the output-stream to write the burst capture to
+ * @param[in] capture the burst capture
+ * @return the output-stream
+ */
+std::ostream &operator<<(std::ostream &out, const burst_capture &capture);
+
+}  // namespace hws
+
+/// @cond Doxygen_suppress
+
+template <>
+struct fmt::formatter<hws::burst_capture> : fmt::ostream_formatter { };
+
+/// @endcond
+
+#endif  // HWS_BURST_CAPTURE_HPP_
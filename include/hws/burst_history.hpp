@@ -0,0 +1,87 @@
+/**
+ * @file
+ * @author Marcel Breyer
+ * @copyright 2024-today All Rights Reserved
+ * @license This file is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Defines a fixed-size ring of the numeric hardware samples of the last ticks used as pre-trigger history of the burst captures.
+ */
+
+#ifndef HWS_BURST_HISTORY_HPP_
+#define HWS_BURST_HISTORY_HPP_
+#pragma once
+
+#include <chrono>   // std::chrono::steady_clock::time_point
+#include <cstddef>  // std::size_t
+#include <vector>   // std::vector
+
+namespace hws::detail {
+
+/**
+ * @brief A fixed-size ring of the time points and the numeric hardware samples of the last ticks.
+ * @details All memory is allocated on construction, i.e., pushing a tick never allocates. Only accessed by the sampling std::thread.
+ */
+class burst_history {
+  public:
+    /**
+     * @brief Construct an empty ring without any capacity.
+     */
+    burst_history() = default;
+    /**
+     * @brief Construct an empty ring holding the last @p capacity ticks with @p num_values values each.
+     * @param[in] capacity the maximum number of retained ticks
+     * @param[in] num_values the number of values per tick
+     */
+    burst_history(std::size_t capacity, std::size_t num_values);
+
+    /**
+     * @brief Append the tick at @p time_point with the @p values, overwriting the oldest tick if the ring is full.
+     * @param[in] time_point the time point of the tick
+     * @param[in] values the values of the tick; must contain exactly `num_values()` values
+     */
+    void push_back(std::chrono::steady_clock::time_point time_point, const std::vector<double> &values) noexcept;
+    /**
+     * @brief Append all retained ticks not older than @p since in chronological order to @p time_points and @p series (one std::vector per value).
+     * @param[in] since the time point of the oldest tick to append
+     * @param[in,out] time_points the time points to append to
+     * @param[in,out] series the values to append to; must contain exactly `num_values()` std::vector
+     */
+    void append_since(std::chrono::steady_clock::time_point since, std::vector<std::chrono::steady_clock::time_point> &time_points, std::vector<std::vector<double>> &series) const;
+    /**
+     * @brief Remove all retained ticks.
+     */
+    void clear() noexcept { size_ = 0; }
+
+    /**
+     * @brief Return the maximum number of retained ticks.
+     * @return the capacity (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::size_t capacity() const noexcept { return time_points_.size(); }
+    /**
+     * @brief Return the number of currently retained ticks.
+     * @return the number of ticks (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::size_t size() const noexcept { return size_; }
+    /**
+     * @brief Return the number of values per tick.
+     * @return the number of values (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::size_t num_values() const noexcept { return num_values_; }
+
+  private:
+    /// The time points of the retained ticks.
+    std::vector<std::chrono::steady_clock::time_point> time_points_{};
+    /// The values of the retained ticks (num_values_ consecutive values per tick).
+    std::vector<double> values_{};
+    /// The number of values per tick.
+    std::size_t num_values_{ 0 };
+    /// The position of the next tick to write.
+    std::size_t next_{ 0 };
+    /// The number of currently retained ticks.
+    std::size_t size_{ 0 };
+};
+
+}  // namespace hws::detail
+
+#endif  // HWS_BURST_HISTORY_HPP_
@@ -12,10 +12,21 @@
 #define HWS_CORE_HPP_
 #pragma once
 
+#include "hws/burst_capture.hpp"
+#include "hws/energy_region.hpp"
 #include "hws/event.hpp"
 #include "hws/hardware_sampler.hpp"
+#include "hws/overrun_policy.hpp"
 #include "hws/sample_category.hpp"
+#include "hws/sample_column.hpp"
+#include "hws/sample_metric.hpp"
+#include "hws/sampling_statistics.hpp"
+#include "hws/scoped_region.hpp"
+#include "hws/streaming_statistics.hpp"
 #include "hws/system_hardware_sampler.hpp"
+#include "hws/tick_consumer.hpp"
+#include "hws/tick_queue.hpp"
+#include "hws/tick_view.hpp"
 #include "hws/version.hpp"
 
 #if defined(HWS_FOR_CPUS_ENABLED)
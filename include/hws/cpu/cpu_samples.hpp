@@ -12,7 +12,11 @@
 #define HWS_CPU_CPU_SAMPLES_HPP_
 #pragma once
 
-#include "hws/utility.hpp"  // HWS_SAMPLE_STRUCT_FIXED_MEMBER, HWS_SAMPLE_STRUCT_SAMPLING_MEMBER
+#include "hws/sample_category.hpp"  // hws::sample_category
+#include "hws/sample_column.hpp"    // hws::sample_column
+#include "hws/sample_matrix.hpp"    // hws::sample_matrix
+#include "hws/sample_metric.hpp"    // hws::sample_metric, hws::sample_metric_layout, hws::make_sample_metric_table
+#include "hws/utility.hpp"          // HWS_SAMPLE_STRUCT_FIXED_MEMBER, HWS_SAMPLE_STRUCT_SAMPLING_MEMBER, HWS_SAMPLE_STRUCT_MATRIX_MEMBER
 
 #include "fmt/ostream.h"  // fmt::formatter, fmt::ostream_formatter
 
@@ -48,25 +52,61 @@ class cpu_general_samples {
      * @return the YAML string (`[[nodiscard]]`)
      */
     [[nodiscard]] std::string generate_yaml_string() const;
-
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(std::string, architecture)        // the CPU architecture (e.g., x86_64)
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(std::string, byte_order)          // the byte order (e.g., little/big endian)
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(unsigned int, num_cores)          // the total number of cores of the CPU(s)
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(unsigned int, num_threads)        // the number of threads of the CPU(s) including potential hyper-threads
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(unsigned int, threads_per_core)   // the number of hyper-threads per core
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(unsigned int, cores_per_socket)   // the number of physical cores per socket
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(unsigned int, num_sockets)        // the number of sockets
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(unsigned int, numa_nodes)         // the number of NUMA nodes
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(std::string, vendor_id)           // the vendor ID (e.g., GenuineIntel)
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(std::string, name)                // the name of the CPU
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(std::vector<std::string>, flags)  // potential CPU flags (e.g., sse4_1, avx, avx, etc)
-
-    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(double, compute_utilization)  // the percent the CPU was busy doing work
-    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(double, ipc)                  // the instructions-per-cycle count
-    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(unsigned int, irq)            // the number of interrupts
-    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(unsigned int, smi)            // the number of system management interrupts
-    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(unsigned int, poll)           // the number of times the CPU was in the polling state
-    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(double, poll_percent)         // the percent of the CPU was in the polling state
+    /**
+     * @brief Return the compile-time descriptors of all general hardware samples in the order of the output.
+     * @details Used to generate `has_samples()`, `generate_yaml_string()`, the output-stream operator, the sample selection, and the Python bindings.
+     * @return the hardware sample descriptors (`[[nodiscard]]`)
+     */
+    [[nodiscard]] static constexpr auto metrics() noexcept {
+        return make_sample_metric_table(sample_category::general,
+                                        sample_metric{ "architecture", &cpu_general_samples::architecture_, "string", "the CPU architecture (e.g., x86_64)" },
+                                        sample_metric{ "byte_order", &cpu_general_samples::byte_order_, "string", "the byte order (e.g., little/big endian)" },
+                                        sample_metric{ "num_cores", &cpu_general_samples::num_cores_, "int", "the total number of cores of the CPU(s)" },
+                                        sample_metric{ "num_threads", &cpu_general_samples::num_threads_, "int", "the number of threads of the CPU(s) including potential hyper-threads" },
+                                        sample_metric{ "threads_per_core", &cpu_general_samples::threads_per_core_, "int", "the number of hyper-threads per core" },
+                                        sample_metric{ "cores_per_socket", &cpu_general_samples::cores_per_socket_, "int", "the number of physical cores per socket" },
+                                        sample_metric{ "num_sockets", &cpu_general_samples::num_sockets_, "int", "the number of sockets" },
+                                        sample_metric{ "numa_nodes", &cpu_general_samples::numa_nodes_, "int", "the number of NUMA nodes" },
+                                        sample_metric{ "vendor_id", &cpu_general_samples::vendor_id_, "string", "the vendor ID (e.g., GenuineIntel)" },
+                                        sample_metric{ "name", &cpu_general_samples::name_, "string", "the name of the CPU" },
+                                        sample_metric{ "flags", &cpu_general_samples::flags_, "string", "potential CPU flags (e.g., sse4_1, avx, avx, etc)" },
+                                        sample_metric{ "compute_utilization", &cpu_general_samples::compute_utilization_, "%", "the percent the CPU was busy doing work" }.with_turbostat_name("Busy%"),
+                                        sample_metric{ "ipc", &cpu_general_samples::ipc_, "float", "the instructions-per-cycle count" }.with_yaml_name("instructions_per_cycle").with_turbostat_name("IPC"),
+                                        sample_metric{ "irq", &cpu_general_samples::irq_, "int", "the number of interrupts" }.with_yaml_name("interrupts").with_turbostat_name("IRQ"),
+                                        sample_metric{ "smi", &cpu_general_samples::smi_, "int", "the number of system management interrupts" }.with_yaml_name("system_management_interrupts").with_turbostat_name("SMI"),
+                                        sample_metric{ "poll", &cpu_general_samples::poll_, "int", "the number of times the CPU was in the polling state" }.with_yaml_name("polling_state").with_turbostat_name("POLL"),
+                                        sample_metric{ "poll_percent", &cpu_general_samples::poll_percent_, "%", "the percent of the CPU was in the polling state" }.with_yaml_name("polling_percentage").with_turbostat_name("POLL%"),
+                                        sample_metric{ "per_cpu_user_percent", &cpu_general_samples::per_cpu_user_percent_, "%", "the percent of time each logical CPU spent in user mode" }.with_yaml_name("per_cpu_user_utilization"),
+                                        sample_metric{ "per_cpu_system_percent", &cpu_general_samples::per_cpu_system_percent_, "%", "the percent of time each logical CPU spent in system mode (including interrupts)" }.with_yaml_name("per_cpu_system_utilization"),
+                                        sample_metric{ "per_cpu_iowait_percent", &cpu_general_samples::per_cpu_iowait_percent_, "%", "the percent of time each logical CPU was idle waiting for I/O" }.with_yaml_name("per_cpu_iowait"),
+                                        sample_metric{ "per_cpu_steal_percent", &cpu_general_samples::per_cpu_steal_percent_, "%", "the percent of time stolen from each logical CPU by the hypervisor" }.with_yaml_name("per_cpu_steal"),
+                                        sample_metric{ "per_cpu_idle_percent", &cpu_general_samples::per_cpu_idle_percent_, "%", "the percent of time each logical CPU was idle" }.with_yaml_name("per_cpu_idle"));
+    }
+
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(std::string, architecture)
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(std::string, byte_order)
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(unsigned int, num_cores)
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(unsigned int, num_threads)
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(unsigned int, threads_per_core)
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(unsigned int, cores_per_socket)
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(unsigned int, num_sockets)
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(unsigned int, numa_nodes)
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(std::string, vendor_id)
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(std::string, name)
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(std::vector<std::string>, flags)
+
+    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(double, compute_utilization)
+    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(double, ipc)
+    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(unsigned int, irq)
+    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(unsigned int, smi)
+    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(unsigned int, poll)
+    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(double, poll_percent)
+
+    HWS_SAMPLE_STRUCT_MATRIX_MEMBER(double, per_cpu_user_percent)
+    HWS_SAMPLE_STRUCT_MATRIX_MEMBER(double, per_cpu_system_percent)
+    HWS_SAMPLE_STRUCT_MATRIX_MEMBER(double, per_cpu_iowait_percent)
+    HWS_SAMPLE_STRUCT_MATRIX_MEMBER(double, per_cpu_steal_percent)
+    HWS_SAMPLE_STRUCT_MATRIX_MEMBER(double, per_cpu_idle_percent)
 };
 
 /**
@@ -102,14 +142,31 @@ class cpu_clock_samples {
      * @return the YAML string (`[[nodiscard]]`)
      */
     [[nodiscard]] std::string generate_yaml_string() const;
-
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(bool, auto_boosted_clock_enabled)  // true if frequency boosting is enabled
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(double, clock_frequency_min)       // the minimum possible CPU frequency in MHz
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(double, clock_frequency_max)       // the maximum possible CPU frequency in MHz
-
-    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(unsigned int, clock_frequency)                   // the average CPU frequency in MHz including idle cores
-    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(unsigned int, average_non_idle_clock_frequency)  // the average CPU frequency in MHz excluding idle cores
-    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(unsigned int, time_stamp_counter)                // the time stamp counter
+    /**
+     * @brief Return the compile-time descriptors of all clock related hardware samples in the order of the output.
+     * @details Used to generate `has_samples()`, `generate_yaml_string()`, the output-stream operator, the sample selection, and the Python bindings.
+     * @return the hardware sample descriptors (`[[nodiscard]]`)
+     */
+    [[nodiscard]] static constexpr auto metrics() noexcept {
+        return make_sample_metric_table(sample_category::clock,
+                                        sample_metric{ "auto_boosted_clock_enabled", &cpu_clock_samples::auto_boosted_clock_enabled_, "bool", "true if frequency boosting is enabled" },
+                                        sample_metric{ "clock_frequency_min", &cpu_clock_samples::clock_frequency_min_, "MHz", "the minimum possible CPU frequency in MHz" },
+                                        sample_metric{ "clock_frequency_max", &cpu_clock_samples::clock_frequency_max_, "MHz", "the maximum possible CPU frequency in MHz" },
+                                        sample_metric{ "clock_frequency", &cpu_clock_samples::clock_frequency_, "MHz", "the average CPU frequency in MHz including idle cores" }.with_turbostat_name("Avg_MHz"),
+                                        sample_metric{ "average_non_idle_clock_frequency", &cpu_clock_samples::average_non_idle_clock_frequency_, "MHz", "the average CPU frequency in MHz excluding idle cores" }.with_turbostat_name("Bzy_MHz"),
+                                        sample_metric{ "time_stamp_counter", &cpu_clock_samples::time_stamp_counter_, "MHz", "the time stamp counter" }.with_turbostat_name("TSC_MHz"),
+                                        sample_metric{ "per_cpu_clock_frequency", &cpu_clock_samples::per_cpu_clock_frequency_, "MHz", "the current frequency of each logical CPU in MHz" });
+    }
+
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(bool, auto_boosted_clock_enabled)
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(double, clock_frequency_min)
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(double, clock_frequency_max)
+
+    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(unsigned int, clock_frequency)
+    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(unsigned int, average_non_idle_clock_frequency)
+    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(unsigned int, time_stamp_counter)
+
+    HWS_SAMPLE_STRUCT_MATRIX_MEMBER(double, per_cpu_clock_frequency)
 };
 
 /**
@@ -145,15 +202,30 @@ class cpu_power_samples {
      * @return the YAML string (`[[nodiscard]]`)
      */
     [[nodiscard]] std::string generate_yaml_string() const;
-
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(std::string, power_measurement_type)  // the type of the power readings: always "instant/current"
-
-    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(double, power_usage)                     // the currently consumed power of the package of the CPU in W
-    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(double, power_total_energy_consumption)  // the total power consumption in J
-    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(double, core_watt)                       // the currently consumed power of the core part of the CPU in W
-    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(double, ram_watt)                        // the currently consumed power of the RAM part of the CPU in W
-    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(double, package_rapl_throttle_percent)   // the percent of time the package throttled due to RAPL limiters
-    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(double, dram_rapl_throttle_percent)      // the percent of time the DRAM throttled due to RAPL limiters
+    /**
+     * @brief Return the compile-time descriptors of all power related hardware samples in the order of the output.
+     * @details Used to generate `has_samples()`, `generate_yaml_string()`, the output-stream operator, the sample selection, and the Python bindings.
+     * @return the hardware sample descriptors (`[[nodiscard]]`)
+     */
+    [[nodiscard]] static constexpr auto metrics() noexcept {
+        return make_sample_metric_table(sample_category::power,
+                                        sample_metric{ "power_measurement_type", &cpu_power_samples::power_measurement_type_, "string", "the type of the power readings: always \"instant/current\"" },
+                                        sample_metric{ "power_usage", &cpu_power_samples::power_usage_, "W", "the currently consumed power of the package of the CPU in W" }.with_turbostat_name("PkgWatt"),
+                                        sample_metric{ "power_total_energy_consumption", &cpu_power_samples::power_total_energy_consumption_, "J", "the total power consumption in J" }.with_yaml_name("power_total_energy_consumed").derived_from("power_usage"),
+                                        sample_metric{ "core_watt", &cpu_power_samples::core_watt_, "W", "the currently consumed power of the core part of the CPU in W" }.with_yaml_name("core_power").with_turbostat_name("CorWatt"),
+                                        sample_metric{ "ram_watt", &cpu_power_samples::ram_watt_, "W", "the currently consumed power of the RAM part of the CPU in W" }.with_yaml_name("dram_power").with_turbostat_name("RAMWatt"),
+                                        sample_metric{ "package_rapl_throttle_percent", &cpu_power_samples::package_rapl_throttle_percent_, "%", "the percent of time the package throttled due to RAPL limiters" }.with_yaml_name("package_rapl_throttling").with_turbostat_name("PKG_%"),
+                                        sample_metric{ "dram_rapl_throttle_percent", &cpu_power_samples::dram_rapl_throttle_percent_, "%", "the percent of time the DRAM throttled due to RAPL limiters" }.with_yaml_name("dram_rapl_throttling").with_turbostat_name("RAM_%"));
+    }
+
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(std::string, power_measurement_type)
+
+    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(double, power_usage)
+    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(double, power_total_energy_consumption)
+    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(double, core_watt)
+    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(double, ram_watt)
+    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(double, package_rapl_throttle_percent)
+    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(double, dram_rapl_throttle_percent)
 };
 
 /**
@@ -189,18 +261,44 @@ class cpu_memory_samples {
      * @return the YAML string (`[[nodiscard]]`)
      */
     [[nodiscard]] std::string generate_yaml_string() const;
-
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(std::string, cache_size_L1d)            // the size of the L1 data cache
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(std::string, cache_size_L1i)            // the size of the L1 instruction cache
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(std::string, cache_size_L2)             // the size of the L2 cache
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(std::string, cache_size_L3)             // the size of the L2 cache
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(unsigned long long, memory_total)       // the total available memory in Byte
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(unsigned long long, swap_memory_total)  // the total available swap memory in Byte
-
-    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(unsigned long long, memory_used)       // the currently used memory in Byte
-    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(unsigned long long, memory_free)       // the currently free memory in Byte
-    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(unsigned long long, swap_memory_used)  // the currently used swap memory in Byte
-    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(unsigned long long, swap_memory_free)  // the currently free swap memory in Byte
+    /**
+     * @brief Return the compile-time descriptors of all memory related hardware samples in the order of the output.
+     * @details Used to generate `has_samples()`, `generate_yaml_string()`, the output-stream operator, the sample selection, and the Python bindings.
+     * @return the hardware sample descriptors (`[[nodiscard]]`)
+     */
+    [[nodiscard]] static constexpr auto metrics() noexcept {
+        return make_sample_metric_table(sample_category::memory,
+                                        sample_metric{ "cache_size_L1d", &cpu_memory_samples::cache_size_L1d_, "string", "the size of the L1 data cache" },
+                                        sample_metric{ "cache_size_L1i", &cpu_memory_samples::cache_size_L1i_, "string", "the size of the L1 instruction cache" },
+                                        sample_metric{ "cache_size_L2", &cpu_memory_samples::cache_size_L2_, "string", "the size of the L2 cache" },
+                                        sample_metric{ "cache_size_L3", &cpu_memory_samples::cache_size_L3_, "string", "the size of the L2 cache" },
+                                        sample_metric{ "memory_total", &cpu_memory_samples::memory_total_, "B", "the total available memory in Byte" },
+                                        sample_metric{ "swap_memory_total", &cpu_memory_samples::swap_memory_total_, "B", "the total available swap memory in Byte" },
+                                        sample_metric{ "memory_used", &cpu_memory_samples::memory_used_, "B", "the currently used memory in Byte" },
+                                        sample_metric{ "memory_free", &cpu_memory_samples::memory_free_, "B", "the currently free memory in Byte" },
+                                        sample_metric{ "swap_memory_used", &cpu_memory_samples::swap_memory_used_, "B", "the currently used swap memory in Byte" },
+                                        sample_metric{ "swap_memory_free", &cpu_memory_samples::swap_memory_free_, "B", "the currently free swap memory in Byte" },
+                                        sample_metric{ "memory_cached", &cpu_memory_samples::memory_cached_, "B", "the memory currently used by the page cache in Byte" },
+                                        sample_metric{ "memory_buffers", &cpu_memory_samples::memory_buffers_, "B", "the memory currently used by kernel buffers in Byte" },
+                                        sample_metric{ "memory_dirty", &cpu_memory_samples::memory_dirty_, "B", "the memory currently waiting to be written back to the disk in Byte" },
+                                        sample_metric{ "memory_anon_pages", &cpu_memory_samples::memory_anon_pages_, "B", "the memory currently used by non-file backed pages in Byte" });
+    }
+
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(std::string, cache_size_L1d)
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(std::string, cache_size_L1i)
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(std::string, cache_size_L2)
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(std::string, cache_size_L3)
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(unsigned long long, memory_total)
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(unsigned long long, swap_memory_total)
+
+    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(unsigned long long, memory_used)
+    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(unsigned long long, memory_free)
+    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(unsigned long long, swap_memory_used)
+    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(unsigned long long, swap_memory_free)
+    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(unsigned long long, memory_cached)
+    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(unsigned long long, memory_buffers)
+    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(unsigned long long, memory_dirty)
+    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(unsigned long long, memory_anon_pages)
 };
 
 /**
@@ -236,10 +334,21 @@ class cpu_temperature_samples {
      * @return the YAML string (`[[nodiscard]]`)
      */
     [[nodiscard]] std::string generate_yaml_string() const;
-
-    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(double, temperature)             // the current temperature of the whole package in °C
-    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(unsigned int, core_temperature)  // the current temperature of the core part of the CPU in °C
-    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(double, core_throttle_percent)   // the percent of time the CPU has throttled
+    /**
+     * @brief Return the compile-time descriptors of all temperature related hardware samples in the order of the output.
+     * @details Used to generate `has_samples()`, `generate_yaml_string()`, the output-stream operator, the sample selection, and the Python bindings.
+     * @return the hardware sample descriptors (`[[nodiscard]]`)
+     */
+    [[nodiscard]] static constexpr auto metrics() noexcept {
+        return make_sample_metric_table(sample_category::temperature,
+                                        sample_metric{ "temperature", &cpu_temperature_samples::temperature_, "°C", "the current temperature of the whole package in °C" }.with_turbostat_name("PkgTmp"),
+                                        sample_metric{ "core_temperature", &cpu_temperature_samples::core_temperature_, "°C", "the current temperature of the core part of the CPU in °C" }.with_turbostat_name("CoreTmp"),
+                                        sample_metric{ "core_throttle_percent", &cpu_temperature_samples::core_throttle_percent_, "%", "the percent of time the CPU has throttled" }.with_yaml_name("core_throttle_percentage").with_turbostat_name("CoreThr"));
+    }
+
+    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(double, temperature)
+    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(unsigned int, core_temperature)
+    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(double, core_throttle_percent)
 };
 
 /**
@@ -275,13 +384,27 @@ class cpu_gfx_samples {
      * @return the YAML string (`[[nodiscard]]`)
      */
     [[nodiscard]] std::string generate_yaml_string() const;
-
-    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(unsigned int, gfx_render_state_percent)  // the percent of time the iGPU was in the render state
-    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(unsigned int, gfx_frequency)             // the current iGPU power consumption in W
-    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(double, average_gfx_frequency)           // the average iGPU frequency in MHz
-    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(double, gfx_state_c0_percent)            // the percent of the time the iGPU was in the c0 state
-    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(double, cpu_works_for_gpu_percent)       // the percent of time the CPU was doing work for the iGPU
-    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(double, gfx_watt)                        // the currently consumed power of the iGPU of the CPU in W
+    /**
+     * @brief Return the compile-time descriptors of all gfx (iGPU) related hardware samples in the order of the output.
+     * @details Used to generate `has_samples()`, `generate_yaml_string()`, the output-stream operator, the sample selection, and the Python bindings.
+     * @return the hardware sample descriptors (`[[nodiscard]]`)
+     */
+    [[nodiscard]] static constexpr auto metrics() noexcept {
+        return make_sample_metric_table(sample_category::gfx,
+                                        sample_metric{ "gfx_render_state_percent", &cpu_gfx_samples::gfx_render_state_percent_, "%", "the percent of time the iGPU was in the render state" }.with_yaml_name("graphics_render_state").with_turbostat_name("GFX%rc6"),
+                                        sample_metric{ "gfx_frequency", &cpu_gfx_samples::gfx_frequency_, "MHz", "the current iGPU power consumption in W" }.with_yaml_name("graphics_frequency").with_turbostat_name("GFXMHz"),
+                                        sample_metric{ "average_gfx_frequency", &cpu_gfx_samples::average_gfx_frequency_, "MHz", "the average iGPU frequency in MHz" }.with_yaml_name("average_graphics_frequency").with_turbostat_name("GFXAMHz"),
+                                        sample_metric{ "gfx_state_c0_percent", &cpu_gfx_samples::gfx_state_c0_percent_, "%", "the percent of the time the iGPU was in the c0 state" }.with_yaml_name("gpu_state_c0").with_turbostat_name("GFX%C0"),
+                                        sample_metric{ "cpu_works_for_gpu_percent", &cpu_gfx_samples::cpu_works_for_gpu_percent_, "%", "the percent of time the CPU was doing work for the iGPU" }.with_yaml_name("cpu_works_for_gpu").with_turbostat_name("CPUGFX%"),
+                                        sample_metric{ "gfx_watt", &cpu_gfx_samples::gfx_watt_, "W", "the currently consumed power of the iGPU of the CPU in W" }.with_yaml_name("graphics_power").with_turbostat_name("GFXWatt"));
+    }
+
+    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(unsigned int, gfx_render_state_percent)
+    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(unsigned int, gfx_frequency)
+    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(double, average_gfx_frequency)
+    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(double, gfx_state_c0_percent)
+    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(double, cpu_works_for_gpu_percent)
+    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(double, gfx_watt)
 };
 
 /**
@@ -304,7 +427,7 @@ class cpu_idle_states_samples {
     // befriend hardware sampler class
     friend class cpu_hardware_sampler;
     /// The map type used for the idle state samples that are categorized using the regular expressions.
-    using map_type = std::unordered_map<std::string, std::vector<double>>;
+    using map_type = std::unordered_map<std::string, sample_column<double>>;
 
   public:
     /**
@@ -319,13 +442,27 @@ class cpu_idle_states_samples {
      * @return the YAML string (`[[nodiscard]]`)
      */
     [[nodiscard]] std::string generate_yaml_string() const;
-
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(map_type, idle_states)                            // the map of additional CPU idle states
-    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(double, all_cpus_state_c0_percent)             // the percent of time all CPUs were in idle state c0
-    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(double, any_cpu_state_c0_percent)              // the percent of time any CPU was in the idle state c0
-    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(double, low_power_idle_state_percent)          // the percent of time the CPUs was in the low power idle state
-    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(double, system_low_power_idle_state_percent)   // the percent of time the CPU was in the system low power idle state
-    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(double, package_low_power_idle_state_percent)  // the percent of time the CPU was in the package low power idle state
+    /**
+     * @brief Return the compile-time descriptors of all idle state related hardware samples in the order of the output.
+     * @details Used to generate `has_samples()`, `generate_yaml_string()`, the output-stream operator, the sample selection, and the Python bindings.
+     * @return the hardware sample descriptors (`[[nodiscard]]`)
+     */
+    [[nodiscard]] static constexpr auto metrics() noexcept {
+        return make_sample_metric_table(sample_category::idle_state,
+                                        sample_metric{ "all_cpus_state_c0_percent", &cpu_idle_states_samples::all_cpus_state_c0_percent_, "%", "the percent of time all CPUs were in idle state c0" }.with_yaml_name("all_cpus_state_c0").with_turbostat_name("Totl%C0"),
+                                        sample_metric{ "any_cpu_state_c0_percent", &cpu_idle_states_samples::any_cpu_state_c0_percent_, "%", "the percent of time any CPU was in the idle state c0" }.with_yaml_name("any_cpu_state_c0").with_turbostat_name("Any%C0"),
+                                        sample_metric{ "low_power_idle_state_percent", &cpu_idle_states_samples::low_power_idle_state_percent_, "%", "the percent of time the CPUs was in the low power idle state" }.with_yaml_name("lower_power_idle_state").with_turbostat_name("CPU%LPI"),
+                                        sample_metric{ "system_low_power_idle_state_percent", &cpu_idle_states_samples::system_low_power_idle_state_percent_, "%", "the percent of time the CPU was in the system low power idle state" }.with_yaml_name("system_lower_power_idle_state").with_turbostat_name("SYS%LPI"),
+                                        sample_metric{ "package_low_power_idle_state_percent", &cpu_idle_states_samples::package_low_power_idle_state_percent_, "%", "the percent of time the CPU was in the package low power idle state" }.with_yaml_name("package_lower_power_idle_state").with_turbostat_name("Pkg%LPI"),
+                                        sample_metric{ "idle_states", &cpu_idle_states_samples::idle_states_, "various", "the map of additional CPU idle states" }.with_yaml_name("CPU%[0-9a-zA-Z]+").with_layout(sample_metric_layout::custom).with_turbostat_name("{}"));
+    }
+
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(map_type, idle_states)
+    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(double, all_cpus_state_c0_percent)
+    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(double, any_cpu_state_c0_percent)
+    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(double, low_power_idle_state_percent)
+    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(double, system_low_power_idle_state_percent)
+    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(double, package_low_power_idle_state_percent)
 };
 
 /**
@@ -0,0 +1,89 @@
+/**
+ * @file
+ * @author Marcel Breyer
+ * @copyright 2024-today All Rights Reserved
+ * @license This file is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Defines a reader for the current frequencies of all logical CPUs exposed by the Linux cpufreq sysfs interface.
+ */
+
+#ifndef HWS_CPU_CPUFREQ_READER_HPP_
+#define HWS_CPU_CPUFREQ_READER_HPP_
+#pragma once
+
+#include <cstddef>     // std::size_t
+#include <filesystem>  // std::filesystem::path
+#include <vector>      // std::vector
+
+namespace hws::detail {
+
+/**
+ * @brief Reads the `scaling_cur_freq` files of all logical CPUs from the cpufreq sysfs interface without spawning a subprocess.
+ * @details The `cpu<N>/cpufreq/scaling_cur_freq` files are opened once and reread using `pread`.
+ *          The logical CPUs are the ones having a cpufreq policy while constructing the reader, ordered by their IDs.
+ *          The frequency of a logical CPU whose file can't be read anymore (e.g., since it went offline) is reported as zero.
+ */
+class cpufreq_reader {
+  public:
+    /**
+     * @brief Open the `scaling_cur_freq` files of all logical CPUs found in @p cpu_root.
+     * @param[in] cpu_root the root directory of the logical CPUs, e.g., a fake directory tree for testing
+     * @throws std::runtime_error if no logical CPU with a cpufreq policy could be found
+     */
+    explicit cpufreq_reader(const std::filesystem::path &cpu_root = "/sys/devices/system/cpu");
+
+    /**
+     * @brief Delete the copy-constructor since the reader owns file descriptors.
+     */
+    cpufreq_reader(const cpufreq_reader &) = delete;
+    /**
+     * @brief Move-construct a reader, taking over the file descriptors of @p other.
+     * @param[in,out] other the reader to move from
+     */
+    cpufreq_reader(cpufreq_reader &&other) noexcept;
+    /**
+     * @brief Delete the copy-assignment operator since the reader owns file descriptors.
+     */
+    cpufreq_reader &operator=(const cpufreq_reader &) = delete;
+    /**
+     * @brief Move-assign a reader, taking over the file descriptors of @p other.
+     * @param[in,out] other the reader to move from
+     * @return `*this`
+     */
+    cpufreq_reader &operator=(cpufreq_reader &&other) noexcept;
+
+    /**
+     * @brief Close all file descriptors.
+     */
+    ~cpufreq_reader();
+
+    /**
+     * @brief Return the IDs of the logical CPUs in the order of the frequencies returned by `read()`.
+     * @return the IDs of the logical CPUs (`[[nodiscard]]`)
+     */
+    [[nodiscard]] const std::vector<std::size_t> &cpu_ids() const noexcept { return cpu_ids_; }
+
+    /**
+     * @brief Reread the current frequencies of all logical CPUs.
+     * @return the frequencies in kHz in the order of `cpu_ids()` (`[[nodiscard]]`)
+     */
+    [[nodiscard]] const std::vector<unsigned long long> &read() noexcept;
+
+  private:
+    /**
+     * @brief Close all file descriptors.
+     */
+    void close_all() noexcept;
+
+    /// The IDs of the logical CPUs.
+    std::vector<std::size_t> cpu_ids_{};
+    /// The file descriptors of the opened `scaling_cur_freq` files.
+    std::vector<int> fds_{};
+    /// The frequencies read last.
+    std::vector<unsigned long long> frequencies_{};
+};
+
+}  // namespace hws::detail
+
+#endif  // HWS_CPU_CPUFREQ_READER_HPP_
@@ -5,21 +5,34 @@
  * @license This file is released under the MIT license.
  *          See the LICENSE.md file in the project root for full license information.
  *
- * @brief Defines a hardware sampler for CPUs using the turbostat, lscpu, and free utilities (requires root).
+ * @brief Defines a hardware sampler for CPUs using the turbostat and lscpu utilities (requires root), `/proc/meminfo`, and the powercap RAPL interface.
  */
 
 #ifndef HWS_CPU_HARDWARE_SAMPLER_HPP_
 #define HWS_CPU_HARDWARE_SAMPLER_HPP_
 #pragma once
 
-#include "hws/cpu/cpu_samples.hpp"   // hws::{cpu_general_samples, clock_samples, power_samples, memory_samples, temperature_samples, gfx_samples, idle_state_samples}
-#include "hws/hardware_sampler.hpp"  // hws::hardware_sampler
-#include "hws/sample_category.hpp"   // hws::sample_category
+#include "hws/cpu/cpu_samples.hpp"        // hws::{cpu_general_samples, clock_samples, power_samples, memory_samples, temperature_samples, gfx_samples, idle_state_samples}
+#include "hws/cpu/cpufreq_reader.hpp"     // hws::detail::cpufreq_reader
+#include "hws/cpu/meminfo_reader.hpp"     // hws::detail::meminfo_reader
+#include "hws/cpu/proc_stat_reader.hpp"   // hws::detail::proc_stat_reader
+#include "hws/cpu/rapl_reader.hpp"        // hws::detail::{rapl_reader, rapl_energy}
+#include "hws/cpu/turbostat_columns.hpp"  // hws::detail::turbostat_column_table
+#include "hws/cpu/turbostat_session.hpp"  // hws::detail::turbostat_session
+#include "hws/hardware_sampler.hpp"       // hws::hardware_sampler
+#include "hws/sample_category.hpp"        // hws::sample_category
 
 #include "fmt/ostream.h"  // fmt::formatter, fmt::ostream_formatter
 
-#include <chrono>  // std::chrono::milliseconds, std::chrono_literals namespace
-#include <iosfwd>  // std::ostream forward declaration
+#include <chrono>       // std::chrono::nanoseconds, std::chrono_literals namespace
+#include <cstddef>      // std::size_t
+#include <filesystem>   // std::filesystem::path
+#include <iosfwd>       // std::ostream forward declaration
+#include <mutex>        // std::mutex
+#include <optional>     // std::optional
+#include <string>       // std::string
+#include <string_view>  // std::string_view
+#include <vector>       // std::vector
 
 namespace hws {
 
@@ -27,7 +40,10 @@ using namespace std::chrono_literals;
 
 /**
  * @brief A hardware sampler for the CPU.
- * @details If available uses the linux commands `turbostat`, `lscpu`, and `free` to gather its information.
+ * @details If available uses the linux commands `turbostat` (a single long-lived process) and `lscpu` as well as the `/proc/meminfo` and `/proc/stat` files to gather its information.
+ *          The current frequency of each logical CPU is read from the Linux cpufreq sysfs interface.
+ *          The power draw of the package, cores, uncore (iGPU), and DRAM is preferably read from the RAPL energy counters exposed via
+ *          the Linux powercap interface, falling back to `turbostat` if they aren't readable.
  */
 class cpu_hardware_sampler : public hardware_sampler {
   public:
@@ -41,7 +57,7 @@ class cpu_hardware_sampler : public hardware_sampler {
      * @param[in] sampling_interval the used sampling interval
      * @param[in] category the sample categories that are enabled for hardware sampling (default: all)
      */
-    explicit cpu_hardware_sampler(std::chrono::milliseconds sampling_interval, sample_category category = sample_category::all);
+    explicit cpu_hardware_sampler(std::chrono::nanoseconds sampling_interval, sample_category category = sample_category::all);
 
     /**
      * @brief Delete the copy-constructor (already implicitly deleted due to the base class's std::atomic member).
@@ -107,6 +123,25 @@ class cpu_hardware_sampler : public hardware_sampler {
      */
     [[nodiscard]] const cpu_idle_states_samples &idle_state_samples() const noexcept { return idle_state_samples_; }
 
+    /**
+     * @brief Set the root directory of the Linux powercap interface the RAPL energy counters are read from (default: `/sys/class/powercap`).
+     * @details Allows to use a fake directory tree, e.g., for testing. If no RAPL package domain can be read, the power samples are retrieved via turbostat.
+     * @param[in] powercap_root the root directory of the powercap interface
+     * @throws std::runtime_error if the hardware sampler has already been started
+     */
+    void set_powercap_root(std::filesystem::path powercap_root);
+    /**
+     * @brief Return the root directory of the Linux powercap interface the RAPL energy counters are read from.
+     * @return the root directory (`[[nodiscard]]`)
+     */
+    [[nodiscard]] const std::filesystem::path &powercap_root() const noexcept { return powercap_root_; }
+    /**
+     * @brief Check whether the power samples are read from the RAPL energy counters instead of via turbostat.
+     * @details Only meaningful after the initial samples have been retrieved.
+     * @return `true` if the RAPL energy counters are used, otherwise `false` (`[[nodiscard]]`)
+     */
+    [[nodiscard]] bool uses_powercap() const noexcept;
+
     /**
      * @copydoc hws::hardware_sampler::device_identification
      */
@@ -119,9 +154,85 @@ class cpu_hardware_sampler : public hardware_sampler {
 
   private:
     /**
-     * @copydoc hws::hardware_sampler::sampling_loop
+     * @copydoc hws::hardware_sampler::initialize_samples
+     */
+    void initialize_samples() final;
+    /**
+     * @copydoc hws::hardware_sampler::sample
+     */
+    void sample() final;
+    /**
+     * @brief Read the cumulative energy counters of the RAPL package and DRAM domains summed over all sockets in J.
+     * @details Uses a separate hws::detail::rapl_reader opened on the first call and guarded by its own mutex, such that the regions can be
+     *          begun and ended from arbitrary threads concurrently to the sampling std::thread. A wraparound of the counters is only
+     *          detected if two consecutive calls lie within one wraparound period (typically several minutes).
+     * @return the cumulative energy, `std::nullopt` if the RAPL energy counters aren't readable (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::optional<double> read_energy_counter() final;
+    /**
+     * @copydoc hws::hardware_sampler::latest_power_usage
+     */
+    [[nodiscard]] std::optional<double> latest_power_usage() const final;
+    /**
+     * @copydoc hws::hardware_sampler::latest_temperature
+     */
+    [[nodiscard]] std::optional<double> latest_temperature() const final;
+    /**
+     * @copydoc hws::hardware_sampler::numeric_sample_names
+     */
+    [[nodiscard]] std::vector<std::string> numeric_sample_names() const final;
+    /**
+     * @copydoc hws::hardware_sampler::latest_numeric_sample_values
      */
-    void sampling_loop() final;
+    void latest_numeric_sample_values(sample_category sampled, std::vector<double> &values) const final;
+#if defined(HWS_VIA_TURBOSTAT_ENABLED)
+    /**
+     * @brief Terminate the turbostat session since its rows aren't read while the sampling is paused.
+     * @details The header and the latest row of the terminated session are remembered.
+     */
+    void pause_samples() final;
+    /**
+     * @brief Restart the turbostat session terminated in `cpu_hardware_sampler::pause_samples()`.
+     * @details Doesn't block: until the new session has printed its first row, the latest row of the terminated session is used.
+     */
+    void resume_samples() final;
+    /**
+     * @brief Terminate the turbostat session such that it doesn't outlive the sampling.
+     */
+    void finalize_samples() final;
+#endif
+    /**
+     * @brief Check whether the hardware sample of the turbostat column @p turbostat_name is read from the RAPL energy counters instead.
+     * @param[in] turbostat_name the name of the turbostat column, e.g., "PkgWatt"
+     * @return `true` if the hardware sample is read from the RAPL energy counters, otherwise `false` (`[[nodiscard]]`)
+     */
+    [[nodiscard]] bool read_via_powercap(std::string_view turbostat_name) const noexcept;
+#if defined(HWS_VIA_PROC_STAT_ENABLED)
+    /**
+     * @brief Reread `/proc/stat` and append the utilization of all logical CPUs to the present per logical CPU utilization samples.
+     */
+    void push_back_per_cpu_utilization();
+#endif
+#if defined(HWS_VIA_CPUFREQ_ENABLED)
+    /**
+     * @brief Reread the current frequencies of all logical CPUs and append them to the per logical CPU frequency samples (if present).
+     */
+    void push_back_per_cpu_clock_frequency();
+#endif
+#if defined(HWS_VIA_TURBOSTAT_ENABLED)
+    /**
+     * @brief Add the hardware samples of all sample classes read via turbostat whose column is part of the header of the @p columns.
+     * @param[in,out] columns the table mapping the turbostat columns to the hardware samples
+     * @param[in] create if `true`, creates the hardware samples of the enabled sample categories, otherwise only adds the already present ones
+     */
+    void add_turbostat_columns(detail::turbostat_column_table &columns, bool create);
+    /**
+     * @brief Start the long-lived turbostat session printing one row per smallest sampling interval of the enabled sample categories retrieved via turbostat.
+     * @details Replaces a previous turbostat session. Until the new session has printed its first row, the row of the @p initial_output is used.
+     * @param[in] initial_output the output of a single turbostat invocation (header and one row)
+     */
+    void start_turbostat_session(std::string_view initial_output);
+#endif
 
     /// The general CPU samples.
     cpu_general_samples general_samples_{};
@@ -137,6 +248,49 @@ class cpu_hardware_sampler : public hardware_sampler {
     cpu_gfx_samples gfx_samples_{};
     /// The idle state related CPU samples.
     cpu_idle_states_samples idle_state_samples_{};
+
+    /// `true` if any of the samples retrieved via turbostat has been selected, i.e., turbostat must be run in the sampling loop.
+    bool turbostat_samples_selected_{ true };
+#if defined(HWS_VIA_TURBOSTAT_ENABLED)
+    /// The long-lived turbostat process whose output is read in the sampling loop; only present while the sampling is running and any sample is retrieved via turbostat.
+    std::optional<detail::turbostat_session> turbostat_session_{};
+    /// The table mapping the cells of the turbostat rows to the hardware samples; rebuilt only if turbostat prints a new header.
+    std::optional<detail::turbostat_column_table> turbostat_columns_{};
+    /// The number of headers printed by the turbostat session the table has been built for.
+    std::size_t turbostat_columns_num_headers_{ 0 };
+    /// The header and the latest row of the turbostat session terminated while the sampling is paused.
+    std::string turbostat_paused_output_{};
+#endif
+
+    /// The root directory of the Linux powercap interface.
+    std::filesystem::path powercap_root_{ "/sys/class/powercap" };
+#if defined(HWS_VIA_POWERCAP_ENABLED)
+    /// The reader for the RAPL energy counters; only present if the counters are readable and power or gfx samples are retrieved.
+    std::optional<detail::rapl_reader> rapl_reader_{};
+    /// The RAPL energy counters read in the previous tick the power samples have been retrieved.
+    detail::rapl_energy rapl_last_power_energy_{};
+    /// The RAPL energy counters read in the previous tick the gfx samples have been retrieved.
+    detail::rapl_energy rapl_last_gfx_energy_{};
+    /// The mutex guarding the region_rapl_reader_ (the regions may be begun and ended from arbitrary threads).
+    std::mutex region_rapl_reader_mutex_{};
+    /// The reader for the RAPL energy counters used by the regions; separate from rapl_reader_ since it is read outside of the sampling std::thread.
+    std::optional<detail::rapl_reader> region_rapl_reader_{};
+    /// `true` if opening the region_rapl_reader_ has already been tried.
+    bool region_rapl_reader_opened_{ false };
+#endif
+
+#if defined(HWS_VIA_PROC_MEMINFO_ENABLED)
+    /// The reader for `/proc/meminfo` keeping the file open during sampling; only present if memory samples are retrieved.
+    std::optional<detail::meminfo_reader> meminfo_reader_{};
+#endif
+#if defined(HWS_VIA_PROC_STAT_ENABLED)
+    /// The reader for `/proc/stat` keeping the file open during sampling; only present if per logical CPU utilization samples are retrieved.
+    std::optional<detail::proc_stat_reader> proc_stat_reader_{};
+#endif
+#if defined(HWS_VIA_CPUFREQ_ENABLED)
+    /// The reader for the current frequencies of all logical CPUs keeping the files open during sampling; only present if per logical CPU frequency samples are retrieved.
+    std::optional<detail::cpufreq_reader> cpufreq_reader_{};
+#endif
 };
 
 /**
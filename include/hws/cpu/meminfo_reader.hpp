@@ -0,0 +1,132 @@
+/**
+ * @file
+ * @author Marcel Breyer
+ * @copyright 2024-today All Rights Reserved
+ * @license This file is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Defines a reader for the memory information provided by the Linux kernel in `/proc/meminfo`.
+ */
+
+#ifndef HWS_CPU_MEMINFO_READER_HPP_
+#define HWS_CPU_MEMINFO_READER_HPP_
+#pragma once
+
+#include <array>        // std::array
+#include <cstddef>      // std::size_t
+#include <string>       // std::string
+#include <string_view>  // std::string_view
+
+namespace hws::detail {
+
+/**
+ * @brief The memory information read from `/proc/meminfo`, all values are given in Byte.
+ * @details Entries not reported by the kernel are zero.
+ */
+struct meminfo {
+    /// The total usable memory (`MemTotal`).
+    unsigned long long mem_total{ 0 };
+    /// The completely unused memory (`MemFree`).
+    unsigned long long mem_free{ 0 };
+    /// The memory available for starting new applications without swapping (`MemAvailable`).
+    unsigned long long mem_available{ 0 };
+    /// The memory used by kernel buffers (`Buffers`).
+    unsigned long long buffers{ 0 };
+    /// The memory used by the page cache (`Cached`).
+    unsigned long long cached{ 0 };
+    /// The reclaimable part of the kernel slab memory (`SReclaimable`).
+    unsigned long long slab_reclaimable{ 0 };
+    /// The total swap memory (`SwapTotal`).
+    unsigned long long swap_total{ 0 };
+    /// The unused swap memory (`SwapFree`).
+    unsigned long long swap_free{ 0 };
+    /// The memory waiting to be written back to the disk (`Dirty`).
+    unsigned long long dirty{ 0 };
+    /// The non-file backed pages mapped into user-space page tables (`AnonPages`).
+    unsigned long long anon_pages{ 0 };
+    /// `true` if the kernel reported `MemAvailable` (since Linux 3.14).
+    bool has_mem_available{ false };
+
+    /**
+     * @brief Return the used memory as reported by the `free` utility (procps-ng 4), i.e., `MemTotal - MemAvailable`.
+     * @details Falls back to `MemTotal - MemFree - Buffers - Cached - SReclaimable` if `MemAvailable` isn't reported by the kernel.
+     * @return the used memory in Byte (`[[nodiscard]]`)
+     */
+    [[nodiscard]] unsigned long long mem_used() const noexcept;
+
+    /**
+     * @brief Return the used swap memory, i.e., `SwapTotal - SwapFree`.
+     * @return the used swap memory in Byte (`[[nodiscard]]`)
+     */
+    [[nodiscard]] unsigned long long swap_used() const noexcept { return swap_total - swap_free; }
+};
+
+/**
+ * @brief Reads `/proc/meminfo` without spawning a subprocess.
+ * @details The file is opened once and kept open for the lifetime of the reader. Each call to `read()` rereads the file from the
+ *          beginning into a fixed-size buffer using `pread` and parses it in-place, i.e., no memory is allocated in the sampling loop.
+ */
+class meminfo_reader {
+  public:
+    /// The size of the buffer the file is read into; `/proc/meminfo` is typically smaller than 2 KiB.
+    constexpr static std::size_t buffer_size = 8192;
+
+    /**
+     * @brief Open the file at @p path.
+     * @param[in] path the path to the memory information file
+     * @throws std::runtime_error if the file couldn't be opened
+     */
+    explicit meminfo_reader(std::string path = "/proc/meminfo");
+
+    /**
+     * @brief Delete the copy-constructor since the reader owns a file descriptor.
+     */
+    meminfo_reader(const meminfo_reader &) = delete;
+    /**
+     * @brief Move-construct a reader, taking over the file descriptor of @p other.
+     * @param[in,out] other the reader to move from
+     */
+    meminfo_reader(meminfo_reader &&other) noexcept;
+    /**
+     * @brief Delete the copy-assignment operator since the reader owns a file descriptor.
+     */
+    meminfo_reader &operator=(const meminfo_reader &) = delete;
+    /**
+     * @brief Move-assign a reader, taking over the file descriptor of @p other.
+     * @param[in,out] other the reader to move from
+     * @return `*this`
+     */
+    meminfo_reader &operator=(meminfo_reader &&other) noexcept;
+
+    /**
+     * @brief Close the file descriptor.
+     */
+    ~meminfo_reader();
+
+    /**
+     * @brief Reread the file and parse the current memory information.
+     * @throws std::runtime_error if the file couldn't be read
+     * @return the current memory information (`[[nodiscard]]`)
+     */
+    [[nodiscard]] meminfo read();
+
+    /**
+     * @brief Parse the memory information in the format of `/proc/meminfo` from @p content.
+     * @details Unknown keys and incomplete lines are ignored.
+     * @param[in] content the content of the memory information file
+     * @return the parsed memory information (`[[nodiscard]]`)
+     */
+    [[nodiscard]] static meminfo parse(std::string_view content) noexcept;
+
+  private:
+    /// The path to the memory information file.
+    std::string path_;
+    /// The file descriptor of the opened file.
+    int fd_{ -1 };
+    /// The buffer the file content is read into.
+    std::array<char, buffer_size> buffer_{};
+};
+
+}  // namespace hws::detail
+
+#endif  // HWS_CPU_MEMINFO_READER_HPP_
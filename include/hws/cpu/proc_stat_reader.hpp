@@ -0,0 +1,126 @@
+/**
+ * @file
+ * @author Marcel Breyer
+ * @copyright 2024-today All Rights Reserved
+ * @license This file is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Defines a reader for the per logical CPU times in `/proc/stat` keeping the file open between reads.
+ */
+
+#ifndef HWS_CPU_PROC_STAT_READER_HPP_
+#define HWS_CPU_PROC_STAT_READER_HPP_
+#pragma once
+
+#include <array>        // std::array
+#include <cstddef>      // std::size_t
+#include <string>       // std::string
+#include <string_view>  // std::string_view
+#include <vector>       // std::vector
+
+namespace hws::detail {
+
+/**
+ * @brief The utilization of a single logical CPU between two reads of `/proc/stat` in percent; sums up to 100%.
+ */
+struct cpu_utilization {
+    /// The time spent in user mode (including niced processes).
+    double user{ 0.0 };
+    /// The time spent in system mode (including servicing hard and soft interrupts).
+    double system{ 0.0 };
+    /// The time spent idle while waiting for I/O to complete.
+    double iowait{ 0.0 };
+    /// The time stolen by the hypervisor for other virtual machines.
+    double steal{ 0.0 };
+    /// The time spent idle.
+    double idle{ 0.0 };
+};
+
+/**
+ * @brief Reads the per logical CPU times of `/proc/stat` and converts the deltas of the jiffies between two reads to percentages.
+ * @details The file is opened once and reread using `pread`. Only the prefix of the file containing the "cpu<N>" lines is read, i.e., the
+ *          (potentially large) interrupt counters at the end aren't copied. Reading and parsing doesn't allocate memory.
+ *          The logical CPUs are the ones online while constructing the reader, ordered by their IDs. A logical CPU going offline afterward
+ *          keeps its previous utilization.
+ */
+class proc_stat_reader {
+  public:
+    /**
+     * @brief Open @p path and determine the logical CPUs.
+     * @param[in] path the path to the file, e.g., a fake file for testing
+     * @throws std::runtime_error if the file couldn't be opened or read or doesn't contain any logical CPU
+     */
+    explicit proc_stat_reader(std::string path = "/proc/stat");
+
+    /**
+     * @brief Delete the copy-constructor since the reader owns a file descriptor.
+     */
+    proc_stat_reader(const proc_stat_reader &) = delete;
+    /**
+     * @brief Move-construct a reader, taking over the file descriptor of @p other.
+     * @param[in,out] other the reader to move from
+     */
+    proc_stat_reader(proc_stat_reader &&other) noexcept;
+    /**
+     * @brief Delete the copy-assignment operator since the reader owns a file descriptor.
+     */
+    proc_stat_reader &operator=(const proc_stat_reader &) = delete;
+    /**
+     * @brief Move-assign a reader, taking over the file descriptor of @p other.
+     * @param[in,out] other the reader to move from
+     * @return `*this`
+     */
+    proc_stat_reader &operator=(proc_stat_reader &&other) noexcept;
+
+    /**
+     * @brief Close the file.
+     */
+    ~proc_stat_reader();
+
+    /**
+     * @brief Return the IDs of the logical CPUs in the order of the utilizations returned by `read()`.
+     * @return the IDs of the logical CPUs (`[[nodiscard]]`)
+     */
+    [[nodiscard]] const std::vector<std::size_t> &cpu_ids() const noexcept { return cpu_ids_; }
+
+    /**
+     * @brief Reread the file and compute the utilization of all logical CPUs since the previous read (since booting for the first read).
+     * @details If no jiffy elapsed for a logical CPU since the previous read (the jiffies are typically incremented every 1-10ms),
+     *          its previous utilization is kept.
+     * @throws std::runtime_error if the file couldn't be read
+     * @return the utilization of the logical CPUs in the order of `cpu_ids()` (`[[nodiscard]]`)
+     */
+    [[nodiscard]] const std::vector<cpu_utilization> &read();
+
+  private:
+    /**
+     * @brief The times of a single logical CPU in jiffies, i.e., the first eight values of its "cpu<N>" line.
+     */
+    using cpu_times = std::array<unsigned long long, 8>;
+
+    /**
+     * @brief Read the prefix of the file into the buffer.
+     * @throws std::runtime_error if the file couldn't be read
+     * @return the read content (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::string_view read_content();
+
+    /// The path to the file.
+    std::string path_;
+    /// The file descriptor of the opened file.
+    int fd_{ -1 };
+    /// The buffer the file is read into; large enough for all "cpu<N>" lines.
+    std::vector<char> buffer_{};
+    /// The IDs of the logical CPUs.
+    std::vector<std::size_t> cpu_ids_{};
+    /// The index into `cpu_ids_` for each ID of a logical CPU, `npos` for logical CPUs that were offline.
+    std::vector<std::size_t> cpu_index_{};
+    /// The times of the logical CPUs at the previous read.
+    std::vector<cpu_times> last_times_{};
+    /// The utilization of the logical CPUs since the previous read.
+    std::vector<cpu_utilization> utilization_{};
+};
+
+}  // namespace hws::detail
+
+#endif  // HWS_CPU_PROC_STAT_READER_HPP_
@@ -0,0 +1,144 @@
+/**
+ * @file
+ * @author Marcel Breyer
+ * @copyright 2024-today All Rights Reserved
+ * @license This file is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Defines a reader for the RAPL energy counters exposed by the Linux powercap sysfs interface.
+ */
+
+#ifndef HWS_CPU_RAPL_READER_HPP_
+#define HWS_CPU_RAPL_READER_HPP_
+#pragma once
+
+#include <chrono>      // std::chrono::steady_clock
+#include <cstddef>     // std::size_t
+#include <filesystem>  // std::filesystem::path
+#include <string>      // std::string
+#include <vector>      // std::vector
+
+namespace hws::detail {
+
+/**
+ * @brief The RAPL domains read from the powercap interface.
+ */
+enum class rapl_domain_type {
+    /** The whole package (socket) of the CPU. */
+    package,
+    /** The cores of the CPU (power plane 0). */
+    core,
+    /** The uncore part of the CPU, i.e., typically the iGPU (power plane 1). */
+    uncore,
+    /** The DRAM attached to the CPU. */
+    dram
+};
+
+/**
+ * @brief The energy consumed since the construction of the hws::detail::rapl_reader, summed over all sockets, in J.
+ */
+struct rapl_energy {
+    /// The time point the energy counters have been read.
+    std::chrono::steady_clock::time_point time_point{};
+    /// The energy consumed by the packages.
+    double package{ 0.0 };
+    /// The energy consumed by the cores.
+    double core{ 0.0 };
+    /// The energy consumed by the uncore parts.
+    double uncore{ 0.0 };
+    /// The energy consumed by the DRAM.
+    double dram{ 0.0 };
+};
+
+/**
+ * @brief Reads the RAPL energy counters of all sockets from the powercap sysfs interface without spawning a subprocess.
+ * @details Reads the `energy_uj` files of the `intel-rapl:<socket>` zones and their `intel-rapl:<socket>:<subzone>` subzones,
+ *          classified by the content of their `name` files. AMD CPUs (Zen and newer) expose their RAPL counters via the same
+ *          `intel-rapl` powercap control type. The `energy_uj` files are opened once and reread using `pread`. Since the
+ *          counters are only 32 bit wide on most CPUs, a wraparound is corrected using the zone's `max_energy_range_uj`,
+ *          assuming that the counters are read at least once per wraparound period (typically several minutes).
+ */
+class rapl_reader {
+  public:
+    /**
+     * @brief Open the energy counters of all RAPL domains found in @p powercap_root.
+     * @param[in] powercap_root the root directory of the powercap interface, e.g., a fake directory tree for testing
+     * @throws std::runtime_error if no package domain could be found or any energy counter couldn't be read (e.g., missing root privileges)
+     */
+    explicit rapl_reader(const std::filesystem::path &powercap_root = "/sys/class/powercap");
+
+    /**
+     * @brief Delete the copy-constructor since the reader owns file descriptors.
+     */
+    rapl_reader(const rapl_reader &) = delete;
+    /**
+     * @brief Move-construct a reader, taking over the file descriptors of @p other.
+     * @param[in,out] other the reader to move from
+     */
+    rapl_reader(rapl_reader &&other) noexcept;
+    /**
+     * @brief Delete the copy-assignment operator since the reader owns file descriptors.
+     */
+    rapl_reader &operator=(const rapl_reader &) = delete;
+    /**
+     * @brief Move-assign a reader, taking over the file descriptors of @p other.
+     * @param[in,out] other the reader to move from
+     * @return `*this`
+     */
+    rapl_reader &operator=(rapl_reader &&other) noexcept;
+
+    /**
+     * @brief Close all file descriptors.
+     */
+    ~rapl_reader();
+
+    /**
+     * @brief Check whether the RAPL domain @p type is available on any socket.
+     * @param[in] type the RAPL domain
+     * @return `true` if the RAPL domain is available, otherwise `false` (`[[nodiscard]]`)
+     */
+    [[nodiscard]] bool has_domain(rapl_domain_type type) const noexcept;
+    /**
+     * @brief Return the number of sockets, i.e., the number of package domains.
+     * @return the number of sockets (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::size_t num_sockets() const noexcept;
+
+    /**
+     * @brief Reread all energy counters.
+     * @throws std::runtime_error if any energy counter couldn't be read
+     * @return the energy consumed since the construction of this reader (`[[nodiscard]]`)
+     */
+    [[nodiscard]] rapl_energy read();
+
+  private:
+    /**
+     * @brief A single RAPL domain of one socket.
+     */
+    struct domain {
+        /// The type of the RAPL domain.
+        rapl_domain_type type;
+        /// The path to the energy counter.
+        std::string energy_path;
+        /// The file descriptor of the opened energy counter.
+        int fd;
+        /// The value after which the energy counter wraps around in µJ.
+        unsigned long long max_energy_range;
+        /// The previously read value of the energy counter in µJ.
+        unsigned long long last_energy;
+        /// The energy consumed since the construction of the reader in µJ.
+        unsigned long long accumulated_energy;
+    };
+
+    /**
+     * @brief Close all file descriptors.
+     */
+    void close_all() noexcept;
+
+    /// All found RAPL domains.
+    std::vector<domain> domains_{};
+};
+
+}  // namespace hws::detail
+
+#endif  // HWS_CPU_RAPL_READER_HPP_
@@ -0,0 +1,184 @@
+/**
+ * @file
+ * @author Marcel Breyer
+ * @copyright 2024-today All Rights Reserved
+ * @license This file is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Defines a table dispatching the cells of a turbostat row to the hardware samples they are stored in.
+ */
+
+#ifndef HWS_CPU_TURBOSTAT_COLUMNS_HPP_
+#define HWS_CPU_TURBOSTAT_COLUMNS_HPP_
+#pragma once
+
+#include "hws/sample_category.hpp"  // hws::sample_category
+#include "hws/sample_column.hpp"    // hws::sample_column_config
+#include "hws/sample_metric.hpp"    // hws::detail::{for_each_sample_metric, is_sample_column_v}
+#include "hws/utility.hpp"          // hws::detail::{convert_to, remove_cvref_t}
+
+#include <algorithm>    // std::find
+#include <cstddef>      // std::size_t
+#include <optional>     // std::optional
+#include <string>       // std::string
+#include <string_view>  // std::string_view
+#include <vector>       // std::vector
+
+namespace hws::detail {
+
+/**
+ * @brief Maps the cells of the turbostat rows to the hardware samples they are stored in.
+ * @details The header is matched against the turbostat column names of the sample classes' metric tables exactly once.
+ *          Afterward, reading a row only tokenizes it and converts the cells of the present hardware samples, i.e.,
+ *          without any string comparison, regular expression, or lookup in the idle state map.
+ *          The table stores pointers to the hardware samples -> the sample classes must outlive the table and their
+ *          hardware samples may not be reset while the table is in use.
+ */
+class turbostat_column_table {
+  public:
+    /**
+     * @brief Create an empty table for the turbostat @p header.
+     * @param[in] header the names of the turbostat columns
+     */
+    explicit turbostat_column_table(std::vector<std::string> header);
+
+    /**
+     * @brief Add all hardware samples of the @p samples read via turbostat whose column is part of the header.
+     * @details Hardware samples stored in a map (the idle states) are added using `add_idle_state_columns`; hardware samples stored in a
+     *          hws::sample_matrix are never read via turbostat.
+     * @tparam Samples the sample class, e.g., hws::cpu_power_samples
+     * @tparam Predicate the type of the predicate
+     * @param[in,out] samples the sample class instance
+     * @param[in] select called with the turbostat column name and the sample category of a hardware sample; returns `true` if the hardware sample should be read from the turbostat rows
+     * @param[in] config if present, creates the selected hardware samples with this configuration, otherwise only adds the already present ones
+     */
+    template <typename Samples, typename Predicate>
+    void add_columns(Samples &samples, const Predicate &select, const std::optional<sample_column_config> &config) {
+        for_each_sample_metric<Samples>([&](const auto &metric) {
+            using metric_type = detail::remove_cvref_t<decltype(metric)>;
+            if constexpr (detail::is_sample_column_v<typename metric_type::value_type>) {
+                if (metric.turbostat_name.empty()) {
+                    return;
+                }
+                const auto it = std::find(header_.cbegin(), header_.cend(), metric.turbostat_name);
+                if (it == header_.cend()) {
+                    return;
+                }
+                // the column is never an idle state, even if the hardware sample isn't read from it
+                const auto index = static_cast<std::size_t>(it - header_.cbegin());
+                named_[index] = true;
+
+                std::optional<typename metric_type::value_type> &column = samples.*metric.member;
+                if (!select(metric.turbostat_name, metric.category) || (!column.has_value() && !config.has_value())) {
+                    return;
+                }
+                if (!column.has_value()) {
+                    column.emplace(config.value());
+                }
+                this->insert(entry{ index, metric.category, &column.value(), &push_back_converted<typename metric_type::value_type> });
+            }
+        });
+    }
+
+    /**
+     * @brief Add all columns of the header that aren't read by any hardware sample and whose name denotes an idle state, e.g., "C1E%" or "Pkg%pc6".
+     * @details Must be called after all `add_columns` calls. The regular expression is only evaluated here and not for every row.
+     * @tparam Map the type of the idle state map
+     * @param[in,out] idle_states the idle state map
+     * @param[in] config if present, creates the map and its entries with this configuration, otherwise only adds the already present entries
+     */
+    template <typename Map>
+    void add_idle_state_columns(std::optional<Map> &idle_states, const std::optional<sample_column_config> &config) {
+        for (std::size_t i = 0; i < header_.size(); ++i) {
+            if (named_[i] || !is_idle_state_column(header_[i])) {
+                continue;
+            }
+            if (!idle_states.has_value()) {
+                if (!config.has_value()) {
+                    return;
+                }
+                idle_states.emplace();
+            }
+            auto it = idle_states->find(header_[i]);
+            if (it == idle_states->end()) {
+                if (!config.has_value()) {
+                    continue;
+                }
+                it = idle_states->emplace(header_[i], typename Map::mapped_type{ config.value() }).first;
+            }
+            // references to the values of a std::map or std::unordered_map are stable
+            this->insert(entry{ i, sample_category::idle_state, &it->second, &push_back_converted<typename Map::mapped_type> });
+        }
+    }
+
+    /**
+     * @brief Check whether the turbostat column @p name denotes an idle state.
+     * @param[in] name the name of the turbostat column
+     * @return `true` if @p name denotes an idle state, otherwise `false` (`[[nodiscard]]`)
+     */
+    [[nodiscard]] static bool is_idle_state_column(const std::string &name);
+
+    /**
+     * @brief Convert the cells of the tab-separated @p row and append them to their respective hardware samples.
+     * @details Cells of hardware samples whose sample category isn't part of @p categories are skipped.
+     * @param[in] row the turbostat row
+     * @param[in] categories the sample categories to read
+     * @throws std::runtime_error if a cell couldn't be converted
+     */
+    void read_row(std::string_view row, sample_category categories) const;
+
+    /**
+     * @brief Return the header the table has been created for.
+     * @return the names of the turbostat columns (`[[nodiscard]]`)
+     */
+    [[nodiscard]] const std::vector<std::string> &header() const noexcept { return header_; }
+
+    /**
+     * @brief Return the number of columns read from each row.
+     * @return the number of columns (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::size_t num_columns() const noexcept { return entries_.size(); }
+
+  private:
+    /**
+     * @brief A single turbostat column and the hardware sample it is stored in.
+     */
+    struct entry {
+        /// The index of the cell in the turbostat rows.
+        std::size_t index;
+        /// The sample category of the hardware sample.
+        sample_category category;
+        /// The hardware sample, i.e., a hws::sample_column.
+        void *column;
+        /// Convert the cell and append it to the hardware sample.
+        void (*push_back)(void *column, std::string_view cell);
+    };
+
+    /**
+     * @brief Convert the @p cell and append it to the @p column.
+     * @tparam Column the type of the hws::sample_column
+     * @param[in,out] column the hardware sample
+     * @param[in] cell the turbostat cell
+     */
+    template <typename Column>
+    static void push_back_converted(void *column, const std::string_view cell) {
+        static_cast<Column *>(column)->push_back(detail::convert_to<typename Column::value_type>(cell));
+    }
+
+    /**
+     * @brief Insert the @p new_entry keeping the entries sorted by their cell index.
+     * @param[in] new_entry the entry to insert
+     */
+    void insert(const entry &new_entry);
+
+    /// The names of the turbostat columns.
+    std::vector<std::string> header_;
+    /// `true` for every column that is read by a hardware sample of any sample class, even if it isn't selected.
+    std::vector<bool> named_;
+    /// The columns read from each row, sorted by their cell index.
+    std::vector<entry> entries_{};
+};
+
+}  // namespace hws::detail
+
+#endif  // HWS_CPU_TURBOSTAT_COLUMNS_HPP_
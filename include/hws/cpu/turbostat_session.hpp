@@ -0,0 +1,129 @@
+/**
+ * @file
+ * @author Marcel Breyer
+ * @copyright 2024-today All Rights Reserved
+ * @license This file is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Defines a long-lived turbostat child process whose output is parsed incrementally.
+ */
+
+#ifndef HWS_CPU_TURBOSTAT_SESSION_HPP_
+#define HWS_CPU_TURBOSTAT_SESSION_HPP_
+#pragma once
+
+#include <sys/types.h>  // pid_t
+
+#include <array>        // std::array
+#include <cstddef>      // std::size_t
+#include <string>       // std::string
+#include <string_view>  // std::string_view
+#include <vector>       // std::vector
+
+namespace hws::detail {
+
+/**
+ * @brief A long-lived turbostat child process, e.g., `turbostat -i 0.1 -S -q`, printing one row per measurement interval.
+ * @details The stdout and stderr of the child are redirected to a non-blocking pipe. `poll()` reads everything available without
+ *          blocking and feeds it to a line-buffered parser: a tab-separated line starting with a letter is the header, a tab-separated
+ *          line with as many cells as the header is a row, all other lines (e.g., warnings on stderr) are ignored. Only the latest
+ *          complete row is kept. After a short warm-up, reading and parsing doesn't allocate memory.
+ */
+class turbostat_session {
+  public:
+    /**
+     * @brief Spawn the child process @p cmd_line (searched in the `PATH`).
+     * @param[in] cmd_line the command line arguments, e.g., `{ "turbostat", "-i", "0.1", "-S", "-q" }`
+     * @throws std::invalid_argument if @p cmd_line is empty
+     * @throws std::runtime_error if the child process couldn't be spawned
+     */
+    explicit turbostat_session(const std::vector<std::string> &cmd_line);
+
+    /**
+     * @brief Delete the copy-constructor since the session owns the child process.
+     */
+    turbostat_session(const turbostat_session &) = delete;
+    /**
+     * @brief Delete the move-constructor since the session owns the child process.
+     */
+    turbostat_session(turbostat_session &&) noexcept = delete;
+    /**
+     * @brief Delete the copy-assignment operator since the session owns the child process.
+     */
+    turbostat_session &operator=(const turbostat_session &) = delete;
+    /**
+     * @brief Delete the move-assignment operator since the session owns the child process.
+     */
+    turbostat_session &operator=(turbostat_session &&) noexcept = delete;
+
+    /**
+     * @brief Stop the child process and wait for it.
+     * @details Closes the pipe and sends `SIGTERM`. If the signal can't be delivered (e.g., the child runs via sudo), the child
+     *          terminates due to `SIGPIPE` the next time it prints a row, i.e., after at most one measurement interval.
+     */
+    ~turbostat_session();
+
+    /**
+     * @brief Read and parse all output of the child process that is currently available without blocking.
+     * @throws std::runtime_error if the pipe couldn't be read or the child process has exited
+     * @return `true` if at least one new row has been parsed, otherwise `false`
+     */
+    bool poll();
+    /**
+     * @brief Parse the @p output as if it has been printed by the child process.
+     * @details Used to seed the session with the output of a single turbostat invocation until the first row has been printed.
+     * @param[in] output the output to parse
+     * @return `true` if at least one new row has been parsed, otherwise `false`
+     */
+    bool parse(std::string_view output);
+
+    /**
+     * @brief Return the header cells, i.e., the names of the turbostat columns.
+     * @return the header cells; empty if no header has been parsed yet (`[[nodiscard]]`)
+     */
+    [[nodiscard]] const std::vector<std::string> &header() const noexcept { return header_; }
+    /**
+     * @brief Return the latest complete row (tab-separated).
+     * @return the row; empty if no row has been parsed yet (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::string_view latest_row() const noexcept { return latest_row_; }
+    /**
+     * @brief Return the number of rows parsed so far.
+     * @return the number of rows (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::size_t num_rows() const noexcept { return num_rows_; }
+    /**
+     * @brief Return the number of headers parsed so far, e.g., to detect that the columns have changed.
+     * @return the number of headers (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::size_t num_headers() const noexcept { return num_headers_; }
+
+  private:
+    /**
+     * @brief Parse the complete @p line (without the trailing newline).
+     * @param[in] line the line to parse
+     * @return `true` if @p line is a new row, otherwise `false`
+     */
+    bool parse_line(std::string_view line);
+
+    /// The process ID of the child process.
+    pid_t pid_{ -1 };
+    /// The read end of the pipe connected to the stdout and stderr of the child process.
+    int fd_{ -1 };
+    /// The buffer the pipe is read into.
+    std::array<char, 4096> read_buffer_{};
+    /// The incomplete line at the end of the output read so far.
+    std::string pending_line_{};
+    /// The header cells.
+    std::vector<std::string> header_{};
+    /// The latest complete row.
+    std::string latest_row_{};
+    /// The number of rows parsed so far.
+    std::size_t num_rows_{ 0 };
+    /// The number of headers parsed so far.
+    std::size_t num_headers_{ 0 };
+};
+
+}  // namespace hws::detail
+
+#endif  // HWS_CPU_TURBOSTAT_SESSION_HPP_
@@ -0,0 +1,101 @@
+/**
+ * @file
+ * @author Marcel Breyer
+ * @copyright 2024-today All Rights Reserved
+ * @license This file is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Defines a region type whose energy consumption is measured using cumulative energy counter snapshots and online aggregates of the samples.
+ */
+
+#ifndef HWS_ENERGY_REGION_HPP_
+#define HWS_ENERGY_REGION_HPP_
+#pragma once
+
+#include "fmt/ostream.h"  // fmt::formatter, fmt::ostream_formatter
+
+#include <chrono>    // std::chrono::{steady_clock::time_point, nanoseconds}
+#include <cstddef>   // std::size_t
+#include <iosfwd>    // std::ostream forward declaration
+#include <optional>  // std::optional
+#include <string>    // std::string
+
+namespace hws {
+
+/**
+ * @brief A struct encapsulating a single region delimited by `hardware_sampler::begin_region` and `hardware_sampler::end_region`.
+ * @details Only the time and the cumulative energy counter of the device are read at the begin and end of the region.
+ *          Additionally, the samples retrieved by the sampling std::thread while the region is open are aggregated online.
+ */
+struct energy_region {
+    /**
+     * @brief Check whether the region has already been ended.
+     * @return `true` if the region has been ended, `false` otherwise (`[[nodiscard]]`)
+     */
+    [[nodiscard]] bool finished() const noexcept { return end_time_point.has_value(); }
+
+    /**
+     * @brief Return the duration of the region.
+     * @return the duration, zero if the region hasn't been ended yet (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::chrono::nanoseconds duration() const noexcept;
+    /**
+     * @brief Return the energy consumed during the region in J.
+     * @details If the device doesn't provide an energy counter, the energy is approximated using the mean power draw of the samples.
+     * @return the energy, `std::nullopt` if the region hasn't been ended yet or neither an energy counter nor power samples are available (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::optional<double> energy() const noexcept;
+    /**
+     * @brief Return the average power draw during the region in W.
+     * @return the average power, `std::nullopt` if the energy isn't available or the region has no duration (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::optional<double> average_power() const noexcept;
+    /**
+     * @brief Return the mean power draw of the power samples retrieved during the region in W.
+     * @return the mean power, `std::nullopt` if no power sample has been retrieved during the region (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::optional<double> mean_power() const noexcept;
+
+    /// The name of this region.
+    std::string name;
+    /// The time point this region began at.
+    std::chrono::steady_clock::time_point begin_time_point{};
+    /// The time point this region ended at, `std::nullopt` if the region is still open.
+    std::optional<std::chrono::steady_clock::time_point> end_time_point{};
+    /// The cumulative energy counter of the device when the region began (in J).
+    std::optional<double> begin_energy{};
+    /// The cumulative energy counter of the device when the region ended (in J).
+    std::optional<double> end_energy{};
+    /// The number of regions that were still open when this region began, i.e., `0` for an outermost region.
+    std::size_t depth{ 0 };
+
+    /// The number of ticks of the sampling loop during the region.
+    std::size_t num_samples{ 0 };
+    /// The number of power samples retrieved during the region.
+    std::size_t num_power_samples{ 0 };
+    /// The sum of all power samples retrieved during the region (in W).
+    double total_power{ 0.0 };
+    /// The maximum power draw during the region (in W).
+    std::optional<double> max_power{};
+    /// The maximum temperature during the region (in °C).
+    std::optional<double> max_temperature{};
+};
+
+/**
+ * @brief Output the energy region @p region to the given output-stream @p out.
+ * @param[in,out] out the output-stream to write the energy region to
+ * @param[in] region the energy region
+ * @return the output-stream
+ */
+std::ostream &operator<<(std::ostream &out, const energy_region &region);
+
+}  // namespace hws
+
+/// @cond Doxygen_suppress
+
+template <>
+struct fmt::formatter<hws::energy_region> : fmt::ostream_formatter { };
+
+/// @endcond
+
+#endif  // HWS_ENERGY_REGION_HPP_
@@ -0,0 +1,89 @@
+/**
+ * @file
+ * @author Marcel Breyer
+ * @copyright 2024-today All Rights Reserved
+ * @license This file is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Defines a multi-producer single-consumer queue used to record events from multiple threads concurrently.
+ */
+
+#ifndef HWS_EVENT_QUEUE_HPP_
+#define HWS_EVENT_QUEUE_HPP_
+#pragma once
+
+#include "hws/event.hpp"  // hws::event
+
+#include <atomic>  // std::atomic
+#include <vector>  // std::vector
+
+namespace hws::detail {
+
+/**
+ * @brief An unbounded multi-producer single-consumer queue of events.
+ * @details Pushing an event is lock-free but not wait-free: each push allocates a new node (which may block in the memory allocator),
+ *          afterward a producer only atomically exchanges the head of the queue and never waits for other producers.
+ *          Only a single consumer at a time may drain the queue, i.e., the consumer side must be synchronized externally.
+ */
+class event_queue {
+  public:
+    /**
+     * @brief Construct an empty event queue.
+     */
+    event_queue();
+
+    /**
+     * @brief Delete the copy-constructor.
+     */
+    event_queue(const event_queue &) = delete;
+    /**
+     * @brief Delete the move-constructor.
+     */
+    event_queue(event_queue &&) noexcept = delete;
+    /**
+     * @brief Delete the copy-assignment operator.
+     */
+    event_queue &operator=(const event_queue &) = delete;
+    /**
+     * @brief Delete the move-assignment operator.
+     */
+    event_queue &operator=(event_queue &&) noexcept = delete;
+
+    /**
+     * @brief Destroy the event queue and all events that haven't been drained yet.
+     */
+    ~event_queue();
+
+    /**
+     * @brief Push the event @p e to the queue. May be called from any number of threads concurrently.
+     * @param[in] e the event
+     */
+    void push(event e);
+
+    /**
+     * @brief Move all events pushed so far, in the order they have been pushed, to the end of @p events.
+     * @details Must only be called by a single consumer at a time.
+     * @param[in,out] events the vector to append the events to
+     */
+    void drain(std::vector<event> &events);
+
+  private:
+    /**
+     * @brief A node of the intrusive linked list representing the queue.
+     */
+    struct node {
+        /// The event stored in this node (moved-from if this node is the current stub node).
+        event e;
+        /// The next node in the queue.
+        std::atomic<node *> next{ nullptr };
+    };
+
+    /// The most recently pushed node. Modified by the producers.
+    std::atomic<node *> head_;
+    /// The stub node preceding the oldest not yet drained node. Only modified by the consumer.
+    node *tail_;
+};
+
+}  // namespace hws::detail
+
+#endif  // HWS_EVENT_QUEUE_HPP_
@@ -18,11 +18,14 @@
 
 #include "fmt/ostream.h"  // fmt::formatter, fmt::ostream_formatter
 
-#include <atomic>   // std::atomic
-#include <chrono>   // std::chrono::milliseconds, std::chrono_literals namespace
-#include <cstddef>  // std::size_t
-#include <cstdint>  // std::uint32_t
-#include <iosfwd>   // std::ostream forward declaration
+#include <atomic>    // std::atomic
+#include <chrono>    // std::chrono::nanoseconds, std::chrono_literals namespace
+#include <cstddef>   // std::size_t
+#include <cstdint>   // std::uint32_t
+#include <iosfwd>    // std::ostream forward declaration
+#include <optional>  // std::optional
+#include <string>    // std::string
+#include <vector>    // std::vector
 
 namespace hws {
 
@@ -53,7 +56,7 @@ class gpu_amd_hardware_sampler : public hardware_sampler {
      * @param[in] sampling_interval the used sampling interval
      * @param[in] category the sample categories that are enabled for hardware sampling (default: all)
      */
-    explicit gpu_amd_hardware_sampler(std::chrono::milliseconds sampling_interval, sample_category category = sample_category::all);
+    explicit gpu_amd_hardware_sampler(std::chrono::nanoseconds sampling_interval, sample_category category = sample_category::all);
     /**
      * @brief Construct a new AMD GPU hardware sampler for device @p device_id with the @p sampling_interval.
      * @details If this is the first AMD GPU sampler, initializes the ROCm SMI environment.
@@ -61,7 +64,7 @@ class gpu_amd_hardware_sampler : public hardware_sampler {
      * @param[in] sampling_interval the used sampling interval
      * @param[in] category the sample categories that are enabled for hardware sampling (default: all)
      */
-    gpu_amd_hardware_sampler(std::size_t device_id, std::chrono::milliseconds sampling_interval, sample_category category = sample_category::all);
+    gpu_amd_hardware_sampler(std::size_t device_id, std::chrono::nanoseconds sampling_interval, sample_category category = sample_category::all);
 
     /**
      * @brief Delete the copy-constructor (already implicitly deleted due to the base class's std::atomic member).
@@ -128,9 +131,33 @@ class gpu_amd_hardware_sampler : public hardware_sampler {
 
   private:
     /**
-     * @copydoc hws::hardware_sampler::sampling_loop
+     * @copydoc hws::hardware_sampler::initialize_samples
      */
-    void sampling_loop() final;
+    void initialize_samples() final;
+    /**
+     * @copydoc hws::hardware_sampler::sample
+     */
+    void sample() final;
+    /**
+     * @copydoc hws::hardware_sampler::read_energy_counter
+     */
+    [[nodiscard]] std::optional<double> read_energy_counter() final;
+    /**
+     * @copydoc hws::hardware_sampler::latest_power_usage
+     */
+    [[nodiscard]] std::optional<double> latest_power_usage() const final;
+    /**
+     * @copydoc hws::hardware_sampler::latest_temperature
+     */
+    [[nodiscard]] std::optional<double> latest_temperature() const final;
+    /**
+     * @copydoc hws::hardware_sampler::numeric_sample_names
+     */
+    [[nodiscard]] std::vector<std::string> numeric_sample_names() const final;
+    /**
+     * @copydoc hws::hardware_sampler::latest_numeric_sample_values
+     */
+    void latest_numeric_sample_values(sample_category sampled, std::vector<double> &values) const final;
 
     /// The ID of the device to sample.
     std::uint32_t device_id_{};
@@ -146,6 +173,9 @@ class gpu_amd_hardware_sampler : public hardware_sampler {
     /// The temperature related AMD GPU samples.
     rocm_smi_temperature_samples temperature_samples_{};
 
+    /// The total energy consumption at the start of the sampling (in J). Used as offset for all subsequent samples.
+    double initial_total_power_consumption_{};
+
     /// The total number of currently active AMD GPU hardware samplers.
     inline static std::atomic<int> instances_{ 0 };
     /// True if the ROCm SMI environment has been successfully initialized (only done by a single hardware sampler).
@@ -12,7 +12,9 @@
 #define HWS_GPU_AMD_ROCM_SMI_SAMPLES_HPP_
 #pragma once
 
-#include "hws/utility.hpp"  // HWS_SAMPLE_STRUCT_FIXED_MEMBER, HWS_SAMPLE_STRUCT_SAMPLING_MEMBER
+#include "hws/sample_category.hpp"  // hws::sample_category
+#include "hws/sample_metric.hpp"    // hws::sample_metric, hws::sample_metric_layout, hws::make_sample_metric_table
+#include "hws/utility.hpp"          // HWS_SAMPLE_STRUCT_FIXED_MEMBER, HWS_SAMPLE_STRUCT_SAMPLING_MEMBER
 
 #include "fmt/ostream.h"  // fmt::formatter, fmt::ostream_formatter
 
@@ -48,15 +50,30 @@ class rocm_smi_general_samples {
      * @return the YAML string (`[[nodiscard]]`)
      */
     [[nodiscard]] std::string generate_yaml_string() const;
-
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(std::string, architecture)  // the architecture name of the device
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(std::string, byte_order)    // the byte order (e.g., little/big endian)
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(std::string, vendor_id)     // the vendor ID
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(std::string, name)          // the name of the device
-
-    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(std::uint32_t, compute_utilization)  // the GPU compute utilization in percent
-    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(std::uint32_t, memory_utilization)   // the GPU memory utilization in percent
-    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(std::string, performance_level)      // the performance level: one of rsmi_dev_perf_level_t
+    /**
+     * @brief Return the compile-time descriptors of all general hardware samples in the order of the output.
+     * @details Used to generate `has_samples()`, `generate_yaml_string()`, the output-stream operator, the sample selection, and the Python bindings.
+     * @return the hardware sample descriptors (`[[nodiscard]]`)
+     */
+    [[nodiscard]] static constexpr auto metrics() noexcept {
+        return make_sample_metric_table(sample_category::general,
+                                        sample_metric{ "architecture", &rocm_smi_general_samples::architecture_, "string", "the architecture name of the device" },
+                                        sample_metric{ "byte_order", &rocm_smi_general_samples::byte_order_, "string", "the byte order (e.g., little/big endian)" },
+                                        sample_metric{ "vendor_id", &rocm_smi_general_samples::vendor_id_, "string", "the vendor ID" },
+                                        sample_metric{ "name", &rocm_smi_general_samples::name_, "string", "the name of the device" },
+                                        sample_metric{ "compute_utilization", &rocm_smi_general_samples::compute_utilization_, "%", "the GPU compute utilization in percent" },
+                                        sample_metric{ "memory_utilization", &rocm_smi_general_samples::memory_utilization_, "%", "the GPU memory utilization in percent" },
+                                        sample_metric{ "performance_level", &rocm_smi_general_samples::performance_level_, "string", "the performance level: one of rsmi_dev_perf_level_t" }.with_yaml_name("performance_state"));
+    }
+
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(std::string, architecture)
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(std::string, byte_order)
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(std::string, vendor_id)
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(std::string, name)
+
+    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(std::uint32_t, compute_utilization)
+    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(std::uint32_t, memory_utilization)
+    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(std::string, performance_level)
 };
 
 /**
@@ -92,21 +109,42 @@ class rocm_smi_clock_samples {
      * @return the YAML string (`[[nodiscard]]`)
      */
     [[nodiscard]] std::string generate_yaml_string() const;
-
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(double, clock_frequency_min)                              // the minimum possible system clock frequency in MHz
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(double, clock_frequency_max)                              // the maximum possible system clock frequency in MHz
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(double, memory_clock_frequency_min)                       // the minimum possible memory clock frequency in MHz
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(double, memory_clock_frequency_max)                       // the maximum possible memory clock frequency in MHz
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(double, socket_clock_frequency_min)                       // the minimum possible socket clock frequency in MHz
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(double, socket_clock_frequency_max)                       // the maximum possible socket clock frequency in MHz
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(std::vector<double>, available_clock_frequencies)         // the available clock frequencies in MHz (slowest to fastest)
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(std::vector<double>, available_memory_clock_frequencies)  // the available memory clock frequencies in MHz (slowest to fastest)
-
-    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(double, clock_frequency)                // the current system clock frequency in MHz
-    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(double, memory_clock_frequency)         // the current memory clock frequency in MHz
-    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(double, socket_clock_frequency)         // the current socket clock frequency in MHz
-    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(std::uint32_t, overdrive_level)         // the GPU overdrive percentage
-    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(std::uint32_t, memory_overdrive_level)  // the GPU memory overdrive percentage
+    /**
+     * @brief Return the compile-time descriptors of all clock related hardware samples in the order of the output.
+     * @details Used to generate `has_samples()`, `generate_yaml_string()`, the output-stream operator, the sample selection, and the Python bindings.
+     * @return the hardware sample descriptors (`[[nodiscard]]`)
+     */
+    [[nodiscard]] static constexpr auto metrics() noexcept {
+        return make_sample_metric_table(sample_category::clock,
+                                        sample_metric{ "clock_frequency_min", &rocm_smi_clock_samples::clock_frequency_min_, "MHz", "the minimum possible system clock frequency in MHz" },
+                                        sample_metric{ "clock_frequency_max", &rocm_smi_clock_samples::clock_frequency_max_, "MHz", "the maximum possible system clock frequency in MHz" },
+                                        sample_metric{ "memory_clock_frequency_min", &rocm_smi_clock_samples::memory_clock_frequency_min_, "MHz", "the minimum possible memory clock frequency in MHz" },
+                                        sample_metric{ "memory_clock_frequency_max", &rocm_smi_clock_samples::memory_clock_frequency_max_, "MHz", "the maximum possible memory clock frequency in MHz" },
+                                        sample_metric{ "socket_clock_frequency_min", &rocm_smi_clock_samples::socket_clock_frequency_min_, "MHz", "the minimum possible socket clock frequency in MHz" },
+                                        sample_metric{ "socket_clock_frequency_max", &rocm_smi_clock_samples::socket_clock_frequency_max_, "MHz", "the maximum possible socket clock frequency in MHz" },
+                                        sample_metric{ "available_clock_frequencies", &rocm_smi_clock_samples::available_clock_frequencies_, "MHz", "the available clock frequencies in MHz (slowest to fastest)" },
+                                        sample_metric{ "available_memory_clock_frequencies", &rocm_smi_clock_samples::available_memory_clock_frequencies_, "MHz", "the available memory clock frequencies in MHz (slowest to fastest)" },
+                                        sample_metric{ "clock_frequency", &rocm_smi_clock_samples::clock_frequency_, "MHz", "the current system clock frequency in MHz" },
+                                        sample_metric{ "memory_clock_frequency", &rocm_smi_clock_samples::memory_clock_frequency_, "MHz", "the current memory clock frequency in MHz" },
+                                        sample_metric{ "socket_clock_frequency", &rocm_smi_clock_samples::socket_clock_frequency_, "MHz", "the current socket clock frequency in MHz" },
+                                        sample_metric{ "overdrive_level", &rocm_smi_clock_samples::overdrive_level_, "%", "the GPU overdrive percentage" },
+                                        sample_metric{ "memory_overdrive_level", &rocm_smi_clock_samples::memory_overdrive_level_, "%", "the GPU memory overdrive percentage" });
+    }
+
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(double, clock_frequency_min)
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(double, clock_frequency_max)
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(double, memory_clock_frequency_min)
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(double, memory_clock_frequency_max)
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(double, socket_clock_frequency_min)
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(double, socket_clock_frequency_max)
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(std::vector<double>, available_clock_frequencies)
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(std::vector<double>, available_memory_clock_frequencies)
+
+    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(double, clock_frequency)
+    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(double, memory_clock_frequency)
+    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(double, socket_clock_frequency)
+    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(std::uint32_t, overdrive_level)
+    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(std::uint32_t, memory_overdrive_level)
 };
 
 /**
@@ -142,15 +180,30 @@ class rocm_smi_power_samples {
      * @return the YAML string (`[[nodiscard]]`)
      */
     [[nodiscard]] std::string generate_yaml_string() const;
-
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(double, power_management_limit)                      // the default power cap (W), may be different from power cap
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(double, power_enforced_limit)                        // if the GPU draws more power (W) than the power cap, the GPU may throttle
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(std::string, power_measurement_type)                 // the type of the power readings: either current power draw or average power draw
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(std::vector<std::string>, available_power_profiles)  // a list of the available power profiles
-
-    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(double, power_usage)                     // the current GPU socket power draw in W
-    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(double, power_total_energy_consumption)  // the total power consumption since the last driver reload in J
-    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(std::string, power_profile)              // the current active power profile; one of 'available_power_profiles'
+    /**
+     * @brief Return the compile-time descriptors of all power related hardware samples in the order of the output.
+     * @details Used to generate `has_samples()`, `generate_yaml_string()`, the output-stream operator, the sample selection, and the Python bindings.
+     * @return the hardware sample descriptors (`[[nodiscard]]`)
+     */
+    [[nodiscard]] static constexpr auto metrics() noexcept {
+        return make_sample_metric_table(sample_category::power,
+                                        sample_metric{ "power_management_limit", &rocm_smi_power_samples::power_management_limit_, "W", "the default power cap (W), may be different from power cap" },
+                                        sample_metric{ "power_enforced_limit", &rocm_smi_power_samples::power_enforced_limit_, "W", "if the GPU draws more power (W) than the power cap, the GPU may throttle" },
+                                        sample_metric{ "power_measurement_type", &rocm_smi_power_samples::power_measurement_type_, "string", "the type of the power readings: either current power draw or average power draw" },
+                                        sample_metric{ "available_power_profiles", &rocm_smi_power_samples::available_power_profiles_, "string", "a list of the available power profiles" },
+                                        sample_metric{ "power_usage", &rocm_smi_power_samples::power_usage_, "W", "the current GPU socket power draw in W" },
+                                        sample_metric{ "power_total_energy_consumption", &rocm_smi_power_samples::power_total_energy_consumption_, "J", "the total power consumption since the last driver reload in J" }.with_yaml_name("power_total_energy_consumed").derived_from("power_usage"),
+                                        sample_metric{ "power_profile", &rocm_smi_power_samples::power_profile_, "string", "the current active power profile; one of 'available_power_profiles'" });
+    }
+
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(double, power_management_limit)
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(double, power_enforced_limit)
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(std::string, power_measurement_type)
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(std::vector<std::string>, available_power_profiles)
+
+    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(double, power_usage)
+    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(double, power_total_energy_consumption)
+    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(std::string, power_profile)
 };
 
 /**
@@ -186,18 +239,36 @@ class rocm_smi_memory_samples {
      * @return the YAML string (`[[nodiscard]]`)
      */
     [[nodiscard]] std::string generate_yaml_string() const;
-
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(std::uint64_t, memory_total)                 // the total available memory in Byte
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(std::uint64_t, visible_memory_total)         // the total visible available memory in Byte, may be smaller than the total memory
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(std::uint32_t, num_pcie_lanes_min)           // the minimum number of used PCIe lanes
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(std::uint32_t, num_pcie_lanes_max)           // the maximum number of used PCIe lanes
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(std::uint64_t, pcie_link_transfer_rate_min)  // the minimum PCIe link transfer rate in MT/s
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(std::uint64_t, pcie_link_transfer_rate_max)  // the maximum PCIe link transfer rate in MT/s
-
-    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(std::uint64_t, memory_used)              // the currently used memory in Byte
-    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(std::uint64_t, memory_free)              // the currently free memory in Byte
-    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(std::uint32_t, num_pcie_lanes)           // the number of currently used PCIe lanes
-    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(std::uint64_t, pcie_link_transfer_rate)  // the current PCIe transfer rate in MT/s
+    /**
+     * @brief Return the compile-time descriptors of all memory related hardware samples in the order of the output.
+     * @details Used to generate `has_samples()`, `generate_yaml_string()`, the output-stream operator, the sample selection, and the Python bindings.
+     * @return the hardware sample descriptors (`[[nodiscard]]`)
+     */
+    [[nodiscard]] static constexpr auto metrics() noexcept {
+        return make_sample_metric_table(sample_category::memory,
+                                        sample_metric{ "memory_total", &rocm_smi_memory_samples::memory_total_, "B", "the total available memory in Byte" },
+                                        sample_metric{ "visible_memory_total", &rocm_smi_memory_samples::visible_memory_total_, "B", "the total visible available memory in Byte, may be smaller than the total memory" },
+                                        sample_metric{ "num_pcie_lanes_min", &rocm_smi_memory_samples::num_pcie_lanes_min_, "int", "the minimum number of used PCIe lanes" },
+                                        sample_metric{ "num_pcie_lanes_max", &rocm_smi_memory_samples::num_pcie_lanes_max_, "int", "the maximum number of used PCIe lanes" },
+                                        sample_metric{ "pcie_link_transfer_rate_min", &rocm_smi_memory_samples::pcie_link_transfer_rate_min_, "MT/s", "the minimum PCIe link transfer rate in MT/s" },
+                                        sample_metric{ "pcie_link_transfer_rate_max", &rocm_smi_memory_samples::pcie_link_transfer_rate_max_, "MT/s", "the maximum PCIe link transfer rate in MT/s" },
+                                        sample_metric{ "memory_used", &rocm_smi_memory_samples::memory_used_, "B", "the currently used memory in Byte" },
+                                        sample_metric{ "memory_free", &rocm_smi_memory_samples::memory_free_, "B", "the currently free memory in Byte" },
+                                        sample_metric{ "num_pcie_lanes", &rocm_smi_memory_samples::num_pcie_lanes_, "int", "the number of currently used PCIe lanes" },
+                                        sample_metric{ "pcie_link_transfer_rate", &rocm_smi_memory_samples::pcie_link_transfer_rate_, "MT/s", "the current PCIe transfer rate in MT/s" });
+    }
+
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(std::uint64_t, memory_total)
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(std::uint64_t, visible_memory_total)
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(std::uint32_t, num_pcie_lanes_min)
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(std::uint32_t, num_pcie_lanes_max)
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(std::uint64_t, pcie_link_transfer_rate_min)
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(std::uint64_t, pcie_link_transfer_rate_max)
+
+    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(std::uint64_t, memory_used)
+    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(std::uint64_t, memory_free)
+    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(std::uint32_t, num_pcie_lanes)
+    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(std::uint64_t, pcie_link_transfer_rate)
 };
 
 /**
@@ -233,32 +304,64 @@ class rocm_smi_temperature_samples {
      * @return the YAML string (`[[nodiscard]]`)
      */
     [[nodiscard]] std::string generate_yaml_string() const;
-
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(std::uint32_t, num_fans)          // the number of fans (if any)
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(std::uint64_t, fan_speed_max)     // the maximum fan speed in RPM
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(double, temperature_min)          // the minimum temperature on the GPU's edge temperature sensor in °C
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(double, temperature_max)          // the maximum temperature on the GPU's edge temperature sensor in °C
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(double, memory_temperature_min)   // the minimum temperature on the GPU's memory temperature sensor in °C
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(double, memory_temperature_max)   // the maximum temperature on the GPU's memory temperature sensor in °C
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(double, hotspot_temperature_min)  // the minimum temperature on the GPU's hotspot temperature sensor in °C
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(double, hotspot_temperature_max)  // the maximum temperature on the GPU's hotspot temperature sensor in °C
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(double, hbm_0_temperature_min)    // the minimum temperature on the GPU's HBM0 temperature sensor in °C
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(double, hbm_0_temperature_max)    // the maximum temperature on the GPU's HBM0 temperature sensor in °C
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(double, hbm_1_temperature_min)    // the minimum temperature on the GPU's HBM1 temperature sensor in °C
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(double, hbm_1_temperature_max)    // the maximum temperature on the GPU's HBM1 temperature sensor in °C
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(double, hbm_2_temperature_min)    // the minimum temperature on the GPU's HBM2 temperature sensor in °C
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(double, hbm_2_temperature_max)    // the maximum temperature on the GPU's HBM2 temperature sensor in °C
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(double, hbm_3_temperature_min)    // the minimum temperature on the GPU's HBM3 temperature sensor in °C
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(double, hbm_3_temperature_max)    // the maximum temperature on the GPU's HBM3 temperature sensor in °C
-
-    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(double, fan_speed_percentage)  // the current fan speed in %
-    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(double, temperature)           // the current temperature on the GPU's edge temperature sensor in °C
-    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(double, hotspot_temperature)   // the current temperature on the GPU's hotspot temperature sensor in °C
-    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(double, memory_temperature)    // the current temperature on the GPU's memory temperature sensor in °C
-    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(double, hbm_0_temperature)     // the current temperature on the GPU's HBM0 temperature sensor in °C
-    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(double, hbm_1_temperature)     // the current temperature on the GPU's HBM1 temperature sensor in °C
-    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(double, hbm_2_temperature)     // the current temperature on the GPU's HBM2 temperature sensor in °C
-    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(double, hbm_3_temperature)     // the current temperature on the GPU's HBM3 temperature sensor in °C
+    /**
+     * @brief Return the compile-time descriptors of all temperature related hardware samples in the order of the output.
+     * @details Used to generate `has_samples()`, `generate_yaml_string()`, the output-stream operator, the sample selection, and the Python bindings.
+     * @return the hardware sample descriptors (`[[nodiscard]]`)
+     */
+    [[nodiscard]] static constexpr auto metrics() noexcept {
+        return make_sample_metric_table(sample_category::temperature,
+                                        sample_metric{ "num_fans", &rocm_smi_temperature_samples::num_fans_, "int", "the number of fans (if any)" },
+                                        sample_metric{ "fan_speed_max", &rocm_smi_temperature_samples::fan_speed_max_, "RPM", "the maximum fan speed in RPM" },
+                                        sample_metric{ "temperature_min", &rocm_smi_temperature_samples::temperature_min_, "°C", "the minimum temperature on the GPU's edge temperature sensor in °C" },
+                                        sample_metric{ "temperature_max", &rocm_smi_temperature_samples::temperature_max_, "°C", "the maximum temperature on the GPU's edge temperature sensor in °C" },
+                                        sample_metric{ "memory_temperature_min", &rocm_smi_temperature_samples::memory_temperature_min_, "°C", "the minimum temperature on the GPU's memory temperature sensor in °C" },
+                                        sample_metric{ "memory_temperature_max", &rocm_smi_temperature_samples::memory_temperature_max_, "°C", "the maximum temperature on the GPU's memory temperature sensor in °C" },
+                                        sample_metric{ "hotspot_temperature_min", &rocm_smi_temperature_samples::hotspot_temperature_min_, "°C", "the minimum temperature on the GPU's hotspot temperature sensor in °C" },
+                                        sample_metric{ "hotspot_temperature_max", &rocm_smi_temperature_samples::hotspot_temperature_max_, "°C", "the maximum temperature on the GPU's hotspot temperature sensor in °C" },
+                                        sample_metric{ "hbm_0_temperature_min", &rocm_smi_temperature_samples::hbm_0_temperature_min_, "°C", "the minimum temperature on the GPU's HBM0 temperature sensor in °C" },
+                                        sample_metric{ "hbm_0_temperature_max", &rocm_smi_temperature_samples::hbm_0_temperature_max_, "°C", "the maximum temperature on the GPU's HBM0 temperature sensor in °C" },
+                                        sample_metric{ "hbm_1_temperature_min", &rocm_smi_temperature_samples::hbm_1_temperature_min_, "°C", "the minimum temperature on the GPU's HBM1 temperature sensor in °C" },
+                                        sample_metric{ "hbm_1_temperature_max", &rocm_smi_temperature_samples::hbm_1_temperature_max_, "°C", "the maximum temperature on the GPU's HBM1 temperature sensor in °C" },
+                                        sample_metric{ "hbm_2_temperature_min", &rocm_smi_temperature_samples::hbm_2_temperature_min_, "°C", "the minimum temperature on the GPU's HBM2 temperature sensor in °C" },
+                                        sample_metric{ "hbm_2_temperature_max", &rocm_smi_temperature_samples::hbm_2_temperature_max_, "°C", "the maximum temperature on the GPU's HBM2 temperature sensor in °C" },
+                                        sample_metric{ "hbm_3_temperature_min", &rocm_smi_temperature_samples::hbm_3_temperature_min_, "°C", "the minimum temperature on the GPU's HBM3 temperature sensor in °C" },
+                                        sample_metric{ "hbm_3_temperature_max", &rocm_smi_temperature_samples::hbm_3_temperature_max_, "°C", "the maximum temperature on the GPU's HBM3 temperature sensor in °C" },
+                                        sample_metric{ "fan_speed_percentage", &rocm_smi_temperature_samples::fan_speed_percentage_, "%", "the current fan speed in %" },
+                                        sample_metric{ "temperature", &rocm_smi_temperature_samples::temperature_, "°C", "the current temperature on the GPU's edge temperature sensor in °C" },
+                                        sample_metric{ "memory_temperature", &rocm_smi_temperature_samples::memory_temperature_, "°C", "the current temperature on the GPU's memory temperature sensor in °C" },
+                                        sample_metric{ "hotspot_temperature", &rocm_smi_temperature_samples::hotspot_temperature_, "°C", "the current temperature on the GPU's hotspot temperature sensor in °C" },
+                                        sample_metric{ "hbm_0_temperature", &rocm_smi_temperature_samples::hbm_0_temperature_, "°C", "the current temperature on the GPU's HBM0 temperature sensor in °C" },
+                                        sample_metric{ "hbm_1_temperature", &rocm_smi_temperature_samples::hbm_1_temperature_, "°C", "the current temperature on the GPU's HBM1 temperature sensor in °C" },
+                                        sample_metric{ "hbm_2_temperature", &rocm_smi_temperature_samples::hbm_2_temperature_, "°C", "the current temperature on the GPU's HBM2 temperature sensor in °C" },
+                                        sample_metric{ "hbm_3_temperature", &rocm_smi_temperature_samples::hbm_3_temperature_, "°C", "the current temperature on the GPU's HBM3 temperature sensor in °C" });
+    }
+
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(std::uint32_t, num_fans)
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(std::uint64_t, fan_speed_max)
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(double, temperature_min)
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(double, temperature_max)
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(double, memory_temperature_min)
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(double, memory_temperature_max)
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(double, hotspot_temperature_min)
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(double, hotspot_temperature_max)
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(double, hbm_0_temperature_min)
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(double, hbm_0_temperature_max)
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(double, hbm_1_temperature_min)
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(double, hbm_1_temperature_max)
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(double, hbm_2_temperature_min)
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(double, hbm_2_temperature_max)
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(double, hbm_3_temperature_min)
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(double, hbm_3_temperature_max)
+
+    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(double, fan_speed_percentage)
+    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(double, temperature)
+    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(double, hotspot_temperature)
+    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(double, memory_temperature)
+    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(double, hbm_0_temperature)
+    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(double, hbm_1_temperature)
+    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(double, hbm_2_temperature)
+    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(double, hbm_3_temperature)
 };
 
 /**
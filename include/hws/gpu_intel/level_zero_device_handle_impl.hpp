@@ -15,12 +15,14 @@
 #include "hws/gpu_intel/level_zero_device_handle.hpp"  // hws::detail::level_zero_device_handle
 #include "hws/gpu_intel/utility.hpp"                   // HWS_LEVEL_ZERO_ERROR_CHECK
 
-#include "fmt/format.h"         // fmt::format
-#include "level_zero/ze_api.h"  // Level Zero runtime functions
+#include "fmt/format.h"          // fmt::format
+#include "level_zero/ze_api.h"   // Level Zero runtime functions
+#include "level_zero/zes_api.h"  // Level Zero sysman handles
 
 #include <cstddef>    // std::size_t
 #include <cstdint>    // std::uint32_t
 #include <memory>     // std::make_shared
+#include <mutex>      // std::once_flag
 #include <stdexcept>  // std::runtime_error
 #include <vector>     // std::vector
 
@@ -69,6 +71,24 @@ struct level_zero_device_handle::level_zero_device_handle_impl {
     ze_driver_handle_t driver{};
     /// The wrapped Level Zero device handle.
     ze_device_handle_t device{};
+
+    /// The Level Zero sysman frequency domain handles of the device.
+    std::vector<zes_freq_handle_t> frequency_handles{};
+    /// The Level Zero sysman power domain handles of the device.
+    std::vector<zes_pwr_handle_t> power_handles{};
+    /// The Level Zero sysman memory module handles of the device.
+    std::vector<zes_mem_handle_t> memory_handles{};
+    /// The Level Zero sysman fan handles of the device.
+    std::vector<zes_fan_handle_t> fan_handles{};
+    /// The Level Zero sysman power supply handles of the device.
+    std::vector<zes_psu_handle_t> psu_handles{};
+    /// The Level Zero sysman temperature sensor handles of the device.
+    std::vector<zes_temp_handle_t> temperature_handles{};
+
+    /// The Level Zero sysman power domain handle used to read the energy counter outside the sampling loop.
+    zes_pwr_handle_t energy_counter_handle{};
+    /// Ensures that the power domain handle used to read the energy counter is only enumerated once.
+    std::once_flag energy_counter_handle_once{};
 };
 
 inline level_zero_device_handle::level_zero_device_handle(const std::size_t device_id) :
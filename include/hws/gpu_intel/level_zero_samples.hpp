@@ -12,7 +12,10 @@
 #define HWS_GPU_INTEL_LEVEL_ZERO_SAMPLES_HPP_
 #pragma once
 
-#include "hws/utility.hpp"  // HWS_SAMPLE_STRUCT_FIXED_MEMBER, HWS_SAMPLE_STRUCT_SAMPLING_MEMBER
+#include "hws/sample_category.hpp"  // hws::sample_category
+#include "hws/sample_column.hpp"    // hws::sample_column
+#include "hws/sample_metric.hpp"    // hws::sample_metric, hws::sample_metric_layout, hws::make_sample_metric_table
+#include "hws/utility.hpp"          // HWS_SAMPLE_STRUCT_FIXED_MEMBER, HWS_SAMPLE_STRUCT_SAMPLING_MEMBER
 
 #include "fmt/ostream.h"  // fmt::formatter, fmt::ostream_formatter
 
@@ -49,14 +52,29 @@ class level_zero_general_samples {
      * @return the YAML string (`[[nodiscard]]`)
      */
     [[nodiscard]] std::string generate_yaml_string() const;
-
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(std::string, byte_order)            // the byte order (e.g., little/big endian)
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(std::string, vendor_id)             // the vendor ID
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(std::string, name)                  // the model name of the device
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(std::vector<std::string>, flags)    // potential GPU flags (e.g. integrated device)
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(std::string, standby_mode)          // the enabled standby mode (power saving or never)
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(std::uint32_t, num_threads_per_eu)  // the number of threads per EU unit
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(std::uint32_t, eu_simd_width)       // the physical EU unit SIMD width
+    /**
+     * @brief Return the compile-time descriptors of all general hardware samples in the order of the output.
+     * @details Used to generate `has_samples()`, `generate_yaml_string()`, the output-stream operator, the sample selection, and the Python bindings.
+     * @return the hardware sample descriptors (`[[nodiscard]]`)
+     */
+    [[nodiscard]] static constexpr auto metrics() noexcept {
+        return make_sample_metric_table(sample_category::general,
+                                        sample_metric{ "byte_order", &level_zero_general_samples::byte_order_, "string", "the byte order (e.g., little/big endian)" },
+                                        sample_metric{ "vendor_id", &level_zero_general_samples::vendor_id_, "string", "the vendor ID" },
+                                        sample_metric{ "name", &level_zero_general_samples::name_, "string", "the model name of the device" },
+                                        sample_metric{ "flags", &level_zero_general_samples::flags_, "string", "potential GPU flags (e.g. integrated device)" },
+                                        sample_metric{ "standby_mode", &level_zero_general_samples::standby_mode_, "string", "the enabled standby mode (power saving or never)" },
+                                        sample_metric{ "num_threads_per_eu", &level_zero_general_samples::num_threads_per_eu_, "int", "the number of threads per EU unit" },
+                                        sample_metric{ "eu_simd_width", &level_zero_general_samples::eu_simd_width_, "int", "the physical EU unit SIMD width" });
+    }
+
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(std::string, byte_order)
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(std::string, vendor_id)
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(std::string, name)
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(std::vector<std::string>, flags)
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(std::string, standby_mode)
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(std::uint32_t, num_threads_per_eu)
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(std::uint32_t, eu_simd_width)
 };
 
 /**
@@ -92,22 +110,44 @@ class level_zero_clock_samples {
      * @return the YAML string (`[[nodiscard]]`)
      */
     [[nodiscard]] std::string generate_yaml_string() const;
-
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(double, clock_frequency_min)                              // the minimum possible GPU clock frequency in MHz
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(double, clock_frequency_max)                              // the maximum possible GPU clock frequency in MHz
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(double, memory_clock_frequency_min)                       // the minimum possible memory clock frequency in MHz
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(double, memory_clock_frequency_max)                       // the maximum possible memory clock frequency in MHz
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(std::vector<double>, available_clock_frequencies)         // the available GPU clock frequencies in MHz (slowest to fastest)
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(std::vector<double>, available_memory_clock_frequencies)  // the available memory clock frequencies in MHz (slowest to fastest)
-
-    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(double, clock_frequency)                     // the current GPU frequency in MHz
-    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(double, memory_clock_frequency)              // the current memory frequency in MHz
-    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(std::int64_t, throttle_reason)               // the current GPU frequency throttle reason as bitmask
-    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(std::string, throttle_reason_string)         // the current GPU frequency throttle reason as string
-    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(std::int64_t, memory_throttle_reason)        // the current memory frequency throttle reason as bitmask
-    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(std::string, memory_throttle_reason_string)  // the current memory frequency throttle reason as string
-    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(double, frequency_limit_tdp)                 // the current maximum allowed GPU frequency based on the TDP limit in MHz
-    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(double, memory_frequency_limit_tdp)          // the current maximum allowed memory frequency based on the TDP limit in MHz
+    /**
+     * @brief Return the compile-time descriptors of all clock related hardware samples in the order of the output.
+     * @details Used to generate `has_samples()`, `generate_yaml_string()`, the output-stream operator, the sample selection, and the Python bindings.
+     * @return the hardware sample descriptors (`[[nodiscard]]`)
+     */
+    [[nodiscard]] static constexpr auto metrics() noexcept {
+        return make_sample_metric_table(sample_category::clock,
+                                        sample_metric{ "clock_frequency_min", &level_zero_clock_samples::clock_frequency_min_, "MHz", "the minimum possible GPU clock frequency in MHz" },
+                                        sample_metric{ "clock_frequency_max", &level_zero_clock_samples::clock_frequency_max_, "MHz", "the maximum possible GPU clock frequency in MHz" }.with_yaml_name("clock_gpu_max"),
+                                        sample_metric{ "memory_clock_frequency_min", &level_zero_clock_samples::memory_clock_frequency_min_, "MHz", "the minimum possible memory clock frequency in MHz" },
+                                        sample_metric{ "memory_clock_frequency_max", &level_zero_clock_samples::memory_clock_frequency_max_, "MHz", "the maximum possible memory clock frequency in MHz" },
+                                        sample_metric{ "available_clock_frequencies", &level_zero_clock_samples::available_clock_frequencies_, "MHz", "the available GPU clock frequencies in MHz (slowest to fastest)" },
+                                        sample_metric{ "available_memory_clock_frequencies", &level_zero_clock_samples::available_memory_clock_frequencies_, "MHz", "the available memory clock frequencies in MHz (slowest to fastest)" },
+                                        sample_metric{ "clock_frequency", &level_zero_clock_samples::clock_frequency_, "MHz", "the current GPU frequency in MHz" },
+                                        sample_metric{ "memory_clock_frequency", &level_zero_clock_samples::memory_clock_frequency_, "MHz", "the current memory frequency in MHz" },
+                                        sample_metric{ "throttle_reason", &level_zero_clock_samples::throttle_reason_, "bitmask", "the current GPU frequency throttle reason as bitmask" },
+                                        sample_metric{ "throttle_reason_string", &level_zero_clock_samples::throttle_reason_string_, "string", "the current GPU frequency throttle reason as string" },
+                                        sample_metric{ "memory_throttle_reason", &level_zero_clock_samples::memory_throttle_reason_, "bitmask", "the current memory frequency throttle reason as bitmask" },
+                                        sample_metric{ "memory_throttle_reason_string", &level_zero_clock_samples::memory_throttle_reason_string_, "string", "the current memory frequency throttle reason as string" },
+                                        sample_metric{ "frequency_limit_tdp", &level_zero_clock_samples::frequency_limit_tdp_, "MHz", "the current maximum allowed GPU frequency based on the TDP limit in MHz" },
+                                        sample_metric{ "memory_frequency_limit_tdp", &level_zero_clock_samples::memory_frequency_limit_tdp_, "MHz", "the current maximum allowed memory frequency based on the TDP limit in MHz" });
+    }
+
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(double, clock_frequency_min)
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(double, clock_frequency_max)
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(double, memory_clock_frequency_min)
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(double, memory_clock_frequency_max)
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(std::vector<double>, available_clock_frequencies)
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(std::vector<double>, available_memory_clock_frequencies)
+
+    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(double, clock_frequency)
+    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(double, memory_clock_frequency)
+    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(std::int64_t, throttle_reason)
+    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(std::string, throttle_reason_string)
+    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(std::int64_t, memory_throttle_reason)
+    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(std::string, memory_throttle_reason_string)
+    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(double, frequency_limit_tdp)
+    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(double, memory_frequency_limit_tdp)
 };
 
 /**
@@ -143,13 +183,26 @@ class level_zero_power_samples {
      * @return the YAML string (`[[nodiscard]]`)
      */
     [[nodiscard]] std::string generate_yaml_string() const;
-
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(double, power_enforced_limit)         // the actually enforced power limit (W), may be different from power management limit if external limiters are set
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(std::string, power_measurement_type)  // the type of the power readings
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(bool, power_management_mode)          // true if power management limits are enabled
-
-    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(double, power_usage)                     // the current power draw of the GPU in W (calculated from power_total_energy_consumption)
-    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(double, power_total_energy_consumption)  // the total power consumption since the last driver reload in J
+    /**
+     * @brief Return the compile-time descriptors of all power related hardware samples in the order of the output.
+     * @details Used to generate `has_samples()`, `generate_yaml_string()`, the output-stream operator, the sample selection, and the Python bindings.
+     * @return the hardware sample descriptors (`[[nodiscard]]`)
+     */
+    [[nodiscard]] static constexpr auto metrics() noexcept {
+        return make_sample_metric_table(sample_category::power,
+                                        sample_metric{ "power_enforced_limit", &level_zero_power_samples::power_enforced_limit_, "W", "the actually enforced power limit (W), may be different from power management limit if external limiters are set" },
+                                        sample_metric{ "power_measurement_type", &level_zero_power_samples::power_measurement_type_, "string", "the type of the power readings" },
+                                        sample_metric{ "power_management_mode", &level_zero_power_samples::power_management_mode_, "bool", "true if power management limits are enabled" },
+                                        sample_metric{ "power_usage", &level_zero_power_samples::power_usage_, "W", "the current power draw of the GPU in W (calculated from power_total_energy_consumption)" }.derived_from("power_total_energy_consumption"),
+                                        sample_metric{ "power_total_energy_consumption", &level_zero_power_samples::power_total_energy_consumption_, "J", "the total power consumption since the last driver reload in J" });
+    }
+
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(double, power_enforced_limit)
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(std::string, power_measurement_type)
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(bool, power_management_mode)
+
+    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(double, power_usage)
+    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(double, power_total_energy_consumption)
 };
 
 /**
@@ -192,21 +245,42 @@ class level_zero_memory_samples {
      * @return the YAML string (`[[nodiscard]]`)
      */
     [[nodiscard]] std::string generate_yaml_string() const;
-
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(map_type<std::uint64_t>, memory_total)          // the total memory size of the different memory modules in Bytes
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(map_type<std::uint64_t>, visible_memory_total)  // the total allocatable memory size of the different memory modules in Bytes
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(map_type<std::string>, memory_location)         // the location of the different memory modules (system or device)
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(std::int32_t, num_pcie_lanes_max)               // the maximum PCIe lane width
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(std::int32_t, pcie_link_generation_max)         // the maximum PCIe generation
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(std::int64_t, pcie_link_speed_max)              // the maximum PCIe bandwidth in MBPS
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(map_type<std::int32_t>, memory_bus_width)       // the bus width of the different memory modules
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(map_type<std::int32_t>, memory_num_channels)    // the number of memory channels of the different memory modules
-
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(map_type<std::vector<std::uint64_t>>, memory_free)  // the currently free memory of the different memory modules in Bytes
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(map_type<std::vector<std::uint64_t>>, memory_used)  // the currently used memory of the different memory modules in Bytes
-    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(std::int32_t, num_pcie_lanes)                    // the current PCIe lane width
-    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(std::int32_t, pcie_link_generation)              // the current PCIe generation
-    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(std::int64_t, pcie_link_speed)                   // the current PCIe bandwidth in bytes/sec
+    /**
+     * @brief Return the compile-time descriptors of all memory related hardware samples in the order of the output.
+     * @details Used to generate `has_samples()`, `generate_yaml_string()`, the output-stream operator, the sample selection, and the Python bindings.
+     * @return the hardware sample descriptors (`[[nodiscard]]`)
+     */
+    [[nodiscard]] static constexpr auto metrics() noexcept {
+        return make_sample_metric_table(sample_category::memory,
+                                        sample_metric{ "memory_total", &level_zero_memory_samples::memory_total_, "B", "the total memory size of the different memory modules in Bytes" }.with_layout(sample_metric_layout::per_key),
+                                        sample_metric{ "visible_memory_total", &level_zero_memory_samples::visible_memory_total_, "B", "the total allocatable memory size of the different memory modules in Bytes" }.with_layout(sample_metric_layout::per_key),
+                                        sample_metric{ "memory_location", &level_zero_memory_samples::memory_location_, "string", "the location of the different memory modules (system or device)" }.with_layout(sample_metric_layout::per_key),
+                                        sample_metric{ "num_pcie_lanes_max", &level_zero_memory_samples::num_pcie_lanes_max_, "int", "the maximum PCIe lane width" },
+                                        sample_metric{ "pcie_link_generation_max", &level_zero_memory_samples::pcie_link_generation_max_, "int", "the maximum PCIe generation" },
+                                        sample_metric{ "pcie_link_speed_max", &level_zero_memory_samples::pcie_link_speed_max_, "MBPS", "the maximum PCIe bandwidth in MBPS" },
+                                        sample_metric{ "memory_bus_width", &level_zero_memory_samples::memory_bus_width_, "Bit", "the bus width of the different memory modules" }.with_layout(sample_metric_layout::per_key),
+                                        sample_metric{ "memory_num_channels", &level_zero_memory_samples::memory_num_channels_, "int", "the number of memory channels of the different memory modules" }.with_layout(sample_metric_layout::per_key),
+                                        sample_metric{ "memory_free", &level_zero_memory_samples::memory_free_, "B", "the currently free memory of the different memory modules in Bytes" }.with_layout(sample_metric_layout::per_key),
+                                        sample_metric{ "memory_used", &level_zero_memory_samples::memory_used_, "B", "the currently used memory of the different memory modules in Bytes" }.with_layout(sample_metric_layout::per_key),
+                                        sample_metric{ "num_pcie_lanes", &level_zero_memory_samples::num_pcie_lanes_, "int", "the current PCIe lane width" },
+                                        sample_metric{ "pcie_link_generation", &level_zero_memory_samples::pcie_link_generation_, "int", "the current PCIe generation" },
+                                        sample_metric{ "pcie_link_speed", &level_zero_memory_samples::pcie_link_speed_, "MBPS", "the current PCIe bandwidth in bytes/sec" });
+    }
+
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(map_type<std::uint64_t>, memory_total)
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(map_type<std::uint64_t>, visible_memory_total)
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(map_type<std::string>, memory_location)
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(std::int32_t, num_pcie_lanes_max)
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(std::int32_t, pcie_link_generation_max)
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(std::int64_t, pcie_link_speed_max)
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(map_type<std::int32_t>, memory_bus_width)
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(map_type<std::int32_t>, memory_num_channels)
+
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(map_type<sample_column<std::uint64_t>>, memory_free)
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(map_type<sample_column<std::uint64_t>>, memory_used)
+    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(std::int32_t, num_pcie_lanes)
+    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(std::int32_t, pcie_link_generation)
+    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(std::int64_t, pcie_link_speed)
 };
 
 /**
@@ -242,18 +316,36 @@ class level_zero_temperature_samples {
      * @return the YAML string (`[[nodiscard]]`)
      */
     [[nodiscard]] std::string generate_yaml_string() const;
-
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(std::uint32_t, num_fans)         // the number of fans
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(std::int32_t, fan_speed_max)     // the maximum fan speed the user can set in RPM
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(double, temperature_max)         // the maximum GPU temperature in °C
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(double, memory_temperature_max)  // the maximum memory temperature in °C
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(double, global_temperature_max)  // the maximum global temperature in °C
-
-    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(double, fan_speed_percentage)  // the current intended fan speed in %
-    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(double, temperature)           // the temperature of the GPU in °C
-    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(double, memory_temperature)    // the temperature of the memory in °C
-    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(double, global_temperature)    // the global temperature in °C
-    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(double, psu_temperature)       // the temperature of the PSU in °C
+    /**
+     * @brief Return the compile-time descriptors of all temperature related hardware samples in the order of the output.
+     * @details Used to generate `has_samples()`, `generate_yaml_string()`, the output-stream operator, the sample selection, and the Python bindings.
+     * @return the hardware sample descriptors (`[[nodiscard]]`)
+     */
+    [[nodiscard]] static constexpr auto metrics() noexcept {
+        return make_sample_metric_table(sample_category::temperature,
+                                        sample_metric{ "num_fans", &level_zero_temperature_samples::num_fans_, "int", "the number of fans" },
+                                        sample_metric{ "fan_speed_max", &level_zero_temperature_samples::fan_speed_max_, "RPM", "the maximum fan speed the user can set in RPM" },
+                                        sample_metric{ "temperature_max", &level_zero_temperature_samples::temperature_max_, "°C", "the maximum GPU temperature in °C" },
+                                        sample_metric{ "memory_temperature_max", &level_zero_temperature_samples::memory_temperature_max_, "°C", "the maximum memory temperature in °C" },
+                                        sample_metric{ "global_temperature_max", &level_zero_temperature_samples::global_temperature_max_, "°C", "the maximum global temperature in °C" },
+                                        sample_metric{ "fan_speed_percentage", &level_zero_temperature_samples::fan_speed_percentage_, "%", "the current intended fan speed in %" },
+                                        sample_metric{ "temperature", &level_zero_temperature_samples::temperature_, "°C", "the temperature of the GPU in °C" },
+                                        sample_metric{ "memory_temperature", &level_zero_temperature_samples::memory_temperature_, "°C", "the temperature of the memory in °C" },
+                                        sample_metric{ "global_temperature", &level_zero_temperature_samples::global_temperature_, "°C", "the global temperature in °C" },
+                                        sample_metric{ "psu_temperature", &level_zero_temperature_samples::psu_temperature_, "°C", "the temperature of the PSU in °C" });
+    }
+
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(std::uint32_t, num_fans)
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(std::int32_t, fan_speed_max)
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(double, temperature_max)
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(double, memory_temperature_max)
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(double, global_temperature_max)
+
+    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(double, fan_speed_percentage)
+    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(double, temperature)
+    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(double, memory_temperature)
+    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(double, global_temperature)
+    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(double, psu_temperature)
 };
 
 /**
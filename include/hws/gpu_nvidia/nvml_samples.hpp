@@ -12,7 +12,9 @@
 #define HWS_GPU_NVIDIA_NVML_SAMPLES_HPP_
 #pragma once
 
-#include "hws/utility.hpp"  // HWS_SAMPLE_STRUCT_FIXED_MEMBER, HWS_SAMPLE_STRUCT_SAMPLING_MEMBER
+#include "hws/sample_category.hpp"  // hws::sample_category
+#include "hws/sample_metric.hpp"    // hws::sample_metric, hws::sample_metric_layout, hws::make_sample_metric_table
+#include "hws/utility.hpp"          // HWS_SAMPLE_STRUCT_FIXED_MEMBER, HWS_SAMPLE_STRUCT_SAMPLING_MEMBER
 
 #include "fmt/ostream.h"  // fmt::formatter, fmt::ostream_formatter
 
@@ -48,17 +50,34 @@ class nvml_general_samples {
      * @return the YAML string (`[[nodiscard]]`)
      */
     [[nodiscard]] std::string generate_yaml_string() const;
-
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(std::string, architecture)  // the architecture name of the device
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(std::string, byte_order)    // the byte order (e.g., little/big endian)
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(unsigned int, num_cores)    // the number of CUDA cores
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(std::string, vendor_id)     // the vendor ID
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(std::string, name)          // the name of the device
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(bool, persistence_mode)     // the persistence mode: if true, the driver is always loaded reducing the latency for the first API call
-
-    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(unsigned int, compute_utilization)  // the GPU compute utilization in percent
-    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(unsigned int, memory_utilization)   // the GPU memory utilization in percent
-    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(int, performance_level)             // the performance state: 0 - 15 where 0 is the maximum performance and 15 the minimum performance
+    /**
+     * @brief Return the compile-time descriptors of all general hardware samples in the order of the output.
+     * @details Used to generate `has_samples()`, `generate_yaml_string()`, the output-stream operator, the sample selection, and the Python bindings.
+     * @return the hardware sample descriptors (`[[nodiscard]]`)
+     */
+    [[nodiscard]] static constexpr auto metrics() noexcept {
+        return make_sample_metric_table(sample_category::general,
+                                        sample_metric{ "architecture", &nvml_general_samples::architecture_, "string", "the architecture name of the device" },
+                                        sample_metric{ "byte_order", &nvml_general_samples::byte_order_, "string", "the byte order (e.g., little/big endian)" },
+                                        sample_metric{ "vendor_id", &nvml_general_samples::vendor_id_, "string", "the vendor ID" },
+                                        sample_metric{ "name", &nvml_general_samples::name_, "string", "the name of the device" },
+                                        sample_metric{ "persistence_mode", &nvml_general_samples::persistence_mode_, "bool", "the persistence mode: if true, the driver is always loaded reducing the latency for the first API call" },
+                                        sample_metric{ "num_cores", &nvml_general_samples::num_cores_, "int", "the number of CUDA cores" },
+                                        sample_metric{ "compute_utilization", &nvml_general_samples::compute_utilization_, "%", "the GPU compute utilization in percent" },
+                                        sample_metric{ "memory_utilization", &nvml_general_samples::memory_utilization_, "%", "the GPU memory utilization in percent" },
+                                        sample_metric{ "performance_level", &nvml_general_samples::performance_level_, "int", "the performance state: 0 - 15 where 0 is the maximum performance and 15 the minimum performance" }.with_yaml_unit("0 - maximum performance; 15 - minimum performance; 32 - unknown"));
+    }
+
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(std::string, architecture)
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(std::string, byte_order)
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(unsigned int, num_cores)
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(std::string, vendor_id)
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(std::string, name)
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(bool, persistence_mode)
+
+    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(unsigned int, compute_utilization)
+    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(unsigned int, memory_utilization)
+    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(int, performance_level)
 };
 
 /**
@@ -97,22 +116,44 @@ class nvml_clock_samples {
      * @return the YAML string (`[[nodiscard]]`)
      */
     [[nodiscard]] std::string generate_yaml_string() const;
-
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(bool, auto_boosted_clock_enabled)                         // true if clock boosting is currently enabled
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(double, clock_frequency_min)                              // the minimum possible graphics clock frequency in MHz
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(double, clock_frequency_max)                              // the maximum possible graphics clock frequency in MHz
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(double, memory_clock_frequency_min)                       // the minimum possible memory clock frequency in MHz
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(double, memory_clock_frequency_max)                       // the maximum possible memory clock frequency in MHz
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(double, sm_clock_frequency_max)                           // the maximum possible SM clock frequency in MHz
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(map_type, available_clock_frequencies)                    // the available clock frequencies in MHz, based on a memory clock frequency (slowest to fastest)
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(std::vector<double>, available_memory_clock_frequencies)  // the available memory clock frequencies in MHz (slowest to fastest)
-
-    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(double, clock_frequency)              // the current graphics clock frequency in MHz
-    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(double, memory_clock_frequency)       // the current memory clock frequency in MHz
-    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(double, sm_clock_frequency)           // the current SM clock frequency in Mhz
-    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(unsigned long long, throttle_reason)  // the reason the GPU clock throttled (as bitmask)
-    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(std::string, throttle_reason_string)  // the reason the GPU clock throttled (as string)
-    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(bool, auto_boosted_clock)             // true if the clocks are currently auto boosted
+    /**
+     * @brief Return the compile-time descriptors of all clock related hardware samples in the order of the output.
+     * @details Used to generate `has_samples()`, `generate_yaml_string()`, the output-stream operator, the sample selection, and the Python bindings.
+     * @return the hardware sample descriptors (`[[nodiscard]]`)
+     */
+    [[nodiscard]] static constexpr auto metrics() noexcept {
+        return make_sample_metric_table(sample_category::clock,
+                                        sample_metric{ "auto_boosted_clock_enabled", &nvml_clock_samples::auto_boosted_clock_enabled_, "bool", "true if clock boosting is currently enabled" },
+                                        sample_metric{ "clock_frequency_min", &nvml_clock_samples::clock_frequency_min_, "MHz", "the minimum possible graphics clock frequency in MHz" },
+                                        sample_metric{ "clock_frequency_max", &nvml_clock_samples::clock_frequency_max_, "MHz", "the maximum possible graphics clock frequency in MHz" },
+                                        sample_metric{ "memory_clock_frequency_min", &nvml_clock_samples::memory_clock_frequency_min_, "MHz", "the minimum possible memory clock frequency in MHz" },
+                                        sample_metric{ "memory_clock_frequency_max", &nvml_clock_samples::memory_clock_frequency_max_, "MHz", "the maximum possible memory clock frequency in MHz" },
+                                        sample_metric{ "sm_clock_frequency_max", &nvml_clock_samples::sm_clock_frequency_max_, "MHz", "the maximum possible SM clock frequency in MHz" },
+                                        sample_metric{ "available_clock_frequencies", &nvml_clock_samples::available_clock_frequencies_, "MHz", "the available clock frequencies in MHz, based on a memory clock frequency (slowest to fastest)" }.with_layout(sample_metric_layout::nested, "memory_clock_frequency_"),
+                                        sample_metric{ "available_memory_clock_frequencies", &nvml_clock_samples::available_memory_clock_frequencies_, "MHz", "the available memory clock frequencies in MHz (slowest to fastest)" },
+                                        sample_metric{ "clock_frequency", &nvml_clock_samples::clock_frequency_, "MHz", "the current graphics clock frequency in MHz" },
+                                        sample_metric{ "memory_clock_frequency", &nvml_clock_samples::memory_clock_frequency_, "MHz", "the current memory clock frequency in MHz" },
+                                        sample_metric{ "sm_clock_frequency", &nvml_clock_samples::sm_clock_frequency_, "MHz", "the current SM clock frequency in Mhz" },
+                                        sample_metric{ "throttle_reason", &nvml_clock_samples::throttle_reason_, "bitmask", "the reason the GPU clock throttled (as bitmask)" }.with_quoted_values(),
+                                        sample_metric{ "throttle_reason_string", &nvml_clock_samples::throttle_reason_string_, "string", "the reason the GPU clock throttled (as string)" },
+                                        sample_metric{ "auto_boosted_clock", &nvml_clock_samples::auto_boosted_clock_, "bool", "true if the clocks are currently auto boosted" });
+    }
+
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(bool, auto_boosted_clock_enabled)
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(double, clock_frequency_min)
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(double, clock_frequency_max)
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(double, memory_clock_frequency_min)
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(double, memory_clock_frequency_max)
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(double, sm_clock_frequency_max)
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(map_type, available_clock_frequencies)
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(std::vector<double>, available_memory_clock_frequencies)
+
+    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(double, clock_frequency)
+    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(double, memory_clock_frequency)
+    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(double, sm_clock_frequency)
+    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(unsigned long long, throttle_reason)
+    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(std::string, throttle_reason_string)
+    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(bool, auto_boosted_clock)
 };
 
 /**
@@ -148,16 +189,32 @@ class nvml_power_samples {
      * @return the YAML string (`[[nodiscard]]`)
      */
     [[nodiscard]] std::string generate_yaml_string() const;
-
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(double, power_management_limit)              // if the GPU draws more power (W) than the power management limit, the GPU may throttle
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(double, power_enforced_limit)                // the actually enforced power limit (W), may be different from power management limit if external limiters are set
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(std::string, power_measurement_type)         // the type of the power readings: either current power draw or average power draw
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(bool, power_management_mode)                 // true if power management algorithms are supported and active
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(std::vector<int>, available_power_profiles)  // a list of the available power profiles
-
-    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(double, power_usage)                     // the current power draw of the GPU and its related circuity (e.g., memory) in W
-    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(double, power_total_energy_consumption)  // the total power consumption since the last driver reload in J
-    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(int, power_profile)                      // the current GPU power state: 0 - 15 where 0 is the maximum power and 15 the minimum power; 32 indicates unknown
+    /**
+     * @brief Return the compile-time descriptors of all power related hardware samples in the order of the output.
+     * @details Used to generate `has_samples()`, `generate_yaml_string()`, the output-stream operator, the sample selection, and the Python bindings.
+     * @return the hardware sample descriptors (`[[nodiscard]]`)
+     */
+    [[nodiscard]] static constexpr auto metrics() noexcept {
+        return make_sample_metric_table(sample_category::power,
+                                        sample_metric{ "power_management_limit", &nvml_power_samples::power_management_limit_, "W", "if the GPU draws more power (W) than the power management limit, the GPU may throttle" },
+                                        sample_metric{ "power_enforced_limit", &nvml_power_samples::power_enforced_limit_, "W", "the actually enforced power limit (W), may be different from power management limit if external limiters are set" },
+                                        sample_metric{ "power_measurement_type", &nvml_power_samples::power_measurement_type_, "string", "the type of the power readings: either current power draw or average power draw" },
+                                        sample_metric{ "power_management_mode", &nvml_power_samples::power_management_mode_, "bool", "true if power management algorithms are supported and active" },
+                                        sample_metric{ "available_power_profiles", &nvml_power_samples::available_power_profiles_, "int", "a list of the available power profiles" },
+                                        sample_metric{ "power_usage", &nvml_power_samples::power_usage_, "W", "the current power draw of the GPU and its related circuity (e.g., memory) in W" },
+                                        sample_metric{ "power_total_energy_consumption", &nvml_power_samples::power_total_energy_consumption_, "J", "the total power consumption since the last driver reload in J" }.with_yaml_name("power_total_energy_consumed"),
+                                        sample_metric{ "power_profile", &nvml_power_samples::power_profile_, "int", "the current GPU power state: 0 - 15 where 0 is the maximum power and 15 the minimum power; 32 indicates unknown" });
+    }
+
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(double, power_management_limit)
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(double, power_enforced_limit)
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(std::string, power_measurement_type)
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(bool, power_management_mode)
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(std::vector<int>, available_power_profiles)
+
+    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(double, power_usage)
+    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(double, power_total_energy_consumption)
+    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(int, power_profile)
 };
 
 /**
@@ -193,18 +250,36 @@ class nvml_memory_samples {
      * @return the YAML string (`[[nodiscard]]`)
      */
     [[nodiscard]] std::string generate_yaml_string() const;
-
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(unsigned long, memory_total)             // the total available memory in Byte
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(unsigned int, num_pcie_lanes_max)        // the maximum number of PCIe lanes
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(unsigned int, pcie_link_generation_max)  // the maximum PCIe link generation (e.g., PCIe 4.0, PCIe 5.0, etc.)
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(unsigned int, pcie_link_speed_max)       // the maximum PCIe link speed in MBPS
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(unsigned int, memory_bus_width)          // the memory bus with in Bit
-
-    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(unsigned long long, memory_used)     // the currently used memory in Byte
-    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(unsigned long long, memory_free)     // the currently free memory in Byte
-    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(unsigned int, num_pcie_lanes)        // the current PCIe link width (e.g., x16, x8, x4, etc)
-    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(unsigned int, pcie_link_generation)  // the current PCIe link generation (may change during runtime to save energy)
-    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(unsigned int, pcie_link_speed)       // the current PCIe link speed in MBPS
+    /**
+     * @brief Return the compile-time descriptors of all memory related hardware samples in the order of the output.
+     * @details Used to generate `has_samples()`, `generate_yaml_string()`, the output-stream operator, the sample selection, and the Python bindings.
+     * @return the hardware sample descriptors (`[[nodiscard]]`)
+     */
+    [[nodiscard]] static constexpr auto metrics() noexcept {
+        return make_sample_metric_table(sample_category::memory,
+                                        sample_metric{ "memory_total", &nvml_memory_samples::memory_total_, "B", "the total available memory in Byte" },
+                                        sample_metric{ "pcie_link_speed_max", &nvml_memory_samples::pcie_link_speed_max_, "MBPS", "the maximum PCIe link speed in MBPS" },
+                                        sample_metric{ "pcie_link_generation_max", &nvml_memory_samples::pcie_link_generation_max_, "int", "the maximum PCIe link generation (e.g., PCIe 4.0, PCIe 5.0, etc.)" },
+                                        sample_metric{ "num_pcie_lanes_max", &nvml_memory_samples::num_pcie_lanes_max_, "int", "the maximum number of PCIe lanes" },
+                                        sample_metric{ "memory_bus_width", &nvml_memory_samples::memory_bus_width_, "Bit", "the memory bus with in Bit" },
+                                        sample_metric{ "memory_used", &nvml_memory_samples::memory_used_, "B", "the currently used memory in Byte" },
+                                        sample_metric{ "memory_free", &nvml_memory_samples::memory_free_, "B", "the currently free memory in Byte" },
+                                        sample_metric{ "num_pcie_lanes", &nvml_memory_samples::num_pcie_lanes_, "int", "the current PCIe link width (e.g., x16, x8, x4, etc)" },
+                                        sample_metric{ "pcie_link_generation", &nvml_memory_samples::pcie_link_generation_, "int", "the current PCIe link generation (may change during runtime to save energy)" },
+                                        sample_metric{ "pcie_link_speed", &nvml_memory_samples::pcie_link_speed_, "MBPS", "the current PCIe link speed in MBPS" });
+    }
+
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(unsigned long, memory_total)
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(unsigned int, num_pcie_lanes_max)
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(unsigned int, pcie_link_generation_max)
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(unsigned int, pcie_link_speed_max)
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(unsigned int, memory_bus_width)
+
+    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(unsigned long long, memory_used)
+    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(unsigned long long, memory_free)
+    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(unsigned int, num_pcie_lanes)
+    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(unsigned int, pcie_link_generation)
+    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(unsigned int, pcie_link_speed)
 };
 
 /**
@@ -239,15 +314,30 @@ class nvml_temperature_samples {
      * @return the YAML string (`[[nodiscard]]`)
      */
     [[nodiscard]] std::string generate_yaml_string() const;
-
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(unsigned int, num_fans)          // the number of fans (if any)
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(unsigned int, fan_speed_min)     // the minimum fan speed the user can set in %
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(unsigned int, fan_speed_max)     // the maximum fan speed the user can set in %
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(double, temperature_max)         // the maximum graphics temperature threshold in °C
-    HWS_SAMPLE_STRUCT_FIXED_MEMBER(double, memory_temperature_max)  // the maximum memory temperature threshold in °C
-
-    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(double, fan_speed_percentage)  // the current intended fan speed in %
-    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(double, temperature)           // the current GPU temperature in °C
+    /**
+     * @brief Return the compile-time descriptors of all temperature related hardware samples in the order of the output.
+     * @details Used to generate `has_samples()`, `generate_yaml_string()`, the output-stream operator, the sample selection, and the Python bindings.
+     * @return the hardware sample descriptors (`[[nodiscard]]`)
+     */
+    [[nodiscard]] static constexpr auto metrics() noexcept {
+        return make_sample_metric_table(sample_category::temperature,
+                                        sample_metric{ "num_fans", &nvml_temperature_samples::num_fans_, "int", "the number of fans (if any)" },
+                                        sample_metric{ "fan_speed_min", &nvml_temperature_samples::fan_speed_min_, "%", "the minimum fan speed the user can set in %" },
+                                        sample_metric{ "fan_speed_max", &nvml_temperature_samples::fan_speed_max_, "%", "the maximum fan speed the user can set in %" },
+                                        sample_metric{ "temperature_max", &nvml_temperature_samples::temperature_max_, "°C", "the maximum graphics temperature threshold in °C" },
+                                        sample_metric{ "memory_temperature_max", &nvml_temperature_samples::memory_temperature_max_, "°C", "the maximum memory temperature threshold in °C" },
+                                        sample_metric{ "fan_speed_percentage", &nvml_temperature_samples::fan_speed_percentage_, "%", "the current intended fan speed in %" },
+                                        sample_metric{ "temperature", &nvml_temperature_samples::temperature_, "°C", "the current GPU temperature in °C" });
+    }
+
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(unsigned int, num_fans)
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(unsigned int, fan_speed_min)
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(unsigned int, fan_speed_max)
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(double, temperature_max)
+    HWS_SAMPLE_STRUCT_FIXED_MEMBER(double, memory_temperature_max)
+
+    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(double, fan_speed_percentage)
+    HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(double, temperature)
 };
 
 /**
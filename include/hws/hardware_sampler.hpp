@@ -12,23 +12,47 @@
 #define HWS_HARDWARE_SAMPLER_HPP_
 #pragma once
 
-#include "hws/event.hpp"            // hws::event
-#include "hws/sample_category.hpp"  // hws::sample_category
+#include "hws/burst_capture.hpp"        // hws::burst_capture
+#include "hws/burst_history.hpp"        // hws::detail::burst_history
+#include "hws/energy_region.hpp"        // hws::energy_region
+#include "hws/event.hpp"                // hws::event
+#include "hws/event_queue.hpp"          // hws::detail::event_queue
+#include "hws/overrun_policy.hpp"       // hws::overrun_policy
+#include "hws/sample_category.hpp"      // hws::sample_category
+#include "hws/sample_column.hpp"        // hws::{sample_column, sample_column_config}
+#include "hws/sample_metric.hpp"        // hws::detail::for_each_sample_metric
+#include "hws/sampling_statistics.hpp"  // hws::sampling_statistics
+#include "hws/tick_view.hpp"            // hws::tick_view
 
-#include <atomic>      // std::atomic
-#include <chrono>      // std::chrono::{system_clock::time_point, steady_clock::time_point, milliseconds}
-#include <cstddef>     // std::size_t
-#include <filesystem>  // std::filesystem::path
-#include <string>      // std::string
-#include <thread>      // std::thread
-#include <vector>      // std::vector
+#include <array>               // std::array
+#include <atomic>              // std::atomic
+#include <chrono>              // std::chrono::{system_clock::time_point, steady_clock::{time_point, duration}, nanoseconds}
+#include <condition_variable>  // std::condition_variable
+#include <cstddef>             // std::size_t
+#include <filesystem>          // std::filesystem::path
+#include <functional>          // std::function
+#include <memory>              // std::shared_ptr, std::make_shared
+#include <mutex>               // std::mutex
+#include <optional>            // std::optional
+#include <string>              // std::string
+#include <string_view>         // std::string_view
+#include <thread>              // std::thread
+#include <type_traits>         // std::decay_t
+#include <utility>             // std::pair
+#include <vector>              // std::vector
 
 namespace hws {
 
+// forward declare the system_hardware_sampler class
+class system_hardware_sampler;
+
 /**
  * @brief The base class for all specialized hardware samplers.
  */
 class hardware_sampler {
+    // befriend the system hardware sampler to be able to drive multiple hardware samplers from a single sampling std::thread
+    friend system_hardware_sampler;
+
   public:
     /**
      * @brief Construct a new hardware sampler with the provided @p sampling_interval.
@@ -36,7 +60,7 @@ class hardware_sampler {
      * @param[in] category the sample categories that are enabled for hardware sampling
      * @throws std::invalid_argument if the @p sampling_interval is zero
      */
-    hardware_sampler(std::chrono::milliseconds sampling_interval, sample_category category);
+    hardware_sampler(std::chrono::nanoseconds sampling_interval, sample_category category);
 
     /**
      * @brief Delete the copy-constructor (already implicitly deleted due to the std::atomic member).
@@ -69,6 +93,8 @@ class hardware_sampler {
     /**
      * @brief Stop hardware sampling. Signals the running std::thread to stop sampling and joins it.
      * @details Once a hardware sampler has been stopped, it can never be stopped again.
+     *          If the samples are retrieved by the shared sampling std::thread of a system_hardware_sampler, waits until the shared
+     *          std::thread observed the stop, i.e., finished its current tick of this hardware sampler.
      * @throws std::runtime_error if the hardware sampler hasn't been started yet
      * @throws std::runtime_error if the hardware sampler has already been stopped
      */
@@ -98,9 +124,21 @@ class hardware_sampler {
      * @return `true` if the hardware sampler has already stopped sampling, `false` otherwise (`[[nodiscard]]`)
      */
     [[nodiscard]] bool has_sampling_stopped() const noexcept;
+    /**
+     * @brief Check whether the hardware samples can safely be accessed, i.e., the hardware sampler hasn't been started yet or the initial samples have already been retrieved.
+     * @details Afterward, the hardware samples and time points can be read while the sampling is still running. A reader always sees a consistent
+     *          prefix of the sampled values (see hws::sample_column) without blocking the sampling std::thread.
+     *          If a sample retention, the sample compression, or the streaming statistics are used, the hardware samples can only be accessed before the
+     *          sampling has been started, after it has been stopped, or from the sampling std::thread itself (e.g., in a trigger predicate).
+     * @return `true` if the hardware samples can safely be accessed, `false` otherwise (`[[nodiscard]]`)
+     */
+    [[nodiscard]] bool samples_accessible() const noexcept;
 
     /**
      * @brief Add a new event.
+     * @details Thread-safe: events can be added from any number of threads concurrently without acquiring a lock of the hardware sampler.
+     *          Each event is allocated on the heap, i.e., the memory allocator may still serialize concurrently recording threads.
+     *          The events are sorted by their time points when they are accessed.
      * @param e the event
      */
     void add_event(event e);
@@ -115,18 +153,147 @@ class hardware_sampler {
      * @param[in] name the name of the event
      */
     void add_event(decltype(event::name) name);
+    /**
+     * @brief Add a new event. The time_point will be the current time.
+     * @details If @p sample_immediately is `true`, additionally retrieves an on-demand sample right at the event (see `hardware_sampler::sample_now()`).
+     * @param[in] name the name of the event
+     * @param[in] sample_immediately `true` to retrieve an on-demand sample at the event
+     */
+    void add_event(decltype(event::name) name, bool sample_immediately);
+
+    /**
+     * @brief Request an on-demand sample independent of the sampling interval, e.g., at the boundary of a short phase.
+     * @details Wakes up the sampling std::thread which immediately retrieves the samples of all enabled sample categories. The on-demand
+     *          sample is added to the normal time points and hardware samples, but doesn't change the deadlines of the regular samples
+     *          (including the per category sampling intervals). Returns without waiting for the sample.
+     *          Does nothing if the hardware sampler is currently not sampling.
+     */
+    void sample_now();
+
+    /**
+     * @brief Begin a new region with the name @p name at the current time.
+     * @details Only reads the time and the cumulative energy counter of the device, i.e., regions are cheap enough to be always enabled.
+     *          Regions may overlap or be nested and can be started from any thread. While a region is open, the samples retrieved by the
+     *          sampling std::thread are aggregated online into the region (see hws::energy_region).
+     * @param[in] name the name of the region
+     * @throws std::runtime_error if the hardware sampler hasn't been started yet or has already been stopped
+     * @return the ID of the new region, i.e., its index in `hardware_sampler::energy_regions()`
+     */
+    std::size_t begin_region(std::string name);
+    /**
+     * @brief End the most recently begun region with the name @p name that hasn't been ended yet.
+     * @param[in] name the name of the region
+     * @throws std::runtime_error if the hardware sampler hasn't been started yet or has already been stopped
+     * @throws std::runtime_error if no open region with the name @p name exists
+     * @return the ended region including its aggregates
+     */
+    energy_region end_region(const std::string &name);
+    /**
+     * @brief End the region with the ID @p id returned by `hardware_sampler::begin_region`.
+     * @param[in] id the ID of the region
+     * @throws std::runtime_error if the hardware sampler hasn't been started yet or has already been stopped
+     * @throws std::runtime_error if the region with the ID @p id doesn't exist or has already been ended
+     * @return the ended region including its aggregates
+     */
+    energy_region end_region(std::size_t id);
+    /**
+     * @brief Return all regions in the order they have been begun.
+     * @return the regions (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::vector<energy_region> energy_regions() const;
+
+    /**
+     * @brief Enable or disable the marker-only mode.
+     * @details In the marker-only mode, no sampling std::thread is started and no hardware samples are retrieved. Only the energy counters
+     *          read in `hardware_sampler::begin_region` and `hardware_sampler::end_region` are recorded.
+     * @param[in] enable `true` to enable the marker-only mode, `false` otherwise (default)
+     * @throws std::runtime_error if the hardware sampler has already been started
+     */
+    void set_marker_only_mode(bool enable);
+    /**
+     * @brief Check whether the marker-only mode is enabled.
+     * @return `true` if the marker-only mode is enabled, `false` otherwise (`[[nodiscard]]`)
+     */
+    [[nodiscard]] bool uses_marker_only_mode() const noexcept { return marker_only_mode_; }
+
+    /**
+     * @brief Add a trigger named @p name whose @p predicate is evaluated after every tick of the sampling loop.
+     * @details If the @p predicate returns `true`, the sampler switches to the burst mode: it samples with the burst sampling interval (even if
+     *          the adaptive sampling increased the interval) until the post-trigger window has elapsed. Afterward, the numeric hardware samples of
+     *          the pre-trigger and post-trigger windows are saved as hws::burst_capture and the triggers are re-armed.
+     *          The triggers are evaluated in the order they have been added; while a burst is active, no trigger is evaluated.
+     *          The @p predicate is called in the sampling std::thread and may therefore read the latest hardware samples, e.g.,
+     *          `[&sampler]() { return sampler.temperature_samples().get_temperature()->back() > 85.0; }`.
+     * @param[in] name the name of the trigger
+     * @param[in] predicate the predicate firing the trigger
+     * @throws std::runtime_error if the hardware sampler has already been started
+     * @throws std::invalid_argument if @p predicate is empty
+     */
+    void add_trigger(std::string name, std::function<bool()> predicate);
+    /**
+     * @brief Set the windows captured around the time point a trigger fired to @p pre_trigger and @p post_trigger and the sampling interval used in the burst mode to @p burst_interval.
+     * @details The numeric hardware samples of the ticks within the @p pre_trigger window are kept in a separate fixed-size ring with at most one entry per
+     *          burst sampling interval, i.e., the regular hardware samples are neither truncated nor affected by the burst captures.
+     *          While a burst is active, the ticks lie on the grid of the @p burst_interval. The sample categories are retrieved on their own grid as
+     *          usual; additionally, the sample categories sampled with the base sampling interval are retrieved in the ticks in between.
+     * @param[in] pre_trigger the duration before the trigger fired to capture
+     * @param[in] post_trigger the duration after the trigger fired to capture in the burst mode
+     * @param[in] burst_interval the sampling interval in the burst mode, `std::nullopt` to use the base sampling interval
+     * @throws std::runtime_error if the hardware sampler has already been started
+     * @throws std::invalid_argument if @p pre_trigger or @p post_trigger is negative or both are zero
+     * @throws std::invalid_argument if @p burst_interval isn't positive or doesn't evenly divide the base sampling interval
+     */
+    void set_burst_window(std::chrono::nanoseconds pre_trigger, std::chrono::nanoseconds post_trigger, std::optional<std::chrono::nanoseconds> burst_interval = std::nullopt);
+    /**
+     * @brief Return the sampling interval used while a burst is active.
+     * @return the burst sampling interval, the base sampling interval if none has been set (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::chrono::nanoseconds burst_sampling_interval() const noexcept { return burst_sampling_interval_.value_or(sampling_interval_); }
+    /**
+     * @brief Check whether any trigger has been added.
+     * @return `true` if triggers are used, `false` otherwise (`[[nodiscard]]`)
+     */
+    [[nodiscard]] bool uses_triggers() const noexcept { return !triggers_.empty(); }
+    /**
+     * @brief Return all burst captures in the order their triggers fired.
+     * @details Thread-safe: can be called while the sampling is still running. A burst that is active when the sampling is stopped is captured
+     *          with a truncated post-trigger window.
+     * @return the burst captures (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::vector<burst_capture> burst_captures() const;
+
+    /**
+     * @brief Add the @p callback that is called with a view of every tick of the sampling loop, including the initial samples and the on-demand samples.
+     * @details The @p callback is called in the sampling std::thread right after the samples of the tick have been retrieved. No memory is
+     *          allocated to call the @p callback, but it delays the next tick; therefore, it should return quickly. To process the ticks in a
+     *          separate std::thread, use hws::tick_consumer. The callbacks are called without holding any lock, i.e., the @p callback may add
+     *          or remove tick callbacks, which only affects the following ticks.
+     *          Thread-safe: can be called while the sampling is running.
+     * @param[in] callback the callback
+     * @throws std::invalid_argument if @p callback is empty
+     * @return the ID of the callback used to remove it again (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::size_t add_tick_callback(std::function<void(const tick_view &)> callback);
+    /**
+     * @brief Remove the tick callback with the ID @p id.
+     * @details Thread-safe: can be called while the sampling is running. Waits until the sampling std::thread returned from a concurrently running tick callback;
+     *          afterward, the callback is guaranteed to not be called anymore. If called from within a tick callback, the callback may still be called in the current tick.
+     * @param[in] id the ID of the callback returned by `hardware_sampler::add_tick_callback`
+     * @throws std::runtime_error if no tick callback with the ID @p id exists
+     */
+    void remove_tick_callback(std::size_t id);
 
     /**
      * @brief Return the number of recorded events.
      * @return the number of events (`[[nodiscard]]`)
      */
-    [[nodiscard]] std::size_t num_events() const noexcept { return events_.size(); }
+    [[nodiscard]] std::size_t num_events() const;
 
     /**
-     * @brief Return a vector of all recorded events.
+     * @brief Return a vector of all recorded events sorted by their time points.
      * @return the events (`[[nodiscard]]`)
      */
-    [[nodiscard]] const std::vector<event> &get_events() const noexcept { return events_; }
+    [[nodiscard]] std::vector<event> get_events() const;
 
     /**
      * @brief Return the event at index @p idx.
@@ -138,15 +305,252 @@ class hardware_sampler {
 
     /**
      * @brief Return the time points the samples of this hardware sampler occurred.
+     * @details Can be called while the sampling is still running if `hardware_sampler::samples_accessible()` returns `true`. Returns the time points published so far.
+     *          If a sample retention is used, only the time points of the retained samples are returned.
      * @return the time points (`[[nodiscard]]`)
      */
-    [[nodiscard]] std::vector<std::chrono::steady_clock::time_point> sampling_time_points() const noexcept { return time_points_; }
+    [[nodiscard]] std::vector<std::chrono::steady_clock::time_point> sampling_time_points() const;
 
     /**
      * @brief Return the sampling interval of this hardware sampler.
-     * @return the samping interval in milliseconds (`[[nodiscard]]`)
+     * @return the samping interval in nanoseconds (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::chrono::nanoseconds sampling_interval() const noexcept { return sampling_interval_; }
+
+    /**
+     * @brief Return the sampling interval used for the samples of the single sample category @p category.
+     * @param[in] category the sample_category; must be exactly one sample category
+     * @throws std::invalid_argument if @p category isn't exactly one sample category
+     * @return the sampling interval of the @p category in nanoseconds (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::chrono::nanoseconds sampling_interval(sample_category category) const;
+    /**
+     * @brief Set the sampling interval used for the samples of all sample categories in @p category to @p interval.
+     * @details All sample categories share the same base sampling interval. Therefore, @p interval must be a multiple of the base
+     *          sampling interval and the samples of the respective categories are only retrieved in the first tick of the sampling loop
+     *          reaching the next multiple of @p interval on the grid of base sampling intervals.
+     * @param[in] category the sample categories whose sampling interval should be changed
+     * @param[in] interval the new sampling interval of the sample categories
+     * @throws std::runtime_error if the hardware sampler has already been started
+     * @throws std::invalid_argument if @p interval isn't a positive multiple of the base sampling interval
+     */
+    void set_sampling_interval(sample_category category, std::chrono::nanoseconds interval);
+    /**
+     * @brief Return the time points the samples of the single sample category @p category occurred.
+     * @details Equal to `hardware_sampler::sampling_time_points()` if the @p category uses the base sampling interval.
+     * @param[in] category the sample_category; must be exactly one sample category
+     * @throws std::invalid_argument if @p category isn't exactly one sample category
+     * @return the time points (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::vector<std::chrono::steady_clock::time_point> sampling_time_points(sample_category category) const;
+    /**
+     * @brief Return the time points at which this hardware sampler started to query the samples of each tick.
+     * @details In contrast to `hardware_sampler::sampling_time_points()`, the time point is taken right before the first driver call
+     *          (or subprocess invocation) of the tick, e.g., after the other hardware samplers of a system_hardware_sampler have been queried.
+     *          Can be called while the sampling is still running if `hardware_sampler::samples_accessible()` returns `true`.
+     *          If a sample retention is used, only the time points of the retained samples are returned.
+     * @return the time points (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::vector<std::chrono::steady_clock::time_point> sampling_query_begin_time_points() const;
+    /**
+     * @brief Return the time points at which this hardware sampler started to query the samples of the single sample category @p category.
+     * @param[in] category the sample_category; must be exactly one sample category
+     * @throws std::invalid_argument if @p category isn't exactly one sample category
+     * @return the time points (`[[nodiscard]]`)
      */
-    [[nodiscard]] std::chrono::milliseconds sampling_interval() const noexcept { return sampling_interval_; }
+    [[nodiscard]] std::vector<std::chrono::steady_clock::time_point> sampling_query_begin_time_points(sample_category category) const;
+    /**
+     * @brief Return the time points at which this hardware sampler finished to query the samples of each tick.
+     * @details Can be called while the sampling is still running if `hardware_sampler::samples_accessible()` returns `true`.
+     *          If a sample retention is used, only the time points of the retained samples are returned.
+     * @return the time points (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::vector<std::chrono::steady_clock::time_point> sampling_query_end_time_points() const;
+    /**
+     * @brief Return the time points at which this hardware sampler finished to query the samples of the single sample category @p category.
+     * @param[in] category the sample_category; must be exactly one sample category
+     * @throws std::invalid_argument if @p category isn't exactly one sample category
+     * @return the time points (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::vector<std::chrono::steady_clock::time_point> sampling_query_end_time_points(sample_category category) const;
+    /**
+     * @brief Return the time needed to query the samples of each tick, i.e., the backend overhead per tick.
+     * @details The first value contains the retrieval of the samples that are only retrieved once.
+     *          Can be called while the sampling is still running if `hardware_sampler::samples_accessible()` returns `true`.
+     *          If a sample retention is used, only the latencies of the retained samples are returned.
+     * @return the query latencies (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::vector<std::chrono::nanoseconds> sampling_query_latencies() const;
+    /**
+     * @brief Return the time needed to query the samples of the ticks in which the single sample category @p category has been sampled.
+     * @param[in] category the sample_category; must be exactly one sample category
+     * @throws std::invalid_argument if @p category isn't exactly one sample category
+     * @return the query latencies (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::vector<std::chrono::nanoseconds> sampling_query_latencies(sample_category category) const;
+
+    /**
+     * @brief Restrict the queried hardware samples to the hardware samples named @p metrics, e.g., `{ "power_usage", "temperature" }`.
+     * @details The names are the names of the sample getters without the `get_` prefix (and the names in the YAML output). The hardware
+     *          samples that aren't selected are neither retrieved in the sampling loop nor part of the output, i.e., their driver calls
+     *          are skipped. The selection further restricts the enabled sample categories. The hardware samples that are only retrieved
+     *          once are always retrieved. If a selected hardware sample is derived from another hardware sample, the latter is retained too.
+     *          Names not matching any hardware sample of the device are ignored. An empty selection (default) selects all hardware samples.
+     * @param[in] metrics the names of the selected hardware samples
+     * @throws std::runtime_error if the hardware sampler has already been started
+     */
+    void set_sample_metrics(std::vector<std::string> metrics);
+    /**
+     * @brief Return the names of the selected hardware samples.
+     * @return the names, empty if all hardware samples are selected (`[[nodiscard]]`)
+     */
+    [[nodiscard]] const std::vector<std::string> &sample_metrics() const noexcept { return sample_metrics_; }
+    /**
+     * @brief Check whether the queried hardware samples are restricted via `hardware_sampler::set_sample_metrics`.
+     * @return `true` if only selected hardware samples are queried, `false` otherwise (`[[nodiscard]]`)
+     */
+    [[nodiscard]] bool uses_sample_metric_selection() const noexcept { return !sample_metrics_.empty(); }
+    /**
+     * @brief Check whether the hardware sample named @p metric is selected.
+     * @param[in] metric the name of the hardware sample
+     * @return `true` if all hardware samples are selected or @p metric is one of them, `false` otherwise (`[[nodiscard]]`)
+     */
+    [[nodiscard]] bool sample_metric_selected(std::string_view metric) const noexcept;
+
+    /**
+     * @brief Enable the adaptive sampling rate with the upper bound @p max_sampling_interval.
+     * @details The base sampling interval is the lower bound of the adaptive sampling interval. If any of the tracked samples
+     *          changes by more than the threshold of its sample category in a tick, the base sampling interval is used again.
+     *          Otherwise, the sampling interval is doubled up to @p max_sampling_interval. If @p max_sampling_interval is equal
+     *          to the base sampling interval, the adaptive sampling rate is disabled (default).
+     * @param[in] max_sampling_interval the largest sampling interval used if the tracked samples stay flat
+     * @throws std::runtime_error if the hardware sampler has already been started
+     * @throws std::invalid_argument if @p max_sampling_interval isn't a positive multiple of the base sampling interval
+     */
+    void set_adaptive_sampling(std::chrono::nanoseconds max_sampling_interval);
+    /**
+     * @brief Check whether the adaptive sampling rate is enabled.
+     * @return `true` if the adaptive sampling rate is enabled, `false` otherwise (`[[nodiscard]]`)
+     */
+    [[nodiscard]] bool uses_adaptive_sampling() const noexcept { return max_sampling_interval_stride_ > 1; }
+    /**
+     * @brief Return the upper bound of the adaptive sampling interval.
+     * @return the maximum sampling interval in nanoseconds, equal to the base sampling interval if the adaptive sampling rate is disabled (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::chrono::nanoseconds max_sampling_interval() const noexcept { return static_cast<std::chrono::nanoseconds::rep>(max_sampling_interval_stride_) * sampling_interval_; }
+    /**
+     * @brief Return the relative change of the tracked samples of the single sample category @p category that resets the adaptive sampling interval.
+     * @param[in] category the sample_category; must be exactly one sample category
+     * @throws std::invalid_argument if @p category isn't exactly one sample category
+     * @return the relative threshold (`[[nodiscard]]`)
+     */
+    [[nodiscard]] double adaptive_sampling_threshold(sample_category category) const;
+    /**
+     * @brief Set the relative change of the tracked samples of all sample categories in @p category that resets the adaptive sampling interval.
+     * @details For example, a @p threshold of `0.05` (default) means that a change of more than 5% between two consecutive samples is considered volatile.
+     * @param[in] category the sample categories whose threshold should be changed
+     * @param[in] threshold the new relative threshold
+     * @throws std::runtime_error if the hardware sampler has already been started
+     * @throws std::invalid_argument if @p threshold is negative
+     */
+    void set_adaptive_sampling_threshold(sample_category category, double threshold);
+
+    /**
+     * @brief Retain only the last @p num_samples samples of every hardware sample (and the respective time points).
+     * @details The hardware samples are stored in fixed-capacity ring buffers (see hws::sample_column), i.e., the memory usage doesn't grow
+     *          over time. The hardware samples can't be read while the sampling is still running if a sample retention is used.
+     * @param[in] num_samples the number of retained samples per hardware sample
+     * @throws std::runtime_error if the hardware sampler has already been started
+     * @throws std::runtime_error if the sample compression or the streaming statistics are enabled
+     * @throws std::invalid_argument if @p num_samples is zero
+     */
+    void set_sample_retention(std::size_t num_samples);
+    /**
+     * @brief Retain only the samples of at least the last @p duration of every hardware sample (and the respective time points).
+     * @details The @p duration is converted to the number of samples retrieved in @p duration using the base sampling interval.
+     *          Therefore, sample categories with a larger sampling interval or an adaptive sampling rate retain the samples of a longer duration.
+     * @param[in] duration the retained duration
+     * @throws std::runtime_error if the hardware sampler has already been started
+     * @throws std::invalid_argument if @p duration isn't positive
+     */
+    void set_sample_retention(std::chrono::nanoseconds duration);
+    /**
+     * @brief Check whether only the last samples are retained.
+     * @return `true` if a sample retention is used, `false` otherwise (`[[nodiscard]]`)
+     */
+    [[nodiscard]] bool uses_sample_retention() const noexcept { return sample_retention_ > 0; }
+    /**
+     * @brief Return the number of retained samples per hardware sample.
+     * @return the number of retained samples, `0` if all samples are retained (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::size_t sample_retention() const noexcept { return sample_retention_; }
+
+    /**
+     * @brief Enable or disable the compression of all hardware samples and time points.
+     * @details The time points are compressed using delta-of-delta encoding, floating point samples using XOR encoding, and integral samples
+     *          using varint encoded deltas (see hws::detail::sample_codec). Samples of other types, e.g., strings, are stored uncompressed.
+     *          The hardware samples can't be read while the sampling is still running if the compression is enabled.
+     * @param[in] enable `true` to compress the hardware samples, `false` otherwise (default)
+     * @throws std::runtime_error if the hardware sampler has already been started, a sample retention is used, or the streaming statistics are enabled
+     */
+    void set_sample_compression(bool enable);
+    /**
+     * @brief Check whether the hardware samples are compressed.
+     * @return `true` if the hardware samples are compressed, `false` otherwise (`[[nodiscard]]`)
+     */
+    [[nodiscard]] bool uses_sample_compression() const noexcept { return sample_compression_; }
+
+    /**
+     * @brief Enable or disable the streaming statistics of all arithmetic hardware samples.
+     * @details Every retrieved value is added to a mergeable hws::streaming_statistics (moments and quantiles) of its hardware sample that is
+     *          accessible via `sample_column::statistics()`, e.g., `sampler.power_samples().get_power_usage()->statistics()`.
+     *          Only the last two samples of every hardware sample (and the respective time points) are retained, i.e., the memory usage is
+     *          constant regardless of the sampling duration. The hardware samples can't be read while the sampling is still running if the
+     *          streaming statistics are enabled.
+     * @param[in] enable `true` to summarize the hardware samples, `false` otherwise (default)
+     * @throws std::runtime_error if the hardware sampler has already been started, a sample retention is used, or the sample compression is enabled
+     */
+    void set_streaming_statistics(bool enable);
+    /**
+     * @brief Check whether the hardware samples are summarized by streaming statistics instead of being stored.
+     * @return `true` if the streaming statistics are enabled, `false` otherwise (`[[nodiscard]]`)
+     */
+    [[nodiscard]] bool uses_streaming_statistics() const noexcept { return streaming_statistics_; }
+
+    /**
+     * @brief Set the expected duration of the sampling to @p duration.
+     * @details Used as hint to allocate the storage of all hardware samples and time points before the sampling loop starts.
+     *          Therefore, no memory has to be allocated in the sampling loop as long as the sampling doesn't take longer than @p duration.
+     *          The memory of arithmetic samples isn't touched until the respective values have been sampled. A @p duration of zero (default) disables the preallocation.
+     * @param[in] duration the expected sampling duration
+     * @throws std::runtime_error if the hardware sampler has already been started
+     * @throws std::invalid_argument if @p duration is negative
+     */
+    void set_expected_sampling_duration(std::chrono::nanoseconds duration);
+    /**
+     * @brief Return the expected duration of the sampling used to preallocate the storage of the hardware samples.
+     * @return the expected sampling duration, zero if no storage is preallocated (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::chrono::nanoseconds expected_sampling_duration() const noexcept { return expected_sampling_duration_; }
+
+    /**
+     * @brief Return the policy used if retrieving a sample takes longer than the sampling interval.
+     * @return the overrun policy (`[[nodiscard]]`)
+     */
+    [[nodiscard]] overrun_policy sampling_overrun_policy() const noexcept { return overrun_policy_; }
+    /**
+     * @brief Set the policy used if retrieving a sample takes longer than the sampling interval.
+     * @param[in] policy the new overrun policy
+     * @throws std::runtime_error if the hardware sampler has already been started
+     */
+    void set_sampling_overrun_policy(overrun_policy policy);
+
+    /**
+     * @brief Return the timing statistics, i.e., the jitter and missed deadlines, of the sampling loop.
+     * @details Can be called while the sampling is still running: returns a consistent snapshot of the statistics after the last update.
+     * @return a copy of the sampling statistics (`[[nodiscard]]`)
+     */
+    [[nodiscard]] hws::sampling_statistics sampling_statistics() const;
 
     /**
      * @brief Dump the hardware samples to the YAML file with @p filename.
@@ -182,9 +586,63 @@ class hardware_sampler {
 
   protected:
     /**
-     * @brief Getter the hardware samples. Called in another std::thread.
+     * @brief Retrieve all hardware samples that must only be retrieved once and the initial values of all sampled hardware samples.
+     * @details Called once in the sampling std::thread before the first tick of the sampling loop.
+     */
+    virtual void initialize_samples() = 0;
+    /**
+     * @brief Retrieve the hardware samples of a single tick of the sampling loop. Called in the sampling std::thread.
+     * @details The time point of the current tick has already been added when this function is called.
+     */
+    virtual void sample() = 0;
+    /**
+     * @brief Read the cumulative energy counter of the device in J.
+     * @details Called by `hardware_sampler::begin_region` and `hardware_sampler::end_region` from arbitrary threads, potentially concurrently
+     *          to the sampling std::thread. Therefore, it must not modify any state used by the sampling loop.
+     * @return the cumulative energy, `std::nullopt` if the device doesn't provide an energy counter (default) (`[[nodiscard]]`)
+     */
+    [[nodiscard]] virtual std::optional<double> read_energy_counter();
+    /**
+     * @brief Return the power draw in W retrieved in the current tick of the sampling loop. Used to aggregate the samples of the open regions.
+     * @details Called in the sampling std::thread after `hardware_sampler::sample()` only if the power samples are due in the current tick.
+     * @return the current power draw, `std::nullopt` if not available (default) (`[[nodiscard]]`)
+     */
+    [[nodiscard]] virtual std::optional<double> latest_power_usage() const;
+    /**
+     * @brief Return the temperature in °C retrieved in the current tick of the sampling loop. Used to aggregate the samples of the open regions.
+     * @details Called in the sampling std::thread after `hardware_sampler::sample()` only if the temperature samples are due in the current tick.
+     * @return the current temperature, `std::nullopt` if not available (default) (`[[nodiscard]]`)
+     */
+    [[nodiscard]] virtual std::optional<double> latest_temperature() const;
+    /**
+     * @brief Return the names of all numeric hardware samples passed to the tick callbacks and captured in the burst captures, one name per series of values.
+     * @details Called once in the sampling std::thread after the initial samples have been retrieved.
+     * @return the names, empty if the hardware sampler doesn't support burst captures (default) (`[[nodiscard]]`)
+     */
+    [[nodiscard]] virtual std::vector<std::string> numeric_sample_names() const;
+    /**
+     * @brief Write the numeric hardware samples retrieved in the current tick of the sampling loop to @p values in the order of `hardware_sampler::numeric_sample_names()`.
+     * @details Called in the sampling std::thread after `hardware_sampler::sample()` in every tick if any trigger or tick callback has been added. Hardware samples
+     *          whose sample category isn't part of @p sampled must be written as NaN. Must not allocate memory.
+     * @param[in] sampled the sample categories retrieved in the current tick
+     * @param[in,out] values the values to write to, sized to the number of names (default: no-op)
      */
-    virtual void sampling_loop() = 0;
+    virtual void latest_numeric_sample_values(sample_category sampled, std::vector<double> &values) const;
+    /**
+     * @brief Release the resources only needed while the hardware samples are retrieved, e.g., long-lived subprocesses.
+     * @details Called in the sampling std::thread if the sampling has been paused before the next tick (default: no-op).
+     */
+    virtual void pause_samples();
+    /**
+     * @brief Reacquire the resources released in `hardware_sampler::pause_samples()`.
+     * @details Called in the sampling std::thread before the first tick after the sampling has been resumed (default: no-op).
+     */
+    virtual void resume_samples();
+    /**
+     * @brief Release all resources only needed while the hardware samples are retrieved, e.g., long-lived subprocesses.
+     * @details Called once in the sampling std::thread after the last tick of the sampling loop (default: no-op).
+     */
+    virtual void finalize_samples();
 
     /**
      * @brief Add a new time point to this hardware sampler. Called during the sampling loop.
@@ -198,29 +656,418 @@ class hardware_sampler {
      * @return Returns `true` if @p category is enabled for sampling, otherwise `false` (`[[nodiscard]]`)
      */
     [[nodiscard]] bool sample_category_enabled(sample_category category) const noexcept;
+    /**
+     * @brief Return the configuration of the sample columns given by the sample retention, compression, and streaming statistics of this hardware sampler.
+     * @details Must be passed to every hws::sample_column and hws::sample_matrix created in `hardware_sampler::initialize_samples()` and `hardware_sampler::sample()`.
+     * @return the configuration (`[[nodiscard]]`)
+     */
+    [[nodiscard]] sample_column_config column_config() const noexcept;
+    /**
+     * @brief Drop all hardware samples of the @p samples retrieved in the sampling loop that are not selected.
+     * @details Must only be called at the end of `hardware_sampler::initialize_samples()`. Afterward, the driver calls of the dropped
+     *          samples are skipped since the sampling loop only retrieves the hardware samples that are present.
+     *          A hardware sample other selected hardware samples are derived from (see `hws::sample_metric::derived_from`) is kept.
+     * @tparam Samples the sample class, e.g., hws::cpu_power_samples
+     * @param[in,out] samples the samples to drop the not selected hardware samples from
+     * @return `true` if any hardware sample retrieved in the sampling loop is still present, `false` otherwise
+     */
+    template <typename Samples>
+    bool apply_sample_metric_selection(Samples &samples) const noexcept {
+        bool any_sample = false;
+        detail::for_each_sample_metric<Samples>([&](const auto &metric) {
+            if constexpr (std::decay_t<decltype(metric)>::is_sampled) {
+                // keep the hardware sample if any selected hardware sample is derived from it
+                bool selected = this->sample_metric_selected(metric.name);
+                detail::for_each_sample_metric<Samples>([&](const auto &other) {
+                    selected = selected || (other.source_name == metric.name && this->sample_metric_selected(other.name));
+                });
+                if (!selected) {
+                    (samples.*metric.member).reset();
+                }
+                any_sample = any_sample || (samples.*metric.member).has_value();
+            }
+        });
+        return any_sample;
+    }
+    /**
+     * @brief Check whether the samples of any of the sample categories in @p category must be retrieved in the current tick of the sampling loop.
+     * @details A sample category is due if it is enabled and the current tick reached the next slot of its sampling interval on the sampling grid.
+     *          Must only be called in `hardware_sampler::sample()`.
+     * @param[in] category the sample_category to check
+     * @return Returns `true` if @p category must be sampled in the current tick, otherwise `false` (`[[nodiscard]]`)
+     */
+    [[nodiscard]] bool sample_category_due(sample_category category) const noexcept;
+    /**
+     * @brief Return the time elapsed between the current and the previous tick in which the single sample category @p category has been sampled.
+     * @details Must only be called in `hardware_sampler::sample()` if `hardware_sampler::sample_category_due(category)` is `true`.
+     * @param[in] category the sample_category; must be exactly one sample category
+     * @return the elapsed time (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::chrono::steady_clock::duration time_since_previous_sample(sample_category category) const noexcept;
+    /**
+     * @brief Return the last value of the @p samples.
+     * @details Must only be called in the sampling std::thread.
+     * @tparam T the type of the samples
+     * @param[in] samples the samples whose last value should be returned
+     * @return the last value, `std::nullopt` if the @p samples are not available or empty (`[[nodiscard]]`)
+     */
+    template <typename T>
+    [[nodiscard]] static std::optional<double> latest_sample(const std::optional<sample_column<T>> &samples) {
+        if (samples.has_value() && !samples->empty()) {
+            return static_cast<double>(samples->back());
+        }
+        return std::nullopt;
+    }
+    /**
+     * @brief Track the change between the last two @p samples of the single sample category @p category for the adaptive sampling rate.
+     * @details Must only be called in `hardware_sampler::sample()` if `hardware_sampler::sample_category_due(category)` is `true`.
+     *          Does nothing if the @p samples are not available or contain fewer than two values.
+     * @tparam T the type of the samples
+     * @param[in] category the sample_category; must be exactly one sample category
+     * @param[in] samples the samples whose last two values should be compared
+     */
+    template <typename T>
+    void track_sample_change(const sample_category category, const std::optional<sample_column<T>> &samples) noexcept {
+        if (samples.has_value() && samples->size() >= 2) {
+            this->track_sample_change(category, static_cast<double>((*samples)[samples->size() - 2]), static_cast<double>(samples->back()));
+        }
+    }
+    /**
+     * @brief Track the change from @p previous to @p current of a sample of the single sample category @p category for the adaptive sampling rate.
+     * @param[in] category the sample_category; must be exactly one sample category
+     * @param[in] previous the previous value of the sample
+     * @param[in] current the current value of the sample
+     */
+    void track_sample_change(sample_category category, double previous, double current) noexcept;
 
   private:
+    /**
+     * @brief Mark this hardware sampler as started without creating the sampling std::thread.
+     * @throws std::runtime_error if the hardware sampler has already been started
+     */
+    void mark_sampling_started();
+    /**
+     * @brief Add the first time point at @p reference_time_point, retrieve the initial samples, and schedule the first deadline.
+     * @param[in] reference_time_point the time point the deadlines of the sampling loop are based on
+     */
+    void initialize_sampling(std::chrono::steady_clock::time_point reference_time_point);
+    /**
+     * @brief Retrieve the samples for the current deadline (if not paused) at the time point @p now and schedule the next deadline.
+     * @details If a deadline has been missed, the remaining deadlines are handled according to the current overrun_policy.
+     * @param[in] now the time point of the current tick
+     */
+    void sampling_tick(std::chrono::steady_clock::time_point now);
+    /**
+     * @brief Retrieve an on-demand sample requested via `hardware_sampler::sample_now()` at the time point @p now (if not paused).
+     * @details The on-demand sample retrieves the samples of all enabled sample categories. It neither changes the deadlines, the
+     *          slots of the per category sampling intervals, nor the adaptive sampling interval of the regular samples.
+     * @param[in] now the time point of the on-demand sample
+     */
+    void sampling_tick_on_demand(std::chrono::steady_clock::time_point now);
+    /**
+     * @brief Add the time point @p now and retrieve the samples of all sample categories in @p due.
+     * @param[in] now the time point of the samples
+     * @param[in] due the sample categories to retrieve in this tick
+     */
+    void retrieve_samples(std::chrono::steady_clock::time_point now, sample_category due);
+    /**
+     * @brief Return the enabled sample categories whose next slot on the sampling grid has been reached in the slot @p slot and schedule their next slot.
+     * @details The slot of a time point is the number of base sampling intervals since the reference time point.
+     *          A sample category is sampled in the first tick reaching a multiple of its sampling interval stride.
+     * @param[in] slot the slot of the current tick
+     * @return the due sample categories (`[[nodiscard]]`)
+     */
+    [[nodiscard]] sample_category due_sample_categories(std::size_t slot) noexcept;
+    /**
+     * @brief Return the enabled sample categories sampled with the base sampling interval. Retrieved in the burst ticks in between two slots.
+     * @return the sample categories (`[[nodiscard]]`)
+     */
+    [[nodiscard]] sample_category base_interval_sample_categories() const noexcept;
+    /**
+     * @brief Remember @p now as the time point of the previous sample of all sample categories sampled in the current tick.
+     * @param[in] now the time point of the current tick
+     */
+    void record_sampled_categories(std::chrono::steady_clock::time_point now) noexcept;
+    /**
+     * @brief Return the next deadline at which the samples must be retrieved.
+     * @return the next deadline (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::chrono::steady_clock::time_point next_deadline() const noexcept { return next_deadline_; }
+    /**
+     * @brief Return the next deadline the sampling std::thread has to wake up for at the time point @p now.
+     * @details If the sampling has just been resumed, all deadlines that passed while the sampling was paused are skipped (without counting them as missed).
+     *          Must only be called by the sampling std::thread.
+     * @param[in] now the current time point
+     * @return the next deadline, `std::chrono::steady_clock::time_point::max()` if the sampling is paused or has been stopped (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::chrono::steady_clock::time_point pending_deadline(std::chrono::steady_clock::time_point now);
+    /**
+     * @brief Check whether the sampling std::thread observed a pause, but the resources of the hardware samples haven't been released yet.
+     * @return `true` if `hardware_sampler::pause_pending_samples()` must be called (`[[nodiscard]]`)
+     */
+    [[nodiscard]] bool samples_pause_pending() const noexcept { return sampling_paused_ && !samples_paused_ && !this->has_sampling_stopped(); }
+    /**
+     * @brief Release the resources of the hardware samples after the sampling std::thread observed a pause.
+     * @details May block, e.g., until a subprocess exited -> must not be called while holding the sampling_wakeup_ mutex. Must only be called by the sampling std::thread.
+     */
+    void pause_pending_samples();
+
+    /**
+     * @brief The mutex and condition variable used to wake up a sleeping sampling std::thread.
+     * @details Shared by all hardware samplers driven by the same sampling std::thread.
+     */
+    struct sampling_wakeup {
+        /// The mutex guarding the sleep of the sampling std::thread.
+        std::mutex mutex{};
+        /// The condition variable the sampling std::thread sleeps on.
+        std::condition_variable cv{};
+
+        /**
+         * @brief Wake up the sampling std::thread, e.g., after the sampling has been stopped, paused, or resumed.
+         * @details The state change must have been published before calling this function. Acquiring the mutex ensures that the sampling
+         *          std::thread either already sleeps or sees the new state before it goes to sleep, i.e., the notification can't be lost.
+         */
+        void notify() {
+            {
+                const std::lock_guard lock{ mutex };
+            }
+            cv.notify_all();
+        }
+    };
+
+    /**
+     * @brief Return the last time points of the @p column of the ticks in which any of the sample categories in @p category has been sampled.
+     * @details Only the time points of the retained samples are returned if a sample retention is used.
+     * @param[in] column the time points of all ticks, e.g., time_points_
+     * @param[in] num_time_points the number of time points in @p column to consider (a consistent prefix while the sampling is running)
+     * @param[in] category the sample categories; `std::nullopt` selects all ticks
+     * @return the time points (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::vector<std::chrono::steady_clock::time_point> retained_time_points(const sample_column<std::chrono::steady_clock::time_point> &column, std::size_t num_time_points, std::optional<sample_category> category) const;
+    /**
+     * @brief Return the time needed to query the samples of the ticks in which any of the sample categories in @p category has been sampled.
+     * @param[in] category the sample categories; `std::nullopt` selects all ticks
+     * @return the query latencies (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::vector<std::chrono::nanoseconds> retained_query_latencies(std::optional<sample_category> category) const;
+    /**
+     * @brief Return the number of samples per hardware sample retained in the ring buffers, including the samples retained for the streaming statistics.
+     * @return the number of retained samples, `0` if all samples are retained (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::size_t num_retained_samples() const noexcept;
+    /**
+     * @brief Return the number of samples per hardware sample whose storage is allocated before the sampling loop starts.
+     * @return the number of samples, `0` if no storage is preallocated (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::size_t expected_num_samples() const noexcept;
+
+    /**
+     * @brief The sampling loop running in the sampling std::thread.
+     * @details The deadlines are absolute time points on a fixed grid. Therefore, the time needed to retrieve the samples doesn't accumulate over time.
+     *          Between two deadlines, the std::thread sleeps on a condition variable such that stopping the sampling doesn't have to wait for the next deadline.
+     *          While the sampling is paused, the std::thread sleeps until the sampling is resumed or stopped.
+     */
+    void sampling_loop();
+
     /// A boolean flag indicating whether the sampling has already started.
     std::atomic<bool> sampling_started_{ false };
     /// A boolean flag indicating whether the sampling has already stopped.
     std::atomic<bool> sampling_stopped_{ false };
     /// A boolean flag indicating whether the sampling is currently running.
     std::atomic<bool> sampling_running_{ false };
+    /// A boolean flag indicating whether the initial samples have already been retrieved.
+    std::atomic<bool> samples_initialized_{ false };
+    /// A boolean flag indicating whether an on-demand sample has been requested.
+    std::atomic<bool> sample_requested_{ false };
+    /// `true` if the samples are retrieved by the shared sampling std::thread of a system_hardware_sampler.
+    bool uses_shared_sampling_thread_{ false };
+    /// `true` if the shared sampling std::thread observed the stop, i.e., doesn't access this hardware sampler anymore. Guarded by the sampling_wakeup_ mutex.
+    bool sampling_stop_acknowledged_{ false };
 
     /// The wallclock time where the hardware sampling started.
     std::chrono::system_clock::time_point start_date_time_{};
 
-    /// The different tracked events.
-    std::vector<event> events_{};
+    /**
+     * @brief Merge all events recorded since the last call into the events sorted by their time points.
+     * @details The events_mutex_ must be held by the caller.
+     */
+    void merge_recorded_events() const;
+
+    /// The events recorded by any thread that haven't been merged into the sorted events yet.
+    mutable detail::event_queue recorded_events_{};
+    /// The mutex guarding the merging of the recorded events. Only locked when accessing the events, never when adding a new event.
+    mutable std::mutex events_mutex_{};
+    /// The different tracked events sorted by their time points.
+    mutable std::vector<event> events_{};
+
+    /**
+     * @brief Aggregate the samples of the current tick into all open regions.
+     * @details Must only be called in the sampling std::thread after `hardware_sampler::sample()`.
+     */
+    void update_region_aggregates();
+    /**
+     * @brief End the open region with the ID @p id at the time point @p end_time_point with the energy counter @p end_energy.
+     * @details The regions_mutex_ must be held by the caller.
+     * @param[in] id the ID of the region to end
+     * @param[in] end_time_point the time point the region ended at
+     * @param[in] end_energy the energy counter when the region ended
+     * @return the ended region
+     */
+    energy_region finish_region(std::size_t id, std::chrono::steady_clock::time_point end_time_point, std::optional<double> end_energy);
+
+    /**
+     * @brief Record the numeric hardware samples of the current tick and evaluate the triggers or end the active burst if its post-trigger window has elapsed at @p now.
+     * @details Must only be called in the sampling std::thread after `hardware_sampler::sample()`.
+     * @param[in] now the time point of the current tick
+     */
+    void update_burst_capture(std::chrono::steady_clock::time_point now);
+    /**
+     * @brief Save the numeric hardware samples of the active burst as hws::burst_capture and re-arm the triggers.
+     * @details Must only be called in the sampling std::thread.
+     */
+    void finish_burst_capture();
+    /**
+     * @brief Capture the active burst with a truncated post-trigger window and release the resources of the hardware samples.
+     * @details Must only be called once in the sampling std::thread after the sampling has been stopped.
+     */
+    void finish_sampling();
+
+    /// The mutex guarding the regions.
+    mutable std::mutex regions_mutex_{};
+    /// The regions in the order they have been begun.
+    std::vector<energy_region> regions_{};
+    /// The IDs of the currently open regions.
+    std::vector<std::size_t> open_regions_{};
+    /// The number of currently open regions. Used to skip the aggregation in the sampling std::thread without acquiring the regions_mutex_.
+    std::atomic<std::size_t> num_open_regions_{ 0 };
+
+    /// The triggers (name and predicate) in the order they have been added.
+    std::vector<std::pair<std::string, std::function<bool()>>> triggers_{};
+    /// The duration captured before a trigger fired.
+    std::chrono::nanoseconds pre_trigger_duration_{ 0 };
+    /// The duration captured after a trigger fired.
+    std::optional<std::chrono::nanoseconds> post_trigger_duration_{};
+    /// The sampling interval while a burst is active, `std::nullopt` to use the base sampling interval.
+    std::optional<std::chrono::nanoseconds> burst_sampling_interval_{};
+    /// The ring of the numeric hardware samples of the last ticks within the pre-trigger window.
+    detail::burst_history burst_history_{};
+    /// The time points of the active burst.
+    std::vector<std::chrono::steady_clock::time_point> burst_time_points_{};
+    /// The series of the numeric hardware samples of the active burst (one per name).
+    std::vector<std::vector<double>> burst_series_{};
+    /// The index of the trigger that fired the active burst, `std::nullopt` if no burst is active.
+    std::optional<std::size_t> burst_trigger_{};
+    /// The time point the trigger of the active burst fired at.
+    std::chrono::steady_clock::time_point burst_trigger_time_point_{};
+    /// The mutex guarding the burst captures.
+    mutable std::mutex burst_captures_mutex_{};
+    /// The burst captures in the order their triggers fired.
+    std::vector<burst_capture> burst_captures_{};
+
+    /**
+     * @brief Call all tick callbacks with a view of the tick at the time point @p now.
+     * @details Must only be called in the sampling std::thread after the samples of the tick have been retrieved.
+     * @param[in] now the time point of the current tick
+     * @param[in] on_demand `true` if the current tick retrieved an on-demand sample
+     */
+    void notify_tick_callbacks(std::chrono::steady_clock::time_point now, bool on_demand);
+
+    /**
+     * @brief Write the numeric hardware samples retrieved in the current tick to numeric_sample_values_ (NaN for the sample categories not retrieved in this tick).
+     * @details Must only be called in the sampling std::thread after the samples of the tick have been retrieved.
+     */
+    void update_numeric_sample_values();
+
+    /// The names of the numeric hardware samples passed to the tick callbacks and captured in the burst captures.
+    std::vector<std::string> numeric_sample_names_{};
+    /// The numeric hardware samples of the current tick (reused to avoid memory allocations in the sampling loop).
+    std::vector<double> numeric_sample_values_{};
+
+    /// The type of the list of the tick callbacks (ID and callback) in the order they have been added. The callbacks are shared between the lists.
+    using tick_callback_list = std::vector<std::pair<std::size_t, std::shared_ptr<const std::function<void(const tick_view &)>>>>;
+    /// The mutex guarding the tick callbacks. Only held to replace or copy the immutable list, never while the callbacks are called.
+    mutable std::mutex tick_callbacks_mutex_{};
+    /// The tick callbacks. Replaced by a new list when a callback is added or removed, such that the sampling std::thread can call the callbacks of its copy without holding the tick_callbacks_mutex_.
+    std::shared_ptr<const tick_callback_list> tick_callbacks_{ std::make_shared<const tick_callback_list>() };
+    /// The ID of the next tick callback.
+    std::size_t next_tick_callback_id_{ 0 };
+    /// The number of tick callbacks. Used to skip the notification in the sampling std::thread without acquiring the tick_callbacks_mutex_.
+    std::atomic<std::size_t> num_tick_callbacks_{ 0 };
+    /// `true` while the sampling std::thread calls the callbacks of its copy of the tick_callbacks_.
+    std::atomic<bool> tick_callbacks_running_{ false };
 
     /// The std::thread used to getter the hardware samples.
     std::thread sampling_thread_{};
+    /// The ID of the std::thread retrieving the hardware samples (either sampling_thread_ or the shared std::thread of a system_hardware_sampler).
+    std::atomic<std::thread::id> sampling_thread_id_{};
 
     /// The time points at which this hardware sampler sampled its values.
-    std::vector<std::chrono::steady_clock::time_point> time_points_{};
+    sample_column<std::chrono::steady_clock::time_point> time_points_{};
+    /// The sample categories sampled in each tick. Published before time_points_.
+    sample_column<sample_category> sampled_categories_{};
+    /// The time points at which this hardware sampler started to query the samples of each tick.
+    sample_column<std::chrono::steady_clock::time_point> query_begin_time_points_{};
+    /// The time points at which this hardware sampler finished to query the samples of each tick. Published after query_begin_time_points_.
+    sample_column<std::chrono::steady_clock::time_point> query_end_time_points_{};
+    /// The time needed to query the samples of the last tick. Only accessed by the sampling std::thread.
+    std::chrono::nanoseconds last_query_latency_{ 0 };
 
     /// The sampling interval of this hardware sampler.
-    const std::chrono::milliseconds sampling_interval_{};
+    const std::chrono::nanoseconds sampling_interval_{};
+
+    /// The number of distinct sample categories (without the shortcuts).
+    static constexpr std::size_t num_sample_categories_ = 7;
+    /// The sampling interval of each sample category as multiple of the base sampling interval.
+    std::array<std::size_t, num_sample_categories_> sampling_interval_strides_{ 1, 1, 1, 1, 1, 1, 1 };
+    /// The time point of the first tick; the origin of the sampling grid.
+    std::chrono::steady_clock::time_point reference_time_point_{};
+    /// The next slot on the sampling grid in which each sample category must be sampled. Only accessed by the sampling std::thread.
+    std::array<std::size_t, num_sample_categories_> next_due_slots_{};
+    /// The time point of the previous tick in which each sample category has been sampled. Only accessed by the sampling std::thread.
+    std::array<std::chrono::steady_clock::time_point, num_sample_categories_> previous_sample_time_points_{};
+    /// The sample categories sampled in the current tick. Only accessed by the sampling std::thread.
+    sample_category due_categories_{};
+
+    /// The upper bound of the adaptive sampling interval as multiple of the base sampling interval (1 means disabled).
+    std::size_t max_sampling_interval_stride_{ 1 };
+    /// The relative change of the tracked samples per sample category that resets the adaptive sampling interval.
+    std::array<double, num_sample_categories_> adaptive_sampling_thresholds_{ 0.05, 0.05, 0.05, 0.05, 0.05, 0.05, 0.05 };
+    /// The current adaptive sampling interval as multiple of the base sampling interval.
+    std::size_t adaptive_sampling_stride_{ 1 };
+    /// A boolean flag indicating whether any sample has been tracked in the current tick.
+    bool sample_change_tracked_{ false };
+    /// A boolean flag indicating whether any tracked sample exceeded its threshold in the current tick.
+    bool sample_change_detected_{ false };
+
+    /// The number of retained samples per hardware sample (0 means all samples are retained).
+    std::size_t sample_retention_{ 0 };
+    /// `true` if the hardware samples are stored compressed.
+    bool sample_compression_{ false };
+    /// `true` if the arithmetic hardware samples are summarized by streaming statistics and only the last two samples are retained.
+    bool streaming_statistics_{ false };
+    /// The names of the selected hardware samples (sorted; empty means all hardware samples are selected).
+    std::vector<std::string> sample_metrics_{};
+    /// The expected sampling duration used to preallocate the storage of the hardware samples (0 means no preallocation).
+    std::chrono::nanoseconds expected_sampling_duration_{ 0 };
+    /// `true` if only the energy counters at the begin and end of the regions are read without a sampling std::thread.
+    bool marker_only_mode_{ false };
+
+    /// The policy used if retrieving a sample takes longer than the sampling interval.
+    overrun_policy overrun_policy_{ overrun_policy::skip };
+
+    /// The timing statistics of the sampling loop. Guarded by sampling_statistics_mutex_.
+    hws::sampling_statistics sampling_statistics_{};
+    /// The mutex guarding the sampling statistics, which are updated by the sampling std::thread while they may be read by any thread.
+    mutable std::mutex sampling_statistics_mutex_{};
+
+    /// The next deadline on the fixed sampling grid.
+    std::chrono::steady_clock::time_point next_deadline_{};
+    /// A boolean flag indicating whether the sampling std::thread observed a pause whose skipped deadlines haven't been handled yet.
+    bool sampling_paused_{ false };
+    /// A boolean flag indicating whether `hardware_sampler::pause_samples()` has been called without a subsequent call to `hardware_sampler::resume_samples()`.
+    bool samples_paused_{ false };
+    /// Used to wake up the sampling std::thread immediately if the sampling is stopped, paused, or resumed.
+    std::shared_ptr<sampling_wakeup> sampling_wakeup_{ std::make_shared<sampling_wakeup>() };
 
     /// The bitmask of sample categories to use.
     const sample_category sample_category_{};
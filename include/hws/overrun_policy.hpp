@@ -0,0 +1,49 @@
+/**
+ * @file
+ * @author Marcel Breyer
+ * @copyright 2024-today All Rights Reserved
+ * @license This file is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Defines an enum class with the policies describing how the sampling loop handles missed deadlines.
+ */
+
+#ifndef HWS_OVERRUN_POLICY_HPP_
+#define HWS_OVERRUN_POLICY_HPP_
+#pragma once
+
+#include "fmt/ostream.h"  // fmt::formatter, fmt::ostream_formatter
+
+#include <iosfwd>  // std::ostream forward declaration
+
+namespace hws {
+
+/**
+ * @brief Enum class containing the possible policies if retrieving a sample takes longer than the sampling interval.
+ * @details The deadlines of the sampling loop always lie on a fixed grid starting at the first time point.
+ */
+enum class overrun_policy {
+    /// Retrieve the samples of all missed deadlines back-to-back until the sampling loop is on schedule again.
+    catch_up,
+    /// Drop all already missed deadlines and continue with the next deadline lying in the future (default).
+    skip
+};
+
+/**
+ * @brief Output the overrun_policy @p policy to the given output-stream @p out.
+ * @param[in,out] out the output-stream to write the overrun_policy to
+ * @param[in] policy the overrun_policy
+ * @return the output-stream
+ */
+std::ostream &operator<<(std::ostream &out, overrun_policy policy);
+
+}  // namespace hws
+
+/// @cond Doxygen_suppress
+
+template <>
+struct fmt::formatter<hws::overrun_policy> : fmt::ostream_formatter { };
+
+/// @endcond
+
+#endif  // HWS_OVERRUN_POLICY_HPP_
@@ -17,26 +17,29 @@ namespace hws {
 /**
  * @brief Enum class as bitfield containing the possible sample categories.
  * @details The sample_category "gfx" and "idle_state" are only used in the cpu_hardware_sampler.
- *          Additionally, the "all" sample_category is available to easily enable all hardware samples (default).
+ *          Additionally, the "all" sample_category is available to easily enable all hardware samples (default) and
+ *          the "high_frequency" sample_category to only enable the samples that are cheap to query.
  */
 enum class sample_category : int {
     // clang-format off
     /// General hardware samples like architecture, names, or utilization.
-    general     = 0b00000001,
+    general        = 0b00000001,
     /// Clock-related hardware samples like minimum, maximum, and current frequencies or throttle reasons.
-    clock       = 0b00000010,
+    clock          = 0b00000010,
     /// Power-related hardware samples like current power draw or total energy consumption.
-    power       = 0b00000100,
+    power          = 0b00000100,
     /// Memory-related hardware samples like memory usage or PCIe information.
-    memory      = 0b00001000,
+    memory         = 0b00001000,
     /// Temperature-related hardware samples like maximum and current temperatures.
-    temperature = 0b00010000,
+    temperature    = 0b00010000,
     /// Gfx-related (iGPU) hardware samples. Only used in the cpu_hardware_sampler.
-    gfx         = 0b00100000,
+    gfx            = 0b00100000,
     /// Idle-state-related hardware samples. Only used in the cpu_hardware_sampler.
-    idle_state  = 0b01000000,
+    idle_state     = 0b01000000,
     /// Shortcut to enable all available hardware samples (default).
-    all         = 0b01111111
+    all            = 0b01111111,
+    /// Shortcut to only enable the clock- and power-related hardware samples, which are cheap enough to be queried with sub-millisecond sampling intervals.
+    high_frequency = 0b00000110
     // clang-format on
 };
 
@@ -0,0 +1,733 @@
+/**
+ * @file
+ * @author Marcel Breyer
+ * @copyright 2024-today All Rights Reserved
+ * @license This file is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Defines an append-only column storing the values of a single sampled hardware sample.
+ */
+
+#ifndef HWS_SAMPLE_COLUMN_HPP_
+#define HWS_SAMPLE_COLUMN_HPP_
+#pragma once
+
+#include "hws/sample_compression.hpp"    // hws::detail::{is_compressible_v, sample_codec}
+#include "hws/streaming_statistics.hpp"  // hws::streaming_statistics
+
+#include <algorithm>         // std::max
+#include <array>             // std::array
+#include <atomic>            // std::atomic, std::memory_order_acquire, std::memory_order_release, std::memory_order_relaxed
+#include <cstddef>           // std::size_t, std::ptrdiff_t
+#include <cstdint>           // std::uint8_t
+#include <initializer_list>  // std::initializer_list
+#include <iterator>          // std::random_access_iterator_tag
+#include <limits>            // std::numeric_limits
+#include <memory>            // std::unique_ptr
+#include <optional>          // std::optional, std::nullopt
+#include <type_traits>       // std::is_arithmetic_v
+#include <utility>           // std::move, std::forward
+#include <vector>            // std::vector
+
+namespace hws {
+
+/**
+ * @brief The configuration of a sample_column, i.e., how its values are retained and stored.
+ * @details The hardware samplers pass the configuration resulting from their sample retention, compression, and streaming statistics settings to
+ *          all sample columns created by their backends (see `hws::hardware_sampler::column_config()`).
+ */
+struct sample_column_config {
+    /// The maximum number of retained values, `0` means unbounded.
+    std::size_t capacity{ 0 };
+    /// The expected number of values whose storage is allocated when the sample_column is created, `0` means unknown.
+    std::size_t expected_size{ 0 };
+    /// `true` if the values should be stored compressed (if supported by their value type).
+    bool compression{ false };
+    /// `true` if all appended values should be summarized in a hws::streaming_statistics (if their value type is arithmetic).
+    bool statistics{ false };
+};
+
+/**
+ * @brief An append-only column storing the values of a single sampled hardware sample.
+ * @details The column supports a single writer (the sampling std::thread) and multiple concurrent readers without any locks.
+ *          The values are stored in chunks of geometrically increasing size that are never relocated, i.e., already published values
+ *          never move in memory. The writer publishes a new value by atomically increasing the size *after* the value has been written.
+ *          Therefore, a reader always sees a consistent prefix of the column of length `sample_column::size()`.
+ *          All non-const member functions must only be called by the single writer.
+ *
+ *          If the column has a fixed capacity, it is a ring buffer retaining only the last `sample_column::capacity()` values, i.e., appending
+ *          a new value to a full column discards its oldest value. Since discarded values are overwritten, a column with a fixed capacity must
+ *          not be read concurrently to the writer.
+ *
+ *          If the column is compressed, the values are appended to an uncompressed block that is compressed as soon as it is full
+ *          (see hws::detail::sample_codec). Reading a compressed value decompresses its whole block into a cache, i.e., reading the values in order
+ *          decompresses each block only once. A reference to a compressed value is only valid until a value of another compressed block is read.
+ *          Since the cache is shared, a compressed column must not be read concurrently.
+ *
+ *          If the column maintains a summary, every appended value is additionally added to a hws::streaming_statistics, i.e., the summary
+ *          also covers the values that have already been discarded by the ring buffer.
+ * @tparam T the type of the stored values
+ */
+template <typename T>
+class sample_column {
+  public:
+    /// The type of the stored values.
+    using value_type = T;
+    /// The unsigned integer type used for indices and sizes.
+    using size_type = std::size_t;
+    /// The signed integer type used for differences between indices.
+    using difference_type = std::ptrdiff_t;
+    /// The type of a reference to a stored value.
+    using reference = value_type &;
+    /// The type of a const reference to a stored value.
+    using const_reference = const value_type &;
+
+    /**
+     * @brief A random access iterator over a consistent prefix of the values stored in a sample_column.
+     */
+    class const_iterator {
+      public:
+        /// The iterator category.
+        using iterator_category = std::random_access_iterator_tag;
+        /// The type of the iterated values.
+        using value_type = T;
+        /// The signed integer type used for differences between iterators.
+        using difference_type = std::ptrdiff_t;
+        /// The type of a pointer to an iterated value.
+        using pointer = const T *;
+        /// The type of a reference to an iterated value.
+        using reference = const T &;
+
+        /**
+         * @brief Default construct an invalid iterator.
+         */
+        const_iterator() = default;
+
+        /**
+         * @brief Construct an iterator pointing to the value with index @p idx in the @p column.
+         * @param[in] column the iterated sample_column
+         * @param[in] idx the current index
+         */
+        const_iterator(const sample_column *column, const size_type idx) noexcept :
+            column_{ column },
+            idx_{ idx } { }
+
+        /**
+         * @brief Access the current value.
+         * @return the current value (`[[nodiscard]]`)
+         */
+        [[nodiscard]] reference operator*() const noexcept { return (*column_)[idx_]; }
+
+        /**
+         * @brief Access the current value.
+         * @return a pointer to the current value (`[[nodiscard]]`)
+         */
+        [[nodiscard]] pointer operator->() const noexcept { return &(*column_)[idx_]; }
+
+        /**
+         * @brief Access the value @p n positions after the current one.
+         * @param[in] n the offset
+         * @return the value (`[[nodiscard]]`)
+         */
+        [[nodiscard]] reference operator[](const difference_type n) const noexcept { return (*column_)[static_cast<size_type>(static_cast<difference_type>(idx_) + n)]; }
+
+        /**
+         * @brief Advance the iterator by one position.
+         * @return a reference to this iterator
+         */
+        const_iterator &operator++() noexcept {
+            ++idx_;
+            return *this;
+        }
+
+        /**
+         * @brief Advance the iterator by one position.
+         * @return the iterator before advancing
+         */
+        const_iterator operator++(int) noexcept {
+            const_iterator tmp{ *this };
+            ++idx_;
+            return tmp;
+        }
+
+        /**
+         * @brief Move the iterator back by one position.
+         * @return a reference to this iterator
+         */
+        const_iterator &operator--() noexcept {
+            --idx_;
+            return *this;
+        }
+
+        /**
+         * @brief Move the iterator back by one position.
+         * @return the iterator before moving back
+         */
+        const_iterator operator--(int) noexcept {
+            const_iterator tmp{ *this };
+            --idx_;
+            return tmp;
+        }
+
+        /**
+         * @brief Advance the iterator by @p n positions.
+         * @param[in] n the offset
+         * @return a reference to this iterator
+         */
+        const_iterator &operator+=(const difference_type n) noexcept {
+            idx_ = static_cast<size_type>(static_cast<difference_type>(idx_) + n);
+            return *this;
+        }
+
+        /**
+         * @brief Move the iterator back by @p n positions.
+         * @param[in] n the offset
+         * @return a reference to this iterator
+         */
+        const_iterator &operator-=(const difference_type n) noexcept {
+            idx_ = static_cast<size_type>(static_cast<difference_type>(idx_) - n);
+            return *this;
+        }
+
+        /**
+         * @brief Return a new iterator advanced by @p n positions.
+         * @param[in] it the iterator
+         * @param[in] n the offset
+         * @return the new iterator (`[[nodiscard]]`)
+         */
+        [[nodiscard]] friend const_iterator operator+(const_iterator it, const difference_type n) noexcept { return it += n; }
+
+        /**
+         * @brief Return a new iterator moved back by @p n positions.
+         * @param[in] it the iterator
+         * @param[in] n the offset
+         * @return the new iterator (`[[nodiscard]]`)
+         */
+        [[nodiscard]] friend const_iterator operator-(const_iterator it, const difference_type n) noexcept { return it -= n; }
+
+        /**
+         * @brief Return the distance between the iterators @p lhs and @p rhs.
+         * @param[in] lhs the first iterator
+         * @param[in] rhs the second iterator
+         * @return the distance (`[[nodiscard]]`)
+         */
+        [[nodiscard]] friend difference_type operator-(const const_iterator &lhs, const const_iterator &rhs) noexcept { return static_cast<difference_type>(lhs.idx_) - static_cast<difference_type>(rhs.idx_); }
+
+        /**
+         * @brief Compare the iterators @p lhs and @p rhs for equality.
+         * @param[in] lhs the first iterator
+         * @param[in] rhs the second iterator
+         * @return `true` if both iterators point to the same position, otherwise `false` (`[[nodiscard]]`)
+         */
+        [[nodiscard]] friend bool operator==(const const_iterator &lhs, const const_iterator &rhs) noexcept { return lhs.idx_ == rhs.idx_; }
+
+        /**
+         * @brief Compare the iterators @p lhs and @p rhs for inequality.
+         * @param[in] lhs the first iterator
+         * @param[in] rhs the second iterator
+         * @return `true` if both iterators point to different positions, otherwise `false` (`[[nodiscard]]`)
+         */
+        [[nodiscard]] friend bool operator!=(const const_iterator &lhs, const const_iterator &rhs) noexcept { return lhs.idx_ != rhs.idx_; }
+
+        /**
+         * @brief Check whether the iterator @p lhs points to a position before @p rhs.
+         * @param[in] lhs the first iterator
+         * @param[in] rhs the second iterator
+         * @return `true` if @p lhs points to a position before @p rhs, otherwise `false` (`[[nodiscard]]`)
+         */
+        [[nodiscard]] friend bool operator<(const const_iterator &lhs, const const_iterator &rhs) noexcept { return lhs.idx_ < rhs.idx_; }
+
+      private:
+        /// The iterated sample_column.
+        const sample_column *column_{ nullptr };
+        /// The current index.
+        size_type idx_{ 0 };
+    };
+
+    /**
+     * @brief Default construct an empty, unbounded, and uncompressed sample_column without a summary.
+     */
+    sample_column() = default;
+
+    /**
+     * @brief Construct an empty sample_column with the capacity, compression, and summary given by @p config.
+     * @details Allocates the storage for `sample_column_config::expected_size` values.
+     * @param[in] config the configuration of the sample_column
+     */
+    explicit sample_column(const sample_column_config &config) :
+        capacity_{ config.capacity },
+        compressed_{ detail::is_compressible_v<T> && config.compression && capacity_ == 0 },
+        statistics_{ initial_statistics(config.statistics) } {
+        this->reserve(config.expected_size);
+    }
+
+    /**
+     * @brief Construct a sample_column containing the values in @p init.
+     * @param[in] init the initial values
+     */
+    sample_column(std::initializer_list<T> init) :
+        sample_column{ sample_column_config{}, init } { }
+
+    /**
+     * @brief Construct a sample_column with the capacity, compression, and summary given by @p config containing the values in @p init.
+     * @details Allocates the storage for `sample_column_config::expected_size` values.
+     * @param[in] config the configuration of the sample_column
+     * @param[in] init the initial values
+     */
+    sample_column(const sample_column_config &config, std::initializer_list<T> init) :
+        sample_column{ config } {
+        this->reserve(std::max(config.expected_size, init.size()));
+        for (const T &val : init) {
+            this->push_back(val);
+        }
+    }
+
+    /**
+     * @brief Copy construct a sample_column containing the currently published values of @p other.
+     * @param[in] other the sample_column to copy
+     */
+    sample_column(const sample_column &other) :
+        capacity_{ other.capacity_ },
+        compressed_{ other.compressed_ },
+        statistics_{} {
+        const size_type size = other.size();
+        this->reserve(size);
+        for (size_type i = 0; i < size; ++i) {
+            this->push_back(other[i]);
+        }
+        num_discarded_ = other.num_discarded_;
+        // the summary also covers the values that are no longer retained -> copy it instead of recomputing it
+        statistics_ = other.statistics_;
+    }
+
+    /**
+     * @brief Move construct a sample_column. Must not be called while @p other is being read or written concurrently.
+     * @param[in,out] other the sample_column to move from
+     */
+    sample_column(sample_column &&other) noexcept :
+        chunks_{ std::move(other.chunks_) },
+        size_{ other.size_.load(std::memory_order_relaxed) },
+        capacity_{ other.capacity_ },
+        first_{ other.first_ },
+        num_discarded_{ other.num_discarded_ },
+        compressed_{ other.compressed_ },
+        compressed_blocks_{ std::move(other.compressed_blocks_) },
+        decompressed_block_{ std::move(other.decompressed_block_) },
+        decompressed_block_index_{ other.decompressed_block_index_ },
+        statistics_{ std::move(other.statistics_) } {
+        other.size_.store(0, std::memory_order_relaxed);
+        other.first_ = 0;
+        other.num_discarded_ = 0;
+        other.compressed_blocks_.clear();
+        other.decompressed_block_index_ = no_block_;
+        other.reset_statistics();
+    }
+
+    /**
+     * @brief Copy assign the currently published values of @p other. Must not be called while this sample_column is being read concurrently.
+     * @param[in] other the sample_column to copy
+     * @return a reference to this sample_column
+     */
+    sample_column &operator=(const sample_column &other) {
+        if (this != &other) {
+            sample_column tmp{ other };
+            *this = std::move(tmp);
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Move assign @p other. Must not be called while this sample_column or @p other are being read or written concurrently.
+     * @param[in,out] other the sample_column to move from
+     * @return a reference to this sample_column
+     */
+    sample_column &operator=(sample_column &&other) noexcept {
+        if (this != &other) {
+            chunks_ = std::move(other.chunks_);
+            size_.store(other.size_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            capacity_ = other.capacity_;
+            first_ = other.first_;
+            num_discarded_ = other.num_discarded_;
+            compressed_ = other.compressed_;
+            compressed_blocks_ = std::move(other.compressed_blocks_);
+            decompressed_block_ = std::move(other.decompressed_block_);
+            decompressed_block_index_ = other.decompressed_block_index_;
+            statistics_ = std::move(other.statistics_);
+            other.size_.store(0, std::memory_order_relaxed);
+            other.first_ = 0;
+            other.num_discarded_ = 0;
+            other.compressed_blocks_.clear();
+            other.decompressed_block_index_ = no_block_;
+            other.reset_statistics();
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Default destructor.
+     */
+    ~sample_column() = default;
+
+    /**
+     * @brief Append the value @p val and publish it to all readers.
+     * @param[in] val the value to append
+     */
+    void push_back(const T &val) { this->emplace_back(val); }
+
+    /**
+     * @copydoc hws::sample_column::push_back(const T &)
+     */
+    void push_back(T &&val) { this->emplace_back(std::move(val)); }
+
+    /**
+     * @brief Append a new value constructed from @p args and publish it to all readers.
+     * @tparam Args the types of the constructor arguments
+     * @param[in] args the constructor arguments
+     */
+    template <typename... Args>
+    void emplace_back(Args &&...args) {
+        if constexpr (std::is_arithmetic_v<T>) {
+            if (statistics_.has_value()) {
+                // construct the value only once to add it to the summary and the column
+                const T val(std::forward<Args>(args)...);
+                statistics_->add(static_cast<double>(val));
+                this->append(val);
+                return;
+            }
+        }
+        this->append(std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Remove all values. Must not be called while this sample_column is being read concurrently.
+     */
+    void clear() noexcept {
+        size_.store(0, std::memory_order_relaxed);
+        first_ = 0;
+        num_discarded_ = 0;
+        compressed_blocks_.clear();
+        decompressed_block_index_ = no_block_;
+        this->reset_statistics();
+        for (auto &chunk : chunks_) {
+            chunk.reset();
+        }
+    }
+
+    /**
+     * @brief Allocate the storage for at least @p size values such that appending up to @p size values doesn't allocate any memory.
+     * @details Already published values are never relocated. Therefore, reserve may be called while the sample_column is read concurrently.
+     * @param[in] size the number of values to allocate the storage for
+     */
+    void reserve(const size_type size) {
+        if (size == 0) {
+            return;
+        }
+        if (compressed_) {
+            // only the uncompressed block has to be allocated upfront
+            if (chunks_[0] == nullptr) {
+                chunks_[0] = allocate(compressed_block_size_);
+            }
+            return;
+        }
+        if (capacity_ != 0) {
+            // ring buffer: the whole capacity is allocated at once
+            if (chunks_[0] == nullptr) {
+                chunks_[0] = allocate(capacity_);
+            }
+            return;
+        }
+        // allocate all chunks up to (and including) the chunk containing the last reserved value
+        const size_type last_chunk = locate(size - 1)[0];
+        for (size_type chunk = 0; chunk <= last_chunk; ++chunk) {
+            if (chunks_[chunk] == nullptr) {
+                chunks_[chunk] = allocate(chunk_size(chunk));
+            }
+        }
+    }
+
+    /**
+     * @brief Set the maximum number of retained values to @p capacity, `0` means unbounded. Must only be called while the sample_column is empty.
+     * @param[in] capacity the new capacity
+     */
+    void set_capacity(const size_type capacity) noexcept {
+        this->clear();
+        capacity_ = capacity;
+        // a ring buffer overwrites its values in place -> can't be compressed
+        compressed_ = compressed_ && capacity_ == 0;
+    }
+
+    /**
+     * @brief Enable or disable the compression of the values. Must only be called while the sample_column is empty.
+     * @details Only sample columns with compressible values (see hws::detail::is_compressible) and an unbounded capacity can be compressed.
+     * @param[in] compressed `true` to compress the values, `false` otherwise
+     */
+    void set_compressed(const bool compressed) noexcept {
+        this->clear();
+        compressed_ = detail::is_compressible_v<T> && compressed && capacity_ == 0;
+    }
+
+    /**
+     * @brief Check whether the values are stored compressed.
+     * @return `true` if the values are compressed, `false` otherwise (`[[nodiscard]]`)
+     */
+    [[nodiscard]] bool compressed() const noexcept { return compressed_; }
+
+    /**
+     * @brief Return the streaming summary of all values ever appended to this sample_column, including the already discarded ones.
+     * @details Only available if the sample_column has been created with `sample_column_config::statistics` set and its value type is arithmetic.
+     *          Must not be called while this sample_column is being written concurrently.
+     * @return the summary, `std::nullopt` if no summary is maintained (`[[nodiscard]]`)
+     */
+    [[nodiscard]] const std::optional<streaming_statistics> &statistics() const noexcept { return statistics_; }
+
+    /**
+     * @brief Return the maximum number of retained values.
+     * @return the capacity, `0` if the sample_column is unbounded (`[[nodiscard]]`)
+     */
+    [[nodiscard]] size_type capacity() const noexcept { return capacity_; }
+
+    /**
+     * @brief Return the number of values that have been discarded because the sample_column was full.
+     * @details The value with index `idx` is the `num_discarded() + idx`-th value ever appended to this sample_column.
+     * @return the number of discarded values (`[[nodiscard]]`)
+     */
+    [[nodiscard]] size_type num_discarded() const noexcept { return num_discarded_; }
+
+    /**
+     * @brief Return the number of currently published values.
+     * @return the number of values (`[[nodiscard]]`)
+     */
+    [[nodiscard]] size_type size() const noexcept { return size_.load(std::memory_order_acquire); }
+
+    /**
+     * @brief Check whether no value has been published yet.
+     * @return `true` if the sample_column is empty, otherwise `false` (`[[nodiscard]]`)
+     */
+    [[nodiscard]] bool empty() const noexcept { return this->size() == 0; }
+
+    /**
+     * @brief Return the value at index @p idx. The index must be smaller than a previously observed `sample_column::size()`.
+     * @param[in] idx the index of the value
+     * @return the value (`[[nodiscard]]`)
+     */
+    [[nodiscard]] const_reference operator[](const size_type idx) const noexcept {
+        if (compressed_) {
+            const size_type block = idx / compressed_block_size_;
+            if (block < compressed_blocks_.size()) {
+                return this->decompressed_value(block, idx % compressed_block_size_);
+            }
+            return chunks_[0][idx % compressed_block_size_];
+        }
+        if (capacity_ != 0) {
+            return chunks_[0][(first_ + idx) % capacity_];
+        }
+        const auto [chunk, offset] = locate(idx);
+        return chunks_[chunk][offset];
+    }
+
+    /**
+     * @brief Return the first value. The sample_column must not be empty.
+     * @return the first value (`[[nodiscard]]`)
+     */
+    [[nodiscard]] const_reference front() const noexcept { return (*this)[0]; }
+
+    /**
+     * @brief Return the last published value. The sample_column must not be empty.
+     * @return the last value (`[[nodiscard]]`)
+     */
+    [[nodiscard]] const_reference back() const noexcept { return (*this)[this->size() - 1]; }
+
+    /**
+     * @brief Return an iterator to the first value.
+     * @return the iterator (`[[nodiscard]]`)
+     */
+    [[nodiscard]] const_iterator begin() const noexcept { return const_iterator{ this, 0 }; }
+
+    /**
+     * @brief Return an iterator past the last value published at the time of this call.
+     * @return the iterator (`[[nodiscard]]`)
+     */
+    [[nodiscard]] const_iterator end() const noexcept { return const_iterator{ this, this->size() }; }
+
+    /**
+     * @brief Copy the currently published values into a contiguous std::vector.
+     * @return the values (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::vector<T> to_vector() const {
+        const size_type size = this->size();
+        std::vector<T> values{};
+        values.reserve(size);
+        for (size_type i = 0; i < size; ++i) {
+            values.push_back((*this)[i]);
+        }
+        return values;
+    }
+
+  private:
+    /// The number of values stored in the first chunk. Each following chunk is twice as large as its predecessor.
+    static constexpr size_type first_chunk_size_ = 64;
+    /// The maximum number of chunks. Enough to store more values than can ever be addressed.
+    static constexpr size_type max_num_chunks_ = 48;
+
+    /**
+     * @brief Return the number of values stored in the chunk with index @p chunk.
+     * @param[in] chunk the index of the chunk
+     * @return the number of values (`[[nodiscard]]`)
+     */
+    [[nodiscard]] static constexpr size_type chunk_size(const size_type chunk) noexcept { return first_chunk_size_ << chunk; }
+
+    /// The number of values per compressed block.
+    static constexpr size_type compressed_block_size_ = 1024;
+    /// The block index indicating that no block has been decompressed.
+    static constexpr size_type no_block_ = std::numeric_limits<size_type>::max();
+
+    /**
+     * @brief Append a new value constructed from @p args without updating the summary and publish it to all readers.
+     * @tparam Args the types of the constructor arguments
+     * @param[in] args the constructor arguments
+     */
+    template <typename... Args>
+    void append(Args &&...args) {
+        // only the writer modifies the size -> a relaxed load is sufficient
+        const size_type idx = size_.load(std::memory_order_relaxed);
+        if (compressed_) {
+            // the uncompressed block is reused after it has been compressed
+            if (chunks_[0] == nullptr) {
+                chunks_[0] = allocate(compressed_block_size_);
+            }
+            const size_type offset = idx % compressed_block_size_;
+            chunks_[0][offset] = T(std::forward<Args>(args)...);
+            if (offset + 1 == compressed_block_size_) {
+                this->compress_block();
+            }
+            size_.store(idx + 1, std::memory_order_release);
+            return;
+        }
+        if (capacity_ != 0) {
+            // ring buffer: the whole capacity is allocated at once
+            if (chunks_[0] == nullptr) {
+                chunks_[0] = allocate(capacity_);
+            }
+            if (idx < capacity_) {
+                chunks_[0][idx] = T(std::forward<Args>(args)...);
+                size_.store(idx + 1, std::memory_order_release);
+            } else {
+                // the column is full -> overwrite the oldest value
+                chunks_[0][first_] = T(std::forward<Args>(args)...);
+                first_ = (first_ + 1) % capacity_;
+                ++num_discarded_;
+            }
+            return;
+        }
+        const auto [chunk, offset] = locate(idx);
+        if (chunks_[chunk] == nullptr) {
+            // the previous chunks are full -> allocate a new chunk, all previous chunks stay where they are
+            chunks_[chunk] = allocate(chunk_size(chunk));
+        }
+        chunks_[chunk][offset] = T(std::forward<Args>(args)...);
+        // publish the new value: all readers that see the new size also see the new value
+        size_.store(idx + 1, std::memory_order_release);
+    }
+
+    /**
+     * @brief Replace the summary with an empty summary of the same relative accuracy (if a summary is maintained).
+     */
+    void reset_statistics() noexcept {
+        if (statistics_.has_value()) {
+            statistics_.emplace(statistics_->relative_accuracy());
+        }
+    }
+
+    /**
+     * @brief Create the initial summary.
+     * @param[in] statistics `true` if a summary should be maintained (only possible for arithmetic value types)
+     * @return the empty summary, `std::nullopt` if no summary should be maintained (`[[nodiscard]]`)
+     */
+    [[nodiscard]] static std::optional<streaming_statistics> initial_statistics(const bool statistics) {
+        if (std::is_arithmetic_v<T> && statistics) {
+            return streaming_statistics{};
+        }
+        return std::nullopt;
+    }
+
+    /**
+     * @brief Compress the full uncompressed block and append it to the compressed blocks.
+     */
+    void compress_block() {
+        if constexpr (detail::is_compressible_v<T>) {
+            if (decompressed_block_ == nullptr) {
+                // allocate the cache here so that reading a compressed value never allocates
+                decompressed_block_ = allocate(compressed_block_size_);
+            }
+            std::vector<std::uint8_t> block{};
+            detail::sample_codec<T>::encode(chunks_[0].get(), compressed_block_size_, block);
+            block.shrink_to_fit();
+            compressed_blocks_.push_back(std::move(block));
+        }
+    }
+
+    /**
+     * @brief Return the value at position @p offset in the compressed block with index @p block.
+     * @details Decompresses the whole block into the cache if it isn't already cached.
+     * @param[in] block the index of the compressed block
+     * @param[in] offset the position of the value in the block
+     * @return the value (`[[nodiscard]]`)
+     */
+    [[nodiscard]] const_reference decompressed_value(const size_type block, const size_type offset) const noexcept {
+        if constexpr (detail::is_compressible_v<T>) {
+            if (decompressed_block_index_ != block) {
+                detail::sample_codec<T>::decode(compressed_blocks_[block].data(), compressed_block_size_, decompressed_block_.get());
+                decompressed_block_index_ = block;
+            }
+        }
+        return decompressed_block_[offset];
+    }
+
+    /**
+     * @brief Allocate a chunk for @p size values.
+     * @details The values are default-initialized, i.e., for arithmetic types the memory is neither zeroed nor touched until a value is appended.
+     * @param[in] size the number of values
+     * @return the chunk (`[[nodiscard]]`)
+     */
+    [[nodiscard]] static std::unique_ptr<T[]> allocate(const size_type size) { return std::unique_ptr<T[]>(new T[size]); }
+
+    /**
+     * @brief Return the chunk and the offset inside this chunk of the value with index @p idx.
+     * @param[in] idx the index of the value
+     * @return the chunk and offset (`[[nodiscard]]`)
+     */
+    [[nodiscard]] static constexpr std::array<size_type, 2> locate(const size_type idx) noexcept {
+        // chunk c starts at index first_chunk_size_ * (2^c - 1)
+        const size_type normalized = idx / first_chunk_size_ + 1;
+        size_type chunk = 0;
+        while ((normalized >> (chunk + 1)) != 0) {
+            ++chunk;
+        }
+        return { chunk, idx - first_chunk_size_ * ((size_type{ 1 } << chunk) - 1) };
+    }
+
+    /// The chunks storing the values. Only the writer allocates new chunks; allocated chunks are never relocated. A ring buffer only uses the first chunk.
+    std::array<std::unique_ptr<T[]>, max_num_chunks_> chunks_{};
+    /// The number of published values.
+    std::atomic<size_type> size_{ 0 };
+    /// The maximum number of retained values, `0` means unbounded.
+    size_type capacity_{ 0 };
+    /// The position of the oldest retained value in the ring buffer.
+    size_type first_{ 0 };
+    /// The number of values discarded because the ring buffer was full.
+    size_type num_discarded_{ 0 };
+    /// `true` if the values are compressed. The first chunk is then used as uncompressed block.
+    bool compressed_{ false };
+    /// The compressed blocks of compressed_block_size_ values each.
+    std::vector<std::vector<std::uint8_t>> compressed_blocks_{};
+    /// The cache storing the most recently decompressed block.
+    mutable std::unique_ptr<T[]> decompressed_block_{};
+    /// The index of the block stored in the cache.
+    mutable size_type decompressed_block_index_{ no_block_ };
+    /// The streaming summary of all appended values, `std::nullopt` if no summary is maintained.
+    std::optional<streaming_statistics> statistics_{};
+};
+
+}  // namespace hws
+
+#endif  // HWS_SAMPLE_COLUMN_HPP_
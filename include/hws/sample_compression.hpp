@@ -0,0 +1,354 @@
+/**
+ * @file
+ * @author Marcel Breyer
+ * @copyright 2024-today All Rights Reserved
+ * @license This file is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Defines the codecs used to compress blocks of sampled values.
+ * @details Time points are encoded using delta-of-delta encoding, floating point values using XOR encoding (both as described in
+ *          "Gorilla: A Fast, Scalable, In-Memory Time Series Database"), and integral values as zigzag varint encoded deltas.
+ */
+
+#ifndef HWS_SAMPLE_COMPRESSION_HPP_
+#define HWS_SAMPLE_COMPRESSION_HPP_
+#pragma once
+
+#include <chrono>       // std::chrono::steady_clock::time_point
+#include <cstddef>      // std::size_t
+#include <cstdint>      // std::uint8_t, std::uint32_t, std::uint64_t, std::int64_t
+#include <cstring>      // std::memcpy
+#include <type_traits>  // std::is_integral_v, std::is_same_v, std::is_floating_point_v, std::conditional_t, std::enable_if_t, std::bool_constant
+#include <vector>       // std::vector
+
+namespace hws::detail {
+
+/**
+ * @brief Check whether the values of type @p T can be compressed.
+ * @tparam T the type to check
+ */
+template <typename T>
+struct is_compressible : std::bool_constant<std::is_integral_v<T> || std::is_same_v<T, float> || std::is_same_v<T, double> || std::is_same_v<T, std::chrono::steady_clock::time_point>> { };
+
+/**
+ * @brief Shorthand for `is_compressible<T>::value`.
+ * @tparam T the type to check
+ */
+template <typename T>
+constexpr bool is_compressible_v = is_compressible<T>::value;
+
+/**
+ * @brief Append single bits to a byte buffer.
+ */
+class bit_writer {
+  public:
+    /**
+     * @brief Construct a bit_writer appending to @p buffer.
+     * @param[in,out] buffer the buffer to append the bits to
+     */
+    explicit bit_writer(std::vector<std::uint8_t> &buffer) noexcept :
+        buffer_{ buffer } { }
+
+    /**
+     * @brief Append the @p num_bits least significant bits of @p value, most significant bit first.
+     * @param[in] value the bits to append
+     * @param[in] num_bits the number of bits to append; must be at most 64
+     */
+    void write(const std::uint64_t value, const unsigned num_bits) {
+        for (unsigned bit = num_bits; bit > 0; --bit) {
+            if (num_free_bits_ == 0) {
+                buffer_.push_back(0);
+                num_free_bits_ = 8;
+            }
+            --num_free_bits_;
+            buffer_.back() |= static_cast<std::uint8_t>(((value >> (bit - 1)) & 1u) << num_free_bits_);
+        }
+    }
+
+  private:
+    /// The buffer the bits are appended to.
+    std::vector<std::uint8_t> &buffer_;
+    /// The number of bits that are still unused in the last byte of the buffer.
+    unsigned num_free_bits_{ 0 };
+};
+
+/**
+ * @brief Read single bits from a byte buffer.
+ */
+class bit_reader {
+  public:
+    /**
+     * @brief Construct a bit_reader reading from @p data.
+     * @param[in] data the buffer to read from
+     */
+    explicit bit_reader(const std::uint8_t *data) noexcept :
+        data_{ data } { }
+
+    /**
+     * @brief Read the next @p num_bits bits, most significant bit first.
+     * @param[in] num_bits the number of bits to read; must be at most 64
+     * @return the read bits (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::uint64_t read(const unsigned num_bits) noexcept {
+        std::uint64_t value{ 0 };
+        for (unsigned bit = 0; bit < num_bits; ++bit) {
+            value = (value << 1u) | ((data_[pos_ / 8] >> (7 - pos_ % 8)) & 1u);
+            ++pos_;
+        }
+        return value;
+    }
+
+  private:
+    /// The buffer to read from.
+    const std::uint8_t *data_;
+    /// The position of the next bit to read.
+    std::size_t pos_{ 0 };
+};
+
+/**
+ * @brief Map the signed integer @p value to an unsigned integer such that values with a small magnitude result in small integers.
+ * @param[in] value the signed integer
+ * @return the zigzag encoded integer (`[[nodiscard]]`)
+ */
+[[nodiscard]] inline std::uint64_t zigzag_encode(const std::int64_t value) noexcept {
+    return (static_cast<std::uint64_t>(value) << 1u) ^ static_cast<std::uint64_t>(value >> 63);
+}
+
+/**
+ * @brief Revert the zigzag encoding of @p value.
+ * @param[in] value the zigzag encoded integer
+ * @return the signed integer (`[[nodiscard]]`)
+ */
+[[nodiscard]] inline std::int64_t zigzag_decode(const std::uint64_t value) noexcept {
+    return static_cast<std::int64_t>(value >> 1u) ^ -static_cast<std::int64_t>(value & 1u);
+}
+
+/**
+ * @brief Compress and decompress blocks of values of type @p T.
+ * @details Integral values (including bool) are encoded as zigzag varint encoded deltas, i.e., an unchanged value needs a single byte.
+ * @tparam T the type of the values
+ */
+template <typename T, typename = void>
+struct sample_codec {
+    /**
+     * @brief Append the compressed @p num_values values in @p values to @p buffer.
+     * @param[in] values the values to compress
+     * @param[in] num_values the number of values
+     * @param[in,out] buffer the buffer to append the compressed values to
+     */
+    static void encode(const T *values, const std::size_t num_values, std::vector<std::uint8_t> &buffer) {
+        std::uint64_t previous{ 0 };
+        for (std::size_t i = 0; i < num_values; ++i) {
+            const auto current = static_cast<std::uint64_t>(values[i]);
+            // write seven bits per byte, the most significant bit indicates whether more bytes follow
+            std::uint64_t delta = zigzag_encode(static_cast<std::int64_t>(current - previous));
+            while (delta >= 0x80u) {
+                buffer.push_back(static_cast<std::uint8_t>(delta | 0x80u));
+                delta >>= 7u;
+            }
+            buffer.push_back(static_cast<std::uint8_t>(delta));
+            previous = current;
+        }
+    }
+
+    /**
+     * @brief Decompress @p num_values values from @p data into @p values.
+     * @param[in] data the compressed values
+     * @param[in] num_values the number of values
+     * @param[out] values the decompressed values
+     */
+    static void decode(const std::uint8_t *data, const std::size_t num_values, T *values) noexcept {
+        std::uint64_t previous{ 0 };
+        for (std::size_t i = 0; i < num_values; ++i) {
+            std::uint64_t delta{ 0 };
+            unsigned shift{ 0 };
+            while ((*data & 0x80u) != 0) {
+                delta |= static_cast<std::uint64_t>(*data & 0x7Fu) << shift;
+                shift += 7;
+                ++data;
+            }
+            delta |= static_cast<std::uint64_t>(*data) << shift;
+            ++data;
+            previous += static_cast<std::uint64_t>(zigzag_decode(delta));
+            values[i] = static_cast<T>(previous);
+        }
+    }
+};
+
+/**
+ * @brief Compress and decompress blocks of floating point values of type @p T.
+ * @details Each value is XORed with its predecessor. An unchanged value needs a single bit, otherwise only the meaningful bits between
+ *          the leading and trailing zeros of the XORed value are stored (reusing the leading and trailing zeros of the previous value if possible).
+ * @tparam T the type of the values
+ */
+template <typename T>
+struct sample_codec<T, std::enable_if_t<std::is_floating_point_v<T>>> {
+    /// The unsigned integer type with the same size as @p T.
+    using bits_type = std::conditional_t<sizeof(T) == sizeof(std::uint32_t), std::uint32_t, std::uint64_t>;
+    static_assert(sizeof(T) == sizeof(bits_type), "Only float and double values can be compressed!");
+    /// The number of bits of @p T.
+    static constexpr unsigned num_bits = 8 * sizeof(T);
+    /// The number of bits necessary to store the number of leading zeros or meaningful bits.
+    static constexpr unsigned num_length_bits = sizeof(T) == sizeof(std::uint32_t) ? 5 : 6;
+
+    /**
+     * @copydoc hws::detail::sample_codec::encode
+     */
+    static void encode(const T *values, const std::size_t num_values, std::vector<std::uint8_t> &buffer) {
+        bit_writer writer{ buffer };
+        bits_type previous{ 0 };
+        unsigned previous_leading{ num_bits };
+        unsigned previous_trailing{ 0 };
+        for (std::size_t i = 0; i < num_values; ++i) {
+            bits_type current{};
+            std::memcpy(&current, &values[i], sizeof(T));
+            const bits_type xored = current ^ previous;
+            previous = current;
+
+            if (xored == 0) {
+                // '0': the value didn't change
+                writer.write(0b0, 1);
+                continue;
+            }
+            const unsigned leading = count_leading_zeros(xored);
+            const unsigned trailing = count_trailing_zeros(xored);
+            if (leading >= previous_leading && trailing >= previous_trailing) {
+                // '10': the meaningful bits fit into the window of the previous value
+                writer.write(0b10, 2);
+                writer.write(xored >> previous_trailing, num_bits - previous_leading - previous_trailing);
+            } else {
+                // '11': store the new window followed by the meaningful bits (the number of meaningful bits is stored minus one)
+                // the number of leading zeros is capped such that it always fits into num_length_bits
+                const unsigned capped_leading = leading < (1u << num_length_bits) - 1 ? leading : (1u << num_length_bits) - 1;
+                const unsigned num_meaningful_bits = num_bits - capped_leading - trailing;
+                writer.write(0b11, 2);
+                writer.write(capped_leading, num_length_bits);
+                writer.write(num_meaningful_bits - 1, num_length_bits);
+                writer.write(xored >> trailing, num_meaningful_bits);
+                previous_leading = capped_leading;
+                previous_trailing = trailing;
+            }
+        }
+    }
+
+    /**
+     * @copydoc hws::detail::sample_codec::decode
+     */
+    static void decode(const std::uint8_t *data, const std::size_t num_values, T *values) noexcept {
+        bit_reader reader{ data };
+        bits_type previous{ 0 };
+        unsigned previous_leading{ num_bits };
+        unsigned previous_trailing{ 0 };
+        for (std::size_t i = 0; i < num_values; ++i) {
+            if (reader.read(1) != 0) {
+                if (reader.read(1) != 0) {
+                    previous_leading = static_cast<unsigned>(reader.read(num_length_bits));
+                    previous_trailing = num_bits - previous_leading - (static_cast<unsigned>(reader.read(num_length_bits)) + 1);
+                }
+                previous ^= static_cast<bits_type>(reader.read(num_bits - previous_leading - previous_trailing) << previous_trailing);
+            }
+            std::memcpy(&values[i], &previous, sizeof(T));
+        }
+    }
+
+  private:
+    /**
+     * @brief Count the number of leading zero bits in @p value.
+     * @param[in] value the value; must not be zero
+     * @return the number of leading zeros (`[[nodiscard]]`)
+     */
+    [[nodiscard]] static unsigned count_leading_zeros(const bits_type value) noexcept {
+        unsigned count{ 0 };
+        while ((value & (bits_type{ 1 } << (num_bits - 1 - count))) == 0) {
+            ++count;
+        }
+        return count;
+    }
+
+    /**
+     * @brief Count the number of trailing zero bits in @p value.
+     * @param[in] value the value; must not be zero
+     * @return the number of trailing zeros (`[[nodiscard]]`)
+     */
+    [[nodiscard]] static unsigned count_trailing_zeros(const bits_type value) noexcept {
+        unsigned count{ 0 };
+        while ((value & (bits_type{ 1 } << count)) == 0) {
+            ++count;
+        }
+        return count;
+    }
+};
+
+/**
+ * @brief Compress and decompress blocks of time points.
+ * @details The time points are (almost) equidistant. Therefore, only the difference between two consecutive deltas (the jitter) is stored
+ *          using variable length buckets: an unchanged delta needs a single bit and a jitter of a few microseconds up to three bytes.
+ */
+template <>
+struct sample_codec<std::chrono::steady_clock::time_point> {
+    /// The type of the compressed values.
+    using value_type = std::chrono::steady_clock::time_point;
+
+    /**
+     * @copydoc hws::detail::sample_codec::encode
+     */
+    static void encode(const value_type *values, const std::size_t num_values, std::vector<std::uint8_t> &buffer) {
+        bit_writer writer{ buffer };
+        std::int64_t previous{ 0 };
+        std::int64_t previous_delta{ 0 };
+        for (std::size_t i = 0; i < num_values; ++i) {
+            const auto current = static_cast<std::int64_t>(values[i].time_since_epoch().count());
+            const std::int64_t delta = current - previous;
+            const std::uint64_t delta_of_delta = zigzag_encode(delta - previous_delta);
+            previous = current;
+            previous_delta = delta;
+
+            // the buckets are chosen for nanosecond resolution: '0' unchanged, '10' up to +-8us, '110' up to +-0.5ms, '1110' up to +-2s, '1111' arbitrary
+            if (delta_of_delta == 0) {
+                writer.write(0b0, 1);
+            } else if (delta_of_delta < (std::uint64_t{ 1 } << 14u)) {
+                writer.write(0b10, 2);
+                writer.write(delta_of_delta, 14);
+            } else if (delta_of_delta < (std::uint64_t{ 1 } << 20u)) {
+                writer.write(0b110, 3);
+                writer.write(delta_of_delta, 20);
+            } else if (delta_of_delta < (std::uint64_t{ 1 } << 32u)) {
+                writer.write(0b1110, 4);
+                writer.write(delta_of_delta, 32);
+            } else {
+                writer.write(0b1111, 4);
+                writer.write(delta_of_delta, 64);
+            }
+        }
+    }
+
+    /**
+     * @copydoc hws::detail::sample_codec::decode
+     */
+    static void decode(const std::uint8_t *data, const std::size_t num_values, value_type *values) noexcept {
+        bit_reader reader{ data };
+        std::int64_t previous{ 0 };
+        std::int64_t previous_delta{ 0 };
+        for (std::size_t i = 0; i < num_values; ++i) {
+            std::uint64_t delta_of_delta{ 0 };
+            if (reader.read(1) != 0) {
+                if (reader.read(1) == 0) {
+                    delta_of_delta = reader.read(14);
+                } else if (reader.read(1) == 0) {
+                    delta_of_delta = reader.read(20);
+                } else if (reader.read(1) == 0) {
+                    delta_of_delta = reader.read(32);
+                } else {
+                    delta_of_delta = reader.read(64);
+                }
+            }
+            previous_delta += zigzag_decode(delta_of_delta);
+            previous += previous_delta;
+            values[i] = value_type{ value_type::duration{ static_cast<value_type::rep>(previous) } };
+        }
+    }
+};
+
+}  // namespace hws::detail
+
+#endif  // HWS_SAMPLE_COMPRESSION_HPP_
@@ -0,0 +1,190 @@
+/**
+ * @file
+ * @author Marcel Breyer
+ * @copyright 2024-today All Rights Reserved
+ * @license This file is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Defines an append-only matrix storing the values of a hardware sample sampled once per row, e.g., per logical CPU.
+ */
+
+#ifndef HWS_SAMPLE_MATRIX_HPP_
+#define HWS_SAMPLE_MATRIX_HPP_
+#pragma once
+
+#include "hws/sample_column.hpp"  // hws::sample_column, hws::sample_column_config
+
+#include <cstddef>  // std::size_t
+#include <numeric>  // std::iota
+#include <utility>  // std::move
+#include <vector>   // std::vector
+
+namespace hws {
+
+/**
+ * @brief An append-only matrix storing the values of a single hardware sample with one row per entity (e.g., logical CPU) and one column per time point.
+ * @details Instead of one hws::sample_column per row, all values are stored in a single hws::sample_column in column-major order, i.e.,
+ *          the values of all rows of one time point are contiguous and appending a time point never allocates more than one chunk.
+ *          Therefore, the matrix inherits the guarantees of its hws::sample_column: a single writer (the sampling std::thread) and multiple
+ *          concurrent readers without any locks. A reader only sees complete columns, i.e., a time point is published once its last row has been appended.
+ *          If the sample retention is limited, the last `capacity` time points (and not values) are retained.
+ * @tparam T the type of the stored values
+ */
+template <typename T>
+class sample_matrix {
+  public:
+    /// The type of the stored values.
+    using value_type = T;
+    /// The unsigned integer type used for indices and sizes.
+    using size_type = std::size_t;
+
+    /**
+     * @brief Default construct an empty sample_matrix without any rows.
+     */
+    sample_matrix() = default;
+
+    /**
+     * @brief Construct an empty, unbounded sample_matrix with @p num_rows rows whose IDs are their indices.
+     * @param[in] num_rows the number of rows
+     */
+    explicit sample_matrix(const size_type num_rows) :
+        sample_matrix{ sample_column_config{}, num_rows } { }
+
+    /**
+     * @brief Construct an empty, unbounded sample_matrix with one row per ID in @p row_ids, e.g., the IDs of the online logical CPUs.
+     * @param[in] row_ids the IDs of the entities the rows belong to in the order of the rows
+     */
+    explicit sample_matrix(std::vector<size_type> row_ids) :
+        sample_matrix{ sample_column_config{}, std::move(row_ids) } { }
+
+    /**
+     * @brief Construct an empty sample_matrix with @p num_rows rows whose IDs are their indices.
+     * @details The capacity and expected size in @p config are given in time points.
+     * @param[in] config the configuration of the underlying hws::sample_column
+     * @param[in] num_rows the number of rows
+     */
+    sample_matrix(const sample_column_config &config, const size_type num_rows) :
+        sample_matrix{ config, std::vector<size_type>(num_rows) } {
+        std::iota(row_ids_.begin(), row_ids_.end(), size_type{ 0 });
+    }
+
+    /**
+     * @brief Construct an empty sample_matrix with one row per ID in @p row_ids, e.g., the IDs of the online logical CPUs.
+     * @details The capacity and expected size in @p config are given in time points.
+     * @param[in] config the configuration of the underlying hws::sample_column
+     * @param[in] row_ids the IDs of the entities the rows belong to in the order of the rows
+     */
+    sample_matrix(const sample_column_config &config, std::vector<size_type> row_ids) :
+        num_rows_{ row_ids.size() },
+        row_ids_{ std::move(row_ids) },
+        // retain and allocate whole time points only
+        values_{ sample_column_config{ config.capacity * num_rows_, config.expected_size * num_rows_, config.compression, config.statistics } } { }
+
+    /**
+     * @brief Append the value @p val of the next row of the current time point. The values of all rows must be appended in order.
+     * @param[in] val the value to append
+     */
+    void push_back(const T &val) { values_.push_back(val); }
+
+    /**
+     * @brief Remove all values. Must not be called while this sample_matrix is being read concurrently.
+     */
+    void clear() noexcept { values_.clear(); }
+
+    /**
+     * @brief Return the number of rows, e.g., the number of logical CPUs.
+     * @return the number of rows (`[[nodiscard]]`)
+     */
+    [[nodiscard]] size_type num_rows() const noexcept { return num_rows_; }
+
+    /**
+     * @brief Return the IDs of the entities the rows belong to, e.g., the IDs of the logical CPUs.
+     * @details The IDs are not necessarily contiguous, e.g., if some logical CPUs are offline, and may differ between two sample_matrix instances.
+     * @return the IDs in the order of the rows (`[[nodiscard]]`)
+     */
+    [[nodiscard]] const std::vector<size_type> &row_ids() const noexcept { return row_ids_; }
+
+    /**
+     * @brief Return the number of published time points, i.e., complete columns.
+     * @return the number of time points (`[[nodiscard]]`)
+     */
+    [[nodiscard]] size_type num_columns() const noexcept { return num_rows_ == 0 ? 0 : values_.size() / num_rows_; }
+
+    /**
+     * @brief Check whether no time point has been published yet.
+     * @return `true` if the sample_matrix is empty, otherwise `false` (`[[nodiscard]]`)
+     */
+    [[nodiscard]] bool empty() const noexcept { return this->num_columns() == 0; }
+
+    /**
+     * @brief Return the value of the row @p row at the time point @p column. The column must be smaller than a previously observed `sample_matrix::num_columns()`.
+     * @param[in] row the index of the row
+     * @param[in] column the index of the time point
+     * @return the value (`[[nodiscard]]`)
+     */
+    [[nodiscard]] const T &operator()(const size_type row, const size_type column) const noexcept { return values_[column * num_rows_ + row]; }
+
+    /**
+     * @brief Copy the values of all published time points of the row @p idx, e.g., of a single logical CPU.
+     * @param[in] idx the index of the row
+     * @return the values of the row (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::vector<T> row(const size_type idx) const {
+        const size_type num_columns = this->num_columns();
+        std::vector<T> values{};
+        values.reserve(num_columns);
+        for (size_type column = 0; column < num_columns; ++column) {
+            values.push_back((*this)(idx, column));
+        }
+        return values;
+    }
+
+    /**
+     * @brief Copy the values of all rows at the time point @p idx.
+     * @param[in] idx the index of the time point
+     * @return the values of the time point (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::vector<T> column(const size_type idx) const {
+        std::vector<T> values{};
+        values.reserve(num_rows_);
+        for (size_type row = 0; row < num_rows_; ++row) {
+            values.push_back((*this)(row, idx));
+        }
+        return values;
+    }
+
+    /**
+     * @brief Copy the values of all published time points to one std::vector per row.
+     * @details The number of time points is only read once, i.e., all rows have the same size even if the sampling std::thread appends new values concurrently.
+     * @return the values of all rows (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::vector<std::vector<T>> to_vector() const {
+        const size_type num_columns = this->num_columns();
+        std::vector<std::vector<T>> rows(num_rows_);
+        for (size_type row = 0; row < num_rows_; ++row) {
+            rows[row].reserve(num_columns);
+            for (size_type column = 0; column < num_columns; ++column) {
+                rows[row].push_back((*this)(row, column));
+            }
+        }
+        return rows;
+    }
+
+    /**
+     * @brief Return the underlying sample_column storing the values of all time points in column-major order.
+     * @return the values (`[[nodiscard]]`)
+     */
+    [[nodiscard]] const sample_column<T> &values() const noexcept { return values_; }
+
+  private:
+    /// The number of rows.
+    size_type num_rows_{ 0 };
+    /// The IDs of the entities the rows belong to.
+    std::vector<size_type> row_ids_{};
+    /// The values of all time points in column-major order.
+    sample_column<T> values_{};
+};
+
+}  // namespace hws
+
+#endif  // HWS_SAMPLE_MATRIX_HPP_
@@ -0,0 +1,688 @@
+/**
+ * @file
+ * @author Marcel Breyer
+ * @copyright 2024-today All Rights Reserved
+ * @license This file is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Defines the compile-time descriptors of the hardware samples and the functions generated from them.
+ */
+
+#ifndef HWS_SAMPLE_METRIC_HPP_
+#define HWS_SAMPLE_METRIC_HPP_
+#pragma once
+
+#include "hws/sample_category.hpp"       // hws::sample_category
+#include "hws/sample_column.hpp"         // hws::sample_column
+#include "hws/sample_matrix.hpp"         // hws::sample_matrix
+#include "hws/streaming_statistics.hpp"  // hws::streaming_statistics
+#include "hws/utility.hpp"               // hws::detail::{is_vector_v, remove_cvref_t, quote, map_entry_to_string, value_or_default}
+
+#include "fmt/format.h"  // fmt::format
+#include "fmt/ranges.h"  // fmt::join
+
+#include <cstddef>        // std::size_t
+#include <limits>         // std::numeric_limits
+#include <map>            // std::map
+#include <optional>       // std::optional
+#include <string>         // std::string
+#include <string_view>    // std::string_view
+#include <tuple>          // std::tuple, std::make_tuple, std::apply
+#include <type_traits>    // std::is_same, std::is_arithmetic, std::true_type, std::false_type, std::bool_constant
+#include <unordered_map>  // std::unordered_map
+#include <vector>         // std::vector
+
+namespace hws {
+
+namespace detail {
+
+/**
+ * @brief The case if the type @p T isn't a std::map or std::unordered_map.
+ * @tparam T the type to check
+ */
+template <typename T>
+struct is_map : std::false_type { };
+
+/**
+ * @brief The case if the type @p T is a std::map.
+ * @tparam Key the type of the keys
+ * @tparam Value the type of the mapped values
+ */
+template <typename Key, typename Value>
+struct is_map<std::map<Key, Value>> : std::true_type { };
+
+/**
+ * @brief The case if the type @p T is a std::unordered_map.
+ * @tparam Key the type of the keys
+ * @tparam Value the type of the mapped values
+ */
+template <typename Key, typename Value>
+struct is_map<std::unordered_map<Key, Value>> : std::true_type { };
+
+/**
+ * @brief Evaluates to `true` if @p T is a std::map or std::unordered_map, otherwise `false`.
+ * @tparam T the type to check
+ */
+template <typename T>
+constexpr bool is_map_v = is_map<T>::value;
+
+/**
+ * @brief The case if the type @p T isn't a hws::sample_column.
+ * @tparam T the type to check
+ */
+template <typename T>
+struct is_sample_column : std::false_type { };
+
+/**
+ * @brief The case if the type @p T is a hws::sample_column.
+ * @tparam T the type of the values
+ */
+template <typename T>
+struct is_sample_column<sample_column<T>> : std::true_type { };
+
+/**
+ * @brief Evaluates to `true` if @p T is a hws::sample_column, otherwise `false`.
+ * @tparam T the type to check
+ */
+template <typename T>
+constexpr bool is_sample_column_v = is_sample_column<T>::value;
+
+/**
+ * @brief The case if the type @p T isn't a hws::sample_matrix.
+ * @tparam T the type to check
+ */
+template <typename T>
+struct is_sample_matrix : std::false_type { };
+
+/**
+ * @brief The case if the type @p T is a hws::sample_matrix.
+ * @tparam T the type of the values
+ */
+template <typename T>
+struct is_sample_matrix<sample_matrix<T>> : std::true_type { };
+
+/**
+ * @brief Evaluates to `true` if @p T is a hws::sample_matrix, otherwise `false`.
+ * @tparam T the type to check
+ */
+template <typename T>
+constexpr bool is_sample_matrix_v = is_sample_matrix<T>::value;
+
+/**
+ * @brief Evaluates to `true` if the hardware sample of type @p T is retrieved in every sampling tick, i.e., is a hws::sample_column, a
+ *        hws::sample_matrix, or a map of hws::sample_column, otherwise `false`.
+ * @tparam T the type to check
+ */
+template <typename T>
+struct is_sampled : std::bool_constant<is_sample_column_v<T> || is_sample_matrix_v<T>> { };
+
+/**
+ * @brief The case if the hardware sample is stored in a std::map.
+ * @tparam Key the type of the keys
+ * @tparam Value the type of the mapped values
+ */
+template <typename Key, typename Value>
+struct is_sampled<std::map<Key, Value>> : is_sample_column<Value> { };
+
+/**
+ * @brief The case if the hardware sample is stored in a std::unordered_map.
+ * @tparam Key the type of the keys
+ * @tparam Value the type of the mapped values
+ */
+template <typename Key, typename Value>
+struct is_sampled<std::unordered_map<Key, Value>> : is_sample_column<Value> { };
+
+/**
+ * @brief Evaluates to `true` if the values of the hardware sample of type @p T are strings, otherwise `false`.
+ * @tparam T the type to check
+ */
+template <typename T>
+struct has_string_values : std::is_same<T, std::string> { };
+
+/**
+ * @brief The case if the hardware sample is stored in a std::vector.
+ * @tparam T the type of the values
+ */
+template <typename T>
+struct has_string_values<std::vector<T>> : has_string_values<T> { };
+
+/**
+ * @brief The case if the hardware sample is stored in a hws::sample_column.
+ * @tparam T the type of the values
+ */
+template <typename T>
+struct has_string_values<sample_column<T>> : has_string_values<T> { };
+
+/**
+ * @brief The case if the hardware sample is stored in a std::map.
+ * @tparam Key the type of the keys
+ * @tparam Value the type of the mapped values
+ */
+template <typename Key, typename Value>
+struct has_string_values<std::map<Key, Value>> : has_string_values<Value> { };
+
+/**
+ * @brief The case if the hardware sample is stored in a std::unordered_map.
+ * @tparam Key the type of the keys
+ * @tparam Value the type of the mapped values
+ */
+template <typename Key, typename Value>
+struct has_string_values<std::unordered_map<Key, Value>> : has_string_values<Value> { };
+
+/**
+ * @brief Evaluates to `true` if the hardware sample of type @p T is retrieved in every sampling tick and its values are numeric, i.e., can be
+ *        converted to a `double`, otherwise `false`.
+ * @tparam T the type to check
+ */
+template <typename T>
+struct has_numeric_values : std::false_type { };
+
+/**
+ * @brief The case if the hardware sample is stored in a hws::sample_column.
+ * @tparam T the type of the values
+ */
+template <typename T>
+struct has_numeric_values<sample_column<T>> : std::is_arithmetic<T> { };
+
+/**
+ * @brief The case if the hardware sample is stored in a hws::sample_matrix.
+ * @tparam T the type of the values
+ */
+template <typename T>
+struct has_numeric_values<sample_matrix<T>> : std::is_arithmetic<T> { };
+
+/**
+ * @brief The case if the hardware sample is stored in a std::map.
+ * @tparam Key the type of the keys
+ * @tparam Value the type of the mapped values
+ */
+template <typename Key, typename Value>
+struct has_numeric_values<std::map<Key, Value>> : std::bool_constant<is_sample_column_v<Value> && has_numeric_values<Value>::value> { };
+
+/**
+ * @brief The case if the hardware sample is stored in a std::unordered_map.
+ * @tparam Key the type of the keys
+ * @tparam Value the type of the mapped values
+ */
+template <typename Key, typename Value>
+struct has_numeric_values<std::unordered_map<Key, Value>> : std::bool_constant<is_sample_column_v<Value> && has_numeric_values<Value>::value> { };
+
+}  // namespace detail
+
+/**
+ * @brief The layout of a hardware sample stored in a map, e.g., one value per memory module, in the YAML output.
+ */
+enum class sample_metric_layout {
+    /** A single entry containing the value(s) of the hardware sample (the only layout for hardware samples that aren't stored in a map). */
+    value,
+    /** One entry per map key named `<key>_<yaml_name>`. */
+    per_key,
+    /** A single entry whose values are a nested mapping `<key_prefix><key>: [values]`. */
+    nested,
+    /** The sample class serializes the hardware sample itself in the YAML output. */
+    custom
+};
+
+/**
+ * @brief The compile-time descriptor of a single hardware sample of the sample class @p Samples, e.g., the power draw in hws::cpu_power_samples.
+ * @details The descriptors of all hardware samples of a sample class are returned by its static `metrics()` function and are used to generate
+ *          the YAML output, the output-stream operator, the sample selection (`hardware_sampler::set_sample_metrics`), and the Python bindings.
+ *          Optional properties are set via the `with_*` functions, e.g.,
+ *          `sample_metric{ "ipc", &cpu_general_samples::ipc_, "float", "the instructions-per-cycle count" }.with_yaml_name("instructions_per_cycle")`.
+ * @tparam Samples the sample class the hardware sample is a member of
+ * @tparam T the type of the hardware sample (without the std::optional)
+ */
+template <typename Samples, typename T>
+struct sample_metric {
+    /// The type of the sample class the hardware sample is a member of.
+    using samples_type = Samples;
+    /// The type of the hardware sample (without the std::optional).
+    using value_type = T;
+
+    /// `true` if the hardware sample is retrieved in every sampling tick, `false` if it is only retrieved once.
+    constexpr static bool is_sampled = detail::is_sampled<T>::value;
+    /// `true` if the hardware sample is stored in a map, e.g., one value per memory module.
+    constexpr static bool is_map = detail::is_map_v<T>;
+
+    /**
+     * @brief Describe the hardware sample stored in @p member_.
+     * @param[in] name_ the name of the hardware sample, i.e., the name of its getter without the `get_` prefix
+     * @param[in] member_ the member storing the hardware sample
+     * @param[in] unit_ the (abbreviated) unit of the hardware sample, e.g., "W" or "%"
+     * @param[in] description_ the description of the hardware sample
+     */
+    constexpr sample_metric(const std::string_view name_, std::optional<T> Samples::*member_, const std::string_view unit_, const std::string_view description_) noexcept :
+        name{ name_ },
+        member{ member_ },
+        unit{ unit_ },
+        description{ description_ },
+        yaml_name{ name_ },
+        yaml_unit{ unit_ == "%" ? std::string_view{ "percentage" } : unit_ } { }
+
+    /**
+     * @brief Return a copy of this descriptor whose hardware sample belongs to the sample category @p category_.
+     * @param[in] category_ the sample category
+     * @return the new descriptor (`[[nodiscard]]`)
+     */
+    [[nodiscard]] constexpr sample_metric in_category(const sample_category category_) const noexcept {
+        sample_metric metric{ *this };
+        metric.category = category_;
+        return metric;
+    }
+
+    /**
+     * @brief Return a copy of this descriptor using @p yaml_name_ as entry name in the YAML output instead of the name of the hardware sample.
+     * @param[in] yaml_name_ the entry name in the YAML output
+     * @return the new descriptor (`[[nodiscard]]`)
+     */
+    [[nodiscard]] constexpr sample_metric with_yaml_name(const std::string_view yaml_name_) const noexcept {
+        sample_metric metric{ *this };
+        metric.yaml_name = yaml_name_;
+        return metric;
+    }
+
+    /**
+     * @brief Return a copy of this descriptor using @p yaml_unit_ as (more detailed) unit in the YAML output.
+     * @param[in] yaml_unit_ the unit in the YAML output
+     * @return the new descriptor (`[[nodiscard]]`)
+     */
+    [[nodiscard]] constexpr sample_metric with_yaml_unit(const std::string_view yaml_unit_) const noexcept {
+        sample_metric metric{ *this };
+        metric.yaml_unit = yaml_unit_;
+        return metric;
+    }
+
+    /**
+     * @brief Return a copy of this descriptor whose hardware sample is read from the turbostat column @p turbostat_name_.
+     * @param[in] turbostat_name_ the name of the turbostat column
+     * @return the new descriptor (`[[nodiscard]]`)
+     */
+    [[nodiscard]] constexpr sample_metric with_turbostat_name(const std::string_view turbostat_name_) const noexcept {
+        sample_metric metric{ *this };
+        metric.turbostat_name = turbostat_name_;
+        return metric;
+    }
+
+    /**
+     * @brief Return a copy of this descriptor whose values are quoted in the YAML output although they aren't strings (e.g., large bitmasks).
+     * @return the new descriptor (`[[nodiscard]]`)
+     */
+    [[nodiscard]] constexpr sample_metric with_quoted_values() const noexcept {
+        sample_metric metric{ *this };
+        metric.quoted = true;
+        return metric;
+    }
+
+    /**
+     * @brief Return a copy of this descriptor using the @p layout_ for the map entries in the YAML output.
+     * @param[in] layout_ the layout of the map entries
+     * @param[in] key_prefix_ the prefix of the keys for the hws::sample_metric_layout::nested layout
+     * @return the new descriptor (`[[nodiscard]]`)
+     */
+    [[nodiscard]] constexpr sample_metric with_layout(const sample_metric_layout layout_, const std::string_view key_prefix_ = {}) const noexcept {
+        static_assert(is_map, "Only hardware samples stored in a map can use a different layout!");
+        sample_metric metric{ *this };
+        metric.layout = layout_;
+        metric.key_prefix = key_prefix_;
+        return metric;
+    }
+
+    /**
+     * @brief Return a copy of this descriptor whose hardware sample is calculated from the hardware sample named @p source_name_.
+     * @details If this hardware sample is selected via `hardware_sampler::set_sample_metrics`, the hardware sample named @p source_name_ is retained too.
+     * @param[in] source_name_ the name of the hardware sample this hardware sample is calculated from
+     * @return the new descriptor (`[[nodiscard]]`)
+     */
+    [[nodiscard]] constexpr sample_metric derived_from(const std::string_view source_name_) const noexcept {
+        sample_metric metric{ *this };
+        metric.source_name = source_name_;
+        return metric;
+    }
+
+    /**
+     * @brief Return the hardware sample of the @p samples.
+     * @param[in] samples the sample class instance
+     * @return the (optional) hardware sample (`[[nodiscard]]`)
+     */
+    [[nodiscard]] const std::optional<T> &get(const Samples &samples) const noexcept { return samples.*member; }
+
+    /// The name of the hardware sample, i.e., the name of its getter without the `get_` prefix.
+    std::string_view name;
+    /// The member storing the hardware sample.
+    std::optional<T> Samples::*member;
+    /// The (abbreviated) unit of the hardware sample.
+    std::string_view unit;
+    /// The description of the hardware sample.
+    std::string_view description;
+    /// The sample category the hardware sample belongs to.
+    sample_category category{ sample_category::all };
+    /// The entry name in the YAML output.
+    std::string_view yaml_name;
+    /// The unit in the YAML output.
+    std::string_view yaml_unit;
+    /// The name of the turbostat column the hardware sample is read from (empty if not read via turbostat).
+    std::string_view turbostat_name{};
+    /// `true` if the values are quoted in the YAML output.
+    bool quoted{ detail::has_string_values<T>::value };
+    /// The layout of the map entries in the YAML output.
+    sample_metric_layout layout{ sample_metric_layout::value };
+    /// The prefix of the keys for the hws::sample_metric_layout::nested layout.
+    std::string_view key_prefix{};
+    /// The name of the hardware sample this hardware sample is calculated from (empty if retrieved directly).
+    std::string_view source_name{};
+};
+
+/**
+ * @brief Create the table of the hardware sample descriptors @p metrics of a sample class whose hardware samples all belong to the sample category @p category.
+ * @tparam Metrics the types of the hardware sample descriptors
+ * @param[in] category the sample category of the sample class
+ * @param[in] metrics the hardware sample descriptors in the order of the output
+ * @return the hardware sample descriptors (`[[nodiscard]]`)
+ */
+template <typename... Metrics>
+[[nodiscard]] constexpr auto make_sample_metric_table(const sample_category category, const Metrics &...metrics) noexcept {
+    return std::make_tuple(metrics.in_category(category)...);
+}
+
+namespace detail {
+
+/**
+ * @brief Call @p func with every hardware sample descriptor of the sample class @p Samples in the order of the output.
+ * @tparam Samples the sample class, e.g., hws::cpu_power_samples
+ * @tparam Func the type of the function
+ * @param[in] func the function called with every hardware sample descriptor
+ */
+template <typename Samples, typename Func>
+constexpr void for_each_sample_metric(Func &&func) {
+    constexpr auto metrics = Samples::metrics();
+    std::apply([&func](const auto &...metric) { (func(metric), ...); }, metrics);
+}
+
+/**
+ * @brief Checks whether any hardware sample of the @p samples is present.
+ * @tparam Samples the sample class, e.g., hws::cpu_power_samples
+ * @param[in] samples the sample class instance
+ * @return `true` if any hardware sample is present, otherwise `false` (`[[nodiscard]]`)
+ */
+template <typename Samples>
+[[nodiscard]] bool has_any_sample(const Samples &samples) noexcept {
+    bool any_sample = false;
+    for_each_sample_metric<Samples>([&](const auto &metric) { any_sample = any_sample || metric.get(samples).has_value(); });
+    return any_sample;
+}
+
+/**
+ * @brief Format the values of the @p matrix as nested list with one list per row, e.g., "[[1, 2], [3, 4]]" for two logical CPUs and two time points.
+ * @tparam T the type of the values
+ * @param[in] matrix the values of the hardware sample
+ * @return the formatted values (`[[nodiscard]]`)
+ */
+template <typename T>
+[[nodiscard]] std::string sample_matrix_to_string(const sample_matrix<T> &matrix) {
+    std::vector<std::string> rows{};
+    for (const std::vector<T> &row : matrix.to_vector()) {
+        rows.push_back(fmt::format("[{}]", fmt::join(row, ", ")));
+    }
+    return fmt::format("[{}]", fmt::join(rows, ", "));
+}
+
+/**
+ * @brief Format the @p values of the hardware sample described by @p metric as YAML value.
+ * @tparam Metric the type of the hardware sample descriptor
+ * @tparam Values the type of the values
+ * @param[in] metric the hardware sample descriptor
+ * @param[in] values the value(s) of the hardware sample
+ * @return the YAML value (`[[nodiscard]]`)
+ */
+template <typename Metric, typename Values>
+[[nodiscard]] std::string sample_metric_yaml_values(const Metric &metric, const Values &values) {
+    if constexpr (is_sample_matrix_v<Values>) {
+        return sample_matrix_to_string(values);
+    } else if constexpr (is_vector_v<Values>) {
+        if (metric.quoted) {
+            return fmt::format("[{}]", fmt::join(quote(values), ", "));
+        }
+        return fmt::format("[{}]", fmt::join(values, ", "));
+    } else {
+        if (metric.quoted) {
+            return fmt::format("\"{}\"", values);
+        }
+        return fmt::format("{}", values);
+    }
+}
+
+/**
+ * @brief Assemble the YAML entry @p entry_name of the hardware sample described by @p metric with the @p values.
+ * @details If the @p values are summarized by a hws::streaming_statistics, the summary is part of the entry.
+ * @tparam Metric the type of the hardware sample descriptor
+ * @tparam Values the type of the values
+ * @param[in] entry_name the name of the YAML entry
+ * @param[in] metric the hardware sample descriptor
+ * @param[in] values the value(s) of the hardware sample
+ * @return the YAML entry (`[[nodiscard]]`)
+ */
+template <typename Metric, typename Values>
+[[nodiscard]] std::string sample_metric_yaml_entry(const std::string_view entry_name, const Metric &metric, const Values &values) {
+    std::string str = fmt::format("  {}:\n", entry_name);
+    if (!metric.turbostat_name.empty()) {
+        str += fmt::format("    turbostat_name: \"{}\"\n", metric.turbostat_name);
+    }
+    str += fmt::format("    unit: \"{}\"\n", metric.yaml_unit);
+    if constexpr (is_sample_matrix_v<Values>) {
+        // the rows of different hardware samples may belong to different entities, e.g., if a logical CPU has no cpufreq driver
+        str += fmt::format("    row_ids: [{}]\n", fmt::join(values.row_ids(), ", "));
+    }
+    str += fmt::format("    values: {}\n", sample_metric_yaml_values(metric, values));
+    if constexpr (is_sample_column_v<Values>) {
+        // the streaming statistics summarize all values, even if only the last values have been retained
+        if (values.statistics().has_value() && values.statistics()->count() > 0) {
+            const streaming_statistics &stats = values.statistics().value();
+            str += fmt::format("    statistics:\n"
+                               "      count: {}\n"
+                               "      min: {}\n"
+                               "      max: {}\n"
+                               "      mean: {}\n"
+                               "      standard_deviation: {}\n"
+                               "      median: {}\n"
+                               "      p99: {}\n",
+                               stats.count(),
+                               stats.min(),
+                               stats.max(),
+                               stats.mean(),
+                               stats.standard_deviation(),
+                               stats.quantile(0.5),
+                               stats.quantile(0.99));
+        }
+    }
+    return str;
+}
+
+/**
+ * @brief Assemble the YAML string containing all available hardware samples of the @p samples in the section @p section.
+ * @details Hardware samples that are not supported by the current device are omitted in the YAML output as well as the hardware samples using the
+ *          hws::sample_metric_layout::custom layout. Returns an empty string if no hardware sample is present.
+ * @tparam Samples the sample class, e.g., hws::cpu_power_samples
+ * @param[in] samples the sample class instance
+ * @param[in] section the name of the YAML section, e.g., "power"
+ * @return the YAML string (`[[nodiscard]]`)
+ */
+template <typename Samples>
+[[nodiscard]] std::string sample_metrics_yaml_string(const Samples &samples, const std::string_view section) {
+    // if no samples are available, return an empty string
+    if (!has_any_sample(samples)) {
+        return "";
+    }
+
+    std::string str = fmt::format("{}:\n", section);
+    for_each_sample_metric<Samples>([&](const auto &metric) {
+        const auto &values = metric.get(samples);
+        if (!values.has_value()) {
+            return;
+        }
+        if constexpr (remove_cvref_t<decltype(metric)>::is_map) {
+            switch (metric.layout) {
+                case sample_metric_layout::value:
+                case sample_metric_layout::nested:
+                    str += fmt::format("  {}:\n"
+                                       "    unit: \"{}\"\n"
+                                       "    values:\n",
+                                       metric.yaml_name,
+                                       metric.yaml_unit);
+                    for (const auto &[key, value] : values.value()) {
+                        str += fmt::format("      {}{}: {}\n", metric.key_prefix, key, sample_metric_yaml_values(metric, value));
+                    }
+                    break;
+                case sample_metric_layout::per_key:
+                    for (const auto &[key, value] : values.value()) {
+                        str += sample_metric_yaml_entry(fmt::format("{}_{}", key, metric.yaml_name), metric, value);
+                    }
+                    break;
+                case sample_metric_layout::custom:
+                    break;
+            }
+        } else {
+            str += sample_metric_yaml_entry(metric.yaml_name, metric, values.value());
+        }
+    });
+    return str;
+}
+
+/**
+ * @brief Format the @p values of a hardware sample for the output-stream operator.
+ * @tparam Values the type of the values
+ * @param[in] values the value(s) of the hardware sample
+ * @return the formatted values (`[[nodiscard]]`)
+ */
+template <typename Values>
+[[nodiscard]] std::string sample_metric_values_to_string(const Values &values) {
+    if constexpr (is_sample_matrix_v<Values>) {
+        return sample_matrix_to_string(values);
+    } else if constexpr (is_vector_v<Values>) {
+        return fmt::format("[{}]", fmt::join(values, ", "));
+    } else {
+        return fmt::format("{}", values);
+    }
+}
+
+/**
+ * @brief Assemble the string containing **all** hardware samples of the @p samples used by the output-stream operators of the sample classes.
+ * @details In contrast to `sample_metrics_yaml_string`, hardware samples not supported by the current device are output with a default initialized value.
+ * @tparam Samples the sample class, e.g., hws::cpu_power_samples
+ * @param[in] samples the sample class instance
+ * @return the string (`[[nodiscard]]`)
+ */
+template <typename Samples>
+[[nodiscard]] std::string sample_metrics_to_string(const Samples &samples) {
+    std::vector<std::string> lines{};
+    for_each_sample_metric<Samples>([&](const auto &metric) {
+        const auto &values = metric.get(samples);
+        if constexpr (remove_cvref_t<decltype(metric)>::is_map) {
+            switch (metric.layout) {
+                case sample_metric_layout::value:
+                case sample_metric_layout::nested:
+                    lines.push_back(fmt::format("{} [{}]: [{}]", metric.name, metric.unit, map_entry_to_string(values)));
+                    break;
+                case sample_metric_layout::per_key:
+                    if (values.has_value()) {
+                        for (const auto &[key, value] : values.value()) {
+                            lines.push_back(fmt::format("{}_{} [{}]: {}", metric.name, key, metric.unit, sample_metric_values_to_string(value)));
+                        }
+                    }
+                    break;
+                case sample_metric_layout::custom:
+                    if (values.has_value()) {
+                        for (const auto &[key, value] : values.value()) {
+                            lines.push_back(fmt::format("{}: {}", key, sample_metric_values_to_string(value)));
+                        }
+                    }
+                    break;
+            }
+        } else {
+            lines.push_back(fmt::format("{} [{}]: {}", metric.name, metric.unit, sample_metric_values_to_string(value_or_default(values))));
+        }
+    });
+    return fmt::format("{}", fmt::join(lines, "\n"));
+}
+
+/**
+ * @brief Append the names of all present numeric hardware samples of the @p samples to @p names, one name per series of values.
+ * @details A hardware sample stored in a map results in one series per key named `<key>_<name>`, a hardware sample stored in a hws::sample_matrix
+ *          in one series per row named `<name>_<row ID>`. The order matches `append_latest_numeric_sample_values`.
+ * @tparam Samples the sample class, e.g., hws::cpu_power_samples
+ * @param[in] samples the sample class instance
+ * @param[in,out] names the names to append to
+ */
+template <typename Samples>
+void append_numeric_sample_names(const Samples &samples, std::vector<std::string> &names) {
+    for_each_sample_metric<Samples>([&](const auto &metric) {
+        using value_type = typename remove_cvref_t<decltype(metric)>::value_type;
+        if constexpr (has_numeric_values<value_type>::value) {
+            const auto &values = metric.get(samples);
+            if (!values.has_value()) {
+                return;
+            }
+            if constexpr (is_map_v<value_type>) {
+                for (const auto &entry : values.value()) {
+                    names.push_back(fmt::format("{}_{}", entry.first, metric.name));
+                }
+            } else if constexpr (is_sample_matrix_v<value_type>) {
+                for (const std::size_t row_id : values->row_ids()) {
+                    names.push_back(fmt::format("{}_{}", metric.name, row_id));
+                }
+            } else {
+                names.emplace_back(metric.name);
+            }
+        }
+    });
+}
+
+/**
+ * @brief Write the latest values of all present numeric hardware samples of the @p samples to @p values starting at @p pos.
+ * @details Hardware samples whose sample category isn't part of @p sampled, i.e., that haven't been retrieved in the current tick, are written
+ *          as NaN. Never writes past the end of @p values. The order matches `append_numeric_sample_names`.
+ * @tparam Samples the sample class, e.g., hws::cpu_power_samples
+ * @param[in] samples the sample class instance
+ * @param[in] sampled the sample categories retrieved in the current tick
+ * @param[in,out] values the values to write to
+ * @param[in,out] pos the position of the next value to write; advanced past the written values
+ */
+template <typename Samples>
+void append_latest_numeric_sample_values(const Samples &samples, const sample_category sampled, std::vector<double> &values, std::size_t &pos) noexcept {
+    const auto write = [&](const bool available, const auto value) {
+        if (pos < values.size()) {
+            values[pos] = available ? static_cast<double>(value) : std::numeric_limits<double>::quiet_NaN();
+        }
+        ++pos;
+    };
+    for_each_sample_metric<Samples>([&](const auto &metric) {
+        using value_type = typename remove_cvref_t<decltype(metric)>::value_type;
+        if constexpr (has_numeric_values<value_type>::value) {
+            const auto &metric_values = metric.get(samples);
+            if (!metric_values.has_value()) {
+                return;
+            }
+            const bool due = (metric.category & sampled) != sample_category{};
+            if constexpr (is_map_v<value_type>) {
+                for (const auto &entry : metric_values.value()) {
+                    const bool available = due && !entry.second.empty();
+                    write(available, available ? entry.second.back() : typename value_type::mapped_type::value_type{});
+                }
+            } else if constexpr (is_sample_matrix_v<value_type>) {
+                const std::size_t num_columns = metric_values->num_columns();
+                for (std::size_t row = 0; row < metric_values->num_rows(); ++row) {
+                    const bool available = due && num_columns > 0;
+                    write(available, available ? metric_values.value()(row, num_columns - 1) : typename value_type::value_type{});
+                }
+            } else {
+                const bool available = due && !metric_values->empty();
+                write(available, available ? metric_values->back() : typename value_type::value_type{});
+            }
+        }
+    });
+}
+
+}  // namespace detail
+
+}  // namespace hws
+
+#endif  // HWS_SAMPLE_METRIC_HPP_
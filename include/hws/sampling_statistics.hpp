@@ -0,0 +1,89 @@
+/**
+ * @file
+ * @author Marcel Breyer
+ * @copyright 2024-today All Rights Reserved
+ * @license This file is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Defines a struct encapsulating timing statistics of the sampling loop.
+ */
+
+#ifndef HWS_SAMPLING_STATISTICS_HPP_
+#define HWS_SAMPLING_STATISTICS_HPP_
+#pragma once
+
+#include "fmt/ostream.h"  // fmt::formatter, fmt::ostream_formatter
+
+#include <chrono>   // std::chrono::nanoseconds
+#include <cstddef>  // std::size_t
+#include <iosfwd>   // std::ostream forward declaration
+
+namespace hws {
+
+/**
+ * @brief A struct encapsulating the timing statistics of a sampling loop.
+ * @details The jitter of a tick is the difference between the time point the tick was actually sampled and its scheduled deadline.
+ */
+struct sampling_statistics {
+    /**
+     * @brief Record a new tick with the measured @p jitter.
+     * @param[in] jitter the difference between the actual time point of the tick and its deadline
+     */
+    void add_tick(std::chrono::nanoseconds jitter) noexcept;
+
+    /**
+     * @brief Return the mean jitter over all recorded ticks.
+     * @return the mean jitter, zero if no tick has been recorded yet (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::chrono::nanoseconds mean_jitter() const noexcept;
+    /**
+     * @brief Record the time @p latency needed to query the samples of a tick (regular or on-demand).
+     * @param[in] latency the time between the begin and end of the query
+     */
+    void add_query(std::chrono::nanoseconds latency) noexcept;
+    /**
+     * @brief Return the mean time needed to query the samples of a tick.
+     * @return the mean query latency, zero if no query has been recorded yet (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::chrono::nanoseconds mean_query_latency() const noexcept;
+
+    /// The number of ticks at which samples have been retrieved (excluding the initial samples).
+    std::size_t num_ticks{ 0 };
+    /// The number of deadlines for which no sample has been retrieved within their sampling interval.
+    std::size_t num_missed_ticks{ 0 };
+    /// The number of on-demand ticks requested via `hardware_sampler::sample_now()` (not included in `num_ticks` and the jitter).
+    std::size_t num_on_demand_ticks{ 0 };
+    /// The minimum jitter over all recorded ticks.
+    std::chrono::nanoseconds min_jitter{ 0 };
+    /// The maximum jitter over all recorded ticks.
+    std::chrono::nanoseconds max_jitter{ 0 };
+    /// The accumulated jitter over all recorded ticks.
+    std::chrono::nanoseconds total_jitter{ 0 };
+    /// The number of queried ticks (regular and on-demand ticks, excluding the initial samples).
+    std::size_t num_queries{ 0 };
+    /// The minimum time needed to query the samples of a tick.
+    std::chrono::nanoseconds min_query_latency{ 0 };
+    /// The maximum time needed to query the samples of a tick.
+    std::chrono::nanoseconds max_query_latency{ 0 };
+    /// The accumulated time needed to query the samples of all ticks.
+    std::chrono::nanoseconds total_query_latency{ 0 };
+};
+
+/**
+ * @brief Output the sampling statistics @p stats to the given output-stream @p out.
+ * @param[in,out] out the output-stream to write the sampling statistics to
+ * @param[in] stats the sampling statistics
+ * @return the output-stream
+ */
+std::ostream &operator<<(std::ostream &out, const sampling_statistics &stats);
+
+}  // namespace hws
+
+/// @cond Doxygen_suppress
+
+template <>
+struct fmt::formatter<hws::sampling_statistics> : fmt::ostream_formatter { };
+
+/// @endcond
+
+#endif  // HWS_SAMPLING_STATISTICS_HPP_
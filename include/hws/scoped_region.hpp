@@ -0,0 +1,107 @@
+/**
+ * @file
+ * @author Marcel Breyer
+ * @copyright 2024-today All Rights Reserved
+ * @license This file is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Defines a RAII guard for a region of one or multiple hardware samplers.
+ */
+
+#ifndef HWS_SCOPED_REGION_HPP_
+#define HWS_SCOPED_REGION_HPP_
+#pragma once
+
+#include "hws/energy_region.hpp"  // hws::energy_region
+
+#include <cstddef>  // std::size_t
+#include <string>   // std::string
+#include <utility>  // std::pair
+#include <vector>   // std::vector
+
+namespace hws {
+
+// forward declare the hardware sampler classes
+class hardware_sampler;
+class system_hardware_sampler;
+
+/**
+ * @brief A RAII guard that begins a region on construction and ends it on destruction.
+ * @details Regions can be nested by nesting the guards. In contrast to `hardware_sampler::end_region(const std::string &)`, the guard always
+ *          ends exactly the region it has begun, even if other regions with the same name are open.
+ */
+class scoped_region {
+  public:
+    /**
+     * @brief Begin the region @p name on the hardware @p sampler.
+     * @param[in,out] sampler the hardware sampler
+     * @param[in] name the name of the region
+     * @throws std::runtime_error if the hardware @p sampler isn't running
+     */
+    scoped_region(hardware_sampler &sampler, const std::string &name);
+    /**
+     * @brief Begin the region @p name on all hardware samplers of the system @p sampler.
+     * @param[in,out] sampler the system hardware sampler
+     * @param[in] name the name of the region
+     * @throws std::runtime_error if the hardware samplers aren't running
+     */
+    scoped_region(system_hardware_sampler &sampler, const std::string &name);
+
+    /**
+     * @brief Delete the copy-constructor.
+     */
+    scoped_region(const scoped_region &) = delete;
+    /**
+     * @brief Delete the move-constructor.
+     */
+    scoped_region(scoped_region &&) noexcept = delete;
+    /**
+     * @brief Delete the copy-assignment operator.
+     */
+    scoped_region &operator=(const scoped_region &) = delete;
+    /**
+     * @brief Delete the move-assignment operator.
+     */
+    scoped_region &operator=(scoped_region &&) noexcept = delete;
+
+    /**
+     * @brief End the region if it hasn't already been ended via `scoped_region::end()`.
+     * @details Errors (e.g., the hardware sampler has already been stopped) are silently ignored.
+     */
+    ~scoped_region();
+
+    /**
+     * @brief End the region before the guard is destroyed.
+     * @details Calling this function again returns the already ended regions.
+     * @throws std::runtime_error if the hardware samplers have already been stopped
+     * @return the ended region per hardware sampler including its aggregates
+     */
+    const std::vector<energy_region> &end();
+    /**
+     * @brief Check whether the region has already been ended.
+     * @return `true` if the region has been ended, `false` otherwise (`[[nodiscard]]`)
+     */
+    [[nodiscard]] bool finished() const noexcept { return finished_; }
+    /**
+     * @brief Return the ended region per hardware sampler.
+     * @return the regions, empty if the region hasn't been ended yet (`[[nodiscard]]`)
+     */
+    [[nodiscard]] const std::vector<energy_region> &regions() const noexcept { return regions_; }
+
+  private:
+    /**
+     * @brief End the region on all hardware samplers if it hasn't already been ended, ignoring all errors.
+     */
+    void end_ignoring_errors() noexcept;
+
+    /// The hardware samplers together with the ID of the region begun on them.
+    std::vector<std::pair<hardware_sampler *, std::size_t>> region_ids_{};
+    /// The ended regions per hardware sampler.
+    std::vector<energy_region> regions_{};
+    /// `true` if the region has already been ended.
+    bool finished_{ false };
+};
+
+}  // namespace hws
+
+#endif  // HWS_SCOPED_REGION_HPP_
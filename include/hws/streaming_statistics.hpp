@@ -0,0 +1,190 @@
+/**
+ * @file
+ * @author Marcel Breyer
+ * @copyright 2024-today All Rights Reserved
+ * @license This file is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Defines a mergeable streaming summary (moments and quantiles) of the values of a single hardware sample.
+ */
+
+#ifndef HWS_STREAMING_STATISTICS_HPP_
+#define HWS_STREAMING_STATISTICS_HPP_
+#pragma once
+
+#include "fmt/ostream.h"  // fmt::formatter, fmt::ostream_formatter
+
+#include <cstddef>  // std::size_t
+#include <cstdint>  // std::uint64_t
+#include <iosfwd>   // std::ostream forward declaration
+#include <vector>   // std::vector
+
+namespace hws {
+
+/**
+ * @brief A mergeable streaming summary of a sequence of values using constant memory.
+ * @details The minimum, maximum, mean, and variance are tracked exactly using Welford's algorithm. The quantiles are approximated using a
+ *          DDSketch: the values are counted in logarithmically sized bins such that every quantile is accurate up to the relative accuracy.
+ *          The number of bins is bounded by `streaming_statistics::max_num_bins`; if more bins are necessary, the bins of the values with the
+ *          smallest magnitude are collapsed, i.e., the upper quantiles (e.g., p95 or p99) always stay accurate.
+ *          Two summaries with the same relative accuracy can be merged exactly, e.g., the summaries of multiple hardware samplers or MPI ranks.
+ */
+class streaming_statistics {
+  public:
+    /// The default relative accuracy of the quantiles.
+    static constexpr double default_relative_accuracy = 0.01;
+    /// The maximum number of bins per sign used for the quantiles.
+    static constexpr std::size_t max_num_bins = 2048;
+    /// Values whose magnitude is smaller than this value are counted as zero in the quantiles.
+    static constexpr double min_indexable_value = 1e-9;
+
+    /**
+     * @brief Construct an empty summary whose quantiles are accurate up to the @p relative_accuracy.
+     * @param[in] relative_accuracy the relative accuracy of the quantiles
+     * @throws std::invalid_argument if @p relative_accuracy isn't in the open interval (0, 1)
+     */
+    explicit streaming_statistics(double relative_accuracy = default_relative_accuracy);
+
+    /**
+     * @brief Add the @p value to the summary in O(1). Non-finite values are ignored.
+     * @param[in] value the new value
+     */
+    void add(double value);
+    /**
+     * @brief Merge the summary @p other into this summary.
+     * @param[in] other the summary to merge
+     * @throws std::invalid_argument if the relative accuracies of both summaries differ
+     */
+    void merge(const streaming_statistics &other);
+
+    /**
+     * @brief Return the relative accuracy of the quantiles.
+     * @return the relative accuracy (`[[nodiscard]]`)
+     */
+    [[nodiscard]] double relative_accuracy() const noexcept { return relative_accuracy_; }
+    /**
+     * @brief Return the number of added values.
+     * @return the number of values (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::size_t count() const noexcept { return count_; }
+    /**
+     * @brief Return the minimum value.
+     * @return the minimum value, NaN if no value has been added (`[[nodiscard]]`)
+     */
+    [[nodiscard]] double min() const noexcept;
+    /**
+     * @brief Return the maximum value.
+     * @return the maximum value, NaN if no value has been added (`[[nodiscard]]`)
+     */
+    [[nodiscard]] double max() const noexcept;
+    /**
+     * @brief Return the arithmetic mean of the values.
+     * @return the mean, NaN if no value has been added (`[[nodiscard]]`)
+     */
+    [[nodiscard]] double mean() const noexcept;
+    /**
+     * @brief Return the (population) variance of the values.
+     * @return the variance, NaN if no value has been added (`[[nodiscard]]`)
+     */
+    [[nodiscard]] double variance() const noexcept;
+    /**
+     * @brief Return the (population) standard deviation of the values.
+     * @return the standard deviation, NaN if no value has been added (`[[nodiscard]]`)
+     */
+    [[nodiscard]] double standard_deviation() const noexcept;
+    /**
+     * @brief Return the approximated @p q quantile of the values, e.g., `0.99` for the p99.
+     * @param[in] q the quantile in the closed interval [0, 1]
+     * @throws std::invalid_argument if @p q isn't in the closed interval [0, 1]
+     * @return the quantile, NaN if no value has been added (`[[nodiscard]]`)
+     */
+    [[nodiscard]] double quantile(double q) const;
+
+    /**
+     * @brief Serialize the summary into a flat std::vector of doubles, e.g., to gather the summaries of multiple MPI ranks using `MPI_DOUBLE`.
+     * @return the serialized summary (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::vector<double> serialize() const;
+    /**
+     * @brief Reconstruct a summary from the @p data created by `streaming_statistics::serialize()`.
+     * @param[in] data the serialized summary
+     * @throws std::invalid_argument if @p data isn't a valid serialized summary
+     * @return the summary (`[[nodiscard]]`)
+     */
+    [[nodiscard]] static streaming_statistics deserialize(const std::vector<double> &data);
+
+  private:
+    /**
+     * @brief A contiguous range of bins counting the values whose logarithmic index falls into the respective bin.
+     */
+    struct bin_store {
+        /**
+         * @brief Add @p num values to the bin with the logarithmic index @p index. Collapses the lowest bins if more than `max_num_bins` are necessary.
+         * @param[in] index the logarithmic index of the values
+         * @param[in] num the number of values
+         */
+        void add(int index, std::uint64_t num);
+
+        /// The number of values per bin.
+        std::vector<std::uint64_t> bins{};
+        /// The logarithmic index of the first bin.
+        int offset{ 0 };
+    };
+
+    /**
+     * @brief Return the logarithmic index of the positive @p value.
+     * @param[in] value the value
+     * @return the index (`[[nodiscard]]`)
+     */
+    [[nodiscard]] int index(double value) const noexcept;
+    /**
+     * @brief Return the representative value of the bin with the logarithmic index @p index, i.e., the value with the smallest relative error for all values of the bin.
+     * @param[in] index the logarithmic index
+     * @return the representative value (`[[nodiscard]]`)
+     */
+    [[nodiscard]] double bin_value(int index) const noexcept;
+
+    /// The relative accuracy of the quantiles.
+    double relative_accuracy_;
+    /// The base of the logarithmic bins: (1 + relative_accuracy_) / (1 - relative_accuracy_).
+    double gamma_;
+    /// The precomputed inverse of the natural logarithm of gamma_.
+    double inverse_log_gamma_;
+
+    /// The number of added values.
+    std::size_t count_{ 0 };
+    /// The running mean of the added values.
+    double mean_{ 0.0 };
+    /// The running sum of the squared differences from the mean (Welford's algorithm).
+    double m2_{ 0.0 };
+    /// The minimum added value.
+    double min_{ 0.0 };
+    /// The maximum added value.
+    double max_{ 0.0 };
+
+    /// The bins of the positive values.
+    bin_store positive_bins_{};
+    /// The bins of the magnitudes of the negative values.
+    bin_store negative_bins_{};
+    /// The number of values whose magnitude is smaller than min_indexable_value.
+    std::uint64_t zero_count_{ 0 };
+};
+
+/**
+ * @brief Output the summary @p stats to the given output-stream @p out.
+ * @param[in,out] out the output-stream to write the summary to
+ * @param[in] stats the summary
+ * @return the output-stream
+ */
+std::ostream &operator<<(std::ostream &out, const streaming_statistics &stats);
+
+}  // namespace hws
+
+/// @cond Doxygen_suppress
+
+template <>
+struct fmt::formatter<hws::streaming_statistics> : fmt::ostream_formatter { };
+
+/// @endcond
+
+#endif  // HWS_STREAMING_STATISTICS_HPP_
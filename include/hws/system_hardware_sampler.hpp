@@ -11,15 +11,21 @@
 #ifndef HWS_SYSTEM_HARDWARE_SAMPLER_HPP_
 #define HWS_SYSTEM_HARDWARE_SAMPLER_HPP_
 
-#include "hws/event.hpp"             // hws::event
-#include "hws/hardware_sampler.hpp"  // hws::hardware_sampler
-#include "hws/sample_category.hpp"   // hws::sample_category
+#include "hws/burst_capture.hpp"        // hws::burst_capture
+#include "hws/energy_region.hpp"        // hws::energy_region
+#include "hws/event.hpp"                // hws::event
+#include "hws/hardware_sampler.hpp"     // hws::hardware_sampler
+#include "hws/overrun_policy.hpp"       // hws::overrun_policy
+#include "hws/sample_category.hpp"      // hws::sample_category
+#include "hws/sampling_statistics.hpp"  // hws::sampling_statistics
 
-#include <chrono>      // std::chrono::{milliseconds, steady_clock::time_point}
+#include <chrono>      // std::chrono::{nanoseconds, steady_clock::time_point}
 #include <cstddef>     // std::size_t
 #include <filesystem>  // std::filesystem::path
-#include <memory>      // std::unique_ptr
+#include <memory>      // std::unique_ptr, std::shared_ptr
+#include <optional>    // std::optional
 #include <string>      // std::string
+#include <thread>      // std::thread
 #include <vector>      // std::vector
 
 namespace hws {
@@ -40,7 +46,7 @@ class system_hardware_sampler {
      * @param[in] sampling_interval the used sampling interval
      * @param[in] category the sample categories that are enabled for hardware sampling (default: all)
      */
-    explicit system_hardware_sampler(std::chrono::milliseconds sampling_interval, sample_category category = sample_category::all);
+    explicit system_hardware_sampler(std::chrono::nanoseconds sampling_interval, sample_category category = sample_category::all);
 
     /**
      * @brief Delete the copy-constructor.
@@ -60,12 +66,13 @@ class system_hardware_sampler {
     system_hardware_sampler &operator=(system_hardware_sampler &&) noexcept = delete;
 
     /**
-     * @brief Explicitly use the default destructor.
+     * @brief Destruct the system hardware sampler. If the shared sampling std::thread is still running, stops it.
      */
-    ~system_hardware_sampler() = default;
+    ~system_hardware_sampler();
 
     /**
      * @brief Start hardware sampling for all wrapped hardware samplers.
+     * @details If the shared sampling std::thread is enabled, only a single std::thread is created for all hardware samplers.
      */
     void start_sampling();
     /**
@@ -113,6 +120,67 @@ class system_hardware_sampler {
      * @param[in] name the name of the event
      */
     void add_event(decltype(event::name) name);
+    /**
+     * @brief Add a new event to all hardware samplers. The time_point will be the current time.
+     * @details If @p sample_immediately is `true`, additionally request an on-demand sample from all hardware samplers.
+     * @param[in] name the name of the event
+     * @param[in] sample_immediately if `true`, retrieve an additional sample at the event boundary
+     */
+    void add_event(decltype(event::name) name, bool sample_immediately);
+    /**
+     * @brief Request an on-demand sample from all hardware samplers without waiting for the next sampling interval.
+     */
+    void sample_now();
+
+    /**
+     * @brief Begin a new region with the name @p name at the current time for all hardware samplers.
+     * @param[in] name the name of the region
+     * @throws std::runtime_error if the hardware samplers aren't running
+     */
+    void begin_region(const std::string &name);
+    /**
+     * @brief End the most recently begun region with the name @p name that hasn't been ended yet for all hardware samplers.
+     * @param[in] name the name of the region
+     * @throws std::runtime_error if the hardware samplers aren't running or no open region with the name @p name exists
+     */
+    void end_region(const std::string &name);
+    /**
+     * @brief Return all regions separately for each hardware sampler.
+     * @return the regions per hardware sampler (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::vector<std::vector<energy_region>> energy_regions() const;
+    /**
+     * @brief Enable or disable the marker-only mode for all hardware samplers.
+     * @details In the marker-only mode, no sampling std::thread is started at all, independent of `system_hardware_sampler::set_shared_sampling_thread`.
+     * @param[in] enable `true` to enable the marker-only mode, `false` otherwise
+     * @throws std::runtime_error if any hardware sampler has already been started
+     */
+    void set_marker_only_mode(bool enable);
+
+    /**
+     * @brief Set the windows captured around the time point a trigger fired for all hardware samplers.
+     * @details The triggers themselves are specific to the hardware samples of each device and must be added to the individual hardware samplers
+     *          (see `hardware_sampler::add_trigger`).
+     * @param[in] pre_trigger the duration before the trigger fired to capture
+     * @param[in] post_trigger the duration after the trigger fired to capture in the burst mode
+     * @param[in] burst_interval the sampling interval in the burst mode, `std::nullopt` to use the base sampling interval of each hardware sampler
+     * @throws std::runtime_error if any hardware sampler has already been started
+     * @throws std::invalid_argument if @p pre_trigger or @p post_trigger is negative or both are zero
+     * @throws std::invalid_argument if @p burst_interval isn't positive or doesn't evenly divide the base sampling interval of any hardware sampler
+     */
+    void set_burst_window(std::chrono::nanoseconds pre_trigger, std::chrono::nanoseconds post_trigger, std::optional<std::chrono::nanoseconds> burst_interval = std::nullopt);
+    /**
+     * @brief Select the hardware samples retrieved by all hardware samplers by their names (see `hardware_sampler::set_sample_metrics`).
+     * @details Names not supported by a hardware sampler are ignored by that hardware sampler.
+     * @param[in] metrics the names of the selected hardware samples; an empty vector selects all hardware samples
+     * @throws std::runtime_error if any hardware sampler has already been started
+     */
+    void set_sample_metrics(const std::vector<std::string> &metrics);
+    /**
+     * @brief Return all burst captures separately for each hardware sampler.
+     * @return the burst captures per hardware sampler (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::vector<std::vector<burst_capture>> burst_captures() const;
 
     /**
      * @brief Return the number of recorded events separately for each hardware sampler.
@@ -129,11 +197,111 @@ class system_hardware_sampler {
      * @return the time points per hardware sampler (`[[nodiscard]]`)
      */
     [[nodiscard]] std::vector<std::vector<std::chrono::steady_clock::time_point>> sampling_time_points() const;
+    /**
+     * @brief Return the time needed to query the samples of each tick separately for each hardware sampler.
+     * @details Since the hardware samplers share a sampling std::thread, they are queried one after another in each tick
+     *          (see `hardware_sampler::sampling_query_begin_time_points()`).
+     * @return the query latencies per hardware sampler (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::vector<std::vector<std::chrono::nanoseconds>> sampling_query_latencies() const;
     /**
      * @brief Return the sampling interval separately for each hardware sampler.
-     * @return the samping interval in milliseconds per hardware sampler (`[[nodiscard]]`)
+     * @return the samping interval in nanoseconds per hardware sampler (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::vector<std::chrono::nanoseconds> sampling_interval() const;
+    /**
+     * @brief Return the sampling interval of the single sample category @p category separately for each hardware sampler.
+     * @param[in] category the sample_category; must be exactly one sample category
+     * @throws std::invalid_argument if @p category isn't exactly one sample category
+     * @return the samping interval in nanoseconds per hardware sampler (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::vector<std::chrono::nanoseconds> sampling_interval(sample_category category) const;
+    /**
+     * @brief Set the sampling interval used for the samples of all sample categories in @p category to @p interval for all hardware samplers.
+     * @param[in] category the sample categories whose sampling interval should be changed
+     * @param[in] interval the new sampling interval of the sample categories; must be a multiple of the base sampling interval
+     * @throws std::runtime_error if any hardware sampler has already been started
+     * @throws std::invalid_argument if @p interval isn't a positive multiple of the base sampling interval
+     */
+    void set_sampling_interval(sample_category category, std::chrono::nanoseconds interval);
+
+    /**
+     * @brief Enable the adaptive sampling rate with the upper bound @p max_sampling_interval for all hardware samplers.
+     * @param[in] max_sampling_interval the largest sampling interval used if the tracked samples stay flat
+     * @throws std::runtime_error if any hardware sampler has already been started
+     * @throws std::invalid_argument if @p max_sampling_interval isn't a positive multiple of the base sampling interval
+     */
+    void set_adaptive_sampling(std::chrono::nanoseconds max_sampling_interval);
+    /**
+     * @brief Set the relative change of the tracked samples of all sample categories in @p category that resets the adaptive sampling interval for all hardware samplers.
+     * @param[in] category the sample categories whose threshold should be changed
+     * @param[in] threshold the new relative threshold
+     * @throws std::runtime_error if any hardware sampler has already been started
+     * @throws std::invalid_argument if @p threshold is negative
+     */
+    void set_adaptive_sampling_threshold(sample_category category, double threshold);
+    /**
+     * @brief Retain only the last @p num_samples samples of every hardware sample for all hardware samplers.
+     * @param[in] num_samples the number of retained samples per hardware sample
+     * @throws std::runtime_error if the hardware samplers have already been started
+     * @throws std::invalid_argument if @p num_samples is zero
+     */
+    void set_sample_retention(std::size_t num_samples);
+    /**
+     * @brief Retain only the samples of at least the last @p duration of every hardware sample for all hardware samplers.
+     * @param[in] duration the retained duration
+     * @throws std::runtime_error if the hardware samplers have already been started
+     * @throws std::invalid_argument if @p duration isn't positive
      */
-    [[nodiscard]] std::vector<std::chrono::milliseconds> sampling_interval() const;
+    void set_sample_retention(std::chrono::nanoseconds duration);
+    /**
+     * @brief Enable or disable the compression of all hardware samples and time points for all hardware samplers.
+     * @param[in] enable `true` to compress the hardware samples, `false` otherwise
+     * @throws std::runtime_error if the hardware samplers have already been started or a sample retention is used
+     */
+    void set_sample_compression(bool enable);
+    /**
+     * @brief Enable or disable the streaming statistics of all arithmetic hardware samples for all hardware samplers.
+     * @details The summaries of the same hardware sample of multiple hardware samplers can be combined using `streaming_statistics::merge`.
+     * @param[in] enable `true` to summarize the hardware samples, `false` otherwise
+     * @throws std::runtime_error if the hardware samplers have already been started, a sample retention is used, or the sample compression is enabled
+     */
+    void set_streaming_statistics(bool enable);
+    /**
+     * @brief Set the expected duration of the sampling used to preallocate the storage of the hardware samples for all hardware samplers.
+     * @param[in] duration the expected sampling duration
+     * @throws std::runtime_error if the hardware samplers have already been started
+     * @throws std::invalid_argument if @p duration is negative
+     */
+    void set_expected_sampling_duration(std::chrono::nanoseconds duration);
+
+    /**
+     * @brief Enable or disable the usage of a single shared sampling std::thread for all wrapped hardware samplers.
+     * @details If enabled, all hardware samplers are driven from a single std::thread instead of one std::thread per hardware sampler.
+     *          Hardware samplers whose deadlines coincide retrieve their samples in the same tick and, therefore, share the same time points.
+     *          Note that a hardware sampler that takes long to retrieve its samples delays all other hardware samplers of the same tick.
+     * @param[in] enable `true` to use a single shared sampling std::thread, `false` to use a separate std::thread per hardware sampler (default)
+     * @throws std::runtime_error if any hardware sampler has already been started
+     */
+    void set_shared_sampling_thread(bool enable);
+    /**
+     * @brief Check whether a single shared sampling std::thread is used for all wrapped hardware samplers.
+     * @return `true` if a single shared sampling std::thread is used, `false` otherwise (`[[nodiscard]]`)
+     */
+    [[nodiscard]] bool uses_shared_sampling_thread() const noexcept { return shared_sampling_thread_; }
+
+    /**
+     * @brief Set the policy used if retrieving a sample takes longer than the sampling interval for all hardware samplers.
+     * @param[in] policy the new overrun policy
+     * @throws std::runtime_error if any hardware sampler has already been started
+     */
+    void set_sampling_overrun_policy(overrun_policy policy);
+
+    /**
+     * @brief Return the timing statistics of the sampling loop separately for each hardware sampler.
+     * @return the sampling statistics per hardware sampler (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::vector<hws::sampling_statistics> sampling_statistics() const;
 
     /**
      * @brief The number of hardware samplers available for the whole system.
@@ -188,8 +356,20 @@ class system_hardware_sampler {
     [[nodiscard]] std::string samples_only_as_yaml_string() const;
 
   private:
+    /**
+     * @brief The sampling loop running in the shared sampling std::thread. Drives all hardware samplers that haven't been stopped yet.
+     */
+    void sampling_loop();
+
     /// The different hardware sampler for the current system.
     std::vector<std::unique_ptr<hardware_sampler>> samplers_;
+
+    /// True if a single shared sampling std::thread should be used for all hardware samplers.
+    bool shared_sampling_thread_{ false };
+    /// The shared std::thread used to getter the hardware samples of all hardware samplers.
+    std::thread sampling_thread_{};
+    /// Used to wake up the shared sampling std::thread if any hardware sampler is stopped, paused, or resumed.
+    std::shared_ptr<hardware_sampler::sampling_wakeup> sampling_wakeup_{};
 };
 
 }  // namespace hws
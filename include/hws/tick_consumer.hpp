@@ -0,0 +1,171 @@
+/**
+ * @file
+ * @author Marcel Breyer
+ * @copyright 2024-today All Rights Reserved
+ * @license This file is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Defines a tick callback that offloads the processing of the ticks to a separate consumer std::thread.
+ */
+
+#ifndef HWS_TICK_CONSUMER_HPP_
+#define HWS_TICK_CONSUMER_HPP_
+#pragma once
+
+#include "hws/hardware_sampler.hpp"  // hws::hardware_sampler
+#include "hws/tick_queue.hpp"        // hws::detail::tick_queue
+#include "hws/tick_view.hpp"         // hws::tick_view
+
+#include <atomic>              // std::atomic
+#include <chrono>              // std::chrono::milliseconds
+#include <condition_variable>  // std::condition_variable
+#include <cstddef>             // std::size_t
+#include <exception>           // std::exception
+#include <functional>          // std::function
+#include <iostream>            // std::cerr, std::endl
+#include <mutex>               // std::mutex, std::unique_lock
+#include <stdexcept>           // std::invalid_argument
+#include <thread>              // std::thread
+#include <utility>             // std::move
+
+namespace hws {
+
+/**
+ * @brief A tick callback that offloads the processing of the ticks to a separate consumer std::thread.
+ * @details In the sampling std::thread, the @p extract function copies the values of interest out of the hws::tick_view into a @p T that is
+ *          pushed into a bounded lock-free queue (the view itself must not leave the sampling std::thread). The @p consume function is called
+ *          in the consumer std::thread for each value in the order the ticks occurred. If the queue is full, the value is dropped instead of
+ *          blocking the sampling std::thread (see `hws::tick_consumer::num_dropped()`).
+ *          The callback is added on construction and removed on destruction; all queued values are consumed before the destructor returns.
+ * @tparam T the type of the values passed from the sampling std::thread to the consumer std::thread; should be cheap to copy without memory allocations
+ */
+template <typename T>
+class tick_consumer {
+  public:
+    /**
+     * @brief Add a tick callback to the hardware sampler @p sampler that offloads the processing of the ticks to a new consumer std::thread.
+     * @param[in,out] sampler the hardware sampler whose ticks should be consumed; must outlive this tick_consumer
+     * @param[in] capacity the maximum number of values queued between the sampling std::thread and the consumer std::thread
+     * @param[in] extract the function copying the values of interest out of the view; called in the sampling std::thread
+     * @param[in] consume the function processing the values; called in the consumer std::thread
+     * @throws std::invalid_argument if @p capacity is zero or @p extract or @p consume is empty
+     */
+    tick_consumer(hardware_sampler &sampler, const std::size_t capacity, std::function<T(const tick_view &)> extract, std::function<void(const T &)> consume) :
+        sampler_{ sampler },
+        queue_{ capacity },
+        extract_{ std::move(extract) },
+        consume_{ std::move(consume) } {
+        if (!extract_ || !consume_) {
+            throw std::invalid_argument{ "The extract and consume functions of a tick_consumer must not be empty!" };
+        }
+        consumer_thread_ = std::thread{ [this]() { this->consumer_loop(); } };
+        callback_id_ = sampler_.add_tick_callback([this](const tick_view &view) { this->produce(view); });
+    }
+
+    /**
+     * @brief Delete the copy-constructor (the consumer std::thread references this tick_consumer).
+     */
+    tick_consumer(const tick_consumer &) = delete;
+    /**
+     * @brief Delete the move-constructor (the consumer std::thread references this tick_consumer).
+     */
+    tick_consumer(tick_consumer &&) noexcept = delete;
+    /**
+     * @brief Delete the copy-assignment operator (the consumer std::thread references this tick_consumer).
+     * @return `*this`
+     */
+    tick_consumer &operator=(const tick_consumer &) = delete;
+    /**
+     * @brief Delete the move-assignment operator (the consumer std::thread references this tick_consumer).
+     * @return `*this`
+     */
+    tick_consumer &operator=(tick_consumer &&) noexcept = delete;
+
+    /**
+     * @brief Remove the tick callback, consume all remaining values, and join the consumer std::thread.
+     */
+    ~tick_consumer() {
+        try {
+            sampler_.remove_tick_callback(callback_id_);
+        } catch (const std::exception &e) {
+            std::cerr << e.what() << std::endl;
+        }
+        stop_ = true;
+        {
+            const std::lock_guard lock{ mutex_ };
+        }
+        cv_.notify_one();
+        consumer_thread_.join();
+    }
+
+    /**
+     * @brief Return the number of values dropped because the queue was full.
+     * @return the number of dropped values (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::size_t num_dropped() const noexcept { return num_dropped_; }
+
+  private:
+    /**
+     * @brief Extract the values of the tick @p view and push them into the queue. Called in the sampling std::thread.
+     * @param[in] view the current tick
+     */
+    void produce(const tick_view &view) {
+        if (!queue_.try_push(extract_(view))) {
+            ++num_dropped_;
+            return;
+        }
+        // don't acquire the mutex: a missed notification is caught by the periodic wake-up of the consumer std::thread
+        cv_.notify_one();
+    }
+
+    /**
+     * @brief Consume all queued values until the tick_consumer is destroyed. Runs in the consumer std::thread.
+     */
+    void consumer_loop() {
+        try {
+            T value{};
+            while (true) {
+                while (queue_.try_pop(value)) {
+                    consume_(value);
+                }
+                if (stop_) {
+                    // the tick callback has already been removed -> consume the values pushed before the removal
+                    while (queue_.try_pop(value)) {
+                        consume_(value);
+                    }
+                    break;
+                }
+                std::unique_lock lock{ mutex_ };
+                cv_.wait_for(lock, std::chrono::milliseconds{ 10 }, [this]() { return stop_ || !queue_.empty(); });
+            }
+        } catch (const std::exception &e) {
+            std::cerr << "Error in tick_consumer thread: " << e.what() << std::endl;
+            throw;
+        }
+    }
+
+    /// The hardware sampler whose ticks are consumed.
+    hardware_sampler &sampler_;
+    /// The queue passing the values from the sampling std::thread to the consumer std::thread.
+    detail::tick_queue<T> queue_;
+    /// The function copying the values of interest out of the view.
+    std::function<T(const tick_view &)> extract_;
+    /// The function processing the values.
+    std::function<void(const T &)> consume_;
+    /// The mutex the consumer std::thread sleeps on.
+    std::mutex mutex_{};
+    /// The condition variable the consumer std::thread sleeps on.
+    std::condition_variable cv_{};
+    /// A boolean flag indicating whether the consumer std::thread should stop.
+    std::atomic<bool> stop_{ false };
+    /// The number of values dropped because the queue was full.
+    std::atomic<std::size_t> num_dropped_{ 0 };
+    /// The ID of the tick callback added to the hardware sampler.
+    std::size_t callback_id_{};
+    /// The std::thread consuming the queued values.
+    std::thread consumer_thread_{};
+};
+
+}  // namespace hws
+
+#endif  // HWS_TICK_CONSUMER_HPP_
@@ -0,0 +1,107 @@
+/**
+ * @file
+ * @author Marcel Breyer
+ * @copyright 2024-today All Rights Reserved
+ * @license This file is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Defines a bounded lock-free single-producer single-consumer queue used to offload the tick callbacks to a consumer std::thread.
+ */
+
+#ifndef HWS_TICK_QUEUE_HPP_
+#define HWS_TICK_QUEUE_HPP_
+#pragma once
+
+#include <atomic>       // std::atomic, std::memory_order_acquire, std::memory_order_release, std::memory_order_relaxed
+#include <cstddef>      // std::size_t
+#include <memory>       // std::unique_ptr
+#include <stdexcept>    // std::invalid_argument
+#include <type_traits>  // std::is_default_constructible_v, std::is_nothrow_copy_assignable_v
+#include <utility>      // std::move
+
+namespace hws::detail {
+
+/**
+ * @brief A bounded lock-free single-producer single-consumer queue.
+ * @details All slots are allocated upfront, i.e., pushing a value never allocates memory if copy assigning a @p T doesn't allocate memory
+ *          (e.g., for trivially copyable types). If the queue is full, pushing a value fails instead of blocking the producer.
+ * @tparam T the type of the values
+ */
+template <typename T>
+class tick_queue {
+    static_assert(std::is_default_constructible_v<T>, "The values stored in a tick_queue must be default constructible!");
+
+  public:
+    /**
+     * @brief Construct an empty queue holding at most @p capacity values.
+     * @param[in] capacity the maximum number of values
+     * @throws std::invalid_argument if @p capacity is zero
+     */
+    explicit tick_queue(const std::size_t capacity) :
+        num_slots_{ capacity + 1 } {
+        if (capacity == 0) {
+            throw std::invalid_argument{ "The capacity of a tick_queue must be larger than 0!" };
+        }
+        // one slot always stays empty to distinguish a full from an empty queue
+        slots_ = std::unique_ptr<T[]>(new T[num_slots_]);
+    }
+
+    /**
+     * @brief Try to push the value @p value. Must only be called by the single producer.
+     * @param[in] value the value to push
+     * @return `true` if the value has been pushed, `false` if the queue is full (`[[nodiscard]]`)
+     */
+    [[nodiscard]] bool try_push(const T &value) noexcept(std::is_nothrow_copy_assignable_v<T>) {
+        const std::size_t tail = tail_.load(std::memory_order_relaxed);
+        const std::size_t next = (tail + 1) % num_slots_;
+        if (next == head_.load(std::memory_order_acquire)) {
+            return false;
+        }
+        slots_[tail] = value;
+        // publish the new value: the consumer that sees the new tail also sees the new value
+        tail_.store(next, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Try to pop the oldest value into @p value. Must only be called by the single consumer.
+     * @param[out] value the popped value
+     * @return `true` if a value has been popped, `false` if the queue is empty (`[[nodiscard]]`)
+     */
+    [[nodiscard]] bool try_pop(T &value) {
+        const std::size_t head = head_.load(std::memory_order_relaxed);
+        if (head == tail_.load(std::memory_order_acquire)) {
+            return false;
+        }
+        value = std::move(slots_[head]);
+        // release the slot: the producer that sees the new head may overwrite the slot
+        head_.store((head + 1) % num_slots_, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Check whether the queue is currently empty.
+     * @return `true` if the queue is empty, `false` otherwise (`[[nodiscard]]`)
+     */
+    [[nodiscard]] bool empty() const noexcept { return head_.load(std::memory_order_acquire) == tail_.load(std::memory_order_acquire); }
+
+    /**
+     * @brief Return the maximum number of values in the queue.
+     * @return the capacity (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::size_t capacity() const noexcept { return num_slots_ - 1; }
+
+  private:
+    /// The number of slots (capacity + 1).
+    std::size_t num_slots_;
+    /// The slots storing the values.
+    std::unique_ptr<T[]> slots_{};
+    /// The position of the oldest value. Only modified by the consumer; on its own cache line to avoid false sharing with the producer.
+    alignas(64) std::atomic<std::size_t> head_{ 0 };
+    /// The position of the next value. Only modified by the producer; on its own cache line to avoid false sharing with the consumer.
+    alignas(64) std::atomic<std::size_t> tail_{ 0 };
+};
+
+}  // namespace hws::detail
+
+#endif  // HWS_TICK_QUEUE_HPP_
@@ -0,0 +1,79 @@
+/**
+ * @file
+ * @author Marcel Breyer
+ * @copyright 2024-today All Rights Reserved
+ * @license This file is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Defines a lightweight, non-owning view of a single tick of the sampling loop passed to the tick callbacks.
+ */
+
+#ifndef HWS_TICK_VIEW_HPP_
+#define HWS_TICK_VIEW_HPP_
+#pragma once
+
+#include "hws/sample_category.hpp"  // hws::sample_category
+
+#include <chrono>    // std::chrono::{steady_clock::time_point, nanoseconds}
+#include <cstddef>   // std::size_t
+#include <optional>  // std::optional
+#include <string>    // std::string
+#include <vector>    // std::vector
+
+namespace hws {
+
+// forward declare the hardware_sampler class
+class hardware_sampler;
+
+/**
+ * @brief A lightweight, non-owning view of a single tick of the sampling loop.
+ * @details Passed to the callbacks added via `hardware_sampler::add_tick_callback` in the sampling std::thread right after the samples of
+ *          the tick have been retrieved. The numeric values of the tick are available backend independently via `numeric_sample_values`.
+ *          Additionally, the values just appended to the sample columns can be read via the backend specific sample accessors,
+ *          e.g., `view.sampler_as<hws::gpu_nvidia_hardware_sampler>().power_samples().get_power_usage()->back()`.
+ *          The view (and the referenced samples) must not be used after the callback returned.
+ */
+struct tick_view {
+    /**
+     * @brief Return the hardware sampler that retrieved the samples as its concrete backend type @p Sampler.
+     * @tparam Sampler the type of the hardware sampler, e.g., hws::gpu_nvidia_hardware_sampler
+     * @throws std::bad_cast if the hardware sampler isn't of type @p Sampler
+     * @return the hardware sampler (`[[nodiscard]]`)
+     */
+    template <typename Sampler>
+    [[nodiscard]] const Sampler &sampler_as() const {
+        return dynamic_cast<const Sampler &>(sampler);
+    }
+
+    /**
+     * @brief Check whether the samples of any sample category in @p category have been retrieved in this tick.
+     * @param[in] category the sample categories to check
+     * @return `true` if the samples of any sample category in @p category have been retrieved, `false` otherwise (`[[nodiscard]]`)
+     */
+    [[nodiscard]] bool sampled(const sample_category category) const noexcept { return static_cast<int>(sampled_categories & category) != 0; }
+
+    /// The hardware sampler that retrieved the samples.
+    const hardware_sampler &sampler;
+    /// The time point of this tick.
+    std::chrono::steady_clock::time_point time_point;
+    /// The time needed to query the samples of this tick, i.e., the backend overhead of this tick.
+    std::chrono::nanoseconds query_latency;
+    /// The index of this tick since the sampling has been started (the initial samples are tick `0`).
+    std::size_t tick;
+    /// `true` if this tick retrieved an on-demand sample (see `hardware_sampler::sample_now`).
+    bool on_demand;
+    /// The sample categories whose samples have been retrieved in this tick.
+    sample_category sampled_categories;
+    /// The power draw retrieved in this tick (in W), `std::nullopt` if not retrieved in this tick or not supported by the device.
+    std::optional<double> power_usage;
+    /// The temperature retrieved in this tick (in °C), `std::nullopt` if not retrieved in this tick or not supported by the device.
+    std::optional<double> temperature;
+    /// The names of the numeric hardware samples of the device (see `hardware_sampler::numeric_sample_names()`), the same in every tick.
+    const std::vector<std::string> &numeric_sample_names;
+    /// The numeric hardware samples retrieved in this tick in the order of `numeric_sample_names`, NaN if not retrieved in this tick.
+    const std::vector<double> &numeric_sample_values;
+};
+
+}  // namespace hws
+
+#endif  // HWS_TICK_VIEW_HPP_
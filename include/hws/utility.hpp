@@ -12,6 +12,9 @@
 #define HWS_UTILITY_HPP_
 #pragma once
 
+#include "hws/sample_column.hpp"  // hws::sample_column
+#include "hws/sample_matrix.hpp"  // hws::sample_matrix
+
 #include "fmt/format.h"  // fmt::format
 #include "fmt/ranges.h"  // fmt::join
 
@@ -42,17 +45,32 @@ namespace hws::detail {
     std::optional<sample_type> sample_name##_{};
 
 /**
- * @brief Defines a public optional vector getter with name `get_sample_name` and a private optional vector member with name `sample_name_`.
+ * @brief Defines a public optional sample column getter with name `get_sample_name` and a private optional sample column member with name `sample_name_`.
  * @details Same as `HWS_SAMPLE_STRUCT_FIXED_MEMBER` but per sample_name multiple values can be tracked.
+ *          The hws::sample_column can safely be read while the sampling std::thread appends new values.
  */
-#define HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(sample_type, sample_name)                                   \
-  public:                                                                                             \
-    [[nodiscard]] const std::optional<std::vector<sample_type>> &get_##sample_name() const noexcept { \
-        return sample_name##_;                                                                        \
-    }                                                                                                 \
-                                                                                                      \
-  private:                                                                                            \
-    std::optional<std::vector<sample_type>> sample_name##_{};
+#define HWS_SAMPLE_STRUCT_SAMPLING_MEMBER(sample_type, sample_name)                                          \
+  public:                                                                                                    \
+    [[nodiscard]] const std::optional<hws::sample_column<sample_type>> &get_##sample_name() const noexcept { \
+        return sample_name##_;                                                                               \
+    }                                                                                                        \
+                                                                                                             \
+  private:                                                                                                   \
+    std::optional<hws::sample_column<sample_type>> sample_name##_{};
+
+/**
+ * @brief Defines a public optional sample matrix getter with name `get_sample_name` and a private optional sample matrix member with name `sample_name_`.
+ * @details Same as `HWS_SAMPLE_STRUCT_SAMPLING_MEMBER` but per time point one value per row (e.g., per logical CPU) is tracked.
+ *          The hws::sample_matrix can safely be read while the sampling std::thread appends new values.
+ */
+#define HWS_SAMPLE_STRUCT_MATRIX_MEMBER(sample_type, sample_name)                                            \
+  public:                                                                                                    \
+    [[nodiscard]] const std::optional<hws::sample_matrix<sample_type>> &get_##sample_name() const noexcept { \
+        return sample_name##_;                                                                               \
+    }                                                                                                        \
+                                                                                                             \
+  private:                                                                                                   \
+    std::optional<hws::sample_matrix<sample_type>> sample_name##_{};
 
 /*****************************************************************************************************/
 /**                                          type_traits                                            **/
@@ -79,7 +97,14 @@ template <typename T>
 struct is_vector<std::vector<T>> : std::true_type { };
 
 /**
- * @brief Evaluates to `true` if @p T is a std::vector, otherwise `false`.
+ * @brief The case if the type @p T is a hws::sample_column (treated like a std::vector).
+ * @tparam T the type to check
+ */
+template <typename T>
+struct is_vector<sample_column<T>> : std::true_type { };
+
+/**
+ * @brief Evaluates to `true` if @p T is a std::vector or hws::sample_column, otherwise `false`.
  * @tparam T the type to check
  */
 template <typename T>
@@ -230,17 +255,17 @@ template <typename MapType>
 /**
  * @brief Quote all @p values and return a vector of strings.
  * @details Example: calling this function with `{ 1, 2, 3, 4 }` would return a vector of strings containing `{ "1", "2", "3", "4" }`.
- * @tparam T the type of the values to quote
+ * @tparam Container the type of the container (std::vector or hws::sample_column) containing the values to quote
  * @param[in] values the values to quote
  * @return the quoted values (`[[nodiscard]]`)
  */
-template <typename T>
-[[nodiscard]] inline std::vector<std::string> quote(const std::vector<T> &values) {
+template <typename Container>
+[[nodiscard]] inline std::vector<std::string> quote(const Container &values) {
     std::vector<std::string> quoted{};
     quoted.reserve(values.size());
 
     // quote all values
-    for (const T &val : values) {
+    for (const auto &val : values) {
         quoted.push_back(fmt::format("\"{}\"", val));
     }
 
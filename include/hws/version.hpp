@@ -0,0 +1,51 @@
+/**
+ * @file
+ * @author Marcel Breyer
+ * @copyright 2024-today All Rights Reserved
+ * @license This file is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Version information for the hardware sampling.
+ */
+
+#ifndef HWS_VERSION_HPP_
+#define HWS_VERSION_HPP_
+#pragma once
+
+#include <string_view>  // std::string_view
+
+namespace hws::version {
+
+/**
+ * @brief The name of the library.
+ * @details The value gets automatically set during the [`CMake`](https://cmake.org/) configuration step.
+ */
+constexpr std::string_view name = "hws - Hardware Sampling for GPUs and CPUs";
+
+/**
+ * @brief The current version of the library in the form: "major.minor.patch".
+ * @details The value gets automatically set during the [`CMake`](https://cmake.org/) configuration step.
+ */
+constexpr std::string_view version = "1.0.1";
+
+/**
+ * @brief The current major version of the library.
+ * @details The value gets automatically set during the [`CMake`](https://cmake.org/) configuration step.
+ */
+constexpr int major = 1;
+
+/**
+ * @brief The current minor version of the library.
+ * @details The value gets automatically set during the [`CMake`](https://cmake.org/) configuration step.
+ */
+constexpr int minor = 0;
+
+/**
+ * @brief The current patch version of the library.
+ * @details The value gets automatically set during the [`CMake`](https://cmake.org/) configuration step.
+ */
+constexpr int patch = 1;
+
+}  // namespace hws::version
+
+#endif  // HWS_VERSION_HPP_
@@ -0,0 +1,39 @@
+/**
+ * @author Marcel Breyer
+ * @copyright 2024-today All Rights Reserved
+ * @license This file is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ */
+
+#include "hws/burst_capture.hpp"
+
+#include "fmt/chrono.h"  // direct formatting of std::chrono types
+#include "fmt/format.h"  // fmt::format
+#include "fmt/ranges.h"  // fmt::join
+
+#include <chrono>   // std::chrono::{nanoseconds, duration_cast}
+#include <ostream>  // std::ostream
+
+namespace hws {
+
+std::chrono::nanoseconds burst_capture::duration() const noexcept {
+    if (time_points.size() < 2) {
+        return std::chrono::nanoseconds{ 0 };
+    }
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(time_points.back() - time_points.front());
+}
+
+std::ostream &operator<<(std::ostream &out, const burst_capture &capture) {
+    out << fmt::format("trigger: {}\n"
+                       "num_time_points: {}\n"
+                       "duration: {}",
+                       capture.trigger,
+                       capture.time_points.size(),
+                       capture.duration());
+    for (const auto &[name, values] : capture.samples) {
+        out << fmt::format("\n{}: [{}]", name, fmt::join(values, ", "));
+    }
+    return out;
+}
+
+}  // namespace hws
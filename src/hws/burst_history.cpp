@@ -0,0 +1,47 @@
+/**
+ * @author Marcel Breyer
+ * @copyright 2024-today All Rights Reserved
+ * @license This file is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ */
+
+#include "hws/burst_history.hpp"
+
+#include <algorithm>  // std::copy
+#include <chrono>     // std::chrono::steady_clock::time_point
+#include <cstddef>    // std::size_t, std::ptrdiff_t
+#include <vector>     // std::vector
+
+namespace hws::detail {
+
+burst_history::burst_history(const std::size_t capacity, const std::size_t num_values) :
+    time_points_(capacity),
+    values_(capacity * num_values),
+    num_values_{ num_values } { }
+
+void burst_history::push_back(const std::chrono::steady_clock::time_point time_point, const std::vector<double> &values) noexcept {
+    if (this->capacity() == 0) {
+        return;
+    }
+    time_points_[next_] = time_point;
+    std::copy(values.cbegin(), values.cbegin() + static_cast<std::ptrdiff_t>(num_values_), values_.begin() + static_cast<std::ptrdiff_t>(next_ * num_values_));
+    next_ = (next_ + 1) % this->capacity();
+    size_ = size_ < this->capacity() ? size_ + 1 : size_;
+}
+
+void burst_history::append_since(const std::chrono::steady_clock::time_point since, std::vector<std::chrono::steady_clock::time_point> &time_points, std::vector<std::vector<double>> &series) const {
+    // the oldest retained tick lies size_ positions before the next tick to write
+    const std::size_t first = (next_ + this->capacity() - size_) % (this->capacity() == 0 ? 1 : this->capacity());
+    for (std::size_t i = 0; i < size_; ++i) {
+        const std::size_t pos = (first + i) % this->capacity();
+        if (time_points_[pos] < since) {
+            continue;
+        }
+        time_points.push_back(time_points_[pos]);
+        for (std::size_t value = 0; value < num_values_; ++value) {
+            series[value].push_back(values_[pos * num_values_ + value]);
+        }
+    }
+}
+
+}  // namespace hws::detail
@@ -0,0 +1,116 @@
+/**
+ * @author Marcel Breyer
+ * @copyright 2024-today All Rights Reserved
+ * @license This file is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ */
+
+#include "hws/cpu/cpufreq_reader.hpp"
+
+#include "hws/utility.hpp"  // hws::detail::starts_with
+
+#include "fmt/format.h"  // fmt::format
+
+#include <algorithm>     // std::sort, std::all_of
+#include <array>         // std::array
+#include <cctype>        // std::isdigit
+#include <cerrno>        // errno, EINTR
+#include <charconv>      // std::from_chars
+#include <cstddef>       // std::size_t
+#include <cstring>       // std::strerror
+#include <fcntl.h>       // ::open, O_RDONLY, O_CLOEXEC
+#include <filesystem>    // std::filesystem::{path, directory_iterator}
+#include <stdexcept>     // std::runtime_error
+#include <string>        // std::string
+#include <system_error>  // std::error_code, std::errc
+#include <unistd.h>      // ::pread, ::close, ssize_t
+#include <utility>       // std::move, std::pair
+#include <vector>        // std::vector
+
+namespace hws::detail {
+
+cpufreq_reader::cpufreq_reader(const std::filesystem::path &cpu_root) {
+    // collect the logical CPUs, i.e., the "cpu<N>" directories having a cpufreq policy
+    std::vector<std::pair<std::size_t, std::filesystem::path>> cpus{};
+    std::error_code ec{};
+    for (const std::filesystem::directory_entry &entry : std::filesystem::directory_iterator{ cpu_root, ec }) {
+        const std::string name = entry.path().filename().string();
+        if (!detail::starts_with(name, "cpu") || name.size() == 3 || !std::all_of(name.cbegin() + 3, name.cend(), [](const unsigned char c) { return std::isdigit(c); })) {
+            continue;
+        }
+        const std::filesystem::path freq_path = entry.path() / "cpufreq" / "scaling_cur_freq";
+        if (std::filesystem::exists(freq_path, ec)) {
+            std::size_t id{};
+            std::from_chars(name.data() + 3, name.data() + name.size(), id);
+            cpus.emplace_back(id, freq_path);
+        }
+    }
+    if (cpus.empty()) {
+        throw std::runtime_error{ fmt::format("Couldn't find any logical CPU with a cpufreq policy in \"{}\"!", cpu_root.string()) };
+    }
+    std::sort(cpus.begin(), cpus.end());
+
+    for (const auto &[id, freq_path] : cpus) {
+        const int fd = ::open(freq_path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) {
+            const std::string error = std::strerror(errno);
+            this->close_all();
+            throw std::runtime_error{ fmt::format("Couldn't open \"{}\": {}", freq_path.string(), error) };
+        }
+        cpu_ids_.push_back(id);
+        fds_.push_back(fd);
+    }
+    frequencies_.resize(fds_.size());
+}
+
+cpufreq_reader::cpufreq_reader(cpufreq_reader &&other) noexcept :
+    cpu_ids_{ std::move(other.cpu_ids_) },
+    fds_{ std::move(other.fds_) },
+    frequencies_{ std::move(other.frequencies_) } {
+    other.fds_.clear();
+}
+
+cpufreq_reader &cpufreq_reader::operator=(cpufreq_reader &&other) noexcept {
+    if (this != &other) {
+        this->close_all();
+        cpu_ids_ = std::move(other.cpu_ids_);
+        fds_ = std::move(other.fds_);
+        frequencies_ = std::move(other.frequencies_);
+        other.fds_.clear();
+    }
+    return *this;
+}
+
+cpufreq_reader::~cpufreq_reader() {
+    this->close_all();
+}
+
+const std::vector<unsigned long long> &cpufreq_reader::read() noexcept {
+    std::array<char, 32> buffer{};
+    for (std::size_t i = 0; i < fds_.size(); ++i) {
+        // sysfs attributes are regenerated on each read starting at offset zero -> no need to seek or reopen the files
+        ssize_t num_bytes = 0;
+        do {
+            num_bytes = ::pread(fds_[i], buffer.data(), buffer.size(), 0);
+        } while (num_bytes < 0 && errno == EINTR);
+
+        unsigned long long frequency{ 0 };
+        if (num_bytes > 0) {
+            const auto [ptr, errc] = std::from_chars(buffer.data(), buffer.data() + num_bytes, frequency);
+            if (errc != std::errc{}) {
+                frequency = 0;
+            }
+        }
+        frequencies_[i] = frequency;
+    }
+    return frequencies_;
+}
+
+void cpufreq_reader::close_all() noexcept {
+    for (const int fd : fds_) {
+        ::close(fd);
+    }
+    fds_.clear();
+}
+
+}  // namespace hws::detail
@@ -7,38 +7,163 @@
 
 #include "hws/cpu/hardware_sampler.hpp"
 
-#include "hws/cpu/cpu_samples.hpp"   // hws::{cpu_general_samples, clock_samples, power_samples, memory_samples, temperature_samples, gfx_samples, idle_state_samples}
-#include "hws/cpu/utility.hpp"       // HWS_SUBPROCESS_ERROR_CHECK, hws::detail::run_subprocess
-#include "hws/hardware_sampler.hpp"  // hws::tracking::hardware_sampler
-#include "hws/sample_category.hpp"   // hws::sample_category
-#include "hws/utility.hpp"           // hws::detail::{split, split_as, trim, convert_to, starts_with}
+#include "hws/cpu/cpu_samples.hpp"        // hws::{cpu_general_samples, clock_samples, power_samples, memory_samples, temperature_samples, gfx_samples, idle_state_samples}
+#include "hws/cpu/cpufreq_reader.hpp"     // hws::detail::cpufreq_reader
+#include "hws/cpu/meminfo_reader.hpp"     // hws::detail::{meminfo, meminfo_reader}
+#include "hws/cpu/proc_stat_reader.hpp"   // hws::detail::{proc_stat_reader, cpu_utilization}
+#include "hws/cpu/rapl_reader.hpp"        // hws::detail::{rapl_reader, rapl_energy, rapl_domain_type}
+#include "hws/cpu/turbostat_columns.hpp"  // hws::detail::turbostat_column_table
+#include "hws/cpu/turbostat_session.hpp"  // hws::detail::turbostat_session
+#include "hws/cpu/utility.hpp"            // HWS_SUBPROCESS_ERROR_CHECK, hws::detail::run_subprocess
+#include "hws/hardware_sampler.hpp"       // hws::tracking::hardware_sampler
+#include "hws/sample_category.hpp"        // hws::sample_category
+#include "hws/sample_column.hpp"          // hws::sample_column_config
+#include "hws/sample_matrix.hpp"          // hws::sample_matrix
+#include "hws/sample_metric.hpp"          // hws::detail::{for_each_sample_metric, append_numeric_sample_names, append_latest_numeric_sample_values}
+#include "hws/utility.hpp"                // hws::detail::{split, split_as, trim, convert_to, starts_with}
 
 #include "fmt/chrono.h"  // direct formatting of std::chrono types
 #include "fmt/format.h"  // fmt::format
 #include "fmt/ranges.h"  // fmt::join
 
-#include <cassert>        // assert
-#include <chrono>         // std::chrono::{steady_clock, milliseconds}
-#include <cstddef>        // std::size_t
-#include <exception>      // std::exception, std::terminate
-#include <ios>            // std::ios_base
-#include <iostream>       // std::cerr, std::endl
-#include <optional>       // std::make_optional
-#include <ostream>        // std::ostream
-#include <regex>          // std::regex, std::regex::extended, std::regex_match, std::regex_replace
-#include <stdexcept>      // std::runtime_error
-#include <string>         // std::string
-#include <string_view>    // std::string_view
-#include <thread>         // std::this_thread
-#include <unordered_map>  // std::unordered_map
-#include <vector>         // std::vector
+#include <algorithm>    // std::min
+#include <chrono>       // std::chrono::{steady_clock, nanoseconds}
+#include <cstddef>      // std::size_t
+#include <exception>    // std::exception, std::terminate
+#include <filesystem>   // std::filesystem::path
+#include <ios>          // std::ios_base
+#include <iostream>     // std::cerr, std::endl
+#include <mutex>        // std::lock_guard
+#include <optional>     // std::optional, std::make_optional, std::nullopt
+#include <ostream>      // std::ostream
+#include <stdexcept>    // std::runtime_error
+#include <string>       // std::string
+#include <string_view>  // std::string_view
+#include <thread>       // std::this_thread::sleep_for
+#include <utility>      // std::move
+#include <vector>       // std::vector
 
 namespace hws {
 
+namespace {
+
+#if defined(HWS_VIA_POWERCAP_ENABLED)
+/**
+ * @brief Return the mean power draw given the energy @p joule consumed in @p seconds.
+ * @param[in] joule the consumed energy in J
+ * @param[in] seconds the elapsed time in s
+ * @return the mean power draw in W (`[[nodiscard]]`)
+ */
+[[nodiscard]] double mean_power(const double joule, const double seconds) noexcept {
+    return seconds > 0.0 ? joule / seconds : 0.0;
+}
+#endif
+
+#if defined(HWS_VIA_PROC_STAT_ENABLED) || defined(HWS_VIA_CPUFREQ_ENABLED)
+/**
+ * @brief Append the values of all logical CPUs as the next time point to the @p matrix (if present).
+ * @tparam T the type of the hardware sample
+ * @tparam Value the type of the read values
+ * @tparam Projection the type of the projection
+ * @param[in,out] matrix the per logical CPU hardware sample
+ * @param[in] values the read values in the order of the matrix rows
+ * @param[in] proj converts a read value to the hardware sample's type
+ */
+template <typename T, typename Value, typename Projection>
+void push_back_time_point(std::optional<sample_matrix<T>> &matrix, const std::vector<Value> &values, const Projection &proj) {
+    if (matrix.has_value()) {
+        for (const Value &value : values) {
+            matrix->push_back(proj(value));
+        }
+    }
+}
+#endif
+
+#if defined(HWS_VIA_TURBOSTAT_ENABLED)
+/**
+ * @brief Check whether any hardware sample of the @p samples retrieved in the sampling loop is still read via turbostat.
+ * @details Only hardware samples with a turbostat column name are considered, i.e., derived hardware samples (calculated from other hardware samples)
+ *          and hardware samples read from sysfs or procfs are ignored.
+ * @tparam Samples the sample class, e.g., hws::cpu_power_samples
+ * @tparam Predicate the type of the predicate
+ * @param[in] samples the sample class instance
+ * @param[in] read_elsewhere returns `true` if the hardware sample of the given turbostat column isn't read via turbostat
+ * @return `true` if any hardware sample is read via turbostat, otherwise `false` (`[[nodiscard]]`)
+ */
+template <typename Samples, typename Predicate>
+[[nodiscard]] bool any_sample_via_turbostat(const Samples &samples, const Predicate &read_elsewhere) {
+    bool any_sample = false;
+    detail::for_each_sample_metric<Samples>([&](const auto &metric) {
+        if constexpr (detail::remove_cvref_t<decltype(metric)>::is_sampled) {
+            any_sample = any_sample || (!metric.turbostat_name.empty() && metric.get(samples).has_value() && !read_elsewhere(metric.turbostat_name));
+        }
+    });
+    return any_sample;
+}
+
+/**
+ * @brief Check whether any hardware sample of the sample class @p Samples may be read via turbostat before turbostat has been run once.
+ * @details Only the hardware sample descriptors are considered: a hardware sample may be read via turbostat if it has a turbostat column name,
+ *          isn't read elsewhere, and is selected itself or a selected hardware sample is derived from it.
+ * @tparam Samples the sample class, e.g., hws::cpu_power_samples
+ * @tparam Selected the type of the selection predicate
+ * @tparam Predicate the type of the predicate
+ * @param[in] selected returns `true` if the hardware sample with the given name is selected
+ * @param[in] read_elsewhere returns `true` if the hardware sample of the given turbostat column isn't read via turbostat
+ * @return `true` if any hardware sample may be read via turbostat, otherwise `false` (`[[nodiscard]]`)
+ */
+template <typename Samples, typename Selected, typename Predicate>
+[[nodiscard]] bool any_metric_via_turbostat(const Selected &selected, const Predicate &read_elsewhere) {
+    bool any_metric = false;
+    detail::for_each_sample_metric<Samples>([&](const auto &metric) {
+        if (metric.turbostat_name.empty() || read_elsewhere(metric.turbostat_name)) {
+            return;
+        }
+        bool metric_selected = selected(metric.name);
+        detail::for_each_sample_metric<Samples>([&](const auto &other) {
+            metric_selected = metric_selected || (other.source_name == metric.name && selected(other.name));
+        });
+        any_metric = any_metric || metric_selected;
+    });
+    return any_metric;
+}
+
+// -n, --num_iterations     number of the measurement iterations
+// -i, --interval           sampling interval in seconds (decimal number)
+// -S, --Summary            limits output to 1-line per interval
+// -q, --quiet              skip decoding system configuration header
+    #if defined(HWS_VIA_TURBOSTAT_ROOT)
+/// The turbostat command line of the initial invocation (run with sudo).
+constexpr std::string_view turbostat_command_line = "sudo turbostat -n 1 -i 0.001 -S -q";
+    #else
+/// The turbostat command line of the initial invocation (run without sudo).
+constexpr std::string_view turbostat_command_line = "turbostat -n 1 -i 0.001 -S -q";
+    #endif
+
+/// The sample categories retrieved via turbostat.
+constexpr sample_category turbostat_sample_categories = sample_category::all & ~sample_category::memory;
+
+/**
+ * @brief Assemble the command line of the long-lived turbostat session printing one row per @p interval.
+ * @param[in] interval the measurement interval
+ * @return the command line arguments (`[[nodiscard]]`)
+ */
+[[nodiscard]] std::vector<std::string> turbostat_session_command_line(const std::chrono::nanoseconds interval) {
+    std::vector<std::string> cmd_line{};
+    #if defined(HWS_VIA_TURBOSTAT_ROOT)
+    cmd_line.emplace_back("sudo");
+    #endif
+    cmd_line.insert(cmd_line.end(), { "turbostat", "-i", fmt::format("{:.6f}", std::chrono::duration<double>(interval).count()), "-S", "-q" });
+    return cmd_line;
+}
+#endif
+
+}  // namespace
+
 cpu_hardware_sampler::cpu_hardware_sampler(const sample_category category) :
     cpu_hardware_sampler{ HWS_SAMPLING_INTERVAL, category } { }
 
-cpu_hardware_sampler::cpu_hardware_sampler(const std::chrono::milliseconds sampling_interval, const sample_category category) :
+cpu_hardware_sampler::cpu_hardware_sampler(const std::chrono::nanoseconds sampling_interval, const sample_category category) :
     hardware_sampler{ sampling_interval, category } { }
 
 cpu_hardware_sampler::~cpu_hardware_sampler() {
@@ -53,13 +178,11 @@ cpu_hardware_sampler::~cpu_hardware_sampler() {
     }
 }
 
-void cpu_hardware_sampler::sampling_loop() {
+void cpu_hardware_sampler::initialize_samples() {
     //
     // add samples where we only have to retrieve the value once
     //
 
-    this->add_time_point(std::chrono::steady_clock::now());
-
 #if defined(HWS_VIA_LSCPU_ENABLED)
     {
         const std::string lscpu_output = detail::run_subprocess("lscpu");
@@ -127,513 +250,481 @@ void cpu_hardware_sampler::sampling_loop() {
     }
 #endif
 
-#if defined(HWS_VIA_FREE_ENABLED)
-    const std::regex whitespace_replace_reg{ "[ ]+", std::regex::extended };
+#if defined(HWS_VIA_PROC_MEMINFO_ENABLED)
     if (this->sample_category_enabled(sample_category::memory)) {
-        std::string free_output = detail::run_subprocess("free -b");
-        free_output = std::regex_replace(free_output, whitespace_replace_reg, " ");
-        const std::vector<std::string_view> free_lines = detail::split(detail::trim(free_output), '\n');
-        assert((free_lines.size() >= 3) && "Must read more than three lines, but fewer were read!");
+        // open /proc/meminfo once -> the file stays open for the whole sampling
+        meminfo_reader_.emplace();
+        const detail::meminfo info = meminfo_reader_->read();
 
         // read memory information
-        const std::vector<std::string_view> memory_data = detail::split(free_lines[1], ' ');
-        memory_samples_.memory_total_ = detail::convert_to<decltype(memory_samples_.memory_total_)::value_type>(memory_data[1]);
-        memory_samples_.memory_used_ = decltype(memory_samples_.memory_used_)::value_type{ detail::convert_to<decltype(memory_samples_.memory_used_)::value_type::value_type>(memory_data[2]) };
-        memory_samples_.memory_free_ = decltype(memory_samples_.memory_free_)::value_type{ detail::convert_to<decltype(memory_samples_.memory_free_)::value_type::value_type>(memory_data[3]) };
+        using vector_type = decltype(memory_samples_.memory_used_)::value_type;
+        memory_samples_.memory_total_ = info.mem_total;
+        memory_samples_.memory_used_ = vector_type{ this->column_config(), { info.mem_used() } };
+        memory_samples_.memory_free_ = vector_type{ this->column_config(), { info.mem_free } };
+        memory_samples_.memory_cached_ = vector_type{ this->column_config(), { info.cached } };
+        memory_samples_.memory_buffers_ = vector_type{ this->column_config(), { info.buffers } };
+        memory_samples_.memory_dirty_ = vector_type{ this->column_config(), { info.dirty } };
+        memory_samples_.memory_anon_pages_ = vector_type{ this->column_config(), { info.anon_pages } };
 
         // read swap information
-        const std::vector<std::string_view> swap_data = detail::split(free_lines[2], ' ');
-        memory_samples_.swap_memory_total_ = detail::convert_to<decltype(memory_samples_.swap_memory_total_)::value_type>(swap_data[1]);
-        memory_samples_.swap_memory_used_ = decltype(memory_samples_.swap_memory_used_)::value_type{ detail::convert_to<decltype(memory_samples_.swap_memory_used_)::value_type::value_type>(swap_data[2]) };
-        memory_samples_.swap_memory_free_ = decltype(memory_samples_.swap_memory_free_)::value_type{ detail::convert_to<decltype(memory_samples_.swap_memory_free_)::value_type::value_type>(swap_data[3]) };
+        memory_samples_.swap_memory_total_ = info.swap_total;
+        memory_samples_.swap_memory_used_ = vector_type{ this->column_config(), { info.swap_used() } };
+        memory_samples_.swap_memory_free_ = vector_type{ this->column_config(), { info.swap_free } };
     }
 #endif
 
-#if defined(HWS_VIA_TURBOSTAT_ENABLED)
+#if defined(HWS_VIA_PROC_STAT_ENABLED)
+    if (this->sample_category_enabled(sample_category::general)) {
+        try {
+            // open /proc/stat once -> the file stays open for the whole sampling
+            proc_stat_reader_.emplace();
+        } catch (const std::runtime_error &) {
+            proc_stat_reader_.reset();
+        }
+    }
+    if (proc_stat_reader_.has_value()) {
+        // one matrix row per online logical CPU; the first time point is the utilization since booting
+        for (std::optional<sample_matrix<double>> *matrix : { &general_samples_.per_cpu_user_percent_, &general_samples_.per_cpu_system_percent_, &general_samples_.per_cpu_iowait_percent_, &general_samples_.per_cpu_steal_percent_, &general_samples_.per_cpu_idle_percent_ }) {
+            matrix->emplace(this->column_config(), proc_stat_reader_->cpu_ids());
+        }
+        this->push_back_per_cpu_utilization();
+    }
+#endif
 
-    // -n, --num_iterations     number of the measurement iterations
-    // -i, --interval           sampling interval in seconds (decimal number)
-    // -S, --Summary            limits output to 1-line per interval
-    // -q, --quiet              skip decoding system configuration header
+#if defined(HWS_VIA_CPUFREQ_ENABLED)
+    if (this->sample_category_enabled(sample_category::clock)) {
+        try {
+            // open the scaling_cur_freq files once -> the files stay open for the whole sampling
+            cpufreq_reader_.emplace();
+        } catch (const std::runtime_error &) {
+            // e.g., virtual machines without cpufreq driver
+            cpufreq_reader_.reset();
+        }
+    }
+    if (cpufreq_reader_.has_value()) {
+        // the logical CPUs with a cpufreq driver may differ from the ones in /proc/stat
+        clock_samples_.per_cpu_clock_frequency_.emplace(this->column_config(), cpufreq_reader_->cpu_ids());
+        this->push_back_per_cpu_clock_frequency();
+    }
+#endif
 
-    // get header information
-    #if defined(HWS_VIA_TURBOSTAT_ROOT)
-    // run with sudo
-    const std::string_view turbostat_command_line = "sudo turbostat -n 1 -i 0.001 -S -q";
-    #else
-    // run without sudo
-    const std::string_view turbostat_command_line = "turbostat -n 1 -i 0.001 -S -q";
-    #endif
+#if defined(HWS_VIA_POWERCAP_ENABLED)
+    if (this->sample_category_enabled(sample_category::power | sample_category::gfx)) {
+        try {
+            rapl_reader_.emplace(powercap_root_);
+        } catch (const std::runtime_error &) {
+            // the RAPL energy counters aren't readable (e.g., missing root privileges) -> fall back to turbostat
+            rapl_reader_.reset();
+        }
+    }
+    if (rapl_reader_.has_value()) {
+        // the initial power draw is averaged over a short period of time (as with turbostat's "-i 0.001")
+        const detail::rapl_energy begin = rapl_reader_->read();
+        std::this_thread::sleep_for(std::chrono::milliseconds{ 1 });
+        const detail::rapl_energy end = rapl_reader_->read();
+        const double seconds = std::chrono::duration<double>(end.time_point - begin.time_point).count();
+
+        if (this->sample_category_enabled(sample_category::power)) {
+            using vector_type = decltype(power_samples_.power_usage_)::value_type;
+            power_samples_.power_usage_ = vector_type{ this->column_config(), { mean_power(end.package - begin.package, seconds) } };
+            power_samples_.power_measurement_type_ = "current/instant";
+            power_samples_.power_total_energy_consumption_ = decltype(power_samples_.power_total_energy_consumption_)::value_type{ this->column_config(), { 0 } };
+            if (rapl_reader_->has_domain(detail::rapl_domain_type::core)) {
+                power_samples_.core_watt_ = decltype(power_samples_.core_watt_)::value_type{ this->column_config(), { mean_power(end.core - begin.core, seconds) } };
+            }
+            if (rapl_reader_->has_domain(detail::rapl_domain_type::dram)) {
+                power_samples_.ram_watt_ = decltype(power_samples_.ram_watt_)::value_type{ this->column_config(), { mean_power(end.dram - begin.dram, seconds) } };
+            }
+        }
+        if (this->sample_category_enabled(sample_category::gfx) && rapl_reader_->has_domain(detail::rapl_domain_type::uncore)) {
+            gfx_samples_.gfx_watt_ = decltype(gfx_samples_.gfx_watt_)::value_type{ this->column_config(), { mean_power(end.uncore - begin.uncore, seconds) } };
+        }
+        rapl_last_power_energy_ = end;
+        rapl_last_gfx_energy_ = end;
+    }
+#endif
 
+#if defined(HWS_VIA_TURBOSTAT_ENABLED)
+    // don't start turbostat at all if none of its hardware samples can be selected
+    // the power samples may be read from the RAPL energy counters and the per logical CPU samples from procfs and sysfs instead
     {
-        // run turbostat
-        const std::string turbostat_output = detail::run_subprocess(turbostat_command_line);
-
+        const auto selected = [this](const std::string_view name) { return this->sample_metric_selected(name); };
+        const auto read_elsewhere = [this](const std::string_view turbostat_name) { return this->read_via_powercap(turbostat_name); };
+        turbostat_samples_selected_ = false;
+        turbostat_samples_selected_ |= this->sample_category_enabled(sample_category::general) && any_metric_via_turbostat<cpu_general_samples>(selected, read_elsewhere);
+        turbostat_samples_selected_ |= this->sample_category_enabled(sample_category::clock) && any_metric_via_turbostat<cpu_clock_samples>(selected, read_elsewhere);
+        turbostat_samples_selected_ |= this->sample_category_enabled(sample_category::power) && any_metric_via_turbostat<cpu_power_samples>(selected, read_elsewhere);
+        turbostat_samples_selected_ |= this->sample_category_enabled(sample_category::temperature) && any_metric_via_turbostat<cpu_temperature_samples>(selected, read_elsewhere);
+        turbostat_samples_selected_ |= this->sample_category_enabled(sample_category::gfx) && any_metric_via_turbostat<cpu_gfx_samples>(selected, read_elsewhere);
+        turbostat_samples_selected_ |= this->sample_category_enabled(sample_category::idle_state) && any_metric_via_turbostat<cpu_idle_states_samples>(selected, read_elsewhere);
+    }
+    // run turbostat once -> its output is also used until the turbostat session has printed its first row
+    const std::string turbostat_output = turbostat_samples_selected_ ? detail::run_subprocess(turbostat_command_line) : std::string{};
+    if (turbostat_samples_selected_) {
         // retrieve the turbostat data
         const std::vector<std::string_view> data = detail::split(detail::trim(turbostat_output), '\n');
-        assert((data.size() >= 2) && "Must read at least two lines!");
-        const std::vector<std::string_view> header = detail::split(data[0], '\t');
-        const std::vector<std::string_view> values = detail::split(data[1], '\t');
-
-        for (std::size_t i = 0; i < header.size(); ++i) {
-            // general samples
-            if (header[i] == "Busy%") {
-                if (this->sample_category_enabled(sample_category::general)) {
-                    using vector_type = decltype(general_samples_.compute_utilization_)::value_type;
-                    general_samples_.compute_utilization_ = vector_type{ detail::convert_to<typename vector_type::value_type>(values[i]) };
-                }
-                continue;
-            } else if (header[i] == "IPC") {
-                if (this->sample_category_enabled(sample_category::general)) {
-                    using vector_type = decltype(general_samples_.ipc_)::value_type;
-                    general_samples_.ipc_ = vector_type{ detail::convert_to<typename vector_type::value_type>(values[i]) };
-                }
-                continue;
-            } else if (header[i] == "IRQ") {
-                if (this->sample_category_enabled(sample_category::general)) {
-                    using vector_type = decltype(general_samples_.irq_)::value_type;
-                    general_samples_.irq_ = vector_type{ detail::convert_to<typename vector_type::value_type>(values[i]) };
-                }
-                continue;
-            } else if (header[i] == "SMI") {
-                if (this->sample_category_enabled(sample_category::general)) {
-                    using vector_type = decltype(general_samples_.smi_)::value_type;
-                    general_samples_.smi_ = vector_type{ detail::convert_to<typename vector_type::value_type>(values[i]) };
-                }
-            } else if (header[i] == "POLL") {
-                if (this->sample_category_enabled(sample_category::general)) {
-                    using vector_type = decltype(general_samples_.poll_)::value_type;
-                    general_samples_.poll_ = vector_type{ detail::convert_to<typename vector_type::value_type>(values[i]) };
-                }
-                continue;
-            } else if (header[i] == "POLL%") {
-                if (this->sample_category_enabled(sample_category::general)) {
-                    using vector_type = decltype(general_samples_.poll_percent_)::value_type;
-                    general_samples_.poll_percent_ = vector_type{ detail::convert_to<typename vector_type::value_type>(values[i]) };
-                }
-                continue;
-            }
+        if (data.size() < 2) {
+            throw std::runtime_error{ fmt::format("The turbostat output must contain at least a header and a row, but got {} line(s)!", data.size()) };
+        }
 
-            // clock related samples
-            if (header[i] == "Avg_MHz") {
-                if (this->sample_category_enabled(sample_category::clock)) {
-                    using vector_type = decltype(clock_samples_.clock_frequency_)::value_type;
-                    clock_samples_.clock_frequency_ = vector_type{ detail::convert_to<typename vector_type::value_type>(values[i]) };
-                }
-                continue;
-            } else if (header[i] == "Bzy_MHz") {
-                if (this->sample_category_enabled(sample_category::clock)) {
-                    using vector_type = decltype(clock_samples_.average_non_idle_clock_frequency_)::value_type;
-                    clock_samples_.average_non_idle_clock_frequency_ = vector_type{ detail::convert_to<typename vector_type::value_type>(values[i]) };
-                }
-                continue;
-            } else if (header[i] == "TSC_MHz") {
-                if (this->sample_category_enabled(sample_category::clock)) {
-                    using vector_type = decltype(clock_samples_.time_stamp_counter_)::value_type;
-                    clock_samples_.time_stamp_counter_ = vector_type{ detail::convert_to<typename vector_type::value_type>(values[i]) };
-                }
-                continue;
-            }
+        // match the header once and create the hardware samples of the enabled sample categories
+        detail::turbostat_column_table columns{ detail::split_as<std::string>(data[0], '\t') };
+        this->add_turbostat_columns(columns, true);
+        columns.read_row(data[1], sample_category::all);
 
-            // power related samples
-            if (header[i] == "PkgWatt") {
-                if (this->sample_category_enabled(sample_category::power)) {
-                    using vector_type = decltype(power_samples_.power_usage_)::value_type;
-                    power_samples_.power_usage_ = vector_type{ detail::convert_to<typename vector_type::value_type>(values[i]) };
-                    power_samples_.power_measurement_type_ = "current/instant";
-                    power_samples_.power_total_energy_consumption_ = decltype(power_samples_.power_total_energy_consumption_)::value_type{ 0 };
-                }
-                continue;
-            } else if (header[i] == "CorWatt") {
-                if (this->sample_category_enabled(sample_category::power)) {
-                    using vector_type = decltype(power_samples_.core_watt_)::value_type;
-                    power_samples_.core_watt_ = vector_type{ detail::convert_to<typename vector_type::value_type>(values[i]) };
-                }
-                continue;
-            } else if (header[i] == "RAMWatt") {
-                if (this->sample_category_enabled(sample_category::power)) {
-                    using vector_type = decltype(power_samples_.ram_watt_)::value_type;
-                    power_samples_.ram_watt_ = vector_type{ detail::convert_to<typename vector_type::value_type>(values[i]) };
-                }
-                continue;
-            } else if (header[i] == "PKG_%") {
-                if (this->sample_category_enabled(sample_category::power)) {
-                    using vector_type = decltype(power_samples_.package_rapl_throttle_percent_)::value_type;
-                    power_samples_.package_rapl_throttle_percent_ = vector_type{ detail::convert_to<typename vector_type::value_type>(values[i]) };
-                }
-                continue;
-            } else if (header[i] == "RAM_%") {
-                if (this->sample_category_enabled(sample_category::power)) {
-                    using vector_type = decltype(power_samples_.dram_rapl_throttle_percent_)::value_type;
-                    power_samples_.dram_rapl_throttle_percent_ = vector_type{ detail::convert_to<typename vector_type::value_type>(values[i]) };
-                }
-                continue;
-            }
+        // the total energy consumption is integrated from the power draw
+        if (power_samples_.power_usage_.has_value() && !this->read_via_powercap("PkgWatt")) {
+            power_samples_.power_measurement_type_ = "current/instant";
+            power_samples_.power_total_energy_consumption_ = decltype(power_samples_.power_total_energy_consumption_)::value_type{ this->column_config(), { 0 } };
+        }
+    }
+#endif
 
-            // temperature related samples
-            if (header[i] == "CoreTmp") {
-                if (this->sample_category_enabled(sample_category::temperature)) {
-                    using vector_type = decltype(temperature_samples_.core_temperature_)::value_type;
-                    temperature_samples_.core_temperature_ = vector_type{ detail::convert_to<typename vector_type::value_type>(values[i]) };
-                }
-                continue;
-            } else if (header[i] == "CoreThr") {
-                if (this->sample_category_enabled(sample_category::temperature)) {
-                    using vector_type = decltype(temperature_samples_.core_throttle_percent_)::value_type;
-                    temperature_samples_.core_throttle_percent_ = vector_type{ detail::convert_to<typename vector_type::value_type>(values[i]) };
-                }
-                continue;
-            } else if (header[i] == "PkgTmp") {
-                if (this->sample_category_enabled(sample_category::temperature)) {
-                    using vector_type = decltype(temperature_samples_.temperature_)::value_type;
-                    temperature_samples_.temperature_ = vector_type{ detail::convert_to<typename vector_type::value_type>(values[i]) };
-                }
-                continue;
-            }
+    // drop the queried samples that haven't been selected -> their subprocesses are skipped in the sampling loop if none of their samples is selected
+    if (this->uses_sample_metric_selection()) {
+#if defined(HWS_VIA_PROC_MEMINFO_ENABLED)
+        // close /proc/meminfo if none of its hardware samples is selected
+        if (!this->apply_sample_metric_selection(memory_samples_)) {
+            meminfo_reader_.reset();
+        }
+#endif
+        const bool general_selected = this->apply_sample_metric_selection(general_samples_);
+        const bool clock_selected = this->apply_sample_metric_selection(clock_samples_);
+#if defined(HWS_VIA_PROC_STAT_ENABLED)
+        // close /proc/stat if none of the per logical CPU utilization samples is selected
+        if (!general_samples_.per_cpu_user_percent_.has_value() && !general_samples_.per_cpu_system_percent_.has_value() && !general_samples_.per_cpu_iowait_percent_.has_value()
+            && !general_samples_.per_cpu_steal_percent_.has_value() && !general_samples_.per_cpu_idle_percent_.has_value()) {
+            proc_stat_reader_.reset();
+        }
+#endif
+#if defined(HWS_VIA_CPUFREQ_ENABLED)
+        // close the scaling_cur_freq files if the per logical CPU frequencies aren't selected
+        if (!clock_samples_.per_cpu_clock_frequency_.has_value()) {
+            cpufreq_reader_.reset();
+        }
+#endif
+#if defined(HWS_VIA_TURBOSTAT_ENABLED)
+        // skip the turbostat session if none of its hardware samples is present after the initial run
+        const auto read_elsewhere = [this](const std::string_view turbostat_name) { return this->read_via_powercap(turbostat_name); };
+        bool any_turbostat_sample = false;
+        any_turbostat_sample |= general_selected && any_sample_via_turbostat(general_samples_, read_elsewhere);
+        any_turbostat_sample |= clock_selected && any_sample_via_turbostat(clock_samples_, read_elsewhere);
+        any_turbostat_sample |= this->apply_sample_metric_selection(power_samples_) && any_sample_via_turbostat(power_samples_, read_elsewhere);
+        any_turbostat_sample |= this->apply_sample_metric_selection(temperature_samples_);
+        any_turbostat_sample |= this->apply_sample_metric_selection(gfx_samples_) && any_sample_via_turbostat(gfx_samples_, read_elsewhere);
+        any_turbostat_sample |= this->apply_sample_metric_selection(idle_state_samples_);
+        turbostat_samples_selected_ = turbostat_samples_selected_ && any_turbostat_sample;
+#else
+        static_cast<void>(general_selected);
+        static_cast<void>(clock_selected);
+#endif
+    }
 
-            // gfx (iGPU) related samples
-            if (header[i] == "GFX%rc6") {
-                if (this->sample_category_enabled(sample_category::gfx)) {
-                    using vector_type = decltype(gfx_samples_.gfx_render_state_percent_)::value_type;
-                    gfx_samples_.gfx_render_state_percent_ = vector_type{ detail::convert_to<typename vector_type::value_type>(values[i]) };
-                }
-                continue;
-            } else if (header[i] == "GFXMHz") {
-                if (this->sample_category_enabled(sample_category::gfx)) {
-                    using vector_type = decltype(gfx_samples_.gfx_frequency_)::value_type;
-                    gfx_samples_.gfx_frequency_ = vector_type{ detail::convert_to<typename vector_type::value_type>(values[i]) };
-                }
-                continue;
-            } else if (header[i] == "GFXAMHz") {
-                if (this->sample_category_enabled(sample_category::gfx)) {
-                    using vector_type = decltype(gfx_samples_.average_gfx_frequency_)::value_type;
-                    gfx_samples_.average_gfx_frequency_ = vector_type{ detail::convert_to<typename vector_type::value_type>(values[i]) };
-                }
-                continue;
-            } else if (header[i] == "GFX%C0") {
-                if (this->sample_category_enabled(sample_category::gfx)) {
-                    using vector_type = decltype(gfx_samples_.gfx_state_c0_percent_)::value_type;
-                    gfx_samples_.gfx_state_c0_percent_ = vector_type{ detail::convert_to<typename vector_type::value_type>(values[i]) };
-                }
-                continue;
-            } else if (header[i] == "CPUGFX%") {
-                if (this->sample_category_enabled(sample_category::gfx)) {
-                    using vector_type = decltype(gfx_samples_.cpu_works_for_gpu_percent_)::value_type;
-                    gfx_samples_.cpu_works_for_gpu_percent_ = vector_type{ detail::convert_to<typename vector_type::value_type>(values[i]) };
-                }
-                continue;
-            } else if (header[i] == "GFXWatt") {
-                if (this->sample_category_enabled(sample_category::gfx)) {
-                    using vector_type = decltype(gfx_samples_.gfx_watt_)::value_type;
-                    gfx_samples_.gfx_watt_ = vector_type{ detail::convert_to<typename vector_type::value_type>(values[i]) };
-                }
-                continue;
-            }
+#if defined(HWS_VIA_TURBOSTAT_ENABLED)
+    // start a single long-lived turbostat process printing one row per interval -> no subprocess is spawned in the sampling loop
+    if (turbostat_samples_selected_ && this->sample_category_enabled(turbostat_sample_categories)) {
+        this->start_turbostat_session(turbostat_output);
+    }
+#endif
+}
 
-            // idle state related samples
-            if (header[i] == "Totl%C0") {
-                if (this->sample_category_enabled(sample_category::idle_state)) {
-                    using vector_type = decltype(idle_state_samples_.all_cpus_state_c0_percent_)::value_type;
-                    idle_state_samples_.all_cpus_state_c0_percent_ = vector_type{ detail::convert_to<typename vector_type::value_type>(values[i]) };
-                }
-                continue;
-            } else if (header[i] == "Any%C0") {
-                if (this->sample_category_enabled(sample_category::idle_state)) {
-                    using vector_type = decltype(idle_state_samples_.any_cpu_state_c0_percent_)::value_type;
-                    idle_state_samples_.any_cpu_state_c0_percent_ = vector_type{ detail::convert_to<typename vector_type::value_type>(values[i]) };
-                }
-                continue;
-            } else if (header[i] == "CPU%LPI") {
-                if (this->sample_category_enabled(sample_category::idle_state)) {
-                    using vector_type = decltype(idle_state_samples_.low_power_idle_state_percent_)::value_type;
-                    idle_state_samples_.low_power_idle_state_percent_ = vector_type{ detail::convert_to<typename vector_type::value_type>(values[i]) };
-                }
-                continue;
-            } else if (header[i] == "SYS%LPI") {
-                if (this->sample_category_enabled(sample_category::idle_state)) {
-                    using vector_type = decltype(idle_state_samples_.system_low_power_idle_state_percent_)::value_type;
-                    idle_state_samples_.system_low_power_idle_state_percent_ = vector_type{ detail::convert_to<typename vector_type::value_type>(values[i]) };
-                }
-                continue;
-            } else if (header[i] == "Pkg%LPI") {
-                if (this->sample_category_enabled(sample_category::idle_state)) {
-                    using vector_type = decltype(idle_state_samples_.package_low_power_idle_state_percent_)::value_type;
-                    idle_state_samples_.package_low_power_idle_state_percent_ = vector_type{ detail::convert_to<typename vector_type::value_type>(values[i]) };
-                }
-                continue;
-            } else {
-                if (this->sample_category_enabled(sample_category::idle_state)) {
-                    // test against regex
-                    const std::string header_str{ header[i] };
-                    const std::regex reg{ std::string{ "CPU%[0-9a-zA-Z]+|Pkg%[0-9a-zA-Z]+|Pk%[0-9a-zA-Z]+|C[0-9a-zA-Z]+%|C[0-9a-zA-Z]+" }, std::regex::extended };
-                    if (std::regex_match(header_str, reg)) {
-                        // first time this branch is reached -> create optional value
-                        if (!idle_state_samples_.idle_states_.has_value()) {
-                            idle_state_samples_.idle_states_ = std::make_optional<typename cpu_idle_states_samples::map_type>();
-                        }
-
-                        using vector_type = cpu_idle_states_samples::map_type::mapped_type;
-                        idle_state_samples_.idle_states_.value()[header_str] = vector_type{ detail::convert_to<typename vector_type::value_type>(values[i]) };
-                    }
-                }
-                continue;
-            }
+void cpu_hardware_sampler::sample() {
+#if defined(HWS_VIA_PROC_MEMINFO_ENABLED)
+    if (this->sample_category_due(sample_category::memory) && meminfo_reader_.has_value()) {
+        // reread /proc/meminfo (no subprocess and no allocation)
+        const detail::meminfo info = meminfo_reader_->read();
+
+        // read memory information
+        if (memory_samples_.memory_used_.has_value()) {
+            memory_samples_.memory_used_->push_back(info.mem_used());
+        }
+        if (memory_samples_.memory_free_.has_value()) {
+            memory_samples_.memory_free_->push_back(info.mem_free);
+        }
+        if (memory_samples_.memory_cached_.has_value()) {
+            memory_samples_.memory_cached_->push_back(info.cached);
+        }
+        if (memory_samples_.memory_buffers_.has_value()) {
+            memory_samples_.memory_buffers_->push_back(info.buffers);
+        }
+        if (memory_samples_.memory_dirty_.has_value()) {
+            memory_samples_.memory_dirty_->push_back(info.dirty);
+        }
+        if (memory_samples_.memory_anon_pages_.has_value()) {
+            memory_samples_.memory_anon_pages_->push_back(info.anon_pages);
+        }
+
+        // read swap information
+        if (memory_samples_.swap_memory_used_.has_value()) {
+            memory_samples_.swap_memory_used_->push_back(info.swap_used());
+        }
+        if (memory_samples_.swap_memory_free_.has_value()) {
+            memory_samples_.swap_memory_free_->push_back(info.swap_free);
         }
+
+        this->track_sample_change(sample_category::memory, memory_samples_.memory_used_);
     }
 #endif
 
-    //
-    // loop until stop_sampling() is called
-    //
+#if defined(HWS_VIA_PROC_STAT_ENABLED)
+    if (proc_stat_reader_.has_value() && this->sample_category_due(sample_category::general)) {
+        // reread /proc/stat (no subprocess and no allocation)
+        this->push_back_per_cpu_utilization();
+    }
+#endif
 
-    while (!this->has_sampling_stopped()) {
-        // only sample values if the sampler currently isn't paused
-        if (this->is_sampling()) {
-            // add current time point
-            this->add_time_point(std::chrono::steady_clock::now());
+#if defined(HWS_VIA_CPUFREQ_ENABLED)
+    if (cpufreq_reader_.has_value() && this->sample_category_due(sample_category::clock)) {
+        // reread the scaling_cur_freq files (no subprocess and no allocation)
+        this->push_back_per_cpu_clock_frequency();
+    }
+#endif
 
-#if defined(HWS_VIA_FREE_ENABLED)
-            if (this->sample_category_enabled(sample_category::memory)) {
-                // run free
-                std::string free_output = detail::run_subprocess("free -b");
-                free_output = std::regex_replace(free_output, whitespace_replace_reg, " ");
-                const std::vector<std::string_view> free_lines = detail::split(detail::trim(free_output), '\n');
-                assert((free_lines.size() >= 3) && "Must read more than three lines, but fewer were read!");
-
-                // read memory information
-                const std::vector<std::string_view> memory_data = detail::split(free_lines[1], ' ');
-                memory_samples_.memory_used_->push_back(detail::convert_to<decltype(memory_samples_.memory_used_)::value_type::value_type>(memory_data[2]));
-                memory_samples_.memory_free_->push_back(detail::convert_to<decltype(memory_samples_.memory_free_)::value_type::value_type>(memory_data[3]));
-
-                // read swap information
-                const std::vector<std::string_view> swap_data = detail::split(free_lines[2], ' ');
-                memory_samples_.swap_memory_used_->push_back(detail::convert_to<decltype(memory_samples_.swap_memory_used_)::value_type::value_type>(swap_data[2]));
-                memory_samples_.swap_memory_free_->push_back(detail::convert_to<decltype(memory_samples_.swap_memory_free_)::value_type::value_type>(swap_data[3]));
+#if defined(HWS_VIA_POWERCAP_ENABLED)
+    if (rapl_reader_.has_value() && this->sample_category_due(sample_category::power | sample_category::gfx)) {
+        // reread the RAPL energy counters (no subprocess)
+        const detail::rapl_energy energy = rapl_reader_->read();
+
+        if (this->sample_category_due(sample_category::power)) {
+            // the mean power draw since the previous tick the power samples have been retrieved
+            const detail::rapl_energy &last = rapl_last_power_energy_;
+            const double seconds = std::chrono::duration<double>(energy.time_point - last.time_point).count();
+            if (power_samples_.power_usage_.has_value()) {
+                power_samples_.power_usage_->push_back(mean_power(energy.package - last.package, seconds));
+            }
+            if (power_samples_.power_total_energy_consumption_.has_value()) {
+                // use the measured energy instead of integrating the power draw
+                power_samples_.power_total_energy_consumption_->push_back(power_samples_.power_total_energy_consumption_->back() + (energy.package - last.package));
+            }
+            if (power_samples_.core_watt_.has_value() && this->read_via_powercap("CorWatt")) {
+                power_samples_.core_watt_->push_back(mean_power(energy.core - last.core, seconds));
             }
+            if (power_samples_.ram_watt_.has_value() && this->read_via_powercap("RAMWatt")) {
+                power_samples_.ram_watt_->push_back(mean_power(energy.dram - last.dram, seconds));
+            }
+            rapl_last_power_energy_ = energy;
+
+            this->track_sample_change(sample_category::power, power_samples_.power_usage_);
+        }
+        if (this->sample_category_due(sample_category::gfx)) {
+            const detail::rapl_energy &last = rapl_last_gfx_energy_;
+            const double seconds = std::chrono::duration<double>(energy.time_point - last.time_point).count();
+            if (gfx_samples_.gfx_watt_.has_value() && this->read_via_powercap("GFXWatt")) {
+                gfx_samples_.gfx_watt_->push_back(mean_power(energy.uncore - last.uncore, seconds));
+            }
+            rapl_last_gfx_energy_ = energy;
+        }
+    }
 #endif
 
 #if defined(HWS_VIA_TURBOSTAT_ENABLED)
-            {
-                // run turbostat
-                const std::string turbostat_output = detail::run_subprocess(turbostat_command_line);
-
-                // retrieve the turbostat data
-                const std::vector<std::string_view> data = detail::split(detail::trim(turbostat_output), '\n');
-                assert((data.size() >= 2) && "Must read at least two lines!");
-                const std::vector<std::string_view> header = detail::split(data[0], '\t');
-                const std::vector<std::string_view> values = detail::split(data[1], '\t');
-
-                // add values to the respective sample entries
-                for (std::size_t i = 0; i < header.size(); ++i) {
-                    // general samples
-                    if (header[i] == "Busy%") {
-                        if (this->sample_category_enabled(sample_category::general)) {
-                            using vector_type = decltype(general_samples_.compute_utilization_)::value_type;
-                            general_samples_.compute_utilization_->push_back(detail::convert_to<typename vector_type::value_type>(values[i]));
-                        }
-                        continue;
-                    } else if (header[i] == "IPC") {
-                        if (this->sample_category_enabled(sample_category::general)) {
-                            using vector_type = decltype(general_samples_.ipc_)::value_type;
-                            general_samples_.ipc_->push_back(detail::convert_to<typename vector_type::value_type>(values[i]));
-                        }
-                        continue;
-                    } else if (header[i] == "IRQ") {
-                        if (this->sample_category_enabled(sample_category::general)) {
-                            using vector_type = decltype(general_samples_.irq_)::value_type;
-                            general_samples_.irq_->push_back(detail::convert_to<typename vector_type::value_type>(values[i]));
-                        }
-                        continue;
-                    } else if (header[i] == "SMI") {
-                        if (this->sample_category_enabled(sample_category::general)) {
-                            using vector_type = decltype(general_samples_.smi_)::value_type;
-                            general_samples_.smi_->push_back(detail::convert_to<typename vector_type::value_type>(values[i]));
-                        }
-                        continue;
-                    } else if (header[i] == "POLL") {
-                        if (this->sample_category_enabled(sample_category::general)) {
-                            using vector_type = decltype(general_samples_.poll_)::value_type;
-                            general_samples_.poll_->push_back(detail::convert_to<typename vector_type::value_type>(values[i]));
-                        }
-                        continue;
-                    } else if (header[i] == "POLL%") {
-                        if (this->sample_category_enabled(sample_category::general)) {
-                            using vector_type = decltype(general_samples_.poll_percent_)::value_type;
-                            general_samples_.poll_percent_->push_back(detail::convert_to<typename vector_type::value_type>(values[i]));
-                        }
-                        continue;
-                    }
-
-                    // clock related samples
-                    if (header[i] == "Avg_MHz") {
-                        if (this->sample_category_enabled(sample_category::clock)) {
-                            using vector_type = decltype(clock_samples_.clock_frequency_)::value_type;
-                            clock_samples_.clock_frequency_->push_back(detail::convert_to<typename vector_type::value_type>(values[i]));
-                        }
-                        continue;
-                    } else if (header[i] == "Bzy_MHz") {
-                        if (this->sample_category_enabled(sample_category::clock)) {
-                            using vector_type = decltype(clock_samples_.average_non_idle_clock_frequency_)::value_type;
-                            clock_samples_.average_non_idle_clock_frequency_->push_back(detail::convert_to<typename vector_type::value_type>(values[i]));
-                        }
-                        continue;
-                    } else if (header[i] == "TSC_MHz") {
-                        if (this->sample_category_enabled(sample_category::clock)) {
-                            using vector_type = decltype(clock_samples_.time_stamp_counter_)::value_type;
-                            clock_samples_.time_stamp_counter_->push_back(detail::convert_to<typename vector_type::value_type>(values[i]));
-                        }
-                        continue;
-                    }
-
-                    // power related samples
-                    if (header[i] == "PkgWatt") {
-                        if (this->sample_category_enabled(sample_category::power)) {
-                            using vector_type = decltype(power_samples_.power_usage_)::value_type;
-                            power_samples_.power_usage_->push_back(detail::convert_to<typename vector_type::value_type>(values[i]));
-                            // calculate total energy consumption
-                            using value_type = decltype(power_samples_.power_total_energy_consumption_)::value_type::value_type;
-                            const std::size_t num_time_points = this->sampling_time_points().size();
-                            const value_type time_difference = std::chrono::duration<value_type>(this->sampling_time_points()[num_time_points - 1] - this->sampling_time_points()[num_time_points - 2]).count();
-                            const auto current = power_samples_.power_usage_->back() * time_difference;
-                            power_samples_.power_total_energy_consumption_->push_back(power_samples_.power_total_energy_consumption_->back() + current);
-                        }
-                        continue;
-                    } else if (header[i] == "CorWatt") {
-                        if (this->sample_category_enabled(sample_category::power)) {
-                            using vector_type = decltype(power_samples_.core_watt_)::value_type;
-                            power_samples_.core_watt_->push_back(detail::convert_to<typename vector_type::value_type>(values[i]));
-                        }
-                        continue;
-                    } else if (header[i] == "RAMWatt") {
-                        if (this->sample_category_enabled(sample_category::power)) {
-                            using vector_type = decltype(power_samples_.ram_watt_)::value_type;
-                            power_samples_.ram_watt_->push_back(detail::convert_to<typename vector_type::value_type>(values[i]));
-                        }
-                        continue;
-                    } else if (header[i] == "PKG_%") {
-                        if (this->sample_category_enabled(sample_category::power)) {
-                            using vector_type = decltype(power_samples_.package_rapl_throttle_percent_)::value_type;
-                            power_samples_.package_rapl_throttle_percent_->push_back(detail::convert_to<typename vector_type::value_type>(values[i]));
-                        }
-                        continue;
-                    } else if (header[i] == "RAM_%") {
-                        if (this->sample_category_enabled(sample_category::power)) {
-                            using vector_type = decltype(power_samples_.dram_rapl_throttle_percent_)::value_type;
-                            power_samples_.dram_rapl_throttle_percent_->push_back(detail::convert_to<typename vector_type::value_type>(values[i]));
-                        }
-                        continue;
-                    }
-
-                    // temperature related samples
-                    if (header[i] == "CoreTmp") {
-                        if (this->sample_category_enabled(sample_category::temperature)) {
-                            using vector_type = decltype(temperature_samples_.core_temperature_)::value_type;
-                            temperature_samples_.core_temperature_->push_back(detail::convert_to<typename vector_type::value_type>(values[i]));
-                        }
-                        continue;
-                    } else if (header[i] == "CoreThr") {
-                        if (this->sample_category_enabled(sample_category::temperature)) {
-                            using vector_type = decltype(temperature_samples_.core_throttle_percent_)::value_type;
-                            temperature_samples_.core_throttle_percent_->push_back(detail::convert_to<typename vector_type::value_type>(values[i]));
-                        }
-                        continue;
-                    } else if (header[i] == "PkgTmp") {
-                        if (this->sample_category_enabled(sample_category::temperature)) {
-                            using vector_type = decltype(temperature_samples_.temperature_)::value_type;
-                            temperature_samples_.temperature_->push_back(detail::convert_to<typename vector_type::value_type>(values[i]));
-                        }
-                        continue;
-                    }
-
-                    // gfx (iGPU) related samples
-                    if (header[i] == "GFX%rc6") {
-                        if (this->sample_category_enabled(sample_category::gfx)) {
-                            using vector_type = decltype(gfx_samples_.gfx_render_state_percent_)::value_type;
-                            gfx_samples_.gfx_render_state_percent_->push_back(detail::convert_to<typename vector_type::value_type>(values[i]));
-                        }
-                        continue;
-                    } else if (header[i] == "GFXMHz") {
-                        if (this->sample_category_enabled(sample_category::gfx)) {
-                            using vector_type = decltype(gfx_samples_.gfx_frequency_)::value_type;
-                            gfx_samples_.gfx_frequency_->push_back(detail::convert_to<typename vector_type::value_type>(values[i]));
-                        }
-                        continue;
-                    } else if (header[i] == "GFXAMHz") {
-                        if (this->sample_category_enabled(sample_category::gfx)) {
-                            using vector_type = decltype(gfx_samples_.average_gfx_frequency_)::value_type;
-                            gfx_samples_.average_gfx_frequency_->push_back(detail::convert_to<typename vector_type::value_type>(values[i]));
-                        }
-                        continue;
-                    } else if (header[i] == "GFX%C0") {
-                        if (this->sample_category_enabled(sample_category::gfx)) {
-                            using vector_type = decltype(gfx_samples_.gfx_state_c0_percent_)::value_type;
-                            gfx_samples_.gfx_state_c0_percent_->push_back(detail::convert_to<typename vector_type::value_type>(values[i]));
-                        }
-                        continue;
-                    } else if (header[i] == "CPUGFX%") {
-                        if (this->sample_category_enabled(sample_category::gfx)) {
-                            using vector_type = decltype(gfx_samples_.cpu_works_for_gpu_percent_)::value_type;
-                            gfx_samples_.cpu_works_for_gpu_percent_->push_back(detail::convert_to<typename vector_type::value_type>(values[i]));
-                        }
-                        continue;
-                    } else if (header[i] == "GFXWatt") {
-                        if (this->sample_category_enabled(sample_category::gfx)) {
-                            using vector_type = decltype(gfx_samples_.gfx_watt_)::value_type;
-                            gfx_samples_.gfx_watt_->push_back(detail::convert_to<typename vector_type::value_type>(values[i]));
-                        }
-                        continue;
-                    }
-
-                    // idle state related samples
-                    if (header[i] == "Totl%C0") {
-                        if (this->sample_category_enabled(sample_category::idle_state)) {
-                            using vector_type = decltype(idle_state_samples_.all_cpus_state_c0_percent_)::value_type;
-                            idle_state_samples_.all_cpus_state_c0_percent_->push_back(detail::convert_to<typename vector_type::value_type>(values[i]));
-                        }
-                        continue;
-                    } else if (header[i] == "Any%C0") {
-                        if (this->sample_category_enabled(sample_category::idle_state)) {
-                            using vector_type = decltype(idle_state_samples_.any_cpu_state_c0_percent_)::value_type;
-                            idle_state_samples_.any_cpu_state_c0_percent_->push_back(detail::convert_to<typename vector_type::value_type>(values[i]));
-                        }
-                        continue;
-                    } else if (header[i] == "CPU%LPI") {
-                        if (this->sample_category_enabled(sample_category::idle_state)) {
-                            using vector_type = decltype(idle_state_samples_.low_power_idle_state_percent_)::value_type;
-                            idle_state_samples_.low_power_idle_state_percent_->push_back(detail::convert_to<typename vector_type::value_type>(values[i]));
-                        }
-                        continue;
-                    } else if (header[i] == "SYS%LPI") {
-                        if (this->sample_category_enabled(sample_category::idle_state)) {
-                            using vector_type = decltype(idle_state_samples_.system_low_power_idle_state_percent_)::value_type;
-                            idle_state_samples_.system_low_power_idle_state_percent_->push_back(detail::convert_to<typename vector_type::value_type>(values[i]));
-                        }
-                        continue;
-                    } else if (header[i] == "Pkg%LPI") {
-                        if (this->sample_category_enabled(sample_category::idle_state)) {
-                            using vector_type = decltype(idle_state_samples_.package_low_power_idle_state_percent_)::value_type;
-                            idle_state_samples_.package_low_power_idle_state_percent_->push_back(detail::convert_to<typename vector_type::value_type>(values[i]));
-                        }
-                        continue;
-                    } else {
-                        if (this->sample_category_enabled(sample_category::idle_state)) {
-                            const std::string header_str{ header[i] };
-                            if (idle_state_samples_.idle_states_.value().count(header_str) > decltype(idle_state_samples_)::map_type::size_type{ 0 }) {
-                                using vector_type = cpu_idle_states_samples::map_type::mapped_type;
-                                idle_state_samples_.idle_states_.value()[header_str].push_back(detail::convert_to<typename vector_type::value_type>(values[i]));
-                            }
-                        }
-                        continue;
-                    }
-                }
+    // only read the turbostat output if any of its sample categories must be sampled in the current tick and any of its samples has been selected
+    if (turbostat_session_.has_value() && this->sample_category_due(turbostat_sample_categories)) {
+        // read the rows printed since the previous tick without blocking
+        // if no new row has been printed yet, the values of the previous row are reused
+        turbostat_session_->poll();
+
+        // the header is matched only once (and again if turbostat prints a new one)
+        // the hardware samples may have been dropped by the selection -> only the present ones are added
+        if (!turbostat_columns_.has_value() || turbostat_columns_num_headers_ != turbostat_session_->num_headers()) {
+            turbostat_columns_.emplace(turbostat_session_->header());
+            this->add_turbostat_columns(turbostat_columns_.value(), false);
+            turbostat_columns_num_headers_ = turbostat_session_->num_headers();
+        }
+
+        // add the values of the latest row to the respective sample entries of the sample categories due in the current tick
+        sample_category due_categories = turbostat_sample_categories;
+        for (const sample_category category : { sample_category::general, sample_category::clock, sample_category::power, sample_category::temperature, sample_category::gfx, sample_category::idle_state }) {
+            if (!this->sample_category_due(category)) {
+                due_categories &= ~category;
             }
+        }
+        turbostat_columns_->read_row(turbostat_session_->latest_row(), due_categories);
+
+        // calculate total energy consumption
+        if (this->sample_category_due(sample_category::power) && power_samples_.power_usage_.has_value() && power_samples_.power_total_energy_consumption_.has_value() && !this->read_via_powercap("PkgWatt")) {
+            using value_type = decltype(power_samples_.power_total_energy_consumption_)::value_type::value_type;
+            const value_type time_difference = std::chrono::duration<value_type>(this->time_since_previous_sample(sample_category::power)).count();
+            const auto current = power_samples_.power_usage_->back() * time_difference;
+            power_samples_.power_total_energy_consumption_->push_back(power_samples_.power_total_energy_consumption_->back() + current);
+        }
+
+        if (this->sample_category_due(sample_category::general)) {
+            this->track_sample_change(sample_category::general, general_samples_.compute_utilization_);
+        }
+        if (this->sample_category_due(sample_category::clock)) {
+            this->track_sample_change(sample_category::clock, clock_samples_.clock_frequency_);
+        }
+        if (this->sample_category_due(sample_category::power) && !this->read_via_powercap("PkgWatt")) {
+            this->track_sample_change(sample_category::power, power_samples_.power_usage_);
+        }
+        if (this->sample_category_due(sample_category::temperature)) {
+            this->track_sample_change(sample_category::temperature, temperature_samples_.temperature_);
+        }
+    }
+#endif
+}
+
+std::optional<double> cpu_hardware_sampler::read_energy_counter() {
+#if defined(HWS_VIA_POWERCAP_ENABLED)
+    const std::lock_guard lock{ region_rapl_reader_mutex_ };
+    if (!region_rapl_reader_opened_) {
+        region_rapl_reader_opened_ = true;
+        try {
+            region_rapl_reader_.emplace(powercap_root_);
+        } catch (const std::runtime_error &) {
+            // the RAPL energy counters aren't readable (e.g., missing root privileges) -> the regions approximate the energy using the power samples
+            region_rapl_reader_.reset();
+        }
+    }
+    if (region_rapl_reader_.has_value()) {
+        try {
+            const detail::rapl_energy energy = region_rapl_reader_->read();
+            return energy.package + energy.dram;
+        } catch (const std::runtime_error &) {
+            return std::nullopt;
+        }
+    }
+#endif
+    return std::nullopt;
+}
+
+std::optional<double> cpu_hardware_sampler::latest_power_usage() const {
+    return latest_sample(power_samples_.power_usage_);
+}
+
+std::optional<double> cpu_hardware_sampler::latest_temperature() const {
+    return latest_sample(temperature_samples_.temperature_);
+}
+
+std::vector<std::string> cpu_hardware_sampler::numeric_sample_names() const {
+    std::vector<std::string> names{};
+    detail::append_numeric_sample_names(general_samples_, names);
+    detail::append_numeric_sample_names(clock_samples_, names);
+    detail::append_numeric_sample_names(power_samples_, names);
+    detail::append_numeric_sample_names(memory_samples_, names);
+    detail::append_numeric_sample_names(temperature_samples_, names);
+    detail::append_numeric_sample_names(gfx_samples_, names);
+    detail::append_numeric_sample_names(idle_state_samples_, names);
+    return names;
+}
+
+void cpu_hardware_sampler::latest_numeric_sample_values(const sample_category sampled, std::vector<double> &values) const {
+    std::size_t pos = 0;
+    detail::append_latest_numeric_sample_values(general_samples_, sampled, values, pos);
+    detail::append_latest_numeric_sample_values(clock_samples_, sampled, values, pos);
+    detail::append_latest_numeric_sample_values(power_samples_, sampled, values, pos);
+    detail::append_latest_numeric_sample_values(memory_samples_, sampled, values, pos);
+    detail::append_latest_numeric_sample_values(temperature_samples_, sampled, values, pos);
+    detail::append_latest_numeric_sample_values(gfx_samples_, sampled, values, pos);
+    detail::append_latest_numeric_sample_values(idle_state_samples_, sampled, values, pos);
+}
+
+#if defined(HWS_VIA_TURBOSTAT_ENABLED)
+void cpu_hardware_sampler::pause_samples() {
+    // remember the latest row -> the first ticks after resuming don't have to wait for the new turbostat session
+    if (turbostat_session_.has_value()) {
+        turbostat_paused_output_ = fmt::format("{}\n{}\n", fmt::join(turbostat_session_->header(), "\t"), turbostat_session_->latest_row());
+    }
+    turbostat_session_.reset();
+}
+
+void cpu_hardware_sampler::resume_samples() {
+    if (turbostat_samples_selected_ && this->sample_category_enabled(turbostat_sample_categories)) {
+        this->start_turbostat_session(turbostat_paused_output_);
+    }
+}
+
+void cpu_hardware_sampler::finalize_samples() {
+    turbostat_session_.reset();
+}
 #endif
+
+void cpu_hardware_sampler::set_powercap_root(std::filesystem::path powercap_root) {
+    if (this->has_sampling_started()) {
+        throw std::runtime_error{ "Can't change the powercap root directory of a hardware sampler that has already been started!" };
+    }
+    powercap_root_ = std::move(powercap_root);
+}
+
+bool cpu_hardware_sampler::uses_powercap() const noexcept {
+#if defined(HWS_VIA_POWERCAP_ENABLED)
+    return rapl_reader_.has_value();
+#else
+    return false;
+#endif
+}
+
+bool cpu_hardware_sampler::read_via_powercap([[maybe_unused]] const std::string_view turbostat_name) const noexcept {
+#if defined(HWS_VIA_POWERCAP_ENABLED)
+    if (rapl_reader_.has_value()) {
+        if (turbostat_name == "PkgWatt") {
+            return true;
+        } else if (turbostat_name == "CorWatt") {
+            return rapl_reader_->has_domain(detail::rapl_domain_type::core);
+        } else if (turbostat_name == "RAMWatt") {
+            return rapl_reader_->has_domain(detail::rapl_domain_type::dram);
+        } else if (turbostat_name == "GFXWatt") {
+            return rapl_reader_->has_domain(detail::rapl_domain_type::uncore);
         }
+    }
+#endif
+    return false;
+}
 
-        // wait for the sampling interval to pass to retrieve the next sample
-        std::this_thread::sleep_for(this->sampling_interval());
+#if defined(HWS_VIA_PROC_STAT_ENABLED)
+void cpu_hardware_sampler::push_back_per_cpu_utilization() {
+    const std::vector<detail::cpu_utilization> &utilization = proc_stat_reader_->read();
+    push_back_time_point(general_samples_.per_cpu_user_percent_, utilization, [](const detail::cpu_utilization &util) { return util.user; });
+    push_back_time_point(general_samples_.per_cpu_system_percent_, utilization, [](const detail::cpu_utilization &util) { return util.system; });
+    push_back_time_point(general_samples_.per_cpu_iowait_percent_, utilization, [](const detail::cpu_utilization &util) { return util.iowait; });
+    push_back_time_point(general_samples_.per_cpu_steal_percent_, utilization, [](const detail::cpu_utilization &util) { return util.steal; });
+    push_back_time_point(general_samples_.per_cpu_idle_percent_, utilization, [](const detail::cpu_utilization &util) { return util.idle; });
+}
+#endif
+
+#if defined(HWS_VIA_CPUFREQ_ENABLED)
+void cpu_hardware_sampler::push_back_per_cpu_clock_frequency() {
+    // cpufreq reports kHz
+    push_back_time_point(clock_samples_.per_cpu_clock_frequency_, cpufreq_reader_->read(), [](const unsigned long long frequency) { return static_cast<double>(frequency) / 1000.0; });
+}
+#endif
+
+#if defined(HWS_VIA_TURBOSTAT_ENABLED)
+void cpu_hardware_sampler::add_turbostat_columns(detail::turbostat_column_table &columns, const bool create) {
+    // the power samples may be read from the RAPL energy counters instead
+    const auto select = [this](const std::string_view turbostat_name, const sample_category category) {
+        return this->sample_category_enabled(category) && !this->read_via_powercap(turbostat_name);
+    };
+    const std::optional<sample_column_config> config = create ? std::make_optional(this->column_config()) : std::nullopt;
+    columns.add_columns(general_samples_, select, config);
+    columns.add_columns(clock_samples_, select, config);
+    columns.add_columns(power_samples_, select, config);
+    columns.add_columns(temperature_samples_, select, config);
+    columns.add_columns(gfx_samples_, select, config);
+    columns.add_columns(idle_state_samples_, select, config);
+    // all remaining columns denoting an idle state are stored in the idle state map
+    if (this->sample_category_enabled(sample_category::idle_state)) {
+        columns.add_idle_state_columns(idle_state_samples_.idle_states_, config);
+    }
+}
+
+void cpu_hardware_sampler::start_turbostat_session(const std::string_view initial_output) {
+    // each row covers the smallest sampling interval of all enabled sample categories retrieved via turbostat
+    std::chrono::nanoseconds interval = std::chrono::nanoseconds::max();
+    for (const sample_category category : { sample_category::general, sample_category::clock, sample_category::power, sample_category::temperature, sample_category::gfx, sample_category::idle_state }) {
+        if (this->sample_category_enabled(category)) {
+            interval = std::min(interval, this->sampling_interval(category));
+        }
     }
+    // terminate the previous turbostat session before spawning the new one
+    turbostat_session_.reset();
+    turbostat_session_.emplace(turbostat_session_command_line(interval));
+    turbostat_session_->parse(initial_output);
+    // the header counter starts anew -> rebuild the table mapping the cells to the hardware samples in the next tick
+    turbostat_columns_.reset();
 }
+#endif
 
 std::string cpu_hardware_sampler::device_identification() const {
     return "cpu_device";
@@ -641,8 +732,8 @@ std::string cpu_hardware_sampler::device_identification() const {
 
 std::string cpu_hardware_sampler::samples_only_as_yaml_string() const {
     // check whether it's safe to generate the YAML entry
-    if (this->is_sampling()) {
-        throw std::runtime_error{ "Can't create the final YAML entry if the hardware sampler is still running!" };
+    if (!this->samples_accessible()) {
+        throw std::runtime_error{ "Can't create the YAML entry before the initial samples have been retrieved!" };
     }
 
     return fmt::format("{}{}"
@@ -668,7 +759,7 @@ std::string cpu_hardware_sampler::samples_only_as_yaml_string() const {
 }
 
 std::ostream &operator<<(std::ostream &out, const cpu_hardware_sampler &sampler) {
-    if (sampler.is_sampling()) {
+    if (!sampler.samples_accessible()) {
         out.setstate(std::ios_base::failbit);
         return out;
     } else {
@@ -0,0 +1,129 @@
+/**
+ * @author Marcel Breyer
+ * @copyright 2024-today All Rights Reserved
+ * @license This file is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ */
+
+#include "hws/cpu/meminfo_reader.hpp"
+
+#include "fmt/format.h"  // fmt::format
+
+#include <algorithm>     // std::min
+#include <array>         // std::array
+#include <cerrno>        // errno, EINTR
+#include <charconv>      // std::from_chars
+#include <cstddef>       // std::size_t
+#include <cstring>       // std::strerror
+#include <fcntl.h>       // ::open, O_RDONLY, O_CLOEXEC
+#include <stdexcept>     // std::runtime_error
+#include <string>        // std::string
+#include <string_view>   // std::string_view
+#include <system_error>  // std::errc
+#include <unistd.h>      // ::pread, ::close, ssize_t
+#include <utility>       // std::move, std::exchange, std::pair
+
+namespace hws::detail {
+
+namespace {
+
+/// The keys in `/proc/meminfo` that are parsed together with the respective member they are stored in.
+constexpr std::array<std::pair<std::string_view, unsigned long long meminfo::*>, 10> meminfo_keys{ {
+    { "MemTotal", &meminfo::mem_total },
+    { "MemFree", &meminfo::mem_free },
+    { "MemAvailable", &meminfo::mem_available },
+    { "Buffers", &meminfo::buffers },
+    { "Cached", &meminfo::cached },
+    { "SwapTotal", &meminfo::swap_total },
+    { "SwapFree", &meminfo::swap_free },
+    { "Dirty", &meminfo::dirty },
+    { "AnonPages", &meminfo::anon_pages },
+    { "SReclaimable", &meminfo::slab_reclaimable },
+} };
+
+}  // namespace
+
+unsigned long long meminfo::mem_used() const noexcept {
+    const unsigned long long available = has_mem_available ? mem_available : mem_free + buffers + cached + slab_reclaimable;
+    return available < mem_total ? mem_total - available : 0ull;
+}
+
+meminfo_reader::meminfo_reader(std::string path) :
+    path_{ std::move(path) },
+    fd_{ ::open(path_.c_str(), O_RDONLY | O_CLOEXEC) } {
+    if (fd_ < 0) {
+        throw std::runtime_error{ fmt::format("Couldn't open \"{}\": {}", path_, std::strerror(errno)) };
+    }
+}
+
+meminfo_reader::meminfo_reader(meminfo_reader &&other) noexcept :
+    path_{ std::move(other.path_) },
+    fd_{ std::exchange(other.fd_, -1) } { }
+
+meminfo_reader &meminfo_reader::operator=(meminfo_reader &&other) noexcept {
+    if (this != &other) {
+        if (fd_ >= 0) {
+            ::close(fd_);
+        }
+        path_ = std::move(other.path_);
+        fd_ = std::exchange(other.fd_, -1);
+    }
+    return *this;
+}
+
+meminfo_reader::~meminfo_reader() {
+    if (fd_ >= 0) {
+        ::close(fd_);
+    }
+}
+
+meminfo meminfo_reader::read() {
+    // procfs files are regenerated on each read starting at offset zero -> no need to seek or reopen the file
+    ssize_t num_bytes = 0;
+    do {
+        num_bytes = ::pread(fd_, buffer_.data(), buffer_.size(), 0);
+    } while (num_bytes < 0 && errno == EINTR);
+    if (num_bytes < 0) {
+        throw std::runtime_error{ fmt::format("Couldn't read \"{}\": {}", path_, std::strerror(errno)) };
+    }
+    return parse(std::string_view{ buffer_.data(), static_cast<std::size_t>(num_bytes) });
+}
+
+meminfo meminfo_reader::parse(std::string_view content) noexcept {
+    meminfo info{};
+
+    // each line has the form "Key:    value kB", only complete lines are parsed
+    for (std::size_t newline = content.find('\n'); newline != std::string_view::npos; newline = content.find('\n')) {
+        const std::string_view line = content.substr(0, newline);
+        content.remove_prefix(newline + 1);
+
+        const std::size_t colon = line.find(':');
+        if (colon == std::string_view::npos) {
+            continue;
+        }
+        const std::string_view key = line.substr(0, colon);
+        for (const auto &[name, member] : meminfo_keys) {
+            if (key != name) {
+                continue;
+            }
+            // skip the whitespaces in front of the value
+            std::string_view value = line.substr(colon + 1);
+            value.remove_prefix(std::min(value.find_first_not_of(' '), value.size()));
+
+            unsigned long long val{};
+            const auto [ptr, ec] = std::from_chars(value.data(), value.data() + value.size(), val);
+            if (ec == std::errc{}) {
+                // the values are reported in kB (actually KiB) -> convert to Byte
+                const std::string_view unit{ ptr, static_cast<std::size_t>(value.data() + value.size() - ptr) };
+                info.*member = unit == " kB" ? val * 1024ull : val;
+                if (member == &meminfo::mem_available) {
+                    info.has_mem_available = true;
+                }
+            }
+            break;
+        }
+    }
+    return info;
+}
+
+}  // namespace hws::detail
@@ -0,0 +1,203 @@
+/**
+ * @author Marcel Breyer
+ * @copyright 2024-today All Rights Reserved
+ * @license This file is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ */
+
+#include "hws/cpu/proc_stat_reader.hpp"
+
+#include "hws/utility.hpp"  // hws::detail::starts_with
+
+#include "fmt/format.h"  // fmt::format
+
+#include <cctype>        // std::isdigit
+#include <cerrno>        // errno, EINTR
+#include <charconv>      // std::from_chars
+#include <cstddef>       // std::size_t
+#include <cstring>       // std::strerror
+#include <fcntl.h>       // ::open, O_RDONLY, O_CLOEXEC
+#include <stdexcept>     // std::runtime_error
+#include <string>        // std::string
+#include <string_view>   // std::string_view
+#include <system_error>  // std::errc
+#include <unistd.h>      // ::pread, ::close, ssize_t
+#include <utility>       // std::move, std::exchange
+
+namespace hws::detail {
+
+namespace {
+
+/// Marks the IDs of logical CPUs that were offline while constructing the reader.
+constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+/**
+ * @brief Parse the "cpu<N>" @p line, e.g., "cpu3 4705 356 584 3699 23 23 0 0 0 0".
+ * @tparam Times the type of the times, i.e., a std::array of eight values
+ * @param[in] line the line to parse (without the trailing newline)
+ * @param[out] id the ID of the logical CPU
+ * @param[out] times the first eight times of the logical CPU; missing times (older kernels) are zero
+ * @return `true` if @p line is a line of a single logical CPU, otherwise `false` (e.g., the line summarizing all logical CPUs) (`[[nodiscard]]`)
+ */
+template <typename Times>
+[[nodiscard]] bool parse_cpu_line(std::string_view line, std::size_t &id, Times &times) noexcept {
+    line.remove_prefix(3);  // "cpu"
+    if (line.empty() || !std::isdigit(static_cast<unsigned char>(line.front()))) {
+        return false;
+    }
+    const char *ptr = line.data();
+    const char *const last = line.data() + line.size();
+    ptr = std::from_chars(ptr, last, id).ptr;
+
+    for (unsigned long long &time : times) {
+        while (ptr != last && *ptr == ' ') {
+            ++ptr;
+        }
+        const auto [next, ec] = std::from_chars(ptr, last, time);
+        if (ec != std::errc{}) {
+            time = 0;
+        }
+        ptr = next;
+    }
+    return true;
+}
+
+}  // namespace
+
+proc_stat_reader::proc_stat_reader(std::string path) :
+    path_{ std::move(path) },
+    fd_{ ::open(path_.c_str(), O_RDONLY | O_CLOEXEC) } {
+    if (fd_ < 0) {
+        throw std::runtime_error{ fmt::format("Couldn't open \"{}\": {}", path_, std::strerror(errno)) };
+    }
+
+    try {
+        // read the whole file once
+        buffer_.resize(65536);
+        std::string_view content = this->read_content();
+        while (content.size() == buffer_.size()) {
+            buffer_.resize(2 * buffer_.size());
+            content = this->read_content();
+        }
+
+        // the "cpu<N>" lines are at the beginning of the file
+        std::size_t cpu_lines_end = 0;
+        for (std::size_t newline = content.find('\n'); newline != std::string_view::npos; newline = content.find('\n', cpu_lines_end)) {
+            const std::string_view line = content.substr(cpu_lines_end, newline - cpu_lines_end);
+            if (!detail::starts_with(line, "cpu")) {
+                break;
+            }
+            std::size_t id{};
+            cpu_times times{};
+            if (parse_cpu_line(line, id, times)) {
+                if (id >= cpu_index_.size()) {
+                    cpu_index_.resize(id + 1, npos);
+                }
+                cpu_index_[id] = cpu_ids_.size();
+                cpu_ids_.push_back(id);
+            }
+            cpu_lines_end = newline + 1;
+        }
+        if (cpu_ids_.empty()) {
+            throw std::runtime_error{ fmt::format("Couldn't find any logical CPU in \"{}\"!", path_) };
+        }
+
+        // only read the "cpu<N>" lines afterward, leaving enough room for the times to grow
+        buffer_.resize(cpu_lines_end + 64 * cpu_ids_.size() + 4096);
+        buffer_.shrink_to_fit();
+    } catch (...) {
+        ::close(fd_);
+        throw;
+    }
+
+    // the first read computes the utilization since booting
+    last_times_.resize(cpu_ids_.size());
+    utilization_.resize(cpu_ids_.size());
+}
+
+proc_stat_reader::proc_stat_reader(proc_stat_reader &&other) noexcept :
+    path_{ std::move(other.path_) },
+    fd_{ std::exchange(other.fd_, -1) },
+    buffer_{ std::move(other.buffer_) },
+    cpu_ids_{ std::move(other.cpu_ids_) },
+    cpu_index_{ std::move(other.cpu_index_) },
+    last_times_{ std::move(other.last_times_) },
+    utilization_{ std::move(other.utilization_) } { }
+
+proc_stat_reader &proc_stat_reader::operator=(proc_stat_reader &&other) noexcept {
+    if (this != &other) {
+        if (fd_ >= 0) {
+            ::close(fd_);
+        }
+        path_ = std::move(other.path_);
+        fd_ = std::exchange(other.fd_, -1);
+        buffer_ = std::move(other.buffer_);
+        cpu_ids_ = std::move(other.cpu_ids_);
+        cpu_index_ = std::move(other.cpu_index_);
+        last_times_ = std::move(other.last_times_);
+        utilization_ = std::move(other.utilization_);
+    }
+    return *this;
+}
+
+proc_stat_reader::~proc_stat_reader() {
+    if (fd_ >= 0) {
+        ::close(fd_);
+    }
+}
+
+const std::vector<cpu_utilization> &proc_stat_reader::read() {
+    const std::string_view content = this->read_content();
+
+    std::size_t line_begin = 0;
+    for (std::size_t newline = content.find('\n'); newline != std::string_view::npos; newline = content.find('\n', line_begin)) {
+        const std::string_view line = content.substr(line_begin, newline - line_begin);
+        line_begin = newline + 1;
+        if (!detail::starts_with(line, "cpu")) {
+            break;
+        }
+        std::size_t id{};
+        cpu_times times{};
+        if (!parse_cpu_line(line, id, times) || id >= cpu_index_.size() || cpu_index_[id] == npos) {
+            // the summary line or a logical CPU that was offline while constructing the reader
+            continue;
+        }
+        const std::size_t idx = cpu_index_[id];
+
+        // user, nice, system, idle, iowait, irq, softirq, steal; the counters (especially iowait) may decrease
+        cpu_times delta{};
+        unsigned long long total = 0;
+        for (std::size_t i = 0; i < times.size(); ++i) {
+            delta[i] = times[i] >= last_times_[idx][i] ? times[i] - last_times_[idx][i] : 0ull;
+            total += delta[i];
+        }
+        last_times_[idx] = times;
+        if (total == 0) {
+            // no jiffy elapsed since the previous read
+            continue;
+        }
+
+        const double scale = 100.0 / static_cast<double>(total);
+        cpu_utilization &util = utilization_[idx];
+        util.user = static_cast<double>(delta[0] + delta[1]) * scale;
+        util.system = static_cast<double>(delta[2] + delta[5] + delta[6]) * scale;
+        util.idle = static_cast<double>(delta[3]) * scale;
+        util.iowait = static_cast<double>(delta[4]) * scale;
+        util.steal = static_cast<double>(delta[7]) * scale;
+    }
+    return utilization_;
+}
+
+std::string_view proc_stat_reader::read_content() {
+    // procfs files are regenerated on each read starting at offset zero -> no need to seek or reopen the file
+    ssize_t num_bytes = 0;
+    do {
+        num_bytes = ::pread(fd_, buffer_.data(), buffer_.size(), 0);
+    } while (num_bytes < 0 && errno == EINTR);
+    if (num_bytes < 0) {
+        throw std::runtime_error{ fmt::format("Couldn't read \"{}\": {}", path_, std::strerror(errno)) };
+    }
+    return std::string_view{ buffer_.data(), static_cast<std::size_t>(num_bytes) };
+}
+
+}  // namespace hws::detail
@@ -0,0 +1,197 @@
+/**
+ * @author Marcel Breyer
+ * @copyright 2024-today All Rights Reserved
+ * @license This file is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ */
+
+#include "hws/cpu/rapl_reader.hpp"
+
+#include "hws/utility.hpp"  // hws::detail::{starts_with, trim, convert_to}
+
+#include "fmt/format.h"  // fmt::format
+
+#include <algorithm>     // std::any_of, std::count_if
+#include <array>         // std::array
+#include <cerrno>        // errno, EINTR
+#include <charconv>      // std::from_chars
+#include <chrono>        // std::chrono::steady_clock
+#include <cstddef>       // std::size_t
+#include <cstring>       // std::strerror
+#include <fcntl.h>       // ::open, O_RDONLY, O_CLOEXEC
+#include <filesystem>    // std::filesystem::{path, directory_iterator}
+#include <fstream>       // std::ifstream
+#include <optional>      // std::optional, std::nullopt
+#include <stdexcept>     // std::runtime_error
+#include <string>        // std::string, std::getline
+#include <string_view>   // std::string_view
+#include <system_error>  // std::errc
+#include <unistd.h>      // ::pread, ::close, ssize_t
+#include <utility>       // std::move
+
+namespace hws::detail {
+
+namespace {
+
+/**
+ * @brief Read the (unsigned) counter value from the already opened file @p fd.
+ * @param[in] fd the file descriptor
+ * @param[in] path the path of the file (only used in the error messages)
+ * @throws std::runtime_error if the file couldn't be read or doesn't contain a number
+ * @return the counter value (`[[nodiscard]]`)
+ */
+[[nodiscard]] unsigned long long read_counter(const int fd, const std::string &path) {
+    std::array<char, 32> buffer{};
+    ssize_t num_bytes = 0;
+    do {
+        num_bytes = ::pread(fd, buffer.data(), buffer.size(), 0);
+    } while (num_bytes < 0 && errno == EINTR);
+    if (num_bytes < 0) {
+        throw std::runtime_error{ fmt::format("Couldn't read \"{}\": {}", path, std::strerror(errno)) };
+    }
+
+    unsigned long long value{};
+    const auto [ptr, ec] = std::from_chars(buffer.data(), buffer.data() + num_bytes, value);
+    if (ec != std::errc{}) {
+        throw std::runtime_error{ fmt::format("Couldn't parse the content of \"{}\" as number!", path) };
+    }
+    return value;
+}
+
+/**
+ * @brief Read the first line of the file @p path.
+ * @param[in] path the path to the file
+ * @throws std::runtime_error if the file couldn't be read
+ * @return the trimmed first line (`[[nodiscard]]`)
+ */
+[[nodiscard]] std::string read_first_line(const std::filesystem::path &path) {
+    std::ifstream file{ path };
+    std::string line;
+    if (!file || !std::getline(file, line)) {
+        throw std::runtime_error{ fmt::format("Couldn't read \"{}\"!", path.string()) };
+    }
+    return std::string{ detail::trim(line) };
+}
+
+/**
+ * @brief Classify the RAPL zone using the content of its `name` file.
+ * @param[in] name the name of the zone, e.g., "package-0" or "dram"
+ * @return the RAPL domain or `std::nullopt` for zones not covering a single socket, e.g., "psys" (`[[nodiscard]]`)
+ */
+[[nodiscard]] std::optional<rapl_domain_type> classify_zone(const std::string_view name) noexcept {
+    if (detail::starts_with(name, "package")) {
+        return rapl_domain_type::package;
+    } else if (name == "core") {
+        return rapl_domain_type::core;
+    } else if (name == "uncore") {
+        return rapl_domain_type::uncore;
+    } else if (name == "dram") {
+        return rapl_domain_type::dram;
+    }
+    return std::nullopt;
+}
+
+}  // namespace
+
+rapl_reader::rapl_reader(const std::filesystem::path &powercap_root) {
+    try {
+        for (const std::filesystem::directory_entry &entry : std::filesystem::directory_iterator{ powercap_root }) {
+            // the subzones are also symlinked in the root directory
+            // the intel-rapl-mmio zones duplicate the package domains and are therefore ignored
+            const std::string zone = entry.path().filename().string();
+            if (!detail::starts_with(zone, "intel-rapl:")) {
+                continue;
+            }
+
+            const std::optional<rapl_domain_type> type = classify_zone(read_first_line(entry.path() / "name"));
+            if (!type.has_value()) {
+                continue;
+            }
+
+            domain dom{ type.value(), (entry.path() / "energy_uj").string(), -1, 0, 0, 0 };
+            dom.fd = ::open(dom.energy_path.c_str(), O_RDONLY | O_CLOEXEC);
+            if (dom.fd < 0) {
+                throw std::runtime_error{ fmt::format("Couldn't open \"{}\": {}", dom.energy_path, std::strerror(errno)) };
+            }
+            domains_.push_back(std::move(dom));
+
+            domain &added = domains_.back();
+            added.max_energy_range = detail::convert_to<unsigned long long>(read_first_line(entry.path() / "max_energy_range_uj"));
+            added.last_energy = read_counter(added.fd, added.energy_path);
+        }
+    } catch (...) {
+        this->close_all();
+        throw;
+    }
+
+    if (!this->has_domain(rapl_domain_type::package)) {
+        throw std::runtime_error{ fmt::format("Couldn't find any RAPL package domain in \"{}\"!", powercap_root.string()) };
+    }
+}
+
+rapl_reader::rapl_reader(rapl_reader &&other) noexcept :
+    domains_{ std::move(other.domains_) } {
+    other.domains_.clear();
+}
+
+rapl_reader &rapl_reader::operator=(rapl_reader &&other) noexcept {
+    if (this != &other) {
+        this->close_all();
+        domains_ = std::move(other.domains_);
+        other.domains_.clear();
+    }
+    return *this;
+}
+
+rapl_reader::~rapl_reader() {
+    this->close_all();
+}
+
+bool rapl_reader::has_domain(const rapl_domain_type type) const noexcept {
+    return std::any_of(domains_.cbegin(), domains_.cend(), [type](const domain &dom) { return dom.type == type; });
+}
+
+std::size_t rapl_reader::num_sockets() const noexcept {
+    return static_cast<std::size_t>(std::count_if(domains_.cbegin(), domains_.cend(), [](const domain &dom) { return dom.type == rapl_domain_type::package; }));
+}
+
+rapl_energy rapl_reader::read() {
+    rapl_energy energy{};
+    energy.time_point = std::chrono::steady_clock::now();
+
+    for (domain &dom : domains_) {
+        const unsigned long long current = read_counter(dom.fd, dom.energy_path);
+        // correct a wraparound of the energy counter
+        dom.accumulated_energy += current >= dom.last_energy ? current - dom.last_energy : dom.max_energy_range - dom.last_energy + current;
+        dom.last_energy = current;
+
+        // convert µJ to J
+        const double joule = static_cast<double>(dom.accumulated_energy) * 1e-6;
+        switch (dom.type) {
+            case rapl_domain_type::package:
+                energy.package += joule;
+                break;
+            case rapl_domain_type::core:
+                energy.core += joule;
+                break;
+            case rapl_domain_type::uncore:
+                energy.uncore += joule;
+                break;
+            case rapl_domain_type::dram:
+                energy.dram += joule;
+                break;
+        }
+    }
+    return energy;
+}
+
+void rapl_reader::close_all() noexcept {
+    for (const domain &dom : domains_) {
+        if (dom.fd >= 0) {
+            ::close(dom.fd);
+        }
+    }
+    domains_.clear();
+}
+
+}  // namespace hws::detail
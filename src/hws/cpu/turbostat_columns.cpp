@@ -0,0 +1,58 @@
+/**
+ * @author Marcel Breyer
+ * @copyright 2024-today All Rights Reserved
+ * @license This file is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ */
+
+#include "hws/cpu/turbostat_columns.hpp"
+
+#include "hws/sample_category.hpp"  // hws::sample_category
+
+#include <algorithm>    // std::upper_bound
+#include <cstddef>      // std::size_t
+#include <regex>        // std::regex, std::regex::extended, std::regex_match
+#include <string>       // std::string
+#include <string_view>  // std::string_view
+#include <utility>      // std::move
+#include <vector>       // std::vector
+
+namespace hws::detail {
+
+turbostat_column_table::turbostat_column_table(std::vector<std::string> header) :
+    header_{ std::move(header) },
+    named_(header_.size(), false) { }
+
+bool turbostat_column_table::is_idle_state_column(const std::string &name) {
+    // only compiled once -> the header is matched without constructing a regex per column
+    static const std::regex reg{ std::string{ "CPU%[0-9a-zA-Z]+|Pkg%[0-9a-zA-Z]+|Pk%[0-9a-zA-Z]+|C[0-9a-zA-Z]+%|C[0-9a-zA-Z]+" }, std::regex::extended };
+    return std::regex_match(name, reg);
+}
+
+void turbostat_column_table::read_row(const std::string_view row, const sample_category categories) const {
+    // walk the row once: skip to the cell of the next entry, convert it, and continue after it
+    std::size_t index = 0;
+    std::size_t cell_begin = 0;
+    for (const entry &e : entries_) {
+        for (; index < e.index; ++index) {
+            cell_begin = row.find('\t', cell_begin);
+            if (cell_begin == std::string_view::npos) {
+                // the row is shorter than the header
+                return;
+            }
+            ++cell_begin;
+        }
+        if (static_cast<int>(e.category & categories) == 0) {
+            continue;
+        }
+        const std::size_t cell_end = row.find('\t', cell_begin);
+        e.push_back(e.column, row.substr(cell_begin, cell_end == std::string_view::npos ? std::string_view::npos : cell_end - cell_begin));
+    }
+}
+
+void turbostat_column_table::insert(const entry &new_entry) {
+    const auto pos = std::upper_bound(entries_.begin(), entries_.end(), new_entry.index, [](const std::size_t index, const entry &e) { return index < e.index; });
+    entries_.insert(pos, new_entry);
+}
+
+}  // namespace hws::detail
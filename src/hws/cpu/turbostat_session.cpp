@@ -0,0 +1,147 @@
+/**
+ * @author Marcel Breyer
+ * @copyright 2024-today All Rights Reserved
+ * @license This file is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ */
+
+#include "hws/cpu/turbostat_session.hpp"
+
+#include "hws/utility.hpp"  // hws::detail::split_as
+
+#include "fmt/format.h"  // fmt::format
+
+#include <algorithm>    // std::count, std::transform
+#include <cctype>       // std::isalpha
+#include <cerrno>       // errno, EINTR, EAGAIN, EWOULDBLOCK
+#include <csignal>      // SIGTERM
+#include <cstddef>      // std::size_t
+#include <cstring>      // std::strerror
+#include <fcntl.h>      // ::fcntl, F_GETFL, F_SETFL, O_NONBLOCK, O_CLOEXEC
+#include <signal.h>     // ::kill
+#include <spawn.h>      // ::posix_spawnp, ::posix_spawn_file_actions_{init, adddup2, destroy}
+#include <stdexcept>    // std::invalid_argument, std::runtime_error
+#include <string>       // std::string
+#include <string_view>  // std::string_view
+#include <sys/wait.h>   // ::waitpid
+#include <unistd.h>     // ::pipe2, ::read, ::close, STDOUT_FILENO, STDERR_FILENO, environ
+#include <vector>       // std::vector
+
+namespace hws::detail {
+
+namespace {
+
+/**
+ * @brief Check whether the error code @p errc signals that a non-blocking read would block.
+ * @details POSIX allows EAGAIN and EWOULDBLOCK to be distinct values, but on most platforms (e.g., Linux) they are the same.
+ * @param[in] errc the error code to check
+ * @return `true` if no data is available at the moment, otherwise `false` (`[[nodiscard]]`)
+ */
+[[nodiscard]] constexpr bool would_block(const int errc) noexcept {
+#if EAGAIN != EWOULDBLOCK
+    return errc == EAGAIN || errc == EWOULDBLOCK;
+#else
+    return errc == EAGAIN;
+#endif
+}
+
+}  // namespace
+
+turbostat_session::turbostat_session(const std::vector<std::string> &cmd_line) {
+    if (cmd_line.empty()) {
+        throw std::invalid_argument{ "The command line of the turbostat session may not be empty!" };
+    }
+
+    // convert to pointers
+    std::vector<char *> cmd_ptr_split(cmd_line.size());
+    std::transform(cmd_line.cbegin(), cmd_line.cend(), cmd_ptr_split.begin(), [](const std::string &s) { return const_cast<char *>(s.c_str()); });
+    cmd_ptr_split.push_back(nullptr);  // posix_spawnp wants the array to be terminated by a nullptr
+
+    // create the pipe the stdout and stderr of the child process are redirected to
+    int pipe_fds[2]{};
+    if (::pipe2(pipe_fds, O_CLOEXEC) != 0) {
+        throw std::runtime_error{ fmt::format("Couldn't create the pipe for \"{}\": {}", cmd_line.front(), std::strerror(errno)) };
+    }
+
+    // spawn the child process; dup2 clears the O_CLOEXEC flag of the duplicated file descriptors
+    posix_spawn_file_actions_t actions{};
+    ::posix_spawn_file_actions_init(&actions);
+    ::posix_spawn_file_actions_adddup2(&actions, pipe_fds[1], STDOUT_FILENO);
+    ::posix_spawn_file_actions_adddup2(&actions, pipe_fds[1], STDERR_FILENO);
+    const int errc = ::posix_spawnp(&pid_, cmd_ptr_split.front(), &actions, nullptr, cmd_ptr_split.data(), environ);
+    ::posix_spawn_file_actions_destroy(&actions);
+    ::close(pipe_fds[1]);
+    if (errc != 0) {
+        ::close(pipe_fds[0]);
+        throw std::runtime_error{ fmt::format("Couldn't spawn \"{}\": {}", cmd_line.front(), std::strerror(errc)) };
+    }
+
+    // never block the sampling loop while reading
+    fd_ = pipe_fds[0];
+    ::fcntl(fd_, F_SETFL, ::fcntl(fd_, F_GETFL) | O_NONBLOCK);
+
+    pending_line_.reserve(read_buffer_.size());
+}
+
+turbostat_session::~turbostat_session() {
+    // closing the pipe lets the child process terminate due to SIGPIPE even if SIGTERM can't be delivered
+    ::close(fd_);
+    ::kill(pid_, SIGTERM);
+    while (::waitpid(pid_, nullptr, 0) < 0 && errno == EINTR) { }
+}
+
+bool turbostat_session::poll() {
+    bool new_row = false;
+    while (true) {
+        const ssize_t num_bytes = ::read(fd_, read_buffer_.data(), read_buffer_.size());
+        if (num_bytes > 0) {
+            new_row |= this->parse(std::string_view{ read_buffer_.data(), static_cast<std::size_t>(num_bytes) });
+        } else if (num_bytes == 0) {
+            throw std::runtime_error{ "The turbostat session has exited unexpectedly!" };
+        } else if (would_block(errno)) {
+            // no more output available
+            return new_row;
+        } else if (errno != EINTR) {
+            throw std::runtime_error{ fmt::format("Couldn't read the output of the turbostat session: {}", std::strerror(errno)) };
+        }
+    }
+}
+
+bool turbostat_session::parse(const std::string_view output) {
+    pending_line_.append(output);
+
+    // parse all complete lines, keep the incomplete rest for the next call
+    bool new_row = false;
+    std::size_t line_begin = 0;
+    for (std::size_t newline = pending_line_.find('\n'); newline != std::string::npos; newline = pending_line_.find('\n', line_begin)) {
+        new_row |= this->parse_line(std::string_view{ pending_line_ }.substr(line_begin, newline - line_begin));
+        line_begin = newline + 1;
+    }
+    pending_line_.erase(0, line_begin);
+    return new_row;
+}
+
+bool turbostat_session::parse_line(std::string_view line) {
+    if (!line.empty() && line.back() == '\r') {
+        line.remove_suffix(1);
+    }
+    // only tab-separated lines are part of the turbostat table
+    if (line.find('\t') == std::string_view::npos) {
+        return false;
+    }
+
+    if (std::isalpha(static_cast<unsigned char>(line.front()))) {
+        // the header names the columns, e.g., "Avg_MHz\tBusy%\t..."
+        header_ = detail::split_as<std::string>(line, '\t');
+        ++num_headers_;
+        return false;
+    } else if (static_cast<std::size_t>(std::count(line.cbegin(), line.cend(), '\t')) + 1 == header_.size()) {
+        // assign reuses the capacity of the previous row
+        latest_row_.assign(line);
+        ++num_rows_;
+        return true;
+    }
+    return false;
+}
+
+}  // namespace hws::detail
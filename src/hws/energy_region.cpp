@@ -0,0 +1,82 @@
+/**
+ * @author Marcel Breyer
+ * @copyright 2024-today All Rights Reserved
+ * @license This file is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ */
+
+#include "hws/energy_region.hpp"
+
+#include "fmt/chrono.h"  // direct formatting of std::chrono types
+#include "fmt/format.h"  // fmt::format
+
+#include <chrono>    // std::chrono::{nanoseconds, duration_cast, duration}
+#include <optional>  // std::optional, std::nullopt
+#include <ostream>   // std::ostream
+#include <string>    // std::string
+
+namespace hws {
+
+std::chrono::nanoseconds energy_region::duration() const noexcept {
+    if (!this->finished()) {
+        return std::chrono::nanoseconds{ 0 };
+    }
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(end_time_point.value() - begin_time_point);
+}
+
+std::optional<double> energy_region::energy() const noexcept {
+    if (!this->finished()) {
+        return std::nullopt;
+    }
+    if (begin_energy.has_value() && end_energy.has_value()) {
+        return end_energy.value() - begin_energy.value();
+    }
+    // no energy counter available -> approximate the energy as (Mean Power [W]) * (Duration [s])
+    const std::optional<double> power = this->mean_power();
+    if (!power.has_value()) {
+        return std::nullopt;
+    }
+    return power.value() * std::chrono::duration<double>{ this->duration() }.count();
+}
+
+std::optional<double> energy_region::average_power() const noexcept {
+    const std::optional<double> region_energy = this->energy();
+    if (!region_energy.has_value() || this->duration() == std::chrono::nanoseconds{ 0 }) {
+        return std::nullopt;
+    }
+    // calculate the average power draw as (Energy [J]) / (Duration [s])
+    return region_energy.value() / std::chrono::duration<double>{ this->duration() }.count();
+}
+
+std::optional<double> energy_region::mean_power() const noexcept {
+    if (num_power_samples == 0) {
+        return std::nullopt;
+    }
+    return total_power / static_cast<double>(num_power_samples);
+}
+
+std::ostream &operator<<(std::ostream &out, const energy_region &region) {
+    const auto value_or_unknown = [](const std::optional<double> &value) {
+        return value.has_value() ? fmt::format("{}", value.value()) : std::string{ "unknown" };
+    };
+    return out << fmt::format("name: {}\n"
+                              "depth: {}\n"
+                              "duration: {}\n"
+                              "energy: {}\n"
+                              "average_power: {}\n"
+                              "num_samples: {}\n"
+                              "mean_power: {}\n"
+                              "max_power: {}\n"
+                              "max_temperature: {}",
+                              region.name,
+                              region.depth,
+                              region.duration(),
+                              value_or_unknown(region.energy()),
+                              value_or_unknown(region.average_power()),
+                              region.num_samples,
+                              value_or_unknown(region.mean_power()),
+                              value_or_unknown(region.max_power),
+                              value_or_unknown(region.max_temperature));
+}
+
+}  // namespace hws
@@ -0,0 +1,51 @@
+/**
+ * @author Marcel Breyer
+ * @copyright 2024-today All Rights Reserved
+ * @license This file is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ */
+
+#include "hws/event_queue.hpp"
+
+#include "hws/event.hpp"  // hws::event
+
+#include <atomic>   // std::memory_order_acq_rel, std::memory_order_release, std::memory_order_acquire
+#include <chrono>   // std::chrono::steady_clock::time_point
+#include <utility>  // std::move
+#include <vector>   // std::vector
+
+namespace hws::detail {
+
+event_queue::event_queue() :
+    head_{ new node{ event{ std::chrono::steady_clock::time_point{}, "" } } },
+    tail_{ head_.load() } { }
+
+event_queue::~event_queue() {
+    // delete the stub node and all nodes that have not been drained yet
+    while (tail_ != nullptr) {
+        node *next = tail_->next.load(std::memory_order_acquire);
+        delete tail_;
+        tail_ = next;
+    }
+}
+
+void event_queue::push(event e) {
+    node *n = new node{ std::move(e) };
+    // link the new node to its predecessor -> other producers never wait for each other
+    node *prev = head_.exchange(n, std::memory_order_acq_rel);
+    prev->next.store(n, std::memory_order_release);
+}
+
+void event_queue::drain(std::vector<event> &events) {
+    // a producer that already exchanged the head but not yet linked its node is picked up by the next drain
+    node *next = tail_->next.load(std::memory_order_acquire);
+    while (next != nullptr) {
+        events.push_back(std::move(next->e));
+        delete tail_;
+        // the drained node becomes the new stub node
+        tail_ = next;
+        next = tail_->next.load(std::memory_order_acquire);
+    }
+}
+
+}  // namespace hws::detail
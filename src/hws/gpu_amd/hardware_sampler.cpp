@@ -11,6 +11,7 @@
 #include "hws/gpu_amd/utility.hpp"           // hws::detail::performance_level_to_string, HWS_ROCM_SMI_ERROR_CHECK
 #include "hws/hardware_sampler.hpp"          // hws::hardware_sampler
 #include "hws/sample_category.hpp"           // hws::sample_category
+#include "hws/sample_metric.hpp"             // hws::detail::{append_numeric_sample_names, append_latest_numeric_sample_values}
 #include "hws/utility.hpp"                   // hws::detail::time_points_to_epoch
 
 #include "fmt/chrono.h"           // direct formatting of std::chrono types
@@ -19,17 +20,16 @@
 #include "hip/hip_runtime_api.h"  // HIP runtime functions
 #include "rocm_smi/rocm_smi.h"    // ROCm SMI runtime functions
 
-#include <chrono>     // std::chrono::{steady_clock, duration_cast, milliseconds}
+#include <chrono>     // std::chrono::{steady_clock, duration_cast, nanoseconds}
 #include <cstddef>    // std::size_t
 #include <cstdint>    // std::uint32_t, std::uint64_t
 #include <exception>  // std::exception, std::terminate
 #include <ios>        // std::ios_base
 #include <iostream>   // std::cerr, std::endl
-#include <optional>   // std::optional
+#include <optional>   // std::optional, std::nullopt
 #include <ostream>    // std::ostream
 #include <stdexcept>  // std::runtime_error
 #include <string>     // std::string
-#include <thread>     // std::this_thread
 #include <utility>    // std::move
 #include <vector>     // std::vector
 
@@ -41,10 +41,10 @@ gpu_amd_hardware_sampler::gpu_amd_hardware_sampler(const sample_category categor
 gpu_amd_hardware_sampler::gpu_amd_hardware_sampler(const std::size_t device_id, const sample_category category) :
     gpu_amd_hardware_sampler{ device_id, HWS_SAMPLING_INTERVAL, category } { }
 
-gpu_amd_hardware_sampler::gpu_amd_hardware_sampler(const std::chrono::milliseconds sampling_interval, const sample_category category) :
+gpu_amd_hardware_sampler::gpu_amd_hardware_sampler(const std::chrono::nanoseconds sampling_interval, const sample_category category) :
     gpu_amd_hardware_sampler{ 0, sampling_interval, category } { }
 
-gpu_amd_hardware_sampler::gpu_amd_hardware_sampler(const std::size_t device_id, const std::chrono::milliseconds sampling_interval, const sample_category category) :
+gpu_amd_hardware_sampler::gpu_amd_hardware_sampler(const std::size_t device_id, const std::chrono::nanoseconds sampling_interval, const sample_category category) :
     hardware_sampler{ sampling_interval, category },
     device_id_{ static_cast<std::uint32_t>(device_id) } {
     // make sure that rsmi_init is only called once for all instances
@@ -78,15 +78,11 @@ gpu_amd_hardware_sampler::~gpu_amd_hardware_sampler() {
     }
 }
 
-void gpu_amd_hardware_sampler::sampling_loop() {
+void gpu_amd_hardware_sampler::initialize_samples() {
     //
     // add samples where we only have to retrieve the value once
     //
 
-    this->add_time_point(std::chrono::steady_clock::now());
-
-    double initial_total_power_consumption{};  // initial total power consumption in J
-
     // retrieve initial general information
     if (this->sample_category_enabled(sample_category::general)) {
         // fixed information -> only retrieved once
@@ -112,17 +108,17 @@ void gpu_amd_hardware_sampler::sampling_loop() {
         // queried samples -> retrieved every iteration if available
         rsmi_dev_perf_level_t pstate{};
         if (rsmi_dev_perf_level_get(device_id_, &pstate) == RSMI_STATUS_SUCCESS) {
-            general_samples_.performance_level_ = decltype(general_samples_.performance_level_)::value_type{ detail::performance_level_to_string(pstate) };
+            general_samples_.performance_level_ = decltype(general_samples_.performance_level_)::value_type{ this->column_config(), { detail::performance_level_to_string(pstate) } };
         }
 
         decltype(general_samples_.compute_utilization_)::value_type::value_type utilization_gpu{};
         if (rsmi_dev_busy_percent_get(device_id_, &utilization_gpu) == RSMI_STATUS_SUCCESS) {
-            general_samples_.compute_utilization_ = decltype(general_samples_.compute_utilization_)::value_type{ utilization_gpu };
+            general_samples_.compute_utilization_ = decltype(general_samples_.compute_utilization_)::value_type{ this->column_config(), { utilization_gpu } };
         }
 
         decltype(general_samples_.memory_utilization_)::value_type::value_type utilization_mem{};
         if (rsmi_dev_memory_busy_percent_get(device_id_, &utilization_mem) == RSMI_STATUS_SUCCESS) {
-            general_samples_.memory_utilization_ = decltype(general_samples_.memory_utilization_)::value_type{ utilization_mem };
+            general_samples_.memory_utilization_ = decltype(general_samples_.memory_utilization_)::value_type{ this->column_config(), { utilization_mem } };
         }
     }
 
@@ -139,7 +135,7 @@ void gpu_amd_hardware_sampler::sampling_loop() {
             clock_samples_.available_clock_frequencies_ = frequencies;
 
             // queried samples -> retrieved every iteration if available
-            clock_samples_.clock_frequency_ = decltype(clock_samples_.clock_frequency_)::value_type{};
+            clock_samples_.clock_frequency_ = decltype(clock_samples_.clock_frequency_)::value_type{ this->column_config() };
             if (frequency_info.current < RSMI_MAX_NUM_FREQUENCIES) {
                 clock_samples_.clock_frequency_->push_back(static_cast<decltype(clock_samples_.clock_frequency_)::value_type::value_type>(frequency_info.frequency[frequency_info.current]) / 1000'000.0);
             } else {
@@ -151,7 +147,7 @@ void gpu_amd_hardware_sampler::sampling_loop() {
             clock_samples_.socket_clock_frequency_min_ = static_cast<decltype(clock_samples_.socket_clock_frequency_min_)::value_type>(frequency_info.frequency[0]) / 1000'000.0;
             clock_samples_.socket_clock_frequency_max_ = static_cast<decltype(clock_samples_.socket_clock_frequency_max_)::value_type>(frequency_info.frequency[frequency_info.num_supported - 1]) / 1000'000.0;
             // queried samples -> retrieved every iteration if available
-            clock_samples_.socket_clock_frequency_ = decltype(clock_samples_.socket_clock_frequency_)::value_type{};
+            clock_samples_.socket_clock_frequency_ = decltype(clock_samples_.socket_clock_frequency_)::value_type{ this->column_config() };
             if (frequency_info.current < RSMI_MAX_NUM_FREQUENCIES) {
                 clock_samples_.socket_clock_frequency_->push_back(static_cast<decltype(clock_samples_.socket_clock_frequency_)::value_type::value_type>(frequency_info.frequency[frequency_info.current]) / 1000'000.0);
             } else {
@@ -169,7 +165,7 @@ void gpu_amd_hardware_sampler::sampling_loop() {
             clock_samples_.available_memory_clock_frequencies_ = frequencies;
 
             // queried samples -> retrieved every iteration if available
-            clock_samples_.memory_clock_frequency_ = decltype(clock_samples_.memory_clock_frequency_)::value_type{};
+            clock_samples_.memory_clock_frequency_ = decltype(clock_samples_.memory_clock_frequency_)::value_type{ this->column_config() };
             if (frequency_info.current < RSMI_MAX_NUM_FREQUENCIES) {
                 clock_samples_.memory_clock_frequency_->push_back(static_cast<decltype(clock_samples_.memory_clock_frequency_)::value_type::value_type>(frequency_info.frequency[frequency_info.current]) / 1000'000.0);
             } else {
@@ -180,12 +176,12 @@ void gpu_amd_hardware_sampler::sampling_loop() {
         // queried samples -> retrieved every iteration if available
         decltype(clock_samples_.overdrive_level_)::value_type::value_type overdrive_level{};
         if (rsmi_dev_overdrive_level_get(device_id_, &overdrive_level) == RSMI_STATUS_SUCCESS) {
-            clock_samples_.overdrive_level_ = decltype(clock_samples_.overdrive_level_)::value_type{ overdrive_level };
+            clock_samples_.overdrive_level_ = decltype(clock_samples_.overdrive_level_)::value_type{ this->column_config(), { overdrive_level } };
         }
 
         decltype(clock_samples_.memory_overdrive_level_)::value_type::value_type memory_overdrive_level{};
         if (rsmi_dev_mem_overdrive_level_get(device_id_, &memory_overdrive_level) == RSMI_STATUS_SUCCESS) {
-            clock_samples_.memory_overdrive_level_ = decltype(clock_samples_.memory_overdrive_level_)::value_type{ memory_overdrive_level };
+            clock_samples_.memory_overdrive_level_ = decltype(clock_samples_.memory_overdrive_level_)::value_type{ this->column_config(), { memory_overdrive_level } };
         }
     }
 
@@ -217,7 +213,7 @@ void gpu_amd_hardware_sampler::sampling_loop() {
                         break;
                 }
                 // report power usage since the first sample
-                power_samples_.power_usage_ = decltype(power_samples_.power_usage_)::value_type{ static_cast<decltype(power_samples_.power_usage_)::value_type::value_type>(power_usage) / 1000'000.0 };
+                power_samples_.power_usage_ = decltype(power_samples_.power_usage_)::value_type{ this->column_config(), { static_cast<decltype(power_samples_.power_usage_)::value_type::value_type>(power_usage) / 1000'000.0 } };
             }
         }
 
@@ -251,28 +247,28 @@ void gpu_amd_hardware_sampler::sampling_loop() {
             // queried samples -> retrieved every iteration if available
             switch (power_profile.current) {
                 case RSMI_PWR_PROF_PRST_CUSTOM_MASK:
-                    power_samples_.power_profile_ = decltype(power_samples_.power_profile_)::value_type{ "CUSTOM" };
+                    power_samples_.power_profile_ = decltype(power_samples_.power_profile_)::value_type{ this->column_config(), { "CUSTOM" } };
                     break;
                 case RSMI_PWR_PROF_PRST_VIDEO_MASK:
-                    power_samples_.power_profile_ = decltype(power_samples_.power_profile_)::value_type{ "VIDEO" };
+                    power_samples_.power_profile_ = decltype(power_samples_.power_profile_)::value_type{ this->column_config(), { "VIDEO" } };
                     break;
                 case RSMI_PWR_PROF_PRST_POWER_SAVING_MASK:
-                    power_samples_.power_profile_ = decltype(power_samples_.power_profile_)::value_type{ "POWER_SAVING" };
+                    power_samples_.power_profile_ = decltype(power_samples_.power_profile_)::value_type{ this->column_config(), { "POWER_SAVING" } };
                     break;
                 case RSMI_PWR_PROF_PRST_COMPUTE_MASK:
-                    power_samples_.power_profile_ = decltype(power_samples_.power_profile_)::value_type{ "COMPUTE" };
+                    power_samples_.power_profile_ = decltype(power_samples_.power_profile_)::value_type{ this->column_config(), { "COMPUTE" } };
                     break;
                 case RSMI_PWR_PROF_PRST_VR_MASK:
-                    power_samples_.power_profile_ = decltype(power_samples_.power_profile_)::value_type{ "VR" };
+                    power_samples_.power_profile_ = decltype(power_samples_.power_profile_)::value_type{ this->column_config(), { "VR" } };
                     break;
                 case RSMI_PWR_PROF_PRST_3D_FULL_SCR_MASK:
-                    power_samples_.power_profile_ = decltype(power_samples_.power_profile_)::value_type{ "3D_FULL_SCREEN" };
+                    power_samples_.power_profile_ = decltype(power_samples_.power_profile_)::value_type{ this->column_config(), { "3D_FULL_SCREEN" } };
                     break;
                 case RSMI_PWR_PROF_PRST_BOOTUP_DEFAULT:
-                    power_samples_.power_profile_ = decltype(power_samples_.power_profile_)::value_type{ "BOOTUP_DEFAULT" };
+                    power_samples_.power_profile_ = decltype(power_samples_.power_profile_)::value_type{ this->column_config(), { "BOOTUP_DEFAULT" } };
                     break;
                 case RSMI_PWR_PROF_PRST_INVALID:
-                    power_samples_.power_profile_ = decltype(power_samples_.power_profile_)::value_type{ "INVALID" };
+                    power_samples_.power_profile_ = decltype(power_samples_.power_profile_)::value_type{ this->column_config(), { "INVALID" } };
                     break;
             }
         }
@@ -283,11 +279,11 @@ void gpu_amd_hardware_sampler::sampling_loop() {
         std::uint64_t power_total_energy_consumption{};
         if (rsmi_dev_energy_count_get(device_id_, &power_total_energy_consumption, &resolution, &timestamp) == RSMI_STATUS_SUCCESS) {
             const auto scaled_value = static_cast<decltype(power_samples_.power_total_energy_consumption_)::value_type::value_type>(power_total_energy_consumption) * static_cast<decltype(power_samples_.power_total_energy_consumption_)::value_type::value_type>(resolution);
-            initial_total_power_consumption = scaled_value / 1000'000.0;
-            power_samples_.power_total_energy_consumption_ = decltype(power_samples_.power_total_energy_consumption_)::value_type{ 0.0 };
+            initial_total_power_consumption_ = scaled_value / 1000'000.0;
+            power_samples_.power_total_energy_consumption_ = decltype(power_samples_.power_total_energy_consumption_)::value_type{ this->column_config(), { 0.0 } };
         } else if (power_samples_.power_usage_.has_value()) {
             // if the total energy consumption cannot be retrieved, but the current power draw, approximate it
-            power_samples_.power_total_energy_consumption_ = decltype(power_samples_.power_total_energy_consumption_)::value_type{ 0.0 };
+            power_samples_.power_total_energy_consumption_ = decltype(power_samples_.power_total_energy_consumption_)::value_type{ this->column_config(), { 0.0 } };
         }
     }
 
@@ -311,8 +307,8 @@ void gpu_amd_hardware_sampler::sampling_loop() {
             memory_samples_.pcie_link_transfer_rate_max_ = bandwidth_info.transfer_rate.frequency[bandwidth_info.transfer_rate.num_supported - 1] / 1'000'000;
 
             // queried samples -> retrieved every iteration if available
-            memory_samples_.pcie_link_transfer_rate_ = decltype(memory_samples_.pcie_link_transfer_rate_)::value_type{};
-            memory_samples_.num_pcie_lanes_ = decltype(memory_samples_.num_pcie_lanes_)::value_type{};
+            memory_samples_.pcie_link_transfer_rate_ = decltype(memory_samples_.pcie_link_transfer_rate_)::value_type{ this->column_config() };
+            memory_samples_.num_pcie_lanes_ = decltype(memory_samples_.num_pcie_lanes_)::value_type{ this->column_config() };
             if (bandwidth_info.transfer_rate.current < RSMI_MAX_NUM_FREQUENCIES) {
                 memory_samples_.pcie_link_transfer_rate_->push_back(bandwidth_info.transfer_rate.frequency[bandwidth_info.transfer_rate.current] / 1'000'000);
                 memory_samples_.num_pcie_lanes_->push_back(bandwidth_info.lanes[bandwidth_info.transfer_rate.current]);
@@ -326,9 +322,9 @@ void gpu_amd_hardware_sampler::sampling_loop() {
         // queried samples -> retrieved every iteration if available
         decltype(memory_samples_.memory_used_)::value_type::value_type memory_used{};
         if (rsmi_dev_memory_usage_get(device_id_, RSMI_MEM_TYPE_VRAM, &memory_used) == RSMI_STATUS_SUCCESS) {
-            memory_samples_.memory_used_ = decltype(memory_samples_.memory_used_)::value_type{ memory_used };
+            memory_samples_.memory_used_ = decltype(memory_samples_.memory_used_)::value_type{ this->column_config(), { memory_used } };
             if (memory_samples_.memory_total_.has_value()) {
-                memory_samples_.memory_free_ = decltype(memory_samples_.memory_used_)::value_type{ memory_samples_.memory_total_.value() - memory_samples_.memory_used_->front() };
+                memory_samples_.memory_free_ = decltype(memory_samples_.memory_used_)::value_type{ this->column_config(), { memory_samples_.memory_total_.value() - memory_samples_.memory_used_->front() } };
             }
         }
     }
@@ -341,7 +337,7 @@ void gpu_amd_hardware_sampler::sampling_loop() {
             if (fan_id == 0) {
                 // queried samples -> retrieved every iteration if available
                 const auto percentage = static_cast<decltype(temperature_samples_.fan_speed_percentage_)::value_type::value_type>(fan_speed) / static_cast<decltype(temperature_samples_.fan_speed_percentage_)::value_type::value_type>(RSMI_MAX_FAN_SPEED);
-                temperature_samples_.fan_speed_percentage_ = decltype(temperature_samples_.fan_speed_percentage_)::value_type{ percentage };
+                temperature_samples_.fan_speed_percentage_ = decltype(temperature_samples_.fan_speed_percentage_)::value_type{ this->column_config(), { percentage } };
             }
             ++fan_id;
         }
@@ -425,266 +421,311 @@ void gpu_amd_hardware_sampler::sampling_loop() {
         // queried samples -> retrieved every iteration if available
         std::int64_t temperature{};
         if (rsmi_dev_temp_metric_get(device_id_, RSMI_TEMP_TYPE_EDGE, RSMI_TEMP_CURRENT, &temperature) == RSMI_STATUS_SUCCESS) {
-            temperature_samples_.temperature_ = decltype(temperature_samples_.temperature_)::value_type{ static_cast<decltype(temperature_samples_.temperature_)::value_type::value_type>(temperature) / 1000.0 };
+            temperature_samples_.temperature_ = decltype(temperature_samples_.temperature_)::value_type{ this->column_config(), { static_cast<decltype(temperature_samples_.temperature_)::value_type::value_type>(temperature) / 1000.0 } };
         }
 
         std::int64_t hotspot_temperature{};
         if (rsmi_dev_temp_metric_get(device_id_, RSMI_TEMP_TYPE_JUNCTION, RSMI_TEMP_CURRENT, &hotspot_temperature) == RSMI_STATUS_SUCCESS) {
-            temperature_samples_.hotspot_temperature_ = decltype(temperature_samples_.hotspot_temperature_)::value_type{ static_cast<decltype(temperature_samples_.hotspot_temperature_)::value_type::value_type>(hotspot_temperature) / 1000.0 };
+            temperature_samples_.hotspot_temperature_ = decltype(temperature_samples_.hotspot_temperature_)::value_type{ this->column_config(), { static_cast<decltype(temperature_samples_.hotspot_temperature_)::value_type::value_type>(hotspot_temperature) / 1000.0 } };
         }
 
         std::int64_t memory_temperature{};
         if (rsmi_dev_temp_metric_get(device_id_, RSMI_TEMP_TYPE_MEMORY, RSMI_TEMP_CURRENT, &memory_temperature) == RSMI_STATUS_SUCCESS) {
-            temperature_samples_.memory_temperature_ = decltype(temperature_samples_.memory_temperature_)::value_type{ static_cast<decltype(temperature_samples_.memory_temperature_)::value_type::value_type>(memory_temperature) / 1000.0 };
+            temperature_samples_.memory_temperature_ = decltype(temperature_samples_.memory_temperature_)::value_type{ this->column_config(), { static_cast<decltype(temperature_samples_.memory_temperature_)::value_type::value_type>(memory_temperature) / 1000.0 } };
         }
 
         std::int64_t hbm_0_temperature{};
         if (rsmi_dev_temp_metric_get(device_id_, RSMI_TEMP_TYPE_HBM_0, RSMI_TEMP_CURRENT, &hbm_0_temperature) == RSMI_STATUS_SUCCESS) {
-            temperature_samples_.hbm_0_temperature_ = decltype(temperature_samples_.hbm_0_temperature_)::value_type{ static_cast<decltype(temperature_samples_.hbm_0_temperature_)::value_type::value_type>(hbm_0_temperature) / 1000.0 };
+            temperature_samples_.hbm_0_temperature_ = decltype(temperature_samples_.hbm_0_temperature_)::value_type{ this->column_config(), { static_cast<decltype(temperature_samples_.hbm_0_temperature_)::value_type::value_type>(hbm_0_temperature) / 1000.0 } };
         }
 
         std::int64_t hbm_1_temperature{};
         if (rsmi_dev_temp_metric_get(device_id_, RSMI_TEMP_TYPE_HBM_1, RSMI_TEMP_CURRENT, &hbm_1_temperature) == RSMI_STATUS_SUCCESS) {
-            temperature_samples_.hbm_1_temperature_ = decltype(temperature_samples_.hbm_1_temperature_)::value_type{ static_cast<decltype(temperature_samples_.hbm_1_temperature_)::value_type::value_type>(hbm_1_temperature) / 1000.0 };
+            temperature_samples_.hbm_1_temperature_ = decltype(temperature_samples_.hbm_1_temperature_)::value_type{ this->column_config(), { static_cast<decltype(temperature_samples_.hbm_1_temperature_)::value_type::value_type>(hbm_1_temperature) / 1000.0 } };
         }
 
         std::int64_t hbm_2_temperature{};
         if (rsmi_dev_temp_metric_get(device_id_, RSMI_TEMP_TYPE_HBM_2, RSMI_TEMP_CURRENT, &hbm_2_temperature) == RSMI_STATUS_SUCCESS) {
-            temperature_samples_.hbm_2_temperature_ = decltype(temperature_samples_.hbm_2_temperature_)::value_type{ static_cast<decltype(temperature_samples_.hbm_2_temperature_)::value_type::value_type>(hbm_2_temperature) / 1000.0 };
+            temperature_samples_.hbm_2_temperature_ = decltype(temperature_samples_.hbm_2_temperature_)::value_type{ this->column_config(), { static_cast<decltype(temperature_samples_.hbm_2_temperature_)::value_type::value_type>(hbm_2_temperature) / 1000.0 } };
         }
 
         std::int64_t hbm_3_temperature{};
         if (rsmi_dev_temp_metric_get(device_id_, RSMI_TEMP_TYPE_HBM_3, RSMI_TEMP_CURRENT, &hbm_3_temperature) == RSMI_STATUS_SUCCESS) {
-            temperature_samples_.hbm_3_temperature_ = decltype(temperature_samples_.hbm_3_temperature_)::value_type{ static_cast<decltype(temperature_samples_.hbm_3_temperature_)::value_type::value_type>(hbm_3_temperature) / 1000.0 };
+            temperature_samples_.hbm_3_temperature_ = decltype(temperature_samples_.hbm_3_temperature_)::value_type{ this->column_config(), { static_cast<decltype(temperature_samples_.hbm_3_temperature_)::value_type::value_type>(hbm_3_temperature) / 1000.0 } };
         }
     }
 
-    //
-    // loop until stop_sampling() is called
-    //
+    // drop the queried samples that haven't been selected -> their ROCm SMI calls are skipped in the sampling loop
+    if (this->uses_sample_metric_selection()) {
+        this->apply_sample_metric_selection(general_samples_);
+        this->apply_sample_metric_selection(clock_samples_);
+        this->apply_sample_metric_selection(power_samples_);
+        this->apply_sample_metric_selection(memory_samples_);
+        this->apply_sample_metric_selection(temperature_samples_);
+    }
+}
 
-    while (!this->has_sampling_stopped()) {
-        // only sample values if the sampler currently isn't paused
-        if (this->is_sampling()) {
-            // add current time point
-            this->add_time_point(std::chrono::steady_clock::now());
-
-            // retrieve general samples
-            if (this->sample_category_enabled(sample_category::general)) {
-                if (general_samples_.performance_level_.has_value()) {
-                    rsmi_dev_perf_level_t pstate{};
-                    HWS_ROCM_SMI_ERROR_CHECK(rsmi_dev_perf_level_get(device_id_, &pstate))
-                    general_samples_.performance_level_->push_back(detail::performance_level_to_string(pstate));
-                }
+void gpu_amd_hardware_sampler::sample() {
+    // retrieve general samples
+    if (this->sample_category_due(sample_category::general)) {
+        if (general_samples_.performance_level_.has_value()) {
+            rsmi_dev_perf_level_t pstate{};
+            HWS_ROCM_SMI_ERROR_CHECK(rsmi_dev_perf_level_get(device_id_, &pstate))
+            general_samples_.performance_level_->push_back(detail::performance_level_to_string(pstate));
+        }
 
-                if (general_samples_.compute_utilization_.has_value()) {
-                    decltype(general_samples_.compute_utilization_)::value_type::value_type value{};
-                    HWS_ROCM_SMI_ERROR_CHECK(rsmi_dev_busy_percent_get(device_id_, &value))
-                    general_samples_.compute_utilization_->push_back(value);
-                }
+        if (general_samples_.compute_utilization_.has_value()) {
+            decltype(general_samples_.compute_utilization_)::value_type::value_type value{};
+            HWS_ROCM_SMI_ERROR_CHECK(rsmi_dev_busy_percent_get(device_id_, &value))
+            general_samples_.compute_utilization_->push_back(value);
+        }
 
-                if (general_samples_.memory_utilization_.has_value()) {
-                    decltype(general_samples_.memory_utilization_)::value_type::value_type value{};
-                    HWS_ROCM_SMI_ERROR_CHECK(rsmi_dev_memory_busy_percent_get(device_id_, &value))
-                    general_samples_.memory_utilization_->push_back(value);
-                }
+        if (general_samples_.memory_utilization_.has_value()) {
+            decltype(general_samples_.memory_utilization_)::value_type::value_type value{};
+            HWS_ROCM_SMI_ERROR_CHECK(rsmi_dev_memory_busy_percent_get(device_id_, &value))
+            general_samples_.memory_utilization_->push_back(value);
+        }
+
+        this->track_sample_change(sample_category::general, general_samples_.compute_utilization_);
+    }
+
+    // retrieve clock related samples
+    if (this->sample_category_due(sample_category::clock)) {
+        if (clock_samples_.clock_frequency_.has_value()) {
+            rsmi_frequencies_t frequency_info{};
+            HWS_ROCM_SMI_ERROR_CHECK(rsmi_dev_gpu_clk_freq_get(device_id_, RSMI_CLK_TYPE_SYS, &frequency_info))
+            if (frequency_info.current < RSMI_MAX_NUM_FREQUENCIES) {
+                clock_samples_.clock_frequency_->push_back(static_cast<decltype(clock_samples_.clock_frequency_)::value_type::value_type>(frequency_info.frequency[frequency_info.current]) / 1000'000.0);
+            } else {
+                // the current index is (somehow) wrong
+                clock_samples_.clock_frequency_->push_back(0);
             }
+        }
 
-            // retrieve clock related samples
-            if (this->sample_category_enabled(sample_category::clock)) {
-                if (clock_samples_.clock_frequency_.has_value()) {
-                    rsmi_frequencies_t frequency_info{};
-                    HWS_ROCM_SMI_ERROR_CHECK(rsmi_dev_gpu_clk_freq_get(device_id_, RSMI_CLK_TYPE_SYS, &frequency_info))
-                    if (frequency_info.current < RSMI_MAX_NUM_FREQUENCIES) {
-                        clock_samples_.clock_frequency_->push_back(static_cast<decltype(clock_samples_.clock_frequency_)::value_type::value_type>(frequency_info.frequency[frequency_info.current]) / 1000'000.0);
-                    } else {
-                        // the current index is (somehow) wrong
-                        clock_samples_.clock_frequency_->push_back(0);
-                    }
-                }
+        if (clock_samples_.socket_clock_frequency_.has_value()) {
+            rsmi_frequencies_t frequency_info{};
+            HWS_ROCM_SMI_ERROR_CHECK(rsmi_dev_gpu_clk_freq_get(device_id_, RSMI_CLK_TYPE_SOC, &frequency_info))
+            if (frequency_info.current < RSMI_MAX_NUM_FREQUENCIES) {
+                clock_samples_.socket_clock_frequency_->push_back(static_cast<decltype(clock_samples_.socket_clock_frequency_)::value_type::value_type>(frequency_info.frequency[frequency_info.current]) / 1000'000.0);
+            } else {
+                // the current index is (somehow) wrong
+                clock_samples_.socket_clock_frequency_->push_back(0);
+            }
+        }
 
-                if (clock_samples_.socket_clock_frequency_.has_value()) {
-                    rsmi_frequencies_t frequency_info{};
-                    HWS_ROCM_SMI_ERROR_CHECK(rsmi_dev_gpu_clk_freq_get(device_id_, RSMI_CLK_TYPE_SOC, &frequency_info))
-                    if (frequency_info.current < RSMI_MAX_NUM_FREQUENCIES) {
-                        clock_samples_.socket_clock_frequency_->push_back(static_cast<decltype(clock_samples_.socket_clock_frequency_)::value_type::value_type>(frequency_info.frequency[frequency_info.current]) / 1000'000.0);
-                    } else {
-                        // the current index is (somehow) wrong
-                        clock_samples_.socket_clock_frequency_->push_back(0);
-                    }
-                }
+        if (clock_samples_.memory_clock_frequency_.has_value()) {
+            rsmi_frequencies_t frequency_info{};
+            HWS_ROCM_SMI_ERROR_CHECK(rsmi_dev_gpu_clk_freq_get(device_id_, RSMI_CLK_TYPE_MEM, &frequency_info))
+            if (frequency_info.current < RSMI_MAX_NUM_FREQUENCIES) {
+                clock_samples_.memory_clock_frequency_->push_back(static_cast<decltype(clock_samples_.memory_clock_frequency_)::value_type::value_type>(frequency_info.frequency[frequency_info.current]) / 1000'000.0);
+            } else {
+                // the current index is (somehow) wrong
+                clock_samples_.memory_clock_frequency_->push_back(0);
+            }
+        }
 
-                if (clock_samples_.memory_clock_frequency_.has_value()) {
-                    rsmi_frequencies_t frequency_info{};
-                    HWS_ROCM_SMI_ERROR_CHECK(rsmi_dev_gpu_clk_freq_get(device_id_, RSMI_CLK_TYPE_MEM, &frequency_info))
-                    if (frequency_info.current < RSMI_MAX_NUM_FREQUENCIES) {
-                        clock_samples_.memory_clock_frequency_->push_back(static_cast<decltype(clock_samples_.memory_clock_frequency_)::value_type::value_type>(frequency_info.frequency[frequency_info.current]) / 1000'000.0);
-                    } else {
-                        // the current index is (somehow) wrong
-                        clock_samples_.memory_clock_frequency_->push_back(0);
-                    }
-                }
+        if (clock_samples_.overdrive_level_.has_value()) {
+            decltype(clock_samples_.overdrive_level_)::value_type::value_type value{};
+            HWS_ROCM_SMI_ERROR_CHECK(rsmi_dev_overdrive_level_get(device_id_, &value))
+            clock_samples_.overdrive_level_->push_back(value);
+        }
 
-                if (clock_samples_.overdrive_level_.has_value()) {
-                    decltype(clock_samples_.overdrive_level_)::value_type::value_type value{};
-                    HWS_ROCM_SMI_ERROR_CHECK(rsmi_dev_overdrive_level_get(device_id_, &value))
-                    clock_samples_.overdrive_level_->push_back(value);
-                }
+        if (clock_samples_.memory_overdrive_level_.has_value()) {
+            decltype(clock_samples_.memory_overdrive_level_)::value_type::value_type value{};
+            HWS_ROCM_SMI_ERROR_CHECK(rsmi_dev_mem_overdrive_level_get(device_id_, &value))
+            clock_samples_.memory_overdrive_level_->push_back(value);
+        }
 
-                if (clock_samples_.memory_overdrive_level_.has_value()) {
-                    decltype(clock_samples_.memory_overdrive_level_)::value_type::value_type value{};
-                    HWS_ROCM_SMI_ERROR_CHECK(rsmi_dev_mem_overdrive_level_get(device_id_, &value))
-                    clock_samples_.memory_overdrive_level_->push_back(value);
-                }
+        this->track_sample_change(sample_category::clock, clock_samples_.clock_frequency_);
+    }
+
+    // retrieve power related samples
+    if (this->sample_category_due(sample_category::power)) {
+        if (power_samples_.power_usage_.has_value()) {
+            [[maybe_unused]] RSMI_POWER_TYPE power_type{};
+            std::uint64_t value{};
+            HWS_ROCM_SMI_ERROR_CHECK(rsmi_dev_power_get(device_id_, &value, &power_type))
+            power_samples_.power_usage_->push_back(static_cast<decltype(power_samples_.power_usage_)::value_type::value_type>(value) / 1000'000.0);
+        }
+
+        if (power_samples_.power_total_energy_consumption_.has_value()) {
+            [[maybe_unused]] std::uint64_t timestamp{};
+            float resolution{};
+            std::uint64_t value{};
+            if (rsmi_dev_energy_count_get(device_id_, &value, &resolution, &timestamp) == RSMI_STATUS_SUCCESS) {
+                const auto scaled_value = static_cast<decltype(power_samples_.power_total_energy_consumption_)::value_type::value_type>(value) * static_cast<decltype(power_samples_.power_total_energy_consumption_)::value_type::value_type>(resolution);
+                power_samples_.power_total_energy_consumption_->push_back((scaled_value / 1000'000.0) - initial_total_power_consumption_);
+            } else if (power_samples_.power_usage_.has_value()) {
+                // if the total energy consumption cannot be retrieved, but the current power draw, approximate it
+                const auto time_difference = std::chrono::duration<double>(this->time_since_previous_sample(sample_category::power)).count();
+                const auto current = power_samples_.power_usage_->back() * time_difference;
+                power_samples_.power_total_energy_consumption_->push_back(power_samples_.power_total_energy_consumption_->back() + current);
             }
+        }
 
-            // retrieve power related samples
-            if (this->sample_category_enabled(sample_category::power)) {
-                if (power_samples_.power_usage_.has_value()) {
-                    [[maybe_unused]] RSMI_POWER_TYPE power_type{};
-                    std::uint64_t value{};
-                    HWS_ROCM_SMI_ERROR_CHECK(rsmi_dev_power_get(device_id_, &value, &power_type))
-                    power_samples_.power_usage_->push_back(static_cast<decltype(power_samples_.power_usage_)::value_type::value_type>(value) / 1000'000.0);
-                }
+        if (power_samples_.power_profile_.has_value()) {
+            rsmi_power_profile_status_t power_profile{};
+            HWS_ROCM_SMI_ERROR_CHECK(rsmi_dev_power_profile_presets_get(device_id_, std::uint32_t{ 0 }, &power_profile))
+            switch (power_profile.current) {
+                case RSMI_PWR_PROF_PRST_CUSTOM_MASK:
+                    power_samples_.power_profile_->emplace_back("CUSTOM");
+                    break;
+                case RSMI_PWR_PROF_PRST_VIDEO_MASK:
+                    power_samples_.power_profile_->emplace_back("VIDEO");
+                    break;
+                case RSMI_PWR_PROF_PRST_POWER_SAVING_MASK:
+                    power_samples_.power_profile_->emplace_back("POWER_SAVING");
+                    break;
+                case RSMI_PWR_PROF_PRST_COMPUTE_MASK:
+                    power_samples_.power_profile_->emplace_back("COMPUTE");
+                    break;
+                case RSMI_PWR_PROF_PRST_VR_MASK:
+                    power_samples_.power_profile_->emplace_back("VR");
+                    break;
+                case RSMI_PWR_PROF_PRST_3D_FULL_SCR_MASK:
+                    power_samples_.power_profile_->emplace_back("3D_FULL_SCREEN");
+                    break;
+                case RSMI_PWR_PROF_PRST_BOOTUP_DEFAULT:
+                    power_samples_.power_profile_->emplace_back("BOOTUP_DEFAULT");
+                    break;
+                case RSMI_PWR_PROF_PRST_INVALID:
+                    power_samples_.power_profile_->emplace_back("INVALID");
+                    break;
+            }
+        }
 
-                if (power_samples_.power_total_energy_consumption_.has_value()) {
-                    [[maybe_unused]] std::uint64_t timestamp{};
-                    float resolution{};
-                    std::uint64_t value{};
-                    if (rsmi_dev_energy_count_get(device_id_, &value, &resolution, &timestamp) == RSMI_STATUS_SUCCESS) {
-                        const auto scaled_value = static_cast<decltype(power_samples_.power_total_energy_consumption_)::value_type::value_type>(value) * static_cast<decltype(power_samples_.power_total_energy_consumption_)::value_type::value_type>(resolution);
-                        power_samples_.power_total_energy_consumption_->push_back((scaled_value / 1000'000.0) - initial_total_power_consumption);
-                    } else if (power_samples_.power_usage_.has_value()) {
-                        // if the total energy consumption cannot be retrieved, but the current power draw, approximate it
-                        const std::size_t num_time_points = this->sampling_time_points().size();
-                        const auto time_difference = std::chrono::duration<double>(this->sampling_time_points()[num_time_points - 1] - this->sampling_time_points()[num_time_points - 2]).count();
-                        const auto current = power_samples_.power_usage_->back() * time_difference;
-                        power_samples_.power_total_energy_consumption_->push_back(power_samples_.power_total_energy_consumption_->back() + current);
-                    }
-                }
+        this->track_sample_change(sample_category::power, power_samples_.power_usage_);
+    }
 
-                if (power_samples_.power_profile_.has_value()) {
-                    rsmi_power_profile_status_t power_profile{};
-                    HWS_ROCM_SMI_ERROR_CHECK(rsmi_dev_power_profile_presets_get(device_id_, std::uint32_t{ 0 }, &power_profile))
-                    switch (power_profile.current) {
-                        case RSMI_PWR_PROF_PRST_CUSTOM_MASK:
-                            power_samples_.power_profile_->emplace_back("CUSTOM");
-                            break;
-                        case RSMI_PWR_PROF_PRST_VIDEO_MASK:
-                            power_samples_.power_profile_->emplace_back("VIDEO");
-                            break;
-                        case RSMI_PWR_PROF_PRST_POWER_SAVING_MASK:
-                            power_samples_.power_profile_->emplace_back("POWER_SAVING");
-                            break;
-                        case RSMI_PWR_PROF_PRST_COMPUTE_MASK:
-                            power_samples_.power_profile_->emplace_back("COMPUTE");
-                            break;
-                        case RSMI_PWR_PROF_PRST_VR_MASK:
-                            power_samples_.power_profile_->emplace_back("VR");
-                            break;
-                        case RSMI_PWR_PROF_PRST_3D_FULL_SCR_MASK:
-                            power_samples_.power_profile_->emplace_back("3D_FULL_SCREEN");
-                            break;
-                        case RSMI_PWR_PROF_PRST_BOOTUP_DEFAULT:
-                            power_samples_.power_profile_->emplace_back("BOOTUP_DEFAULT");
-                            break;
-                        case RSMI_PWR_PROF_PRST_INVALID:
-                            power_samples_.power_profile_->emplace_back("INVALID");
-                            break;
-                    }
-                }
+    // retrieve memory related samples
+    if (this->sample_category_due(sample_category::memory)) {
+        if (memory_samples_.memory_used_.has_value() || memory_samples_.memory_free_.has_value()) {
+            decltype(memory_samples_.memory_used_)::value_type::value_type value{};
+            HWS_ROCM_SMI_ERROR_CHECK(rsmi_dev_memory_usage_get(device_id_, RSMI_MEM_TYPE_VRAM, &value))
+            if (memory_samples_.memory_used_.has_value()) {
+                memory_samples_.memory_used_->push_back(value);
             }
+            if (memory_samples_.memory_free_.has_value()) {
+                memory_samples_.memory_free_->push_back(memory_samples_.memory_total_.value() - value);
+            }
+        }
 
-            // retrieve memory related samples
-            if (this->sample_category_enabled(sample_category::memory)) {
-                if (memory_samples_.memory_used_.has_value()) {
-                    decltype(memory_samples_.memory_used_)::value_type::value_type value{};
-                    HWS_ROCM_SMI_ERROR_CHECK(rsmi_dev_memory_usage_get(device_id_, RSMI_MEM_TYPE_VRAM, &value))
-                    memory_samples_.memory_used_->push_back(value);
-                    if (memory_samples_.memory_free_.has_value()) {
-                        memory_samples_.memory_free_->push_back(memory_samples_.memory_total_.value() - value);
-                    }
-                }
-
-                if (memory_samples_.pcie_link_transfer_rate_.has_value() && memory_samples_.num_pcie_lanes_.has_value()) {
-                    rsmi_pcie_bandwidth_t bandwidth_info{};
-                    HWS_ROCM_SMI_ERROR_CHECK(rsmi_dev_pci_bandwidth_get(device_id_, &bandwidth_info))
-                    if (bandwidth_info.transfer_rate.current < RSMI_MAX_NUM_FREQUENCIES) {
-                        memory_samples_.pcie_link_transfer_rate_->push_back(bandwidth_info.transfer_rate.frequency[bandwidth_info.transfer_rate.current] / 1'000'000);
-                        memory_samples_.num_pcie_lanes_->push_back(bandwidth_info.lanes[bandwidth_info.transfer_rate.current]);
-                    } else {
-                        // the current index is (somehow) wrong
-                        memory_samples_.pcie_link_transfer_rate_->push_back(0);
-                        memory_samples_.num_pcie_lanes_->push_back(0);
-                    }
-                }
+        if (memory_samples_.pcie_link_transfer_rate_.has_value() || memory_samples_.num_pcie_lanes_.has_value()) {
+            rsmi_pcie_bandwidth_t bandwidth_info{};
+            HWS_ROCM_SMI_ERROR_CHECK(rsmi_dev_pci_bandwidth_get(device_id_, &bandwidth_info))
+            // the current index may (somehow) be wrong
+            const bool valid_index = bandwidth_info.transfer_rate.current < RSMI_MAX_NUM_FREQUENCIES;
+            if (memory_samples_.pcie_link_transfer_rate_.has_value()) {
+                memory_samples_.pcie_link_transfer_rate_->push_back(valid_index ? bandwidth_info.transfer_rate.frequency[bandwidth_info.transfer_rate.current] / 1'000'000 : 0);
+            }
+            if (memory_samples_.num_pcie_lanes_.has_value()) {
+                memory_samples_.num_pcie_lanes_->push_back(valid_index ? bandwidth_info.lanes[bandwidth_info.transfer_rate.current] : 0);
             }
+        }
 
-            // retrieve temperature related samples
-            if (this->sample_category_enabled(sample_category::temperature)) {
-                if (temperature_samples_.fan_speed_percentage_.has_value()) {
-                    std::int64_t value{};
-                    HWS_ROCM_SMI_ERROR_CHECK(rsmi_dev_fan_speed_get(device_id_, std::uint32_t{ 0 }, &value))
-                    temperature_samples_.fan_speed_percentage_->push_back(static_cast<decltype(temperature_samples_.fan_speed_percentage_)::value_type::value_type>(value) / static_cast<decltype(temperature_samples_.fan_speed_percentage_)::value_type::value_type>(RSMI_MAX_FAN_SPEED));
-                }
+        this->track_sample_change(sample_category::memory, memory_samples_.memory_used_);
+    }
 
-                if (temperature_samples_.temperature_.has_value()) {
-                    std::int64_t value{};
-                    HWS_ROCM_SMI_ERROR_CHECK(rsmi_dev_temp_metric_get(device_id_, RSMI_TEMP_TYPE_EDGE, RSMI_TEMP_CURRENT, &value))
-                    temperature_samples_.temperature_->push_back(static_cast<decltype(temperature_samples_.temperature_)::value_type::value_type>(value) / 1000.0);
-                }
+    // retrieve temperature related samples
+    if (this->sample_category_due(sample_category::temperature)) {
+        if (temperature_samples_.fan_speed_percentage_.has_value()) {
+            std::int64_t value{};
+            HWS_ROCM_SMI_ERROR_CHECK(rsmi_dev_fan_speed_get(device_id_, std::uint32_t{ 0 }, &value))
+            temperature_samples_.fan_speed_percentage_->push_back(static_cast<decltype(temperature_samples_.fan_speed_percentage_)::value_type::value_type>(value) / static_cast<decltype(temperature_samples_.fan_speed_percentage_)::value_type::value_type>(RSMI_MAX_FAN_SPEED));
+        }
 
-                if (temperature_samples_.memory_temperature_.has_value()) {
-                    std::int64_t value{};
-                    HWS_ROCM_SMI_ERROR_CHECK(rsmi_dev_temp_metric_get(device_id_, RSMI_TEMP_TYPE_MEMORY, RSMI_TEMP_CURRENT, &value))
-                    temperature_samples_.memory_temperature_->push_back(static_cast<decltype(temperature_samples_.memory_temperature_)::value_type::value_type>(value) / 1000.0);
-                }
+        if (temperature_samples_.temperature_.has_value()) {
+            std::int64_t value{};
+            HWS_ROCM_SMI_ERROR_CHECK(rsmi_dev_temp_metric_get(device_id_, RSMI_TEMP_TYPE_EDGE, RSMI_TEMP_CURRENT, &value))
+            temperature_samples_.temperature_->push_back(static_cast<decltype(temperature_samples_.temperature_)::value_type::value_type>(value) / 1000.0);
+        }
 
-                if (temperature_samples_.hotspot_temperature_.has_value()) {
-                    std::int64_t value{};
-                    HWS_ROCM_SMI_ERROR_CHECK(rsmi_dev_temp_metric_get(device_id_, RSMI_TEMP_TYPE_JUNCTION, RSMI_TEMP_CURRENT, &value))
-                    temperature_samples_.hotspot_temperature_->push_back(static_cast<decltype(temperature_samples_.hotspot_temperature_)::value_type::value_type>(value) / 1000.0);
-                }
+        if (temperature_samples_.memory_temperature_.has_value()) {
+            std::int64_t value{};
+            HWS_ROCM_SMI_ERROR_CHECK(rsmi_dev_temp_metric_get(device_id_, RSMI_TEMP_TYPE_MEMORY, RSMI_TEMP_CURRENT, &value))
+            temperature_samples_.memory_temperature_->push_back(static_cast<decltype(temperature_samples_.memory_temperature_)::value_type::value_type>(value) / 1000.0);
+        }
 
-                if (temperature_samples_.hbm_0_temperature_.has_value()) {
-                    std::int64_t value{};
-                    HWS_ROCM_SMI_ERROR_CHECK(rsmi_dev_temp_metric_get(device_id_, RSMI_TEMP_TYPE_HBM_0, RSMI_TEMP_CURRENT, &value))
-                    temperature_samples_.hbm_0_temperature_->push_back(static_cast<decltype(temperature_samples_.hbm_0_temperature_)::value_type::value_type>(value) / 1000.0);
-                }
+        if (temperature_samples_.hotspot_temperature_.has_value()) {
+            std::int64_t value{};
+            HWS_ROCM_SMI_ERROR_CHECK(rsmi_dev_temp_metric_get(device_id_, RSMI_TEMP_TYPE_JUNCTION, RSMI_TEMP_CURRENT, &value))
+            temperature_samples_.hotspot_temperature_->push_back(static_cast<decltype(temperature_samples_.hotspot_temperature_)::value_type::value_type>(value) / 1000.0);
+        }
 
-                if (temperature_samples_.hbm_1_temperature_.has_value()) {
-                    std::int64_t value{};
-                    HWS_ROCM_SMI_ERROR_CHECK(rsmi_dev_temp_metric_get(device_id_, RSMI_TEMP_TYPE_HBM_1, RSMI_TEMP_CURRENT, &value))
-                    temperature_samples_.hbm_1_temperature_->push_back(static_cast<decltype(temperature_samples_.hbm_1_temperature_)::value_type::value_type>(value) / 1000.0);
-                }
+        if (temperature_samples_.hbm_0_temperature_.has_value()) {
+            std::int64_t value{};
+            HWS_ROCM_SMI_ERROR_CHECK(rsmi_dev_temp_metric_get(device_id_, RSMI_TEMP_TYPE_HBM_0, RSMI_TEMP_CURRENT, &value))
+            temperature_samples_.hbm_0_temperature_->push_back(static_cast<decltype(temperature_samples_.hbm_0_temperature_)::value_type::value_type>(value) / 1000.0);
+        }
 
-                if (temperature_samples_.hbm_2_temperature_.has_value()) {
-                    std::int64_t value{};
-                    HWS_ROCM_SMI_ERROR_CHECK(rsmi_dev_temp_metric_get(device_id_, RSMI_TEMP_TYPE_HBM_2, RSMI_TEMP_CURRENT, &value))
-                    temperature_samples_.hbm_2_temperature_->push_back(static_cast<decltype(temperature_samples_.hbm_2_temperature_)::value_type::value_type>(value) / 1000.0);
-                }
+        if (temperature_samples_.hbm_1_temperature_.has_value()) {
+            std::int64_t value{};
+            HWS_ROCM_SMI_ERROR_CHECK(rsmi_dev_temp_metric_get(device_id_, RSMI_TEMP_TYPE_HBM_1, RSMI_TEMP_CURRENT, &value))
+            temperature_samples_.hbm_1_temperature_->push_back(static_cast<decltype(temperature_samples_.hbm_1_temperature_)::value_type::value_type>(value) / 1000.0);
+        }
 
-                if (temperature_samples_.hbm_3_temperature_.has_value()) {
-                    std::int64_t value{};
-                    HWS_ROCM_SMI_ERROR_CHECK(rsmi_dev_temp_metric_get(device_id_, RSMI_TEMP_TYPE_HBM_3, RSMI_TEMP_CURRENT, &value))
-                    temperature_samples_.hbm_3_temperature_->push_back(static_cast<decltype(temperature_samples_.hbm_3_temperature_)::value_type::value_type>(value) / 1000.0);
-                }
-            }
+        if (temperature_samples_.hbm_2_temperature_.has_value()) {
+            std::int64_t value{};
+            HWS_ROCM_SMI_ERROR_CHECK(rsmi_dev_temp_metric_get(device_id_, RSMI_TEMP_TYPE_HBM_2, RSMI_TEMP_CURRENT, &value))
+            temperature_samples_.hbm_2_temperature_->push_back(static_cast<decltype(temperature_samples_.hbm_2_temperature_)::value_type::value_type>(value) / 1000.0);
         }
 
-        // wait for the sampling interval to pass to retrieve the next sample
-        std::this_thread::sleep_for(this->sampling_interval());
+        if (temperature_samples_.hbm_3_temperature_.has_value()) {
+            std::int64_t value{};
+            HWS_ROCM_SMI_ERROR_CHECK(rsmi_dev_temp_metric_get(device_id_, RSMI_TEMP_TYPE_HBM_3, RSMI_TEMP_CURRENT, &value))
+            temperature_samples_.hbm_3_temperature_->push_back(static_cast<decltype(temperature_samples_.hbm_3_temperature_)::value_type::value_type>(value) / 1000.0);
+        }
+
+        this->track_sample_change(sample_category::temperature, temperature_samples_.temperature_);
     }
 }
 
+std::optional<double> gpu_amd_hardware_sampler::read_energy_counter() {
+    // the accumulated energy counter in units of resolution µJ
+    [[maybe_unused]] std::uint64_t timestamp{};
+    float resolution{};
+    std::uint64_t value{};
+    if (rsmi_dev_energy_count_get(device_id_, &value, &resolution, &timestamp) != RSMI_STATUS_SUCCESS) {
+        return std::nullopt;
+    }
+    return static_cast<double>(value) * static_cast<double>(resolution) / 1000'000.0;
+}
+
+std::optional<double> gpu_amd_hardware_sampler::latest_power_usage() const {
+    return latest_sample(power_samples_.power_usage_);
+}
+
+std::optional<double> gpu_amd_hardware_sampler::latest_temperature() const {
+    return latest_sample(temperature_samples_.temperature_);
+}
+
+std::vector<std::string> gpu_amd_hardware_sampler::numeric_sample_names() const {
+    std::vector<std::string> names{};
+    detail::append_numeric_sample_names(general_samples_, names);
+    detail::append_numeric_sample_names(clock_samples_, names);
+    detail::append_numeric_sample_names(power_samples_, names);
+    detail::append_numeric_sample_names(memory_samples_, names);
+    detail::append_numeric_sample_names(temperature_samples_, names);
+    return names;
+}
+
+void gpu_amd_hardware_sampler::latest_numeric_sample_values(const sample_category sampled, std::vector<double> &values) const {
+    std::size_t pos = 0;
+    detail::append_latest_numeric_sample_values(general_samples_, sampled, values, pos);
+    detail::append_latest_numeric_sample_values(clock_samples_, sampled, values, pos);
+    detail::append_latest_numeric_sample_values(power_samples_, sampled, values, pos);
+    detail::append_latest_numeric_sample_values(memory_samples_, sampled, values, pos);
+    detail::append_latest_numeric_sample_values(temperature_samples_, sampled, values, pos);
+}
+
 std::string gpu_amd_hardware_sampler::device_identification() const {
     return fmt::format("gpu_amd_device_{}", device_id_);
 }
 
 std::string gpu_amd_hardware_sampler::samples_only_as_yaml_string() const {
     // check whether it's safe to generate the YAML entry
-    if (this->is_sampling()) {
-        throw std::runtime_error{ "Can't create the final YAML entry if the hardware sampler is still running!" };
+    if (!this->samples_accessible()) {
+        throw std::runtime_error{ "Can't create the YAML entry before the initial samples have been retrieved!" };
     }
 
     return fmt::format("{}{}"
@@ -704,7 +745,7 @@ std::string gpu_amd_hardware_sampler::samples_only_as_yaml_string() const {
 }
 
 std::ostream &operator<<(std::ostream &out, const gpu_amd_hardware_sampler &sampler) {
-    if (sampler.is_sampling()) {
+    if (!sampler.samples_accessible()) {
         out.setstate(std::ios_base::failbit);
         return out;
     } else {
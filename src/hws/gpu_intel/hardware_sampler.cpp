@@ -12,6 +12,7 @@
 #include "hws/gpu_intel/utility.hpp"                        // HWS_LEVEL_ZERO_ERROR_CHECK
 #include "hws/hardware_sampler.hpp"                         // hws::hardware_sampler
 #include "hws/sample_category.hpp"                          // hws::sample_category
+#include "hws/sample_metric.hpp"                            // hws::detail::{append_numeric_sample_names, append_latest_numeric_sample_values}
 #include "hws/utility.hpp"                                  // hws::{durations_from_reference_time, join}
 
 #include "fmt/chrono.h"          // direct formatting of std::chrono types
@@ -19,15 +20,16 @@
 #include "level_zero/ze_api.h"   // Level Zero runtime functions
 #include "level_zero/zes_api.h"  // Level Zero runtime functions
 
-#include <chrono>     // std::chrono::{steady_clock, duration_cast, milliseconds}
+#include <chrono>     // std::chrono::{steady_clock, duration_cast, nanoseconds}
 #include <cstddef>    // std::size_t
 #include <cstdint>    // std::int32_t, std::int64_t
 #include <exception>  // std::exception, std::terminate
 #include <ios>        // std::ios_base
 #include <iostream>   // std::cerr, std::endl
+#include <mutex>      // std::call_once
+#include <optional>   // std::optional, std::nullopt
 #include <stdexcept>  // std::runtime_error
 #include <string>     // std::string
-#include <thread>     // std::this_thread
 #include <utility>    // std::move
 #include <vector>     // std::vector
 
@@ -39,10 +41,10 @@ gpu_intel_hardware_sampler::gpu_intel_hardware_sampler(const sample_category cat
 gpu_intel_hardware_sampler::gpu_intel_hardware_sampler(const std::size_t device_id, const sample_category category) :
     gpu_intel_hardware_sampler{ device_id, HWS_SAMPLING_INTERVAL, category } { }
 
-gpu_intel_hardware_sampler::gpu_intel_hardware_sampler(const std::chrono::milliseconds sampling_interval, const sample_category category) :
+gpu_intel_hardware_sampler::gpu_intel_hardware_sampler(const std::chrono::nanoseconds sampling_interval, const sample_category category) :
     gpu_intel_hardware_sampler{ 0, sampling_interval, category } { }
 
-gpu_intel_hardware_sampler::gpu_intel_hardware_sampler(const std::size_t device_id, const std::chrono::milliseconds sampling_interval, const sample_category category) :
+gpu_intel_hardware_sampler::gpu_intel_hardware_sampler(const std::size_t device_id, const std::chrono::nanoseconds sampling_interval, const sample_category category) :
     hardware_sampler{ sampling_interval, category } {
     // make sure that zeInit is only called once for all instances
     if (instances_++ == 0) {
@@ -71,26 +73,22 @@ gpu_intel_hardware_sampler::~gpu_intel_hardware_sampler() {
     }
 }
 
-void gpu_intel_hardware_sampler::sampling_loop() {
+void gpu_intel_hardware_sampler::initialize_samples() {
     // get the level zero handle from the device
     ze_device_handle_t device = device_.get_impl().device;
 
-    // the different handles
-    std::vector<zes_freq_handle_t> frequency_handles{};
-    std::vector<zes_pwr_handle_t> power_handles{};
-    std::vector<zes_mem_handle_t> memory_handles{};
-    std::vector<zes_fan_handle_t> fan_handles{};
-    std::vector<zes_psu_handle_t> psu_handles{};
-    std::vector<zes_temp_handle_t> temperature_handles{};
+    // the different handles (enumerated once and reused in every tick of the sampling loop)
+    std::vector<zes_freq_handle_t> &frequency_handles = device_.get_impl().frequency_handles;
+    std::vector<zes_pwr_handle_t> &power_handles = device_.get_impl().power_handles;
+    std::vector<zes_mem_handle_t> &memory_handles = device_.get_impl().memory_handles;
+    std::vector<zes_fan_handle_t> &fan_handles = device_.get_impl().fan_handles;
+    std::vector<zes_psu_handle_t> &psu_handles = device_.get_impl().psu_handles;
+    std::vector<zes_temp_handle_t> &temperature_handles = device_.get_impl().temperature_handles;
 
     //
     // add samples where we only have to retrieve the value once
     //
 
-    this->add_time_point(std::chrono::steady_clock::now());
-
-    double initial_total_power_consumption{};  // initial total power consumption in J
-
     // retrieve initial general information
     if (this->sample_category_enabled(sample_category::general)) {
         // the byte order is given by Intel directly
@@ -191,19 +189,19 @@ void gpu_intel_hardware_sampler::sampling_loop() {
                                 case ZES_FREQ_DOMAIN_GPU:
                                     {
                                         if (frequency_state.tdp >= 0.0) {
-                                            clock_samples_.frequency_limit_tdp_ = decltype(clock_samples_.frequency_limit_tdp_)::value_type{ frequency_state.tdp };
+                                            clock_samples_.frequency_limit_tdp_ = decltype(clock_samples_.frequency_limit_tdp_)::value_type{ this->column_config(), { frequency_state.tdp } };
                                         }
                                         if (frequency_state.actual >= 0.0) {
-                                            clock_samples_.clock_frequency_ = decltype(clock_samples_.clock_frequency_)::value_type{ frequency_state.actual };
+                                            clock_samples_.clock_frequency_ = decltype(clock_samples_.clock_frequency_)::value_type{ this->column_config(), { frequency_state.actual } };
                                         }
                                         if (frequency_state.throttleReasons >= 0.0) {
                                             {
                                                 using vector_type = decltype(clock_samples_.throttle_reason_)::value_type;
-                                                clock_samples_.throttle_reason_ = vector_type{ static_cast<vector_type::value_type>(static_cast<std::int64_t>(frequency_state.throttleReasons)) };
+                                                clock_samples_.throttle_reason_ = vector_type{ this->column_config(), { static_cast<vector_type::value_type>(static_cast<std::int64_t>(frequency_state.throttleReasons)) } };
                                             }
                                             {
                                                 using vector_type = decltype(clock_samples_.throttle_reason_string_)::value_type;
-                                                clock_samples_.throttle_reason_string_ = vector_type{ static_cast<vector_type::value_type>(detail::throttle_reason_to_string(frequency_state.throttleReasons)) };
+                                                clock_samples_.throttle_reason_string_ = vector_type{ this->column_config(), { static_cast<vector_type::value_type>(detail::throttle_reason_to_string(frequency_state.throttleReasons)) } };
                                             }
                                         }
                                     }
@@ -211,19 +209,19 @@ void gpu_intel_hardware_sampler::sampling_loop() {
                                 case ZES_FREQ_DOMAIN_MEMORY:
                                     {
                                         if (frequency_state.tdp >= 0.0) {
-                                            clock_samples_.memory_frequency_limit_tdp_ = decltype(clock_samples_.memory_frequency_limit_tdp_)::value_type{ frequency_state.tdp };
+                                            clock_samples_.memory_frequency_limit_tdp_ = decltype(clock_samples_.memory_frequency_limit_tdp_)::value_type{ this->column_config(), { frequency_state.tdp } };
                                         }
                                         if (frequency_state.actual >= 0.0) {
-                                            clock_samples_.memory_clock_frequency_ = decltype(clock_samples_.memory_clock_frequency_)::value_type{ frequency_state.actual };
+                                            clock_samples_.memory_clock_frequency_ = decltype(clock_samples_.memory_clock_frequency_)::value_type{ this->column_config(), { frequency_state.actual } };
                                         }
                                         if (frequency_state.throttleReasons >= 0.0) {
                                             {
                                                 using vector_type = decltype(clock_samples_.memory_throttle_reason_)::value_type;
-                                                clock_samples_.memory_throttle_reason_ = vector_type{ static_cast<vector_type::value_type>(static_cast<std::int64_t>(frequency_state.throttleReasons)) };
+                                                clock_samples_.memory_throttle_reason_ = vector_type{ this->column_config(), { static_cast<vector_type::value_type>(static_cast<std::int64_t>(frequency_state.throttleReasons)) } };
                                             }
                                             {
                                                 using vector_type = decltype(clock_samples_.memory_throttle_reason_string_)::value_type;
-                                                clock_samples_.memory_throttle_reason_string_ = vector_type{ static_cast<vector_type::value_type>(detail::throttle_reason_to_string(frequency_state.throttleReasons)) };
+                                                clock_samples_.memory_throttle_reason_string_ = vector_type{ this->column_config(), { static_cast<vector_type::value_type>(detail::throttle_reason_to_string(frequency_state.throttleReasons)) } };
                                             }
                                         }
                                     }
@@ -279,9 +277,9 @@ void gpu_intel_hardware_sampler::sampling_loop() {
                     // get total power consumption
                     zes_power_energy_counter_t energy_counter{};
                     if (zesPowerGetEnergyCounter(power_handles.front(), &energy_counter) == ZE_RESULT_SUCCESS) {
-                        initial_total_power_consumption = static_cast<decltype(power_samples_.power_total_energy_consumption_)::value_type::value_type>(energy_counter.energy) / 1000.0 / 1000.0;
-                        power_samples_.power_total_energy_consumption_ = decltype(power_samples_.power_total_energy_consumption_)::value_type{ 0.0 };
-                        power_samples_.power_usage_ = decltype(power_samples_.power_total_energy_consumption_)::value_type{ 0.0 };
+                        initial_total_power_consumption_ = static_cast<decltype(power_samples_.power_total_energy_consumption_)::value_type::value_type>(energy_counter.energy) / 1000.0 / 1000.0;
+                        power_samples_.power_total_energy_consumption_ = decltype(power_samples_.power_total_energy_consumption_)::value_type{ this->column_config(), { 0.0 } };
+                        power_samples_.power_usage_ = decltype(power_samples_.power_total_energy_consumption_)::value_type{ this->column_config(), { 0.0 } };
                     }
 
                     // get energy thresholds
@@ -378,13 +376,13 @@ void gpu_intel_hardware_sampler::sampling_loop() {
                 zes_pci_state_t pci_state{};
                 if (zesDevicePciGetState(device, &pci_state) == ZE_RESULT_SUCCESS) {
                     if (pci_state.speed.maxBandwidth != -1) {
-                        memory_samples_.pcie_link_speed_ = decltype(memory_samples_.pcie_link_speed_)::value_type{ static_cast<decltype(memory_samples_.pcie_link_speed_max_)::value_type>(static_cast<double>(pci_state.speed.maxBandwidth) / 1e6) };
+                        memory_samples_.pcie_link_speed_ = decltype(memory_samples_.pcie_link_speed_)::value_type{ this->column_config(), { static_cast<decltype(memory_samples_.pcie_link_speed_max_)::value_type>(static_cast<double>(pci_state.speed.maxBandwidth) / 1e6) } };
                     }
                     if (pci_state.speed.width != -1) {
-                        memory_samples_.num_pcie_lanes_ = decltype(memory_samples_.num_pcie_lanes_)::value_type{ pci_state.speed.width };
+                        memory_samples_.num_pcie_lanes_ = decltype(memory_samples_.num_pcie_lanes_)::value_type{ this->column_config(), { pci_state.speed.width } };
                     }
                     if (pci_state.speed.gen != -1) {
-                        memory_samples_.pcie_link_generation_ = decltype(memory_samples_.pcie_link_generation_)::value_type{ pci_state.speed.gen };
+                        memory_samples_.pcie_link_generation_ = decltype(memory_samples_.pcie_link_generation_)::value_type{ this->column_config(), { pci_state.speed.gen } };
                     }
                 }
             }
@@ -409,7 +407,7 @@ void gpu_intel_hardware_sampler::sampling_loop() {
                     std::int32_t fan_speed{};
                     if (zesFanGetState(fan_handles.front(), ZES_FAN_SPEED_UNITS_PERCENT, &fan_speed) == ZE_RESULT_SUCCESS) {
                         if (fan_speed != -1) {
-                            temperature_samples_.fan_speed_percentage_ = decltype(temperature_samples_.fan_speed_percentage_)::value_type{ static_cast<decltype(temperature_samples_.fan_speed_percentage_)::value_type::value_type>(fan_speed) };
+                            temperature_samples_.fan_speed_percentage_ = decltype(temperature_samples_.fan_speed_percentage_)::value_type{ this->column_config(), { static_cast<decltype(temperature_samples_.fan_speed_percentage_)::value_type::value_type>(fan_speed) } };
                         }
                     }
                 }
@@ -425,7 +423,7 @@ void gpu_intel_hardware_sampler::sampling_loop() {
                     zes_psu_state_t psu_state{};
                     if (zesPsuGetState(psu_handles.front(), &psu_state) == ZE_RESULT_SUCCESS) {
                         if (psu_state.temperature != -1) {
-                            temperature_samples_.psu_temperature_ = static_cast<decltype(temperature_samples_.psu_temperature_)::value_type>(psu_state.temperature);
+                            temperature_samples_.psu_temperature_ = decltype(temperature_samples_.psu_temperature_)::value_type{ this->column_config(), { static_cast<decltype(temperature_samples_.psu_temperature_)::value_type::value_type>(psu_state.temperature) } };
                         }
                     }
                 }
@@ -451,7 +449,7 @@ void gpu_intel_hardware_sampler::sampling_loop() {
 
                                     // first value to add -> initialize map
                                     if (!temperature_samples_.global_temperature_.has_value()) {
-                                        temperature_samples_.global_temperature_ = decltype(temperature_samples_.global_temperature_)::value_type{};
+                                        temperature_samples_.global_temperature_ = decltype(temperature_samples_.global_temperature_)::value_type{ this->column_config() };
                                     }
                                     double temp{};
                                     if (zesTemperatureGetState(handle, &temp) == ZE_RESULT_SUCCESS) {
@@ -470,7 +468,7 @@ void gpu_intel_hardware_sampler::sampling_loop() {
 
                                     // first value to add -> initialize map
                                     if (!temperature_samples_.temperature_.has_value()) {
-                                        temperature_samples_.temperature_ = decltype(temperature_samples_.temperature_)::value_type{};
+                                        temperature_samples_.temperature_ = decltype(temperature_samples_.temperature_)::value_type{ this->column_config() };
                                     }
                                     double temp{};
                                     if (zesTemperatureGetState(handle, &temp) == ZE_RESULT_SUCCESS) {
@@ -489,7 +487,7 @@ void gpu_intel_hardware_sampler::sampling_loop() {
 
                                     // first value to add -> initialize map
                                     if (!temperature_samples_.memory_temperature_.has_value()) {
-                                        temperature_samples_.memory_temperature_ = decltype(temperature_samples_.memory_temperature_)::value_type{};
+                                        temperature_samples_.memory_temperature_ = decltype(temperature_samples_.memory_temperature_)::value_type{ this->column_config() };
                                     }
                                     double temp{};
                                     if (zesTemperatureGetState(handle, &temp) == ZE_RESULT_SUCCESS) {
@@ -506,182 +504,248 @@ void gpu_intel_hardware_sampler::sampling_loop() {
         }
     }
 
-    //
-    // loop until stop_sampling() is called
-    //
-
-    while (!this->has_sampling_stopped()) {
-        // only sample values if the sampler currently isn't paused
-        if (this->is_sampling()) {
-            // add current time point
-            this->add_time_point(std::chrono::steady_clock::now());
+    // drop the queried samples that haven't been selected -> their Level Zero calls are skipped in the sampling loop
+    if (this->uses_sample_metric_selection()) {
+        this->apply_sample_metric_selection(general_samples_);
+        this->apply_sample_metric_selection(clock_samples_);
+        this->apply_sample_metric_selection(power_samples_);
+        this->apply_sample_metric_selection(memory_samples_);
+        this->apply_sample_metric_selection(temperature_samples_);
+    }
+}
 
-            // retrieve clock related samples
-            if (this->sample_category_enabled(sample_category::clock)) {
-                for (zes_freq_handle_t handle : frequency_handles) {
-                    // get frequency properties
-                    zes_freq_properties_t prop{};
-                    HWS_LEVEL_ZERO_ERROR_CHECK(zesFrequencyGetProperties(handle, &prop))
+void gpu_intel_hardware_sampler::sample() {
+    // get the level zero handle from the device
+    ze_device_handle_t device = device_.get_impl().device;
 
-                    // get current frequency information
-                    zes_freq_state_t frequency_state{};
-                    if (clock_samples_.clock_frequency_.has_value() || clock_samples_.memory_clock_frequency_.has_value()) {
-                        HWS_LEVEL_ZERO_ERROR_CHECK(zesFrequencyGetState(handle, &frequency_state))
-                        // determine the frequency domain (e.g. GPU, memory, etc)
-                        switch (prop.type) {
-                            case ZES_FREQ_DOMAIN_GPU:
-                                {
-                                    if (clock_samples_.frequency_limit_tdp_.has_value()) {
-                                        clock_samples_.frequency_limit_tdp_->push_back(frequency_state.tdp);
-                                    }
-                                    if (clock_samples_.clock_frequency_.has_value()) {
-                                        clock_samples_.clock_frequency_->push_back(frequency_state.actual);
-                                    }
-                                    if (clock_samples_.throttle_reason_.has_value()) {
-                                        clock_samples_.throttle_reason_->push_back(static_cast<std::int64_t>(frequency_state.throttleReasons));
-                                    }
-                                    if (clock_samples_.throttle_reason_string_.has_value()) {
-                                        clock_samples_.throttle_reason_string_->push_back(detail::throttle_reason_to_string(frequency_state.throttleReasons));
-                                    }
-                                }
-                                break;
-                            case ZES_FREQ_DOMAIN_MEMORY:
-                                {
-                                    if (clock_samples_.memory_frequency_limit_tdp_.has_value()) {
-                                        clock_samples_.memory_frequency_limit_tdp_->push_back(frequency_state.tdp);
-                                    }
-                                    if (clock_samples_.memory_clock_frequency_.has_value()) {
-                                        clock_samples_.memory_clock_frequency_->push_back(frequency_state.actual);
-                                    }
-                                    if (clock_samples_.memory_throttle_reason_.has_value()) {
-                                        clock_samples_.memory_throttle_reason_->push_back(static_cast<std::int64_t>(frequency_state.throttleReasons));
-                                    }
-                                    if (clock_samples_.memory_throttle_reason_string_.has_value()) {
-                                        clock_samples_.memory_throttle_reason_string_->push_back(detail::throttle_reason_to_string(frequency_state.throttleReasons));
-                                    }
-                                }
-                                break;
-                            default:
-                                // do nothing
-                                break;
+    // the different handles enumerated during the initialization
+    const std::vector<zes_freq_handle_t> &frequency_handles = device_.get_impl().frequency_handles;
+    const std::vector<zes_pwr_handle_t> &power_handles = device_.get_impl().power_handles;
+    const std::vector<zes_mem_handle_t> &memory_handles = device_.get_impl().memory_handles;
+    const std::vector<zes_psu_handle_t> &psu_handles = device_.get_impl().psu_handles;
+    const std::vector<zes_temp_handle_t> &temperature_handles = device_.get_impl().temperature_handles;
+
+    // retrieve clock related samples
+    if (this->sample_category_due(sample_category::clock)) {
+        for (zes_freq_handle_t handle : frequency_handles) {
+            // get frequency properties
+            zes_freq_properties_t prop{};
+            HWS_LEVEL_ZERO_ERROR_CHECK(zesFrequencyGetProperties(handle, &prop))
+
+            // get current frequency information
+            zes_freq_state_t frequency_state{};
+            if (clock_samples_.clock_frequency_.has_value() || clock_samples_.memory_clock_frequency_.has_value() || clock_samples_.throttle_reason_.has_value() || clock_samples_.throttle_reason_string_.has_value()
+                || clock_samples_.memory_throttle_reason_.has_value() || clock_samples_.memory_throttle_reason_string_.has_value() || clock_samples_.frequency_limit_tdp_.has_value() || clock_samples_.memory_frequency_limit_tdp_.has_value()) {
+                HWS_LEVEL_ZERO_ERROR_CHECK(zesFrequencyGetState(handle, &frequency_state))
+                // determine the frequency domain (e.g. GPU, memory, etc)
+                switch (prop.type) {
+                    case ZES_FREQ_DOMAIN_GPU:
+                        {
+                            if (clock_samples_.frequency_limit_tdp_.has_value()) {
+                                clock_samples_.frequency_limit_tdp_->push_back(frequency_state.tdp);
+                            }
+                            if (clock_samples_.clock_frequency_.has_value()) {
+                                clock_samples_.clock_frequency_->push_back(frequency_state.actual);
+                            }
+                            if (clock_samples_.throttle_reason_.has_value()) {
+                                clock_samples_.throttle_reason_->push_back(static_cast<std::int64_t>(frequency_state.throttleReasons));
+                            }
+                            if (clock_samples_.throttle_reason_string_.has_value()) {
+                                clock_samples_.throttle_reason_string_->push_back(detail::throttle_reason_to_string(frequency_state.throttleReasons));
+                            }
                         }
-                    }
+                        break;
+                    case ZES_FREQ_DOMAIN_MEMORY:
+                        {
+                            if (clock_samples_.memory_frequency_limit_tdp_.has_value()) {
+                                clock_samples_.memory_frequency_limit_tdp_->push_back(frequency_state.tdp);
+                            }
+                            if (clock_samples_.memory_clock_frequency_.has_value()) {
+                                clock_samples_.memory_clock_frequency_->push_back(frequency_state.actual);
+                            }
+                            if (clock_samples_.memory_throttle_reason_.has_value()) {
+                                clock_samples_.memory_throttle_reason_->push_back(static_cast<std::int64_t>(frequency_state.throttleReasons));
+                            }
+                            if (clock_samples_.memory_throttle_reason_string_.has_value()) {
+                                clock_samples_.memory_throttle_reason_string_->push_back(detail::throttle_reason_to_string(frequency_state.throttleReasons));
+                            }
+                        }
+                        break;
+                    default:
+                        // do nothing
+                        break;
                 }
             }
+        }
 
-            // retrieve power related samples
-            if (this->sample_category_enabled(sample_category::power)) {
-                if (!power_handles.empty()) {
-                    // NOTE: only the first power domain is used here
-                    if (power_samples_.power_total_energy_consumption_.has_value()) {
-                        // get total power consumption
-                        zes_power_energy_counter_t energy_counter{};
-                        HWS_LEVEL_ZERO_ERROR_CHECK(zesPowerGetEnergyCounter(power_handles.front(), &energy_counter))
-
-                        const auto power_consumption = static_cast<decltype(power_samples_.power_total_energy_consumption_)::value_type::value_type>(energy_counter.energy) / 1000.0 / 1000.0;
-
-                        // calculate current power draw as (Energy Difference [J]) / (Time Difference [s])
-                        const std::size_t last_index = this->sampling_time_points().size() - 1;
-                        const double power_usage = ((power_consumption - initial_total_power_consumption) - power_samples_.power_total_energy_consumption_->back()) / (std::chrono::duration<double>(this->sampling_time_points()[last_index] - this->sampling_time_points()[last_index - 1]).count());
-                        power_samples_.power_usage_->push_back(power_usage);
+        this->track_sample_change(sample_category::clock, clock_samples_.clock_frequency_);
+    }
 
-                        // add power consumption last to be able to use the std::vector::back() function
-                        power_samples_.power_total_energy_consumption_->push_back(power_consumption - initial_total_power_consumption);
-                    }
+    // retrieve power related samples
+    if (this->sample_category_due(sample_category::power)) {
+        if (!power_handles.empty()) {
+            // NOTE: only the first power domain is used here
+            if (power_samples_.power_total_energy_consumption_.has_value()) {
+                // get total power consumption
+                zes_power_energy_counter_t energy_counter{};
+                HWS_LEVEL_ZERO_ERROR_CHECK(zesPowerGetEnergyCounter(power_handles.front(), &energy_counter))
+
+                const auto power_consumption = static_cast<decltype(power_samples_.power_total_energy_consumption_)::value_type::value_type>(energy_counter.energy) / 1000.0 / 1000.0;
+
+                // calculate current power draw as (Energy Difference [J]) / (Time Difference [s])
+                const double power_usage = ((power_consumption - initial_total_power_consumption_) - power_samples_.power_total_energy_consumption_->back()) / (std::chrono::duration<double>(this->time_since_previous_sample(sample_category::power)).count());
+                if (power_samples_.power_usage_.has_value()) {
+                    power_samples_.power_usage_->push_back(power_usage);
                 }
+
+                // add power consumption last to be able to use the std::vector::back() function
+                power_samples_.power_total_energy_consumption_->push_back(power_consumption - initial_total_power_consumption_);
             }
+        }
 
-            // retrieve memory related samples
-            if (this->sample_category_enabled(sample_category::memory)) {
-                for (zes_mem_handle_t handle : memory_handles) {
-                    zes_mem_properties_t prop{};
-                    HWS_LEVEL_ZERO_ERROR_CHECK(zesMemoryGetProperties(handle, &prop))
+        this->track_sample_change(sample_category::power, power_samples_.power_usage_);
+    }
 
-                    // get the memory module name
-                    const std::string memory_module_name = detail::memory_module_to_name(prop.type);
+    // retrieve memory related samples
+    if (this->sample_category_due(sample_category::memory)) {
+        for (zes_mem_handle_t handle : memory_handles) {
+            zes_mem_properties_t prop{};
+            HWS_LEVEL_ZERO_ERROR_CHECK(zesMemoryGetProperties(handle, &prop))
 
-                    if (memory_samples_.memory_free_.has_value()) {
-                        // get current memory information
-                        zes_mem_state_t mem_state{};
-                        HWS_LEVEL_ZERO_ERROR_CHECK(zesMemoryGetState(handle, &mem_state))
+            // get the memory module name
+            const std::string memory_module_name = detail::memory_module_to_name(prop.type);
 
-                        memory_samples_.memory_free_.value()[memory_module_name].push_back(mem_state.free);
+            if (memory_samples_.memory_free_.has_value() || memory_samples_.memory_used_.has_value()) {
+                // get current memory information
+                zes_mem_state_t mem_state{};
+                HWS_LEVEL_ZERO_ERROR_CHECK(zesMemoryGetState(handle, &mem_state))
 
-                        if (memory_samples_.visible_memory_total_.has_value()) {
-                            memory_samples_.memory_used_.value()[memory_module_name].push_back(memory_samples_.visible_memory_total_.value()[memory_module_name] - mem_state.free);
-                        }
-                    }
+                if (memory_samples_.memory_free_.has_value()) {
+                    memory_samples_.memory_free_.value()[memory_module_name].push_back(mem_state.free);
                 }
 
-                if (memory_samples_.pcie_link_speed_.has_value() || memory_samples_.num_pcie_lanes_.has_value() || memory_samples_.num_pcie_lanes_.has_value()) {
-                    // the current PCIe stats
-                    zes_pci_state_t pci_state{};
-                    HWS_LEVEL_ZERO_ERROR_CHECK(zesDevicePciGetState(device, &pci_state))
-                    if (memory_samples_.pcie_link_speed_.has_value()) {
-                        memory_samples_.pcie_link_speed_->push_back(static_cast<decltype(memory_samples_.pcie_link_speed_)::value_type::value_type>(static_cast<double>(pci_state.speed.maxBandwidth) / 1e6));
-                    }
-                    if (memory_samples_.num_pcie_lanes_.has_value()) {
-                        memory_samples_.num_pcie_lanes_->push_back(pci_state.speed.width);
-                    }
-                    if (memory_samples_.pcie_link_generation_.has_value()) {
-                        memory_samples_.pcie_link_generation_->push_back(pci_state.speed.gen);
-                    }
+                if (memory_samples_.memory_used_.has_value() && memory_samples_.visible_memory_total_.has_value()) {
+                    memory_samples_.memory_used_.value()[memory_module_name].push_back(memory_samples_.visible_memory_total_.value()[memory_module_name] - mem_state.free);
                 }
             }
+        }
 
-            // retrieve temperature related samples
-            if (this->sample_category_enabled(sample_category::temperature)) {
-                if (!psu_handles.empty()) {
-                    if (temperature_samples_.psu_temperature_.has_value()) {
-                        // NOTE: only the first PSU is used here
-                        zes_psu_state_t psu_state{};
-                        HWS_LEVEL_ZERO_ERROR_CHECK(zesPsuGetState(psu_handles.front(), &psu_state))
-                        temperature_samples_.psu_temperature_->push_back(psu_state.temperature);
-                    }
-                }
+        if (memory_samples_.pcie_link_speed_.has_value() || memory_samples_.num_pcie_lanes_.has_value() || memory_samples_.pcie_link_generation_.has_value()) {
+            // the current PCIe stats
+            zes_pci_state_t pci_state{};
+            HWS_LEVEL_ZERO_ERROR_CHECK(zesDevicePciGetState(device, &pci_state))
+            if (memory_samples_.pcie_link_speed_.has_value()) {
+                memory_samples_.pcie_link_speed_->push_back(static_cast<decltype(memory_samples_.pcie_link_speed_)::value_type::value_type>(static_cast<double>(pci_state.speed.maxBandwidth) / 1e6));
+            }
+            if (memory_samples_.num_pcie_lanes_.has_value()) {
+                memory_samples_.num_pcie_lanes_->push_back(pci_state.speed.width);
+            }
+            if (memory_samples_.pcie_link_generation_.has_value()) {
+                memory_samples_.pcie_link_generation_->push_back(pci_state.speed.gen);
+            }
+        }
+    }
 
-                for (zes_temp_handle_t handle : temperature_handles) {
-                    zes_temp_properties_t prop{};
-                    HWS_LEVEL_ZERO_ERROR_CHECK(zesTemperatureGetProperties(handle, &prop))
+    // retrieve temperature related samples
+    if (this->sample_category_due(sample_category::temperature)) {
+        if (!psu_handles.empty()) {
+            if (temperature_samples_.psu_temperature_.has_value()) {
+                // NOTE: only the first PSU is used here
+                zes_psu_state_t psu_state{};
+                HWS_LEVEL_ZERO_ERROR_CHECK(zesPsuGetState(psu_handles.front(), &psu_state))
+                temperature_samples_.psu_temperature_->push_back(psu_state.temperature);
+            }
+        }
 
-                    switch (prop.type) {
-                        case ZES_TEMP_SENSORS_GLOBAL:
-                            {
-                                if (temperature_samples_.global_temperature_.has_value()) {
-                                    double temp{};
-                                    HWS_LEVEL_ZERO_ERROR_CHECK(zesTemperatureGetState(handle, &temp))
-                                    temperature_samples_.global_temperature_->push_back(temp);
-                                }
-                            }
-                            break;
-                        case ZES_TEMP_SENSORS_GPU:
-                            {
-                                if (temperature_samples_.temperature_.has_value()) {
-                                    double temp{};
-                                    HWS_LEVEL_ZERO_ERROR_CHECK(zesTemperatureGetState(handle, &temp))
-                                    temperature_samples_.temperature_->push_back(temp);
-                                }
-                            }
-                            break;
-                        case ZES_TEMP_SENSORS_MEMORY:
-                            {
-                                if (temperature_samples_.memory_temperature_.has_value()) {
-                                    double temp{};
-                                    HWS_LEVEL_ZERO_ERROR_CHECK(zesTemperatureGetState(handle, &temp))
-                                    temperature_samples_.memory_temperature_->push_back(temp);
-                                }
-                            }
-                            break;
-                        default:
-                            break;
+        for (zes_temp_handle_t handle : temperature_handles) {
+            zes_temp_properties_t prop{};
+            HWS_LEVEL_ZERO_ERROR_CHECK(zesTemperatureGetProperties(handle, &prop))
+
+            switch (prop.type) {
+                case ZES_TEMP_SENSORS_GLOBAL:
+                    {
+                        if (temperature_samples_.global_temperature_.has_value()) {
+                            double temp{};
+                            HWS_LEVEL_ZERO_ERROR_CHECK(zesTemperatureGetState(handle, &temp))
+                            temperature_samples_.global_temperature_->push_back(temp);
+                        }
                     }
-                }
+                    break;
+                case ZES_TEMP_SENSORS_GPU:
+                    {
+                        if (temperature_samples_.temperature_.has_value()) {
+                            double temp{};
+                            HWS_LEVEL_ZERO_ERROR_CHECK(zesTemperatureGetState(handle, &temp))
+                            temperature_samples_.temperature_->push_back(temp);
+                        }
+                    }
+                    break;
+                case ZES_TEMP_SENSORS_MEMORY:
+                    {
+                        if (temperature_samples_.memory_temperature_.has_value()) {
+                            double temp{};
+                            HWS_LEVEL_ZERO_ERROR_CHECK(zesTemperatureGetState(handle, &temp))
+                            temperature_samples_.memory_temperature_->push_back(temp);
+                        }
+                    }
+                    break;
+                default:
+                    break;
             }
         }
 
-        // wait for the sampling interval to pass to retrieve the next sample
-        std::this_thread::sleep_for(this->sampling_interval());
+        this->track_sample_change(sample_category::temperature, temperature_samples_.temperature_);
+    }
+}
+
+std::optional<double> gpu_intel_hardware_sampler::read_energy_counter() {
+    auto &impl = device_.get_impl();
+
+    // the power domains used in the sampling loop may not be enumerated yet (or at all) -> enumerate the first power domain separately once
+    std::call_once(impl.energy_counter_handle_once, [&impl]() {
+        std::uint32_t num_power_domains{ 1 };
+        if (zesDeviceEnumPowerDomains(impl.device, &num_power_domains, &impl.energy_counter_handle) != ZE_RESULT_SUCCESS || num_power_domains == 0) {
+            impl.energy_counter_handle = nullptr;
+        }
+    });
+    if (impl.energy_counter_handle == nullptr) {
+        return std::nullopt;
+    }
+
+    // NOTE: only the first power domain is used here (as in the sampling loop)
+    zes_power_energy_counter_t energy_counter{};
+    if (zesPowerGetEnergyCounter(impl.energy_counter_handle, &energy_counter) != ZE_RESULT_SUCCESS) {
+        return std::nullopt;
     }
+    // the energy counter is in µJ
+    return static_cast<double>(energy_counter.energy) / 1000.0 / 1000.0;
+}
+
+std::optional<double> gpu_intel_hardware_sampler::latest_power_usage() const {
+    return latest_sample(power_samples_.power_usage_);
+}
+
+std::optional<double> gpu_intel_hardware_sampler::latest_temperature() const {
+    return latest_sample(temperature_samples_.temperature_);
+}
+
+std::vector<std::string> gpu_intel_hardware_sampler::numeric_sample_names() const {
+    std::vector<std::string> names{};
+    detail::append_numeric_sample_names(general_samples_, names);
+    detail::append_numeric_sample_names(clock_samples_, names);
+    detail::append_numeric_sample_names(power_samples_, names);
+    detail::append_numeric_sample_names(memory_samples_, names);
+    detail::append_numeric_sample_names(temperature_samples_, names);
+    return names;
+}
+
+void gpu_intel_hardware_sampler::latest_numeric_sample_values(const sample_category sampled, std::vector<double> &values) const {
+    std::size_t pos = 0;
+    detail::append_latest_numeric_sample_values(general_samples_, sampled, values, pos);
+    detail::append_latest_numeric_sample_values(clock_samples_, sampled, values, pos);
+    detail::append_latest_numeric_sample_values(power_samples_, sampled, values, pos);
+    detail::append_latest_numeric_sample_values(memory_samples_, sampled, values, pos);
+    detail::append_latest_numeric_sample_values(temperature_samples_, sampled, values, pos);
 }
 
 std::string gpu_intel_hardware_sampler::device_identification() const {
@@ -694,8 +758,8 @@ std::string gpu_intel_hardware_sampler::device_identification() const {
 
 std::string gpu_intel_hardware_sampler::samples_only_as_yaml_string() const {
     // check whether it's safe to generate the YAML entry
-    if (this->is_sampling()) {
-        throw std::runtime_error{ "Can't create the final YAML entry if the hardware sampler is still running!" };
+    if (!this->samples_accessible()) {
+        throw std::runtime_error{ "Can't create the YAML entry before the initial samples have been retrieved!" };
     }
 
     return fmt::format("{}{}"
@@ -715,7 +779,7 @@ std::string gpu_intel_hardware_sampler::samples_only_as_yaml_string() const {
 }
 
 std::ostream &operator<<(std::ostream &out, const gpu_intel_hardware_sampler &sampler) {
-    if (sampler.is_sampling()) {
+    if (!sampler.samples_accessible()) {
         out.setstate(std::ios_base::failbit);
         return out;
     } else {
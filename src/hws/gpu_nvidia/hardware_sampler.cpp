@@ -12,6 +12,7 @@
 #include "hws/gpu_nvidia/utility.hpp"                  // HWS_NVML_ERROR_CHECK
 #include "hws/hardware_sampler.hpp"                    // hws::hardware_sampler
 #include "hws/sample_category.hpp"                     // hws::sample_category
+#include "hws/sample_metric.hpp"                       // hws::detail::{append_numeric_sample_names, append_latest_numeric_sample_values}
 #include "hws/utility.hpp"                             // hws::detail::time_points_to_epoch
 
 #include "fmt/chrono.h"  // direct formatting of std::chrono types
@@ -20,17 +21,16 @@
 #include "nvml.h"        // NVML runtime functions
 
 #include <algorithm>  // std::min_element, std::sort, std::transform
-#include <chrono>     // std::chrono::{steady_clock, duration_cast, milliseconds}
+#include <chrono>     // std::chrono::{steady_clock, duration_cast, nanoseconds}
 #include <cstddef>    // std::size_t
 #include <exception>  // std::exception, std::terminate
 #include <ios>        // std::ios_base
 #include <iostream>   // std::cerr, std::endl
 #include <numeric>    // std::iota
-#include <optional>   // std::optional
+#include <optional>   // std::optional, std::nullopt
 #include <ostream>    // std::ostream
 #include <stdexcept>  // std::runtime_error
 #include <string>     // std::string
-#include <thread>     // std::this_thread
 #include <vector>     // std::vector
 
 namespace hws {
@@ -41,10 +41,10 @@ gpu_nvidia_hardware_sampler::gpu_nvidia_hardware_sampler(const sample_category c
 gpu_nvidia_hardware_sampler::gpu_nvidia_hardware_sampler(const std::size_t device_id, const sample_category category) :
     gpu_nvidia_hardware_sampler{ device_id, HWS_SAMPLING_INTERVAL, category } { }
 
-gpu_nvidia_hardware_sampler::gpu_nvidia_hardware_sampler(const std::chrono::milliseconds sampling_interval, const sample_category category) :
+gpu_nvidia_hardware_sampler::gpu_nvidia_hardware_sampler(const std::chrono::nanoseconds sampling_interval, const sample_category category) :
     gpu_nvidia_hardware_sampler{ 0, sampling_interval, category } { }
 
-gpu_nvidia_hardware_sampler::gpu_nvidia_hardware_sampler(const std::size_t device_id, const std::chrono::milliseconds sampling_interval, const sample_category category) :
+gpu_nvidia_hardware_sampler::gpu_nvidia_hardware_sampler(const std::size_t device_id, const std::chrono::nanoseconds sampling_interval, const sample_category category) :
     hardware_sampler{ sampling_interval, category } {
     // make sure that nvmlInit is only called once for all instances
     if (instances_++ == 0) {
@@ -80,7 +80,7 @@ gpu_nvidia_hardware_sampler::~gpu_nvidia_hardware_sampler() {
     }
 }
 
-void gpu_nvidia_hardware_sampler::sampling_loop() {
+void gpu_nvidia_hardware_sampler::initialize_samples() {
     // get the nvml handle from the device
     nvmlDevice_t device = device_.get_impl().device;
 
@@ -88,10 +88,6 @@ void gpu_nvidia_hardware_sampler::sampling_loop() {
     // add samples where we only have to retrieve the value once
     //
 
-    this->add_time_point(std::chrono::steady_clock::now());
-
-    double initial_total_power_consumption{};  // initial total power consumption in J
-
     // retrieve initial general information
     if (this->sample_category_enabled(sample_category::general)) {
         // fixed information -> only retrieved once
@@ -177,13 +173,13 @@ void gpu_nvidia_hardware_sampler::sampling_loop() {
         // queried samples -> retrieved every iteration if available
         nvmlPstates_t pstate{};
         if (nvmlDeviceGetPerformanceState(device, &pstate) == NVML_SUCCESS) {
-            general_samples_.performance_level_ = decltype(general_samples_.performance_level_)::value_type{ static_cast<decltype(general_samples_.performance_level_)::value_type::value_type>(pstate) };
+            general_samples_.performance_level_ = decltype(general_samples_.performance_level_)::value_type{ this->column_config(), { static_cast<decltype(general_samples_.performance_level_)::value_type::value_type>(pstate) } };
         }
 
         nvmlUtilization_t util{};
         if (nvmlDeviceGetUtilizationRates(device, &util) == NVML_SUCCESS) {
-            general_samples_.compute_utilization_ = decltype(general_samples_.compute_utilization_)::value_type{ util.gpu };
-            general_samples_.memory_utilization_ = decltype(general_samples_.memory_utilization_)::value_type{ util.memory };
+            general_samples_.compute_utilization_ = decltype(general_samples_.compute_utilization_)::value_type{ this->column_config(), { util.gpu } };
+            general_samples_.memory_utilization_ = decltype(general_samples_.memory_utilization_)::value_type{ this->column_config(), { util.memory } };
         }
     }
 
@@ -254,31 +250,31 @@ void gpu_nvidia_hardware_sampler::sampling_loop() {
         // queried samples -> retrieved every iteration if available
         unsigned int clock_graph{};
         if (nvmlDeviceGetClockInfo(device, NVML_CLOCK_GRAPHICS, &clock_graph) == NVML_SUCCESS) {
-            clock_samples_.clock_frequency_ = decltype(clock_samples_.clock_frequency_)::value_type{ static_cast<decltype(clock_samples_.clock_frequency_)::value_type::value_type>(clock_graph) };
+            clock_samples_.clock_frequency_ = decltype(clock_samples_.clock_frequency_)::value_type{ this->column_config(), { static_cast<decltype(clock_samples_.clock_frequency_)::value_type::value_type>(clock_graph) } };
         }
 
         unsigned int clock_sm{};
         if (nvmlDeviceGetClockInfo(device, NVML_CLOCK_SM, &clock_sm) == NVML_SUCCESS) {
-            clock_samples_.sm_clock_frequency_ = decltype(clock_samples_.sm_clock_frequency_)::value_type{ static_cast<decltype(clock_samples_.sm_clock_frequency_)::value_type::value_type>(clock_sm) };
+            clock_samples_.sm_clock_frequency_ = decltype(clock_samples_.sm_clock_frequency_)::value_type{ this->column_config(), { static_cast<decltype(clock_samples_.sm_clock_frequency_)::value_type::value_type>(clock_sm) } };
         }
 
         unsigned int clock_mem{};
         if (nvmlDeviceGetClockInfo(device, NVML_CLOCK_MEM, &clock_mem) == NVML_SUCCESS) {
-            clock_samples_.memory_clock_frequency_ = decltype(clock_samples_.memory_clock_frequency_)::value_type{ static_cast<decltype(clock_samples_.memory_clock_frequency_)::value_type::value_type>(clock_mem) };
+            clock_samples_.memory_clock_frequency_ = decltype(clock_samples_.memory_clock_frequency_)::value_type{ this->column_config(), { static_cast<decltype(clock_samples_.memory_clock_frequency_)::value_type::value_type>(clock_mem) } };
         }
 
 #if CUDA_VERSION >= 12000
         decltype(clock_samples_.throttle_reason_)::value_type::value_type clock_throttle_reason{};
         if (nvmlDeviceGetCurrentClocksEventReasons(device, &clock_throttle_reason) == NVML_SUCCESS) {
-            clock_samples_.throttle_reason_ = decltype(clock_samples_.throttle_reason_)::value_type{ clock_throttle_reason };
-            clock_samples_.throttle_reason_string_ = decltype(clock_samples_.throttle_reason_string_)::value_type{ detail::throttle_event_reason_to_string(clock_throttle_reason) };
+            clock_samples_.throttle_reason_ = decltype(clock_samples_.throttle_reason_)::value_type{ this->column_config(), { clock_throttle_reason } };
+            clock_samples_.throttle_reason_string_ = decltype(clock_samples_.throttle_reason_string_)::value_type{ this->column_config(), { detail::throttle_event_reason_to_string(clock_throttle_reason) } };
         }
 #endif
 
         nvmlEnableState_t mode{};
         nvmlEnableState_t default_mode{};
         if (nvmlDeviceGetAutoBoostedClocksEnabled(device, &mode, &default_mode) == NVML_SUCCESS) {
-            clock_samples_.auto_boosted_clock_ = decltype(clock_samples_.auto_boosted_clock_)::value_type{ mode == NVML_FEATURE_ENABLED };
+            clock_samples_.auto_boosted_clock_ = decltype(clock_samples_.auto_boosted_clock_)::value_type{ this->column_config(), { mode == NVML_FEATURE_ENABLED } };
         }
     }
 
@@ -323,18 +319,18 @@ void gpu_nvidia_hardware_sampler::sampling_loop() {
         // queried samples -> retrieved every iteration if available
         unsigned int power_usage{};
         if (nvmlDeviceGetPowerUsage(device, &power_usage) == NVML_SUCCESS) {
-            power_samples_.power_usage_ = decltype(power_samples_.power_usage_)::value_type{ static_cast<decltype(power_samples_.power_usage_)::value_type::value_type>(power_usage) / 1000.0 };
+            power_samples_.power_usage_ = decltype(power_samples_.power_usage_)::value_type{ this->column_config(), { static_cast<decltype(power_samples_.power_usage_)::value_type::value_type>(power_usage) / 1000.0 } };
         }
 
         unsigned long long power_total_energy_consumption{};
         if (nvmlDeviceGetTotalEnergyConsumption(device, &power_total_energy_consumption) == NVML_SUCCESS) {
-            initial_total_power_consumption = static_cast<decltype(power_samples_.power_total_energy_consumption_)::value_type::value_type>(power_total_energy_consumption) / 1000.0;
-            power_samples_.power_total_energy_consumption_ = decltype(power_samples_.power_total_energy_consumption_)::value_type{ 0.0 };
+            initial_total_power_consumption_ = static_cast<decltype(power_samples_.power_total_energy_consumption_)::value_type::value_type>(power_total_energy_consumption) / 1000.0;
+            power_samples_.power_total_energy_consumption_ = decltype(power_samples_.power_total_energy_consumption_)::value_type{ this->column_config(), { 0.0 } };
         }
 
         nvmlPstates_t pstate{};
         if (nvmlDeviceGetPowerState(device, &pstate) == NVML_SUCCESS) {
-            power_samples_.power_profile_ = decltype(power_samples_.power_profile_)::value_type{ static_cast<decltype(power_samples_.power_profile_)::value_type::value_type>(pstate) };
+            power_samples_.power_profile_ = decltype(power_samples_.power_profile_)::value_type{ this->column_config(), { static_cast<decltype(power_samples_.power_profile_)::value_type::value_type>(pstate) } };
         }
     }
 
@@ -345,8 +341,8 @@ void gpu_nvidia_hardware_sampler::sampling_loop() {
         if (nvmlDeviceGetMemoryInfo(device, &memory_info) == NVML_SUCCESS) {
             memory_samples_.memory_total_ = memory_info.total;
             // queried samples -> retrieved every iteration if available
-            memory_samples_.memory_free_ = decltype(memory_samples_.memory_free_)::value_type{ memory_info.free };
-            memory_samples_.memory_used_ = decltype(memory_samples_.memory_used_)::value_type{ memory_info.used };
+            memory_samples_.memory_free_ = decltype(memory_samples_.memory_free_)::value_type{ this->column_config(), { memory_info.free } };
+            memory_samples_.memory_used_ = decltype(memory_samples_.memory_used_)::value_type{ this->column_config(), { memory_info.used } };
         }
 
         decltype(memory_samples_.memory_bus_width_)::value_type memory_bus_width{};
@@ -372,12 +368,12 @@ void gpu_nvidia_hardware_sampler::sampling_loop() {
         // queried samples -> retrieved every iteration if available
         decltype(memory_samples_.num_pcie_lanes_)::value_type::value_type num_pcie_lanes{};
         if (nvmlDeviceGetCurrPcieLinkWidth(device, &num_pcie_lanes) == NVML_SUCCESS) {
-            memory_samples_.num_pcie_lanes_ = decltype(memory_samples_.num_pcie_lanes_)::value_type{ num_pcie_lanes };
+            memory_samples_.num_pcie_lanes_ = decltype(memory_samples_.num_pcie_lanes_)::value_type{ this->column_config(), { num_pcie_lanes } };
         }
 
         decltype(memory_samples_.pcie_link_generation_)::value_type::value_type pcie_link_generation{};
         if (nvmlDeviceGetCurrPcieLinkGeneration(device, &pcie_link_generation) == NVML_SUCCESS) {
-            memory_samples_.pcie_link_generation_ = decltype(memory_samples_.pcie_link_generation_)::value_type{ pcie_link_generation };
+            memory_samples_.pcie_link_generation_ = decltype(memory_samples_.pcie_link_generation_)::value_type{ this->column_config(), { pcie_link_generation } };
         }
     }
 
@@ -411,140 +407,197 @@ void gpu_nvidia_hardware_sampler::sampling_loop() {
         // queried samples -> retrieved every iteration if available
         unsigned int fan_speed_percentage{};
         if (nvmlDeviceGetFanSpeed(device, &fan_speed_percentage) == NVML_SUCCESS) {
-            temperature_samples_.fan_speed_percentage_ = decltype(temperature_samples_.fan_speed_percentage_)::value_type{ static_cast<decltype(temperature_samples_.fan_speed_percentage_)::value_type::value_type>(fan_speed_percentage) };
+            temperature_samples_.fan_speed_percentage_ = decltype(temperature_samples_.fan_speed_percentage_)::value_type{ this->column_config(), { static_cast<decltype(temperature_samples_.fan_speed_percentage_)::value_type::value_type>(fan_speed_percentage) } };
         }
 
         unsigned int temperature{};
         if (nvmlDeviceGetTemperature(device, NVML_TEMPERATURE_GPU, &temperature) == NVML_SUCCESS) {
-            temperature_samples_.temperature_ = decltype(temperature_samples_.temperature_)::value_type{ static_cast<decltype(temperature_samples_.temperature_)::value_type::value_type>(temperature) };
+            temperature_samples_.temperature_ = decltype(temperature_samples_.temperature_)::value_type{ this->column_config(), { static_cast<decltype(temperature_samples_.temperature_)::value_type::value_type>(temperature) } };
         }
     }
 
-    //
-    // loop until stop_sampling() is called
-    //
+    // drop the queried samples that haven't been selected -> their NVML calls are skipped in the sampling loop
+    if (this->uses_sample_metric_selection()) {
+        this->apply_sample_metric_selection(general_samples_);
+        this->apply_sample_metric_selection(clock_samples_);
+        this->apply_sample_metric_selection(power_samples_);
+        this->apply_sample_metric_selection(memory_samples_);
+        this->apply_sample_metric_selection(temperature_samples_);
+    }
+}
 
-    while (!this->has_sampling_stopped()) {
-        // only sample values if the sampler currently isn't paused
-        if (this->is_sampling()) {
-            // add current time point
-            this->add_time_point(std::chrono::steady_clock::now());
-
-            // retrieve general samples
-            if (this->sample_category_enabled(sample_category::general)) {
-                if (general_samples_.performance_level_.has_value()) {
-                    nvmlPstates_t pstate{};
-                    HWS_NVML_ERROR_CHECK(nvmlDeviceGetPerformanceState(device, &pstate))
-                    general_samples_.performance_level_->push_back(static_cast<decltype(general_samples_.performance_level_)::value_type::value_type>(pstate));
-                }
+void gpu_nvidia_hardware_sampler::sample() {
+    // get the nvml handle from the device
+    nvmlDevice_t device = device_.get_impl().device;
 
-                if (general_samples_.compute_utilization_.has_value() && general_samples_.memory_utilization_.has_value()) {
-                    nvmlUtilization_t util{};
-                    HWS_NVML_ERROR_CHECK(nvmlDeviceGetUtilizationRates(device, &util))
-                    general_samples_.compute_utilization_->push_back(util.gpu);
-                    general_samples_.memory_utilization_->push_back(util.memory);
-                }
+    // retrieve general samples
+    if (this->sample_category_due(sample_category::general)) {
+        if (general_samples_.performance_level_.has_value()) {
+            nvmlPstates_t pstate{};
+            HWS_NVML_ERROR_CHECK(nvmlDeviceGetPerformanceState(device, &pstate))
+            general_samples_.performance_level_->push_back(static_cast<decltype(general_samples_.performance_level_)::value_type::value_type>(pstate));
+        }
+
+        if (general_samples_.compute_utilization_.has_value() || general_samples_.memory_utilization_.has_value()) {
+            nvmlUtilization_t util{};
+            HWS_NVML_ERROR_CHECK(nvmlDeviceGetUtilizationRates(device, &util))
+            if (general_samples_.compute_utilization_.has_value()) {
+                general_samples_.compute_utilization_->push_back(util.gpu);
             }
+            if (general_samples_.memory_utilization_.has_value()) {
+                general_samples_.memory_utilization_->push_back(util.memory);
+            }
+        }
 
-            // retrieve clock related samples
-            if (this->sample_category_enabled(sample_category::clock)) {
-                if (clock_samples_.clock_frequency_.has_value()) {
-                    unsigned int value{};
-                    HWS_NVML_ERROR_CHECK(nvmlDeviceGetClockInfo(device, NVML_CLOCK_GRAPHICS, &value))
-                    clock_samples_.clock_frequency_->push_back(static_cast<decltype(clock_samples_.clock_frequency_)::value_type::value_type>(value));
-                }
+        this->track_sample_change(sample_category::general, general_samples_.compute_utilization_);
+    }
 
-                if (clock_samples_.sm_clock_frequency_.has_value()) {
-                    unsigned int value{};
-                    HWS_NVML_ERROR_CHECK(nvmlDeviceGetClockInfo(device, NVML_CLOCK_SM, &value))
-                    clock_samples_.sm_clock_frequency_->push_back(static_cast<decltype(clock_samples_.sm_clock_frequency_)::value_type::value_type>(value));
-                }
+    // retrieve clock related samples
+    if (this->sample_category_due(sample_category::clock)) {
+        if (clock_samples_.clock_frequency_.has_value()) {
+            unsigned int value{};
+            HWS_NVML_ERROR_CHECK(nvmlDeviceGetClockInfo(device, NVML_CLOCK_GRAPHICS, &value))
+            clock_samples_.clock_frequency_->push_back(static_cast<decltype(clock_samples_.clock_frequency_)::value_type::value_type>(value));
+        }
 
-                if (clock_samples_.memory_clock_frequency_.has_value()) {
-                    unsigned int value{};
-                    HWS_NVML_ERROR_CHECK(nvmlDeviceGetClockInfo(device, NVML_CLOCK_MEM, &value))
-                    clock_samples_.memory_clock_frequency_->push_back(static_cast<decltype(clock_samples_.memory_clock_frequency_)::value_type::value_type>(value));
-                }
+        if (clock_samples_.sm_clock_frequency_.has_value()) {
+            unsigned int value{};
+            HWS_NVML_ERROR_CHECK(nvmlDeviceGetClockInfo(device, NVML_CLOCK_SM, &value))
+            clock_samples_.sm_clock_frequency_->push_back(static_cast<decltype(clock_samples_.sm_clock_frequency_)::value_type::value_type>(value));
+        }
+
+        if (clock_samples_.memory_clock_frequency_.has_value()) {
+            unsigned int value{};
+            HWS_NVML_ERROR_CHECK(nvmlDeviceGetClockInfo(device, NVML_CLOCK_MEM, &value))
+            clock_samples_.memory_clock_frequency_->push_back(static_cast<decltype(clock_samples_.memory_clock_frequency_)::value_type::value_type>(value));
+        }
 
 #if CUDA_VERSION >= 12000
-                if (clock_samples_.throttle_reason_string_.has_value()) {
-                    decltype(clock_samples_.throttle_reason_)::value_type::value_type value{};
-                    HWS_NVML_ERROR_CHECK(nvmlDeviceGetCurrentClocksEventReasons(device, &value))
-                    clock_samples_.throttle_reason_->push_back(value);
-                    clock_samples_.throttle_reason_string_->push_back(detail::throttle_event_reason_to_string(value));
-                }
+        if (clock_samples_.throttle_reason_.has_value() || clock_samples_.throttle_reason_string_.has_value()) {
+            decltype(clock_samples_.throttle_reason_)::value_type::value_type value{};
+            HWS_NVML_ERROR_CHECK(nvmlDeviceGetCurrentClocksEventReasons(device, &value))
+            if (clock_samples_.throttle_reason_.has_value()) {
+                clock_samples_.throttle_reason_->push_back(value);
+            }
+            if (clock_samples_.throttle_reason_string_.has_value()) {
+                clock_samples_.throttle_reason_string_->push_back(detail::throttle_event_reason_to_string(value));
+            }
+        }
 #endif
 
-                if (clock_samples_.auto_boosted_clock_.has_value()) {
-                    nvmlEnableState_t mode{};
-                    nvmlEnableState_t default_mode{};
-                    HWS_NVML_ERROR_CHECK(nvmlDeviceGetAutoBoostedClocksEnabled(device, &mode, &default_mode))
-                    clock_samples_.auto_boosted_clock_->push_back(mode == NVML_FEATURE_ENABLED);
-                }
-            }
+        if (clock_samples_.auto_boosted_clock_.has_value()) {
+            nvmlEnableState_t mode{};
+            nvmlEnableState_t default_mode{};
+            HWS_NVML_ERROR_CHECK(nvmlDeviceGetAutoBoostedClocksEnabled(device, &mode, &default_mode))
+            clock_samples_.auto_boosted_clock_->push_back(mode == NVML_FEATURE_ENABLED);
+        }
 
-            // retrieve power related information
-            if (this->sample_category_enabled(sample_category::power)) {
-                if (power_samples_.power_profile_.has_value()) {
-                    nvmlPstates_t pstate{};
-                    HWS_NVML_ERROR_CHECK(nvmlDeviceGetPowerState(device, &pstate))
-                    power_samples_.power_profile_->push_back(static_cast<decltype(power_samples_.power_profile_)::value_type::value_type>(pstate));
-                }
+        this->track_sample_change(sample_category::clock, clock_samples_.clock_frequency_);
+    }
 
-                if (power_samples_.power_usage_.has_value()) {
-                    unsigned int value{};
-                    HWS_NVML_ERROR_CHECK(nvmlDeviceGetPowerUsage(device, &value))
-                    power_samples_.power_usage_->push_back(static_cast<decltype(power_samples_.power_usage_)::value_type::value_type>(value) / 1000.0);
-                }
+    // retrieve power related information
+    if (this->sample_category_due(sample_category::power)) {
+        if (power_samples_.power_profile_.has_value()) {
+            nvmlPstates_t pstate{};
+            HWS_NVML_ERROR_CHECK(nvmlDeviceGetPowerState(device, &pstate))
+            power_samples_.power_profile_->push_back(static_cast<decltype(power_samples_.power_profile_)::value_type::value_type>(pstate));
+        }
 
-                if (power_samples_.power_total_energy_consumption_.has_value()) {
-                    unsigned long long value{};
-                    HWS_NVML_ERROR_CHECK(nvmlDeviceGetTotalEnergyConsumption(device, &value))
-                    power_samples_.power_total_energy_consumption_->push_back((static_cast<decltype(power_samples_.power_total_energy_consumption_)::value_type::value_type>(value) / 1000.0) - initial_total_power_consumption);
-                }
-            }
+        if (power_samples_.power_usage_.has_value()) {
+            unsigned int value{};
+            HWS_NVML_ERROR_CHECK(nvmlDeviceGetPowerUsage(device, &value))
+            power_samples_.power_usage_->push_back(static_cast<decltype(power_samples_.power_usage_)::value_type::value_type>(value) / 1000.0);
+        }
 
-            // retrieve memory related information
-            if (this->sample_category_enabled(sample_category::memory)) {
-                if (memory_samples_.memory_free_.has_value() && memory_samples_.memory_used_.has_value()) {
-                    nvmlMemory_t memory_info{};
-                    HWS_NVML_ERROR_CHECK(nvmlDeviceGetMemoryInfo(device, &memory_info))
-                    memory_samples_.memory_free_->push_back(memory_info.free);
-                    memory_samples_.memory_used_->push_back(memory_info.used);
-                }
+        if (power_samples_.power_total_energy_consumption_.has_value()) {
+            unsigned long long value{};
+            HWS_NVML_ERROR_CHECK(nvmlDeviceGetTotalEnergyConsumption(device, &value))
+            power_samples_.power_total_energy_consumption_->push_back((static_cast<decltype(power_samples_.power_total_energy_consumption_)::value_type::value_type>(value) / 1000.0) - initial_total_power_consumption_);
+        }
 
-                if (memory_samples_.num_pcie_lanes_.has_value()) {
-                    decltype(memory_samples_.num_pcie_lanes_)::value_type::value_type value{};
-                    HWS_NVML_ERROR_CHECK(nvmlDeviceGetCurrPcieLinkWidth(device, &value))
-                    memory_samples_.num_pcie_lanes_->push_back(value);
-                }
+        this->track_sample_change(sample_category::power, power_samples_.power_usage_);
+    }
 
-                if (memory_samples_.pcie_link_generation_.has_value()) {
-                    decltype(memory_samples_.pcie_link_generation_)::value_type::value_type value{};
-                    HWS_NVML_ERROR_CHECK(nvmlDeviceGetCurrPcieLinkGeneration(device, &value))
-                    memory_samples_.pcie_link_generation_->push_back(value);
-                }
+    // retrieve memory related information
+    if (this->sample_category_due(sample_category::memory)) {
+        if (memory_samples_.memory_free_.has_value() || memory_samples_.memory_used_.has_value()) {
+            nvmlMemory_t memory_info{};
+            HWS_NVML_ERROR_CHECK(nvmlDeviceGetMemoryInfo(device, &memory_info))
+            if (memory_samples_.memory_free_.has_value()) {
+                memory_samples_.memory_free_->push_back(memory_info.free);
+            }
+            if (memory_samples_.memory_used_.has_value()) {
+                memory_samples_.memory_used_->push_back(memory_info.used);
             }
+        }
 
-            // retrieve temperature related information
-            if (this->sample_category_enabled(sample_category::temperature)) {
-                if (temperature_samples_.fan_speed_percentage_.has_value()) {
-                    unsigned int value{};
-                    HWS_NVML_ERROR_CHECK(nvmlDeviceGetFanSpeed(device, &value))
-                    temperature_samples_.fan_speed_percentage_->push_back(static_cast<decltype(temperature_samples_.fan_speed_percentage_)::value_type::value_type>(value));
-                }
+        if (memory_samples_.num_pcie_lanes_.has_value()) {
+            decltype(memory_samples_.num_pcie_lanes_)::value_type::value_type value{};
+            HWS_NVML_ERROR_CHECK(nvmlDeviceGetCurrPcieLinkWidth(device, &value))
+            memory_samples_.num_pcie_lanes_->push_back(value);
+        }
 
-                if (temperature_samples_.temperature_.has_value()) {
-                    unsigned int value{};
-                    HWS_NVML_ERROR_CHECK(nvmlDeviceGetTemperature(device, NVML_TEMPERATURE_GPU, &value))
-                    temperature_samples_.temperature_->push_back(static_cast<decltype(temperature_samples_.temperature_)::value_type::value_type>(value));
-                }
-            }
+        if (memory_samples_.pcie_link_generation_.has_value()) {
+            decltype(memory_samples_.pcie_link_generation_)::value_type::value_type value{};
+            HWS_NVML_ERROR_CHECK(nvmlDeviceGetCurrPcieLinkGeneration(device, &value))
+            memory_samples_.pcie_link_generation_->push_back(value);
+        }
+
+        this->track_sample_change(sample_category::memory, memory_samples_.memory_used_);
+    }
+
+    // retrieve temperature related information
+    if (this->sample_category_due(sample_category::temperature)) {
+        if (temperature_samples_.fan_speed_percentage_.has_value()) {
+            unsigned int value{};
+            HWS_NVML_ERROR_CHECK(nvmlDeviceGetFanSpeed(device, &value))
+            temperature_samples_.fan_speed_percentage_->push_back(static_cast<decltype(temperature_samples_.fan_speed_percentage_)::value_type::value_type>(value));
+        }
+
+        if (temperature_samples_.temperature_.has_value()) {
+            unsigned int value{};
+            HWS_NVML_ERROR_CHECK(nvmlDeviceGetTemperature(device, NVML_TEMPERATURE_GPU, &value))
+            temperature_samples_.temperature_->push_back(static_cast<decltype(temperature_samples_.temperature_)::value_type::value_type>(value));
         }
 
-        // wait for the sampling interval to pass to retrieve the next sample
-        std::this_thread::sleep_for(this->sampling_interval());
+        this->track_sample_change(sample_category::temperature, temperature_samples_.temperature_);
+    }
+}
+
+std::optional<double> gpu_nvidia_hardware_sampler::read_energy_counter() {
+    // the total energy consumption since the driver has been loaded in mJ
+    unsigned long long value{};
+    if (nvmlDeviceGetTotalEnergyConsumption(device_.get_impl().device, &value) != NVML_SUCCESS) {
+        return std::nullopt;
     }
+    return static_cast<double>(value) / 1000.0;
+}
+
+std::optional<double> gpu_nvidia_hardware_sampler::latest_power_usage() const {
+    return latest_sample(power_samples_.power_usage_);
+}
+
+std::optional<double> gpu_nvidia_hardware_sampler::latest_temperature() const {
+    return latest_sample(temperature_samples_.temperature_);
+}
+
+std::vector<std::string> gpu_nvidia_hardware_sampler::numeric_sample_names() const {
+    std::vector<std::string> names{};
+    detail::append_numeric_sample_names(general_samples_, names);
+    detail::append_numeric_sample_names(clock_samples_, names);
+    detail::append_numeric_sample_names(power_samples_, names);
+    detail::append_numeric_sample_names(memory_samples_, names);
+    detail::append_numeric_sample_names(temperature_samples_, names);
+    return names;
+}
+
+void gpu_nvidia_hardware_sampler::latest_numeric_sample_values(const sample_category sampled, std::vector<double> &values) const {
+    std::size_t pos = 0;
+    detail::append_latest_numeric_sample_values(general_samples_, sampled, values, pos);
+    detail::append_latest_numeric_sample_values(clock_samples_, sampled, values, pos);
+    detail::append_latest_numeric_sample_values(power_samples_, sampled, values, pos);
+    detail::append_latest_numeric_sample_values(memory_samples_, sampled, values, pos);
+    detail::append_latest_numeric_sample_values(temperature_samples_, sampled, values, pos);
 }
 
 std::string gpu_nvidia_hardware_sampler::device_identification() const {
@@ -555,8 +608,8 @@ std::string gpu_nvidia_hardware_sampler::device_identification() const {
 
 std::string gpu_nvidia_hardware_sampler::samples_only_as_yaml_string() const {
     // check whether it's safe to generate the YAML entry
-    if (this->is_sampling()) {
-        throw std::runtime_error{ "Can't create the final YAML entry if the hardware sampler is still running!" };
+    if (!this->samples_accessible()) {
+        throw std::runtime_error{ "Can't create the YAML entry before the initial samples have been retrieved!" };
     }
 
     return fmt::format("{}{}"
@@ -576,7 +629,7 @@ std::string gpu_nvidia_hardware_sampler::samples_only_as_yaml_string() const {
 }
 
 std::ostream &operator<<(std::ostream &out, const gpu_nvidia_hardware_sampler &sampler) {
-    if (sampler.is_sampling()) {
+    if (!sampler.samples_accessible()) {
         out.setstate(std::ios_base::failbit);
         return out;
     } else {
@@ -7,48 +7,92 @@
 
 #include "hws/hardware_sampler.hpp"
 
-#include "hws/event.hpp"    // hws::event
-#include "hws/utility.hpp"  // hws::detail::durations_from_reference_time
-#include "hws/version.hpp"  // hws::version::version
+#include "hws/burst_capture.hpp"        // hws::burst_capture
+#include "hws/burst_history.hpp"        // hws::detail::burst_history
+#include "hws/energy_region.hpp"        // hws::energy_region
+#include "hws/event.hpp"                // hws::event
+#include "hws/overrun_policy.hpp"       // hws::overrun_policy
+#include "hws/sample_category.hpp"      // hws::sample_category
+#include "hws/sample_column.hpp"        // hws::{sample_column, sample_column_config}
+#include "hws/sampling_statistics.hpp"  // hws::sampling_statistics
+#include "hws/tick_view.hpp"            // hws::tick_view
+#include "hws/utility.hpp"              // hws::detail::{duration_from_reference_time, durations_from_reference_time}
+#include "hws/version.hpp"              // hws::version::version
 
 #include "fmt/chrono.h"  // direct formatting of std::chrono types
 #include "fmt/format.h"  // fmt::format
 #include "fmt/ranges.h"  // fmt::join
 
-#include <chrono>     // std::chrono::{system_clock, steady_clock, duration_cast, milliseconds}
-#include <cstddef>    // std::size_t
-#include <exception>  // std::exception
-#include <fstream>    // std::ofstream
-#include <iostream>   // std::cerr, std::endl
-#include <stdexcept>  // std::runtime_error, std::out_of_range
-#include <thread>     // std::thread
-#include <utility>    // std::move
+#include <algorithm>           // std::min, std::max, std::max_element, std::fill, std::find, std::find_if, std::copy_if, std::stable_sort, std::inplace_merge, std::sort, std::unique, std::binary_search, std::transform
+#include <array>               // std::array
+#include <chrono>              // std::chrono::{system_clock, steady_clock, duration_cast, duration, nanoseconds}
+#include <cmath>               // std::abs, std::isnan
+#include <condition_variable>  // std::cv_status
+#include <cstddef>             // std::size_t
+#include <exception>           // std::exception
+#include <fstream>             // std::ofstream
+#include <functional>          // std::function
+#include <initializer_list>    // std::initializer_list
+#include <iostream>            // std::cerr, std::endl
+#include <iterator>            // std::back_inserter
+#include <limits>              // std::numeric_limits
+#include <memory>              // std::shared_ptr, std::make_shared
+#include <mutex>               // std::lock_guard, std::unique_lock
+#include <optional>            // std::optional, std::nullopt
+#include <stdexcept>           // std::runtime_error, std::out_of_range, std::invalid_argument
+#include <string>              // std::string
+#include <string_view>         // std::string_view
+#include <thread>              // std::thread, std::this_thread::{get_id, yield}
+#include <utility>             // std::move, std::exchange
+#include <vector>              // std::vector
 
 namespace hws {
 
-hardware_sampler::hardware_sampler(const std::chrono::milliseconds sampling_interval, const sample_category category) :
+namespace {
+
+/// The names of the distinct sample categories in the order of their bits.
+constexpr std::array<const char *, 7> sample_category_names{ "general", "clock", "power", "memory", "temperature", "gfx", "idle_state" };
+
+/**
+ * @brief Return the index of the single sample category @p category in the order of their bits.
+ * @param[in] category the sample_category; must be exactly one sample category
+ * @throws std::invalid_argument if @p category isn't exactly one sample category
+ * @return the index of the sample category (`[[nodiscard]]`)
+ */
+[[nodiscard]] std::size_t sample_category_index(const sample_category category) {
+    const auto bits = static_cast<unsigned int>(category & sample_category::all);
+    if (bits == 0 || (bits & (bits - 1)) != 0 || category != (category & sample_category::all)) {
+        throw std::invalid_argument{ fmt::format("The sample category {:#b} must be exactly one sample category!", static_cast<int>(category)) };
+    }
+    std::size_t idx = 0;
+    while ((bits >> idx) != 1u) {
+        ++idx;
+    }
+    return idx;
+}
+
+}  // namespace
+
+hardware_sampler::hardware_sampler(const std::chrono::nanoseconds sampling_interval, const sample_category category) :
     sampling_interval_{ sampling_interval },
     sample_category_{ category } {
-    if (sampling_interval == std::chrono::milliseconds{ 0 }) {
-        throw std::invalid_argument{ "The sampling interval must be larger than 0ms!" };
+    if (sampling_interval <= std::chrono::nanoseconds{ 0 }) {
+        throw std::invalid_argument{ "The sampling interval must be larger than 0ns!" };
     }
 }
 
 hardware_sampler::~hardware_sampler() = default;
 
 void hardware_sampler::start_sampling() {
-    // can't start an already running sampler
-    if (this->has_sampling_started()) {
-        throw std::runtime_error{ "Can start every hardware sampler only once!" };
-    }
+    this->mark_sampling_started();
 
-    // record start time
-    start_date_time_ = std::chrono::system_clock::now();
+    if (this->uses_marker_only_mode()) {
+        // no hardware samples are retrieved -> no sampling std::thread necessary
+        samples_initialized_ = true;
+        return;
+    }
 
     // start sampling loop
-    sampling_started_ = true;
-    sampling_running_ = true;
-    this->add_event("sampling_started");
     sampling_thread_ = std::thread{
         [this]() {
             try {
@@ -73,14 +117,31 @@ void hardware_sampler::stop_sampling() {
     }
 
     // stop sampling
-    sampling_running_ = false;
-    sampling_stopped_ = true;  // -> notifies the sampling std::thread
-    sampling_thread_.join();
+    {
+        std::unique_lock lock{ sampling_wakeup_->mutex };
+        sampling_running_ = false;
+        sampling_stopped_ = true;
+        sampling_wakeup_->cv.notify_all();
+        // the shared sampling std::thread of a system_hardware_sampler may still be retrieving the samples of this hardware sampler
+        // -> wait until it acknowledged the stop before accessing the samples and events
+        if (uses_shared_sampling_thread_) {
+            sampling_wakeup_->cv.wait(lock, [this]() { return sampling_stop_acknowledged_; });
+        }
+    }
+    // the std::thread doesn't exist if the sampling loop is driven by a system_hardware_sampler
+    if (sampling_thread_.joinable()) {
+        sampling_thread_.join();
+    }
     this->add_event("sampling_stopped");
+
+    // merge and sort all events recorded during the sampling
+    const std::lock_guard lock{ events_mutex_ };
+    this->merge_recorded_events();
 }
 
 void hardware_sampler::pause_sampling() {
-    sampling_running_ = false;  // notifies the sampling std::thread
+    sampling_running_ = false;
+    sampling_wakeup_->notify();
     this->add_event("sampling_paused");
 }
 
@@ -88,7 +149,8 @@ void hardware_sampler::resume_sampling() {
     if (this->has_sampling_stopped()) {
         throw std::runtime_error{ "Can't resume a hardware sampler that has already been stopped!" };
     }
-    sampling_running_ = true;  // notifies the sampling std::thread
+    sampling_running_ = true;
+    sampling_wakeup_->notify();
     this->add_event("sampling_resumed");
 }
 
@@ -104,21 +166,371 @@ bool hardware_sampler::has_sampling_stopped() const noexcept {
     return sampling_stopped_;
 }
 
+bool hardware_sampler::samples_accessible() const noexcept {
+    // the std::thread retrieving the hardware samples can always read them
+    if (this->has_sampling_started() && std::this_thread::get_id() == sampling_thread_id_.load()) {
+        return true;
+    }
+    // the ring buffers overwrite their oldest values and the compressed values share a cache -> they can't be read concurrently
+    if (this->num_retained_samples() > 0 || this->uses_sample_compression()) {
+        return !this->has_sampling_started() || this->has_sampling_stopped();
+    }
+    // before the sampling has been started, the sampling std::thread doesn't touch the hardware samples
+    return !this->has_sampling_started() || samples_initialized_;
+}
+
 void hardware_sampler::add_event(event e) {
-    events_.push_back(std::move(e));
+    recorded_events_.push(std::move(e));
 }
 
 void hardware_sampler::add_event(decltype(event::time_point) time_point, decltype(event::name) name) {
-    events_.emplace_back(time_point, name);
+    recorded_events_.push(event{ time_point, std::move(name) });
 }
 
 void hardware_sampler::add_event(decltype(event::name) name) {
-    events_.emplace_back(std::chrono::steady_clock::now(), name);
+    recorded_events_.push(event{ std::chrono::steady_clock::now(), std::move(name) });
+}
+
+void hardware_sampler::add_event(decltype(event::name) name, const bool sample_immediately) {
+    this->add_event(std::move(name));
+    if (sample_immediately) {
+        this->sample_now();
+    }
+}
+
+void hardware_sampler::sample_now() {
+    if (this->is_sampling()) {
+        sample_requested_ = true;
+        sampling_wakeup_->notify();
+    }
+}
+
+std::size_t hardware_sampler::begin_region(std::string name) {
+    if (!this->has_sampling_started() || this->has_sampling_stopped()) {
+        throw std::runtime_error{ fmt::format("Can begin the region \"{}\" only while the hardware sampler is running!", name) };
+    }
+
+    // read the counters before acquiring the lock to not serialize the (potentially slow) driver calls
+    energy_region region{};
+    region.name = std::move(name);
+    region.begin_time_point = std::chrono::steady_clock::now();
+    region.begin_energy = this->read_energy_counter();
+
+    const std::lock_guard lock{ regions_mutex_ };
+    region.depth = open_regions_.size();
+    regions_.push_back(std::move(region));
+    open_regions_.push_back(regions_.size() - 1);
+    ++num_open_regions_;
+    return regions_.size() - 1;
+}
+
+energy_region hardware_sampler::end_region(const std::string &name) {
+    if (!this->has_sampling_started() || this->has_sampling_stopped()) {
+        throw std::runtime_error{ fmt::format("Can end the region \"{}\" only while the hardware sampler is running!", name) };
+    }
+
+    // read the counters before acquiring the lock to not serialize the (potentially slow) driver calls
+    const std::chrono::steady_clock::time_point end_time_point = std::chrono::steady_clock::now();
+    const std::optional<double> end_energy = this->read_energy_counter();
+
+    const std::lock_guard lock{ regions_mutex_ };
+    // end the innermost open region with the given name
+    const auto it = std::find_if(open_regions_.rbegin(), open_regions_.rend(), [this, &name](const std::size_t id) { return regions_[id].name == name; });
+    if (it == open_regions_.rend()) {
+        throw std::runtime_error{ fmt::format("Can't end the region \"{}\" since no such region is open!", name) };
+    }
+    return this->finish_region(*it, end_time_point, end_energy);
+}
+
+energy_region hardware_sampler::end_region(const std::size_t id) {
+    if (!this->has_sampling_started() || this->has_sampling_stopped()) {
+        throw std::runtime_error{ fmt::format("Can end the region with the ID {} only while the hardware sampler is running!", id) };
+    }
+
+    // read the counters before acquiring the lock to not serialize the (potentially slow) driver calls
+    const std::chrono::steady_clock::time_point end_time_point = std::chrono::steady_clock::now();
+    const std::optional<double> end_energy = this->read_energy_counter();
+
+    const std::lock_guard lock{ regions_mutex_ };
+    if (id >= regions_.size() || regions_[id].finished()) {
+        throw std::runtime_error{ fmt::format("Can't end the region with the ID {} since no such region is open!", id) };
+    }
+    return this->finish_region(id, end_time_point, end_energy);
+}
+
+std::vector<energy_region> hardware_sampler::energy_regions() const {
+    const std::lock_guard lock{ regions_mutex_ };
+    return regions_;
+}
+
+std::size_t hardware_sampler::add_tick_callback(std::function<void(const tick_view &)> callback) {
+    if (!callback) {
+        throw std::invalid_argument{ "The tick callback must not be empty!" };
+    }
+
+    const std::lock_guard lock{ tick_callbacks_mutex_ };
+    // the sampling std::thread may currently call the callbacks of the published list -> never modify it, but publish a new list sharing the callbacks
+    auto callbacks = std::make_shared<tick_callback_list>(*tick_callbacks_);
+    callbacks->emplace_back(next_tick_callback_id_, std::make_shared<const std::function<void(const tick_view &)>>(std::move(callback)));
+    tick_callbacks_ = std::move(callbacks);
+    ++num_tick_callbacks_;
+    return next_tick_callback_id_++;
+}
+
+void hardware_sampler::remove_tick_callback(const std::size_t id) {
+    std::shared_ptr<const tick_callback_list> old_callbacks{};
+    {
+        const std::lock_guard lock{ tick_callbacks_mutex_ };
+        const auto it = std::find_if(tick_callbacks_->cbegin(), tick_callbacks_->cend(), [id](const auto &callback) { return callback.first == id; });
+        if (it == tick_callbacks_->cend()) {
+            throw std::runtime_error{ fmt::format("Can't remove the tick callback with the ID {} since no such callback exists!", id) };
+        }
+        // the sampling std::thread may currently call the callbacks of the published list -> never modify it, but publish a new list without the callback
+        auto callbacks = std::make_shared<tick_callback_list>();
+        callbacks->reserve(tick_callbacks_->size() - 1);
+        std::copy_if(tick_callbacks_->cbegin(), tick_callbacks_->cend(), std::back_inserter(*callbacks), [id](const auto &callback) { return callback.first != id; });
+        old_callbacks = std::exchange(tick_callbacks_, std::move(callbacks));
+        --num_tick_callbacks_;
+    }
+
+    // wait until the sampling std::thread returned from the callbacks of the old list (unless called from within a tick callback)
+    // -> afterward, the removed callback is never called again and it is destroyed in this std::thread
+    if (std::this_thread::get_id() != sampling_thread_id_.load()) {
+        while (tick_callbacks_running_) {
+            std::this_thread::yield();
+        }
+    }
+}
+
+void hardware_sampler::set_marker_only_mode(const bool enable) {
+    if (this->has_sampling_started()) {
+        throw std::runtime_error{ "Can't change the marker-only mode of a hardware sampler that has already been started!" };
+    }
+    marker_only_mode_ = enable;
+}
+
+void hardware_sampler::add_trigger(std::string name, std::function<bool()> predicate) {
+    if (this->has_sampling_started()) {
+        throw std::runtime_error{ fmt::format("Can't add the trigger \"{}\" to a hardware sampler that has already been started!", name) };
+    }
+    if (!predicate) {
+        throw std::invalid_argument{ fmt::format("The predicate of the trigger \"{}\" must not be empty!", name) };
+    }
+    triggers_.emplace_back(std::move(name), std::move(predicate));
+}
+
+void hardware_sampler::set_burst_window(const std::chrono::nanoseconds pre_trigger, const std::chrono::nanoseconds post_trigger, const std::optional<std::chrono::nanoseconds> burst_interval) {
+    if (this->has_sampling_started()) {
+        throw std::runtime_error{ "Can't change the burst window of a hardware sampler that has already been started!" };
+    }
+    if (pre_trigger < std::chrono::nanoseconds{ 0 } || post_trigger < std::chrono::nanoseconds{ 0 }) {
+        throw std::invalid_argument{ fmt::format("The pre-trigger window {} and post-trigger window {} must not be negative!", pre_trigger, post_trigger) };
+    }
+    if (pre_trigger + post_trigger == std::chrono::nanoseconds{ 0 }) {
+        throw std::invalid_argument{ "The pre-trigger and post-trigger windows must not both be 0ns!" };
+    }
+    // the base sampling grid must be part of the burst sampling grid -> the sample categories keep their own grid during a burst
+    if (burst_interval.has_value() && (burst_interval.value() <= std::chrono::nanoseconds{ 0 } || this->sampling_interval() % burst_interval.value() != std::chrono::nanoseconds{ 0 })) {
+        throw std::invalid_argument{ fmt::format("The burst sampling interval {} must evenly divide the base sampling interval {}!", burst_interval.value(), this->sampling_interval()) };
+    }
+    pre_trigger_duration_ = pre_trigger;
+    post_trigger_duration_ = post_trigger;
+    burst_sampling_interval_ = burst_interval;
+}
+
+std::vector<burst_capture> hardware_sampler::burst_captures() const {
+    const std::lock_guard lock{ burst_captures_mutex_ };
+    return burst_captures_;
+}
+
+std::size_t hardware_sampler::num_events() const {
+    const std::lock_guard lock{ events_mutex_ };
+    this->merge_recorded_events();
+    return events_.size();
+}
+
+std::vector<event> hardware_sampler::get_events() const {
+    const std::lock_guard lock{ events_mutex_ };
+    this->merge_recorded_events();
+    return events_;
+}
+
+void hardware_sampler::set_sampling_overrun_policy(const overrun_policy policy) {
+    if (this->has_sampling_started()) {
+        throw std::runtime_error{ "Can't change the overrun policy of a hardware sampler that has already been started!" };
+    }
+    overrun_policy_ = policy;
+}
+
+hws::sampling_statistics hardware_sampler::sampling_statistics() const {
+    const std::lock_guard lock{ sampling_statistics_mutex_ };
+    return sampling_statistics_;
+}
+
+std::chrono::nanoseconds hardware_sampler::sampling_interval(const sample_category category) const {
+    return static_cast<std::chrono::nanoseconds::rep>(sampling_interval_strides_[sample_category_index(category)]) * this->sampling_interval();
+}
+
+void hardware_sampler::set_sampling_interval(const sample_category category, const std::chrono::nanoseconds interval) {
+    if (this->has_sampling_started()) {
+        throw std::runtime_error{ "Can't change the sampling interval of a hardware sampler that has already been started!" };
+    }
+    if (interval <= std::chrono::nanoseconds{ 0 } || interval % this->sampling_interval() != std::chrono::nanoseconds{ 0 }) {
+        throw std::invalid_argument{ fmt::format("The sampling interval {} must be a positive multiple of the base sampling interval {}!", interval, this->sampling_interval()) };
+    }
+
+    // all sample categories are sampled on the same base tick -> store the sampling interval as multiple of the base sampling interval
+    const auto stride = static_cast<std::size_t>(interval / this->sampling_interval());
+    for (std::size_t idx = 0; idx < num_sample_categories_; ++idx) {
+        if (static_cast<int>(category & static_cast<sample_category>(1 << idx)) != 0) {
+            sampling_interval_strides_[idx] = stride;
+        }
+    }
+}
+
+void hardware_sampler::set_sample_metrics(std::vector<std::string> metrics) {
+    if (this->has_sampling_started()) {
+        throw std::runtime_error{ "Can't change the selected hardware samples of a hardware sampler that has already been started!" };
+    }
+    // sort the names to be able to use a binary search during the initialization
+    std::sort(metrics.begin(), metrics.end());
+    metrics.erase(std::unique(metrics.begin(), metrics.end()), metrics.end());
+    sample_metrics_ = std::move(metrics);
+}
+
+bool hardware_sampler::sample_metric_selected(const std::string_view metric) const noexcept {
+    return sample_metrics_.empty() || std::binary_search(sample_metrics_.cbegin(), sample_metrics_.cend(), metric);
+}
+
+void hardware_sampler::set_adaptive_sampling(const std::chrono::nanoseconds max_sampling_interval) {
+    if (this->has_sampling_started()) {
+        throw std::runtime_error{ "Can't change the adaptive sampling of a hardware sampler that has already been started!" };
+    }
+    if (max_sampling_interval <= std::chrono::nanoseconds{ 0 } || max_sampling_interval % this->sampling_interval() != std::chrono::nanoseconds{ 0 }) {
+        throw std::invalid_argument{ fmt::format("The maximum sampling interval {} must be a positive multiple of the base sampling interval {}!", max_sampling_interval, this->sampling_interval()) };
+    }
+    max_sampling_interval_stride_ = static_cast<std::size_t>(max_sampling_interval / this->sampling_interval());
+}
+
+void hardware_sampler::set_sample_retention(const std::size_t num_samples) {
+    if (this->has_sampling_started()) {
+        throw std::runtime_error{ "Can't change the sample retention of a hardware sampler that has already been started!" };
+    }
+    if (num_samples == 0) {
+        throw std::invalid_argument{ "The number of retained samples must be larger than 0!" };
+    }
+    if (this->uses_sample_compression()) {
+        throw std::runtime_error{ "Can't use a sample retention together with the sample compression!" };
+    }
+    if (this->uses_streaming_statistics()) {
+        throw std::runtime_error{ "Can't use a sample retention together with the streaming statistics!" };
+    }
+    sample_retention_ = num_samples;
+}
+
+void hardware_sampler::set_sample_retention(const std::chrono::nanoseconds duration) {
+    if (duration <= std::chrono::nanoseconds{ 0 }) {
+        throw std::invalid_argument{ fmt::format("The retained duration {} must be larger than 0ns!", duration) };
+    }
+    // round up so that at least the requested duration is retained (+1 for the sample at the start of the duration)
+    this->set_sample_retention(static_cast<std::size_t>((duration + this->sampling_interval() - std::chrono::nanoseconds{ 1 }) / this->sampling_interval()) + 1);
+}
+
+void hardware_sampler::set_sample_compression(const bool enable) {
+    if (this->has_sampling_started()) {
+        throw std::runtime_error{ "Can't change the sample compression of a hardware sampler that has already been started!" };
+    }
+    if (enable && this->uses_sample_retention()) {
+        throw std::runtime_error{ "Can't use the sample compression together with a sample retention!" };
+    }
+    if (enable && this->uses_streaming_statistics()) {
+        throw std::runtime_error{ "Can't use the sample compression together with the streaming statistics!" };
+    }
+    sample_compression_ = enable;
+}
+
+void hardware_sampler::set_streaming_statistics(const bool enable) {
+    if (this->has_sampling_started()) {
+        throw std::runtime_error{ "Can't change the streaming statistics of a hardware sampler that has already been started!" };
+    }
+    if (enable && this->uses_sample_retention()) {
+        throw std::runtime_error{ "Can't use the streaming statistics together with a sample retention!" };
+    }
+    if (enable && this->uses_sample_compression()) {
+        throw std::runtime_error{ "Can't use the streaming statistics together with the sample compression!" };
+    }
+    streaming_statistics_ = enable;
+}
+
+void hardware_sampler::set_expected_sampling_duration(const std::chrono::nanoseconds duration) {
+    if (this->has_sampling_started()) {
+        throw std::runtime_error{ "Can't change the expected sampling duration of a hardware sampler that has already been started!" };
+    }
+    if (duration < std::chrono::nanoseconds{ 0 }) {
+        throw std::invalid_argument{ fmt::format("The expected sampling duration {} must not be negative!", duration) };
+    }
+    expected_sampling_duration_ = duration;
+}
+
+double hardware_sampler::adaptive_sampling_threshold(const sample_category category) const {
+    return adaptive_sampling_thresholds_[sample_category_index(category)];
+}
+
+void hardware_sampler::set_adaptive_sampling_threshold(const sample_category category, const double threshold) {
+    if (this->has_sampling_started()) {
+        throw std::runtime_error{ "Can't change the adaptive sampling threshold of a hardware sampler that has already been started!" };
+    }
+    if (threshold < 0.0) {
+        throw std::invalid_argument{ fmt::format("The adaptive sampling threshold must not be negative, but is {}!", threshold) };
+    }
+    for (std::size_t idx = 0; idx < num_sample_categories_; ++idx) {
+        if (static_cast<int>(category & static_cast<sample_category>(1 << idx)) != 0) {
+            adaptive_sampling_thresholds_[idx] = threshold;
+        }
+    }
+}
+
+std::vector<std::chrono::steady_clock::time_point> hardware_sampler::sampling_time_points() const {
+    return this->retained_time_points(time_points_, time_points_.size(), std::nullopt);
+}
+
+std::vector<std::chrono::steady_clock::time_point> hardware_sampler::sampling_time_points(const sample_category category) const {
+    static_cast<void>(sample_category_index(category));
+    return this->retained_time_points(time_points_, time_points_.size(), category);
+}
+
+std::vector<std::chrono::steady_clock::time_point> hardware_sampler::sampling_query_begin_time_points() const {
+    return this->retained_time_points(query_begin_time_points_, query_begin_time_points_.size(), std::nullopt);
+}
+
+std::vector<std::chrono::steady_clock::time_point> hardware_sampler::sampling_query_begin_time_points(const sample_category category) const {
+    static_cast<void>(sample_category_index(category));
+    return this->retained_time_points(query_begin_time_points_, query_begin_time_points_.size(), category);
+}
+
+std::vector<std::chrono::steady_clock::time_point> hardware_sampler::sampling_query_end_time_points() const {
+    return this->retained_time_points(query_end_time_points_, query_end_time_points_.size(), std::nullopt);
+}
+
+std::vector<std::chrono::steady_clock::time_point> hardware_sampler::sampling_query_end_time_points(const sample_category category) const {
+    static_cast<void>(sample_category_index(category));
+    return this->retained_time_points(query_end_time_points_, query_end_time_points_.size(), category);
+}
+
+std::vector<std::chrono::nanoseconds> hardware_sampler::sampling_query_latencies() const {
+    return this->retained_query_latencies(std::nullopt);
+}
+
+std::vector<std::chrono::nanoseconds> hardware_sampler::sampling_query_latencies(const sample_category category) const {
+    static_cast<void>(sample_category_index(category));
+    return this->retained_query_latencies(category);
 }
 
 event hardware_sampler::get_event(const std::size_t idx) const {
-    if (idx >= this->num_events()) {
-        throw std::out_of_range{ fmt::format("The index {} is out-of-range for the number of events {}!", idx, this->num_events()) };
+    const std::lock_guard lock{ events_mutex_ };
+    this->merge_recorded_events();
+    if (idx >= events_.size()) {
+        throw std::out_of_range{ fmt::format("The index {} is out-of-range for the number of events {}!", idx, events_.size()) };
     }
 
     return events_[idx];
@@ -149,14 +561,98 @@ std::string hardware_sampler::as_yaml_string() const {
         throw std::runtime_error{ "Can return samples as string only after the sampling has been stopped!" };
     }
 
+    const hws::sampling_statistics statistics = this->sampling_statistics();
+
+    // generate the per sample category sampling intervals
+    std::string category_sampling_intervals{};
+    for (std::size_t idx = 0; idx < num_sample_categories_; ++idx) {
+        const auto category = static_cast<sample_category>(1 << idx);
+        if (this->sample_category_enabled(category)) {
+            category_sampling_intervals += fmt::format("  {}: {}\n", sample_category_names[idx], std::chrono::duration<double, std::milli>{ this->sampling_interval(category) }.count());
+        }
+    }
+
     // generate the event information
+    const std::vector<event> events = this->get_events();
     std::vector<decltype(event::time_point)> event_time_points{};
     std::vector<decltype(event::name)> event_names{};
-    for (const auto &[time_point, name] : events_) {
+    for (const auto &[time_point, name] : events) {
         event_time_points.push_back(time_point);
         event_names.push_back(fmt::format("\"{}\"", name));
     }
 
+    // generate the region information (relative to the same reference time as the events)
+    const auto value_or_null = [](const std::optional<double> &value) {
+        return value.has_value() ? fmt::format("{}", value.value()) : std::string{ "null" };
+    };
+    std::vector<std::string> region_names{};
+    std::vector<double> region_begin_time_points{};
+    std::vector<std::string> region_end_time_points{};
+    std::vector<std::string> region_energies{};
+    std::vector<std::string> region_average_powers{};
+    std::vector<std::size_t> region_depths{};
+    std::vector<std::size_t> region_num_samples{};
+    std::vector<std::string> region_mean_powers{};
+    std::vector<std::string> region_max_powers{};
+    std::vector<std::string> region_max_temperatures{};
+    for (const energy_region &region : this->energy_regions()) {
+        region_names.push_back(fmt::format("\"{}\"", region.name));
+        region_begin_time_points.push_back(detail::duration_from_reference_time(region.begin_time_point, events.front().time_point));
+        region_end_time_points.push_back(region.finished() ? fmt::format("{}", detail::duration_from_reference_time(region.end_time_point.value(), events.front().time_point)) : std::string{ "null" });
+        region_energies.push_back(value_or_null(region.energy()));
+        region_average_powers.push_back(value_or_null(region.average_power()));
+        region_depths.push_back(region.depth);
+        region_num_samples.push_back(region.num_samples);
+        region_mean_powers.push_back(value_or_null(region.mean_power()));
+        region_max_powers.push_back(value_or_null(region.max_power));
+        region_max_temperatures.push_back(value_or_null(region.max_temperature));
+    }
+
+    // generate the selected hardware samples information
+    std::vector<std::string> sample_metric_names{};
+    for (const std::string &metric : sample_metrics_) {
+        sample_metric_names.push_back(fmt::format("\"{}\"", metric));
+    }
+
+    // generate the burst capture information (relative to the same reference time as the events)
+    std::vector<std::string> trigger_names{};
+    for (const auto &[name, predicate] : triggers_) {
+        trigger_names.push_back(fmt::format("\"{}\"", name));
+    }
+    std::string burst_captures{};
+    for (const burst_capture &capture : this->burst_captures()) {
+        std::string samples{};
+        for (const auto &[name, values] : capture.samples) {
+            // a hardware sample not retrieved in a tick is stored as NaN
+            std::vector<std::string> formatted_values{};
+            for (const double value : values) {
+                formatted_values.push_back(value_or_null(std::isnan(value) ? std::nullopt : std::optional<double>{ value }));
+            }
+            samples += fmt::format("      {}: [{}]\n", name, fmt::join(formatted_values, ", "));
+        }
+        burst_captures += fmt::format("\n"
+                                      "  - trigger: \"{}\"\n"
+                                      "    trigger_time_point:\n"
+                                      "      unit: \"s\"\n"
+                                      "      values: {}\n"
+                                      "    time_points:\n"
+                                      "      unit: \"s\"\n"
+                                      "      values: [{}]\n"
+                                      "    samples:{}\n"
+                                      "{}",
+                                      capture.trigger,
+                                      detail::duration_from_reference_time(capture.trigger_time_point, events.front().time_point),
+                                      fmt::join(detail::durations_from_reference_time(capture.time_points, events.front().time_point), ", "),
+                                      samples.empty() ? " {}" : "",
+                                      samples);
+    }
+
+    // generate the query latencies in ms (the query end time points are implicitly given by the begin time points and the latencies)
+    std::vector<double> query_latencies{};
+    for (const std::chrono::nanoseconds latency : this->sampling_query_latencies()) {
+        query_latencies.push_back(std::chrono::duration<double, std::milli>{ latency }.count());
+    }
+
     return fmt::format("device_identification: \"{}\"\n"
                        "\n"
                        "version: \"{}\"\n"
@@ -173,27 +669,708 @@ std::string hardware_sampler::as_yaml_string() const {
                        "  unit: \"ms\"\n"
                        "  values: {}\n"
                        "\n"
+                       "category_sampling_intervals:\n"
+                       "  unit: \"ms\"\n"
+                       "{}"
+                       "\n"
+                       "adaptive_sampling:\n"
+                       "  enabled: {}\n"
+                       "  max_sampling_interval:\n"
+                       "    unit: \"ms\"\n"
+                       "    values: {}\n"
+                       "\n"
+                       "sample_metrics:\n"
+                       "  enabled: {}\n"
+                       "  names: [{}]\n"
+                       "\n"
+                       "sample_retention:\n"
+                       "  enabled: {}\n"
+                       "  num_samples: {}\n"
+                       "\n"
+                       "sample_compression:\n"
+                       "  enabled: {}\n"
+                       "\n"
+                       "streaming_statistics:\n"
+                       "  enabled: {}\n"
+                       "\n"
+                       "marker_only_mode:\n"
+                       "  enabled: {}\n"
+                       "\n"
+                       "energy_regions:\n"
+                       "  names: [{}]\n"
+                       "  begin_time_points:\n"
+                       "    unit: \"s\"\n"
+                       "    values: [{}]\n"
+                       "  end_time_points:\n"
+                       "    unit: \"s\"\n"
+                       "    values: [{}]\n"
+                       "  energy:\n"
+                       "    unit: \"J\"\n"
+                       "    values: [{}]\n"
+                       "  average_power:\n"
+                       "    unit: \"W\"\n"
+                       "    values: [{}]\n"
+                       "  depths: [{}]\n"
+                       "  num_samples: [{}]\n"
+                       "  mean_power:\n"
+                       "    unit: \"W\"\n"
+                       "    values: [{}]\n"
+                       "  max_power:\n"
+                       "    unit: \"W\"\n"
+                       "    values: [{}]\n"
+                       "  max_temperature:\n"
+                       "    unit: \"°C\"\n"
+                       "    values: [{}]\n"
+                       "\n"
+                       "burst_capture:\n"
+                       "  triggers: [{}]\n"
+                       "  captures:{}\n"
+                       "\n"
+                       "sampling_statistics:\n"
+                       "  overrun_policy: \"{}\"\n"
+                       "  num_ticks: {}\n"
+                       "  num_missed_ticks: {}\n"
+                       "  num_on_demand_ticks: {}\n"
+                       "  jitter:\n"
+                       "    unit: \"ns\"\n"
+                       "    min: {}\n"
+                       "    max: {}\n"
+                       "    mean: {}\n"
+                       "  num_queries: {}\n"
+                       "  query_latency:\n"
+                       "    unit: \"ns\"\n"
+                       "    min: {}\n"
+                       "    max: {}\n"
+                       "    mean: {}\n"
+                       "\n"
                        "time_points:\n"
                        "  unit: \"s\"\n"
                        "  values: [{}]\n"
                        "\n"
+                       "query_begin_time_points:\n"
+                       "  unit: \"s\"\n"
+                       "  values: [{}]\n"
+                       "\n"
+                       "query_latencies:\n"
+                       "  unit: \"ms\"\n"
+                       "  values: [{}]\n"
+                       "\n"
                        "{}\n",
                        this->device_identification(),
                        version::version,
                        start_date_time_,
-                       fmt::join(detail::durations_from_reference_time(event_time_points, this->get_event(0).time_point), ", "),
+                       fmt::join(detail::durations_from_reference_time(event_time_points, events.front().time_point), ", "),
                        fmt::join(event_names, ", "),
-                       this->sampling_interval().count(),
-                       fmt::join(detail::durations_from_reference_time(this->sampling_time_points(), this->get_event(0).time_point), ", "),
+                       std::chrono::duration<double, std::milli>{ this->sampling_interval() }.count(),
+                       category_sampling_intervals,
+                       this->uses_adaptive_sampling(),
+                       std::chrono::duration<double, std::milli>{ this->max_sampling_interval() }.count(),
+                       this->uses_sample_metric_selection(),
+                       fmt::join(sample_metric_names, ", "),
+                       this->uses_sample_retention(),
+                       this->sample_retention(),
+                       this->uses_sample_compression(),
+                       this->uses_streaming_statistics(),
+                       this->uses_marker_only_mode(),
+                       fmt::join(region_names, ", "),
+                       fmt::join(region_begin_time_points, ", "),
+                       fmt::join(region_end_time_points, ", "),
+                       fmt::join(region_energies, ", "),
+                       fmt::join(region_average_powers, ", "),
+                       fmt::join(region_depths, ", "),
+                       fmt::join(region_num_samples, ", "),
+                       fmt::join(region_mean_powers, ", "),
+                       fmt::join(region_max_powers, ", "),
+                       fmt::join(region_max_temperatures, ", "),
+                       fmt::join(trigger_names, ", "),
+                       burst_captures.empty() ? std::string{ " []" } : burst_captures,
+                       this->sampling_overrun_policy(),
+                       statistics.num_ticks,
+                       statistics.num_missed_ticks,
+                       statistics.num_on_demand_ticks,
+                       statistics.min_jitter.count(),
+                       statistics.max_jitter.count(),
+                       statistics.mean_jitter().count(),
+                       statistics.num_queries,
+                       statistics.min_query_latency.count(),
+                       statistics.max_query_latency.count(),
+                       statistics.mean_query_latency().count(),
+                       fmt::join(detail::durations_from_reference_time(this->sampling_time_points(), events.front().time_point), ", "),
+                       fmt::join(detail::durations_from_reference_time(this->sampling_query_begin_time_points(), events.front().time_point), ", "),
+                       fmt::join(query_latencies, ", "),
                        this->samples_only_as_yaml_string());
 }
 
+std::optional<double> hardware_sampler::read_energy_counter() {
+    return std::nullopt;
+}
+
+std::optional<double> hardware_sampler::latest_power_usage() const {
+    return std::nullopt;
+}
+
+std::optional<double> hardware_sampler::latest_temperature() const {
+    return std::nullopt;
+}
+
+std::vector<std::string> hardware_sampler::numeric_sample_names() const {
+    return {};
+}
+
+void hardware_sampler::latest_numeric_sample_values([[maybe_unused]] const sample_category sampled, [[maybe_unused]] std::vector<double> &values) const { }
+
+void hardware_sampler::pause_samples() { }
+
+void hardware_sampler::resume_samples() { }
+
+void hardware_sampler::finalize_samples() { }
+
+void hardware_sampler::mark_sampling_started() {
+    // can't start an already running sampler
+    if (this->has_sampling_started()) {
+        throw std::runtime_error{ "Can start every hardware sampler only once!" };
+    }
+    if (this->uses_triggers() && !post_trigger_duration_.has_value()) {
+        throw std::runtime_error{ "Can't use triggers without setting the burst window!" };
+    }
+    if (this->uses_triggers() && this->uses_marker_only_mode()) {
+        throw std::runtime_error{ "Can't use triggers together with the marker-only mode!" };
+    }
+
+    // record start time
+    start_date_time_ = std::chrono::system_clock::now();
+
+    sampling_started_ = true;
+    sampling_running_ = true;
+    this->add_event("sampling_started");
+}
+
+void hardware_sampler::initialize_sampling(const std::chrono::steady_clock::time_point reference_time_point) {
+    sampling_thread_id_ = std::this_thread::get_id();
+    // a sample category is sampled in at least every stride-th tick -> retain the time points of the last retained samples of each sample category
+    const std::size_t max_stride = *std::max_element(sampling_interval_strides_.cbegin(), sampling_interval_strides_.cend());
+    const std::size_t time_point_capacity = (this->num_retained_samples() + 1) * max_stride;
+    // the sampled categories and query time points are stored exactly like the time points of the ticks -> their indices always match
+    if (this->num_retained_samples() > 0) {
+        sampled_categories_.set_capacity(time_point_capacity);
+    }
+    sampled_categories_.reserve(this->expected_num_samples());
+    for (sample_column<std::chrono::steady_clock::time_point> *column : { &time_points_, &query_begin_time_points_, &query_end_time_points_ }) {
+        if (this->num_retained_samples() > 0) {
+            column->set_capacity(time_point_capacity);
+        }
+        column->set_compressed(sample_compression_);
+        // allocate the storage for the time points before the time critical sampling loop
+        column->reserve(this->expected_num_samples());
+    }
+
+    //
+    // add samples where we only have to retrieve the value once
+    //
+
+    // the deadlines and the sampling intervals of all sample categories are slots on the same grid starting at the reference time point
+    reference_time_point_ = reference_time_point;
+    due_categories_ = this->due_sample_categories(0);
+    sampled_categories_.push_back(due_categories_);
+    this->add_time_point(reference_time_point);
+    const std::chrono::steady_clock::time_point query_begin = std::chrono::steady_clock::now();
+    query_begin_time_points_.push_back(query_begin);
+    this->initialize_samples();
+    const std::chrono::steady_clock::time_point query_end = std::chrono::steady_clock::now();
+    query_end_time_points_.push_back(query_end);
+    last_query_latency_ = std::chrono::duration_cast<std::chrono::nanoseconds>(query_end - query_begin);
+    this->record_sampled_categories(reference_time_point);
+    // the tick callbacks may be added at any time -> always allocate the memory for the numeric hardware samples before the time critical sampling loop
+    numeric_sample_names_ = this->numeric_sample_names();
+    numeric_sample_values_.assign(numeric_sample_names_.size(), std::numeric_limits<double>::quiet_NaN());
+    if (this->uses_triggers()) {
+        // the pre-trigger ring holds at most one entry per burst sampling interval -> allocate all memory before the time critical sampling loop
+        burst_history_ = detail::burst_history{ static_cast<std::size_t>(pre_trigger_duration_ / this->burst_sampling_interval()) + 1, numeric_sample_names_.size() };
+    }
+    // publish the initial samples: afterward, only new values are appended to the sample columns
+    samples_initialized_ = true;
+    this->notify_tick_callbacks(reference_time_point, false);
+
+    // the deadlines lie on a fixed grid -> the time needed to retrieve the samples doesn't add to the sampling interval
+    next_deadline_ = reference_time_point + std::chrono::duration_cast<std::chrono::steady_clock::duration>(this->sampling_interval());
+}
+
+void hardware_sampler::sampling_tick(const std::chrono::steady_clock::time_point now) {
+    using clock_type = std::chrono::steady_clock;
+    const clock_type::duration interval = std::chrono::duration_cast<clock_type::duration>(this->sampling_interval());
+    // while a burst is active, the deadlines lie on the finer grid of the burst sampling interval
+    const clock_type::duration burst_interval = std::chrono::duration_cast<clock_type::duration>(this->burst_sampling_interval());
+    const clock_type::duration step = burst_trigger_.has_value() ? burst_interval : interval;
+
+    // only sample values if the sampler currently isn't paused
+    if (this->is_sampling()) {
+        {
+            // record how far the current tick deviates from its deadline
+            const std::lock_guard lock{ sampling_statistics_mutex_ };
+            sampling_statistics_.add_tick(std::chrono::duration_cast<std::chrono::nanoseconds>(now - next_deadline_));
+            if (overrun_policy_ == overrun_policy::catch_up && now - next_deadline_ >= step) {
+                // the sample of this deadline is so late that it lies in the interval of the next deadline
+                ++sampling_statistics_.num_missed_ticks;
+            }
+        }
+
+        // the tick belongs to the slot of its deadline on the sampling grid, even if it is late
+        const clock_type::duration since_reference = next_deadline_ - reference_time_point_;
+        if (since_reference % interval == clock_type::duration::zero()) {
+            this->retrieve_samples(now, this->due_sample_categories(static_cast<std::size_t>(since_reference / interval)));
+        } else {
+            // a burst tick in between two slots -> only retrieve the sample categories sampled with the base sampling interval without consuming their slots
+            this->retrieve_samples(now, this->base_interval_sample_categories());
+        }
+        this->notify_tick_callbacks(now, false);
+
+        // adapt the sampling interval based on the volatility of the tracked samples
+        if (this->uses_adaptive_sampling() && sample_change_tracked_) {
+            // fall back to the base sampling interval if the samples change quickly, otherwise gradually increase the sampling interval
+            adaptive_sampling_stride_ = sample_change_detected_ ? 1 : std::min(2 * adaptive_sampling_stride_, max_sampling_interval_stride_);
+        }
+        if (burst_trigger_.has_value()) {
+            // the burst mode always samples with the burst sampling interval
+            adaptive_sampling_stride_ = 1;
+        }
+        sample_change_tracked_ = false;
+        sample_change_detected_ = false;
+    }
+
+    // calculate the next deadline (always a multiple of the base sampling interval, or of the burst sampling interval while a burst is active)
+    if (burst_trigger_.has_value()) {
+        next_deadline_ += burst_interval;
+    } else {
+        // the burst may have ended in between two slots -> continue with the next slot on the base sampling grid
+        const clock_type::duration offset = (next_deadline_ - reference_time_point_) % interval;
+        next_deadline_ += offset == clock_type::duration::zero() ? static_cast<clock_type::rep>(adaptive_sampling_stride_) * interval : interval - offset;
+    }
+    if (overrun_policy_ == overrun_policy::skip) {
+        const clock_type::duration next_step = burst_trigger_.has_value() ? burst_interval : interval;
+        const clock_type::time_point after = clock_type::now();
+        if (next_deadline_ <= after) {
+            // skip all deadlines that have already passed
+            const auto num_missed_deadlines = (after - next_deadline_) / next_step + 1;
+            {
+                const std::lock_guard lock{ sampling_statistics_mutex_ };
+                sampling_statistics_.num_missed_ticks += static_cast<std::size_t>(num_missed_deadlines);
+            }
+            next_deadline_ += num_missed_deadlines * next_step;
+        }
+    }
+}
+
+void hardware_sampler::sampling_tick_on_demand(const std::chrono::steady_clock::time_point now) {
+    // only sample values if the sampler currently isn't paused
+    if (this->is_sampling()) {
+        // an on-demand sample retrieves all enabled sample categories, but doesn't consume the next slots of their sampling intervals
+        sample_category enabled{};
+        for (std::size_t idx = 0; idx < num_sample_categories_; ++idx) {
+            const auto single_category = static_cast<sample_category>(1 << idx);
+            if (this->sample_category_enabled(single_category)) {
+                enabled |= single_category;
+            }
+        }
+        this->retrieve_samples(now, enabled);
+        this->notify_tick_callbacks(now, true);
+        {
+            const std::lock_guard lock{ sampling_statistics_mutex_ };
+            ++sampling_statistics_.num_on_demand_ticks;
+        }
+        // an on-demand sample doesn't influence the adaptive sampling interval of the regular samples
+        sample_change_tracked_ = false;
+        sample_change_detected_ = false;
+    }
+}
+
+void hardware_sampler::retrieve_samples(const std::chrono::steady_clock::time_point now, const sample_category due) {
+    // reacquire the resources released while the sampling was paused
+    if (samples_paused_) {
+        samples_paused_ = false;
+        this->resume_samples();
+    }
+
+    // add current time point (the sampled categories are published first such that they are available for every published time point)
+    due_categories_ = due;
+    sampled_categories_.push_back(due);
+    this->add_time_point(now);
+
+    // the tick may have started long before, e.g., if other hardware samplers of a system_hardware_sampler have been queried first
+    // -> additionally record when the query of the samples actually started and ended
+    const std::chrono::steady_clock::time_point query_begin = std::chrono::steady_clock::now();
+    query_begin_time_points_.push_back(query_begin);
+    this->sample();
+    const std::chrono::steady_clock::time_point query_end = std::chrono::steady_clock::now();
+    query_end_time_points_.push_back(query_end);
+    last_query_latency_ = std::chrono::duration_cast<std::chrono::nanoseconds>(query_end - query_begin);
+    {
+        const std::lock_guard lock{ sampling_statistics_mutex_ };
+        sampling_statistics_.add_query(last_query_latency_);
+    }
+
+    this->update_region_aggregates();
+    this->record_sampled_categories(now);
+    this->update_burst_capture(now);
+}
+
+void hardware_sampler::update_region_aggregates() {
+    // fast path: no region is open -> nothing to aggregate
+    if (num_open_regions_ == 0) {
+        return;
+    }
+
+    // retrieve the values of the current tick before acquiring the lock
+    std::optional<double> power{};
+    if (this->sample_category_due(sample_category::power)) {
+        power = this->latest_power_usage();
+    }
+    std::optional<double> temperature{};
+    if (this->sample_category_due(sample_category::temperature)) {
+        temperature = this->latest_temperature();
+    }
+
+    const std::lock_guard lock{ regions_mutex_ };
+    for (const std::size_t id : open_regions_) {
+        energy_region &region = regions_[id];
+        ++region.num_samples;
+        if (power.has_value()) {
+            ++region.num_power_samples;
+            region.total_power += power.value();
+            region.max_power = std::max(region.max_power.value_or(power.value()), power.value());
+        }
+        if (temperature.has_value()) {
+            region.max_temperature = std::max(region.max_temperature.value_or(temperature.value()), temperature.value());
+        }
+    }
+}
+
+energy_region hardware_sampler::finish_region(const std::size_t id, const std::chrono::steady_clock::time_point end_time_point, const std::optional<double> end_energy) {
+    energy_region &region = regions_[id];
+    region.end_time_point = end_time_point;
+    region.end_energy = end_energy;
+
+    open_regions_.erase(std::find(open_regions_.begin(), open_regions_.end(), id));
+    --num_open_regions_;
+    return region;
+}
+
+void hardware_sampler::update_burst_capture(const std::chrono::steady_clock::time_point now) {
+    // fast path: no trigger has been added
+    if (!this->uses_triggers()) {
+        return;
+    }
+
+    // record the numeric hardware samples of the current tick
+    this->update_numeric_sample_values();
+
+    if (burst_trigger_.has_value()) {
+        // the burst is active -> the tick belongs to the post-trigger window
+        burst_time_points_.push_back(now);
+        for (std::size_t i = 0; i < burst_series_.size(); ++i) {
+            burst_series_[i].push_back(numeric_sample_values_[i]);
+        }
+    } else {
+        // the triggers are armed -> remember the tick in the pre-trigger ring and check whether any trigger fires
+        burst_history_.push_back(now, numeric_sample_values_);
+        for (std::size_t i = 0; i < triggers_.size(); ++i) {
+            if (triggers_[i].second()) {
+                burst_trigger_ = i;
+                burst_trigger_time_point_ = now;
+                // the burst mode samples with the burst sampling interval -> reserve the memory for the whole post-trigger window
+                const std::size_t capacity = burst_history_.capacity() + static_cast<std::size_t>(post_trigger_duration_.value() / this->burst_sampling_interval()) + 2;
+                burst_time_points_.clear();
+                burst_time_points_.reserve(capacity);
+                burst_series_.assign(numeric_sample_names_.size(), std::vector<double>{});
+                for (std::vector<double> &series : burst_series_) {
+                    series.reserve(capacity);
+                }
+                burst_history_.append_since(now - std::chrono::duration_cast<std::chrono::steady_clock::duration>(pre_trigger_duration_), burst_time_points_, burst_series_);
+                burst_history_.clear();
+                this->add_event(event{ now, fmt::format("burst_triggered_{}", triggers_[i].first) });
+                break;
+            }
+        }
+    }
+    if (burst_trigger_.has_value() && now - burst_trigger_time_point_ >= post_trigger_duration_.value()) {
+        // the post-trigger window has elapsed
+        this->finish_burst_capture();
+    }
+}
+
+void hardware_sampler::notify_tick_callbacks(const std::chrono::steady_clock::time_point now, const bool on_demand) {
+    // fast path: no tick callback has been added
+    if (num_tick_callbacks_ == 0) {
+        return;
+    }
+
+    // copy the immutable list of the tick callbacks (no memory allocation) -> the callbacks are called without holding the lock
+    std::shared_ptr<const tick_callback_list> callbacks{};
+    {
+        const std::lock_guard lock{ tick_callbacks_mutex_ };
+        callbacks = tick_callbacks_;
+        // set while holding the lock -> a concurrent remove_tick_callback either sees the flag or its callback isn't part of the copied list
+        tick_callbacks_running_ = true;
+    }
+
+    // the view lives on the stack and references the preallocated numeric hardware samples -> no memory allocation
+    this->update_numeric_sample_values();
+    tick_view view{ *this, now, last_query_latency_, time_points_.num_discarded() + time_points_.size() - 1, on_demand, due_categories_, std::nullopt, std::nullopt, numeric_sample_names_, numeric_sample_values_ };
+    if (view.sampled(sample_category::power)) {
+        view.power_usage = this->latest_power_usage();
+    }
+    if (view.sampled(sample_category::temperature)) {
+        view.temperature = this->latest_temperature();
+    }
+
+    try {
+        for (const auto &callback : *callbacks) {
+            (*callback.second)(view);
+        }
+    } catch (...) {
+        callbacks.reset();
+        tick_callbacks_running_ = false;
+        throw;
+    }
+    // release the copied list before signaling remove_tick_callback -> a removed callback is never destroyed in the sampling std::thread
+    callbacks.reset();
+    tick_callbacks_running_ = false;
+}
+
+void hardware_sampler::update_numeric_sample_values() {
+    std::fill(numeric_sample_values_.begin(), numeric_sample_values_.end(), std::numeric_limits<double>::quiet_NaN());
+    this->latest_numeric_sample_values(due_categories_, numeric_sample_values_);
+}
+
+void hardware_sampler::finish_burst_capture() {
+    burst_capture capture{};
+    capture.trigger = triggers_[burst_trigger_.value()].first;
+    capture.trigger_time_point = burst_trigger_time_point_;
+    capture.time_points = std::move(burst_time_points_);
+    for (std::size_t i = 0; i < numeric_sample_names_.size(); ++i) {
+        capture.samples.emplace(numeric_sample_names_[i], std::move(burst_series_[i]));
+    }
+    burst_time_points_.clear();
+    burst_series_.clear();
+    // re-arm the triggers
+    burst_trigger_.reset();
+
+    const std::lock_guard lock{ burst_captures_mutex_ };
+    burst_captures_.push_back(std::move(capture));
+}
+
+void hardware_sampler::sampling_loop() {
+    this->initialize_sampling(std::chrono::steady_clock::now());
+
+    //
+    // loop until stop_sampling() is called
+    //
+
+    while (true) {
+        std::unique_lock lock{ sampling_wakeup_->mutex };
+        if (sample_requested_.exchange(false)) {
+            // retrieve the on-demand sample without blocking the threads that want to wake up the sampling std::thread
+            lock.unlock();
+            this->sampling_tick_on_demand(std::chrono::steady_clock::now());
+            continue;
+        }
+        const std::chrono::steady_clock::time_point deadline = this->pending_deadline(std::chrono::steady_clock::now());
+        if (this->has_sampling_stopped()) {
+            break;
+        }
+        if (this->samples_pause_pending()) {
+            // releasing the resources may block, e.g., until a subprocess exited -> don't block the threads that want to wake up the sampling std::thread
+            lock.unlock();
+            this->pause_pending_samples();
+            continue;
+        }
+        if (deadline == std::chrono::steady_clock::time_point::max()) {
+            // the sampling is paused -> sleep until it is resumed or stopped
+            sampling_wakeup_->cv.wait(lock);
+            continue;
+        }
+        // wait for the next deadline to retrieve the next sample, but wake up immediately if the sampling is stopped or paused
+        if (sampling_wakeup_->cv.wait_until(lock, deadline) == std::cv_status::no_timeout) {
+            continue;
+        }
+        lock.unlock();
+        this->sampling_tick(std::chrono::steady_clock::now());
+    }
+
+    this->finish_sampling();
+}
+
+void hardware_sampler::finish_sampling() {
+    // capture the active burst with a truncated post-trigger window
+    if (burst_trigger_.has_value()) {
+        this->finish_burst_capture();
+    }
+    this->finalize_samples();
+}
+
+void hardware_sampler::pause_pending_samples() {
+    samples_paused_ = true;
+    this->pause_samples();
+}
+
+std::chrono::steady_clock::time_point hardware_sampler::pending_deadline(const std::chrono::steady_clock::time_point now) {
+    using clock_type = std::chrono::steady_clock;
+
+    if (this->has_sampling_stopped()) {
+        return clock_type::time_point::max();
+    }
+    if (!this->is_sampling()) {
+        sampling_paused_ = true;
+        return clock_type::time_point::max();
+    }
+    if (sampling_paused_) {
+        // the sampling has been resumed -> continue with the first deadline on the sampling grid after now
+        sampling_paused_ = false;
+        const clock_type::duration interval = std::chrono::duration_cast<clock_type::duration>(this->sampling_interval());
+        if (next_deadline_ <= now) {
+            next_deadline_ += ((now - next_deadline_) / interval + 1) * interval;
+        }
+    }
+    return next_deadline_;
+}
+
 void hardware_sampler::add_time_point(const std::chrono::steady_clock::time_point time_point) {
     time_points_.push_back(time_point);
 }
 
+std::size_t hardware_sampler::expected_num_samples() const noexcept {
+    if (this->num_retained_samples() > 0) {
+        // the ring buffers never store more than the retained samples
+        return this->num_retained_samples();
+    }
+    if (expected_sampling_duration_ == std::chrono::nanoseconds{ 0 }) {
+        return 0;
+    }
+    // +1 for the initial samples
+    return static_cast<std::size_t>(expected_sampling_duration_ / this->sampling_interval()) + 1;
+}
+
+std::size_t hardware_sampler::num_retained_samples() const noexcept {
+    // the streaming statistics summarize all samples -> retain only the last two samples needed by the adaptive sampling and the region aggregates
+    return this->uses_streaming_statistics() ? 2 : sample_retention_;
+}
+
+std::vector<std::chrono::steady_clock::time_point> hardware_sampler::retained_time_points(const sample_column<std::chrono::steady_clock::time_point> &column, const std::size_t num_time_points, const std::optional<sample_category> category) const {
+    // the ticks of a sample category aren't equidistant (adaptive sampling rate, on-demand samples) -> select them via the categories sampled in each tick
+    // the sampled categories are published before the time points -> they are available for all considered time points
+    const auto sampled = [this, category](const std::size_t i) {
+        return !category.has_value() || static_cast<int>(sampled_categories_[i] & category.value()) != 0;
+    };
+    // only the time points of the last retained samples are retained
+    const std::size_t num_retained = this->num_retained_samples();
+    std::size_t first = 0;
+    if (num_retained > 0) {
+        std::size_t num_category_time_points = 0;
+        for (first = num_time_points; first > 0 && num_category_time_points < num_retained; --first) {
+            num_category_time_points += sampled(first - 1) ? 1 : 0;
+        }
+    }
+
+    std::vector<std::chrono::steady_clock::time_point> time_points{};
+    time_points.reserve(num_time_points - first);
+    for (std::size_t i = first; i < num_time_points; ++i) {
+        if (sampled(i)) {
+            time_points.push_back(column[i]);
+        }
+    }
+    return time_points;
+}
+
+std::vector<std::chrono::nanoseconds> hardware_sampler::retained_query_latencies(const std::optional<sample_category> category) const {
+    // the end time points are published after the begin time points -> use the number of end time points for both to get a consistent prefix
+    const std::size_t num_queries = query_end_time_points_.size();
+    const std::vector<std::chrono::steady_clock::time_point> begin_time_points = this->retained_time_points(query_begin_time_points_, num_queries, category);
+    const std::vector<std::chrono::steady_clock::time_point> end_time_points = this->retained_time_points(query_end_time_points_, num_queries, category);
+
+    std::vector<std::chrono::nanoseconds> latencies(end_time_points.size());
+    std::transform(end_time_points.cbegin(), end_time_points.cend(), begin_time_points.cbegin(), latencies.begin(), [](const auto end, const auto begin) {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin);
+    });
+    return latencies;
+}
+
+void hardware_sampler::merge_recorded_events() const {
+    const auto num_sorted_events = static_cast<std::vector<event>::difference_type>(events_.size());
+    recorded_events_.drain(events_);
+
+    // the events of different threads may be out of order -> sort the new events and merge them with the already sorted ones
+    const auto by_time_point = [](const event &lhs, const event &rhs) { return lhs.time_point < rhs.time_point; };
+    std::stable_sort(events_.begin() + num_sorted_events, events_.end(), by_time_point);
+    std::inplace_merge(events_.begin(), events_.begin() + num_sorted_events, events_.end(), by_time_point);
+}
+
 bool hardware_sampler::sample_category_enabled(const sample_category category) const noexcept {
     return static_cast<int>(this->sample_category_ & category) != 0;
 }
 
+sample_column_config hardware_sampler::column_config() const noexcept {
+    return sample_column_config{ this->num_retained_samples(), this->expected_num_samples(), sample_compression_, streaming_statistics_ };
+}
+
+bool hardware_sampler::sample_category_due(const sample_category category) const noexcept {
+    return static_cast<int>(due_categories_ & category) != 0;
+}
+
+sample_category hardware_sampler::due_sample_categories(const std::size_t slot) noexcept {
+    sample_category due{};
+    for (std::size_t idx = 0; idx < num_sample_categories_; ++idx) {
+        const auto single_category = static_cast<sample_category>(1 << idx);
+        if (this->sample_category_enabled(single_category) && slot >= next_due_slots_[idx]) {
+            due |= single_category;
+            // the next slot on the grid of the sample category, independent of when the current slot has been sampled
+            const std::size_t stride = sampling_interval_strides_[idx];
+            next_due_slots_[idx] = (slot / stride + 1) * stride;
+        }
+    }
+    return due;
+}
+
+sample_category hardware_sampler::base_interval_sample_categories() const noexcept {
+    sample_category categories{};
+    for (std::size_t idx = 0; idx < num_sample_categories_; ++idx) {
+        const auto single_category = static_cast<sample_category>(1 << idx);
+        if (this->sample_category_enabled(single_category) && sampling_interval_strides_[idx] == 1) {
+            categories |= single_category;
+        }
+    }
+    return categories;
+}
+
+void hardware_sampler::record_sampled_categories(const std::chrono::steady_clock::time_point now) noexcept {
+    for (std::size_t idx = 0; idx < num_sample_categories_; ++idx) {
+        if (this->sample_category_due(static_cast<sample_category>(1 << idx))) {
+            previous_sample_time_points_[idx] = now;
+        }
+    }
+}
+
+std::chrono::steady_clock::duration hardware_sampler::time_since_previous_sample(const sample_category category) const noexcept {
+    // the previous sample of the category may lie an arbitrary number of ticks back (adaptive sampling rate, on-demand samples)
+    std::chrono::steady_clock::time_point previous = time_points_.back();
+    for (std::size_t idx = 0; idx < num_sample_categories_; ++idx) {
+        if (category == static_cast<sample_category>(1 << idx)) {
+            previous = previous_sample_time_points_[idx];
+        }
+    }
+    return time_points_.back() - previous;
+}
+
+void hardware_sampler::track_sample_change(const sample_category category, const double previous, const double current) noexcept {
+    double threshold = adaptive_sampling_thresholds_.front();
+    for (std::size_t idx = 0; idx < num_sample_categories_; ++idx) {
+        if (category == static_cast<sample_category>(1 << idx)) {
+            threshold = adaptive_sampling_thresholds_[idx];
+        }
+    }
+
+    // the relative change with respect to the previous value (guarding against a division by zero)
+    const double relative_change = std::abs(current - previous) / std::max(std::abs(previous), std::numeric_limits<double>::min());
+    sample_change_tracked_ = true;
+    sample_change_detected_ = sample_change_detected_ || relative_change > threshold;
+}
+
 }  // namespace hws
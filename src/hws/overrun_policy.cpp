@@ -0,0 +1,26 @@
+/**
+ * @author Marcel Breyer
+ * @copyright 2024-today All Rights Reserved
+ * @license This file is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ */
+
+#include "hws/overrun_policy.hpp"
+
+#include <ios>      // std::ios_base
+#include <ostream>  // std::ostream
+
+namespace hws {
+
+std::ostream &operator<<(std::ostream &out, const overrun_policy policy) {
+    switch (policy) {
+        case overrun_policy::catch_up:
+            return out << "catch_up";
+        case overrun_policy::skip:
+            return out << "skip";
+    }
+    out.setstate(std::ios_base::failbit);
+    return out;
+}
+
+}  // namespace hws
@@ -0,0 +1,80 @@
+/**
+ * @author Marcel Breyer
+ * @copyright 2024-today All Rights Reserved
+ * @license This file is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ */
+
+#include "hws/sampling_statistics.hpp"
+
+#include "fmt/chrono.h"  // direct formatting of std::chrono types
+#include "fmt/format.h"  // fmt::format
+
+#include <algorithm>  // std::min, std::max
+#include <chrono>     // std::chrono::nanoseconds
+#include <ostream>    // std::ostream
+
+namespace hws {
+
+void sampling_statistics::add_tick(const std::chrono::nanoseconds jitter) noexcept {
+    if (num_ticks == 0) {
+        min_jitter = jitter;
+        max_jitter = jitter;
+    } else {
+        min_jitter = std::min(min_jitter, jitter);
+        max_jitter = std::max(max_jitter, jitter);
+    }
+    total_jitter += jitter;
+    ++num_ticks;
+}
+
+std::chrono::nanoseconds sampling_statistics::mean_jitter() const noexcept {
+    if (num_ticks == 0) {
+        return std::chrono::nanoseconds{ 0 };
+    }
+    return total_jitter / static_cast<std::chrono::nanoseconds::rep>(num_ticks);
+}
+
+void sampling_statistics::add_query(const std::chrono::nanoseconds latency) noexcept {
+    if (num_queries == 0) {
+        min_query_latency = latency;
+        max_query_latency = latency;
+    } else {
+        min_query_latency = std::min(min_query_latency, latency);
+        max_query_latency = std::max(max_query_latency, latency);
+    }
+    total_query_latency += latency;
+    ++num_queries;
+}
+
+std::chrono::nanoseconds sampling_statistics::mean_query_latency() const noexcept {
+    if (num_queries == 0) {
+        return std::chrono::nanoseconds{ 0 };
+    }
+    return total_query_latency / static_cast<std::chrono::nanoseconds::rep>(num_queries);
+}
+
+std::ostream &operator<<(std::ostream &out, const sampling_statistics &stats) {
+    return out << fmt::format("num_ticks: {}\n"
+                              "num_missed_ticks: {}\n"
+                              "num_on_demand_ticks: {}\n"
+                              "min_jitter: {}\n"
+                              "max_jitter: {}\n"
+                              "mean_jitter: {}\n"
+                              "num_queries: {}\n"
+                              "min_query_latency: {}\n"
+                              "max_query_latency: {}\n"
+                              "mean_query_latency: {}",
+                              stats.num_ticks,
+                              stats.num_missed_ticks,
+                              stats.num_on_demand_ticks,
+                              stats.min_jitter,
+                              stats.max_jitter,
+                              stats.mean_jitter(),
+                              stats.num_queries,
+                              stats.min_query_latency,
+                              stats.max_query_latency,
+                              stats.mean_query_latency());
+}
+
+}  // namespace hws
@@ -0,0 +1,66 @@
+/**
+ * @author Marcel Breyer
+ * @copyright 2024-today All Rights Reserved
+ * @license This file is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ */
+
+#include "hws/scoped_region.hpp"
+
+#include "hws/energy_region.hpp"            // hws::energy_region
+#include "hws/hardware_sampler.hpp"         // hws::hardware_sampler
+#include "hws/system_hardware_sampler.hpp"  // hws::system_hardware_sampler
+
+#include <cstddef>    // std::size_t
+#include <exception>  // std::exception
+#include <string>     // std::string
+#include <vector>     // std::vector
+
+namespace hws {
+
+scoped_region::scoped_region(hardware_sampler &sampler, const std::string &name) {
+    region_ids_.emplace_back(&sampler, sampler.begin_region(name));
+}
+
+scoped_region::scoped_region(system_hardware_sampler &sampler, const std::string &name) {
+    region_ids_.reserve(sampler.num_samplers());
+    try {
+        for (auto &ptr : sampler.samplers()) {
+            region_ids_.emplace_back(ptr.get(), ptr->begin_region(name));
+        }
+    } catch (...) {
+        // the destructor isn't called if the constructor throws -> end the already begun regions
+        this->end_ignoring_errors();
+        throw;
+    }
+}
+
+scoped_region::~scoped_region() {
+    this->end_ignoring_errors();
+}
+
+const std::vector<energy_region> &scoped_region::end() {
+    if (!finished_) {
+        regions_.reserve(region_ids_.size());
+        for (const auto &[sampler, id] : region_ids_) {
+            regions_.push_back(sampler->end_region(id));
+        }
+        finished_ = true;
+    }
+    return regions_;
+}
+
+void scoped_region::end_ignoring_errors() noexcept {
+    if (!finished_) {
+        for (const auto &[sampler, id] : region_ids_) {
+            try {
+                sampler->end_region(id);
+            } catch (const std::exception &) {
+                // the hardware sampler has already been stopped -> the region stays open
+            }
+        }
+        finished_ = true;
+    }
+}
+
+}  // namespace hws
@@ -0,0 +1,280 @@
+/**
+ * @author Marcel Breyer
+ * @copyright 2024-today All Rights Reserved
+ * @license This file is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ */
+
+#include "hws/streaming_statistics.hpp"
+
+#include "fmt/format.h"  // fmt::format
+
+#include <algorithm>         // std::min, std::max, std::clamp
+#include <cmath>             // std::log, std::ceil, std::pow, std::sqrt, std::isfinite, std::floor
+#include <cstddef>           // std::size_t, std::ptrdiff_t
+#include <cstdint>           // std::uint64_t
+#include <initializer_list>  // std::initializer_list
+#include <limits>            // std::numeric_limits
+#include <numeric>           // std::accumulate
+#include <ostream>           // std::ostream
+#include <stdexcept>         // std::invalid_argument
+#include <vector>            // std::vector
+
+namespace hws {
+
+void streaming_statistics::bin_store::add(const int index, const std::uint64_t num) {
+    if (bins.empty()) {
+        offset = index;
+        bins.assign(1, num);
+        return;
+    }
+
+    if (index < offset) {
+        // the new bin lies below the current range -> grow downwards, but never beyond max_num_bins
+        const std::size_t num_new_bins = std::min(static_cast<std::size_t>(offset - index), max_num_bins - std::min(bins.size(), max_num_bins));
+        bins.insert(bins.begin(), num_new_bins, std::uint64_t{ 0 });
+        offset -= static_cast<int>(num_new_bins);
+        // if the bin couldn't be created, the value is collapsed into the lowest bin
+        bins.front() += num;
+        return;
+    }
+
+    const auto pos = static_cast<std::size_t>(index - offset);
+    if (pos >= bins.size()) {
+        // the new bin lies above the current range -> grow upwards
+        const std::size_t new_size = pos + 1;
+        if (new_size > max_num_bins) {
+            // too many bins -> collapse the lowest bins such that the new bin is the last one
+            const std::size_t shift = new_size - max_num_bins;
+            const std::size_t num_collapsed = std::min(shift + 1, bins.size());
+            const std::uint64_t collapsed = std::accumulate(bins.cbegin(), bins.cbegin() + static_cast<std::ptrdiff_t>(num_collapsed), std::uint64_t{ 0 });
+            bins.erase(bins.begin(), bins.begin() + static_cast<std::ptrdiff_t>(num_collapsed - 1));
+            bins.front() = collapsed;
+            offset += static_cast<int>(shift);
+            bins.resize(max_num_bins, std::uint64_t{ 0 });
+        } else {
+            bins.resize(new_size, std::uint64_t{ 0 });
+        }
+    }
+    bins[static_cast<std::size_t>(index - offset)] += num;
+}
+
+streaming_statistics::streaming_statistics(const double relative_accuracy) :
+    relative_accuracy_{ relative_accuracy } {
+    if (!(relative_accuracy > 0.0 && relative_accuracy < 1.0)) {
+        throw std::invalid_argument{ fmt::format("The relative accuracy must be in the open interval (0, 1), but is {}!", relative_accuracy) };
+    }
+    gamma_ = (1.0 + relative_accuracy) / (1.0 - relative_accuracy);
+    inverse_log_gamma_ = 1.0 / std::log(gamma_);
+}
+
+int streaming_statistics::index(const double value) const noexcept {
+    return static_cast<int>(std::ceil(std::log(value) * inverse_log_gamma_));
+}
+
+double streaming_statistics::bin_value(const int index) const noexcept {
+    return 2.0 * std::pow(gamma_, index) / (gamma_ + 1.0);
+}
+
+void streaming_statistics::add(const double value) {
+    if (!std::isfinite(value)) {
+        return;
+    }
+
+    // update the moments using Welford's algorithm
+    ++count_;
+    const double delta = value - mean_;
+    mean_ += delta / static_cast<double>(count_);
+    m2_ += delta * (value - mean_);
+    min_ = count_ == 1 ? value : std::min(min_, value);
+    max_ = count_ == 1 ? value : std::max(max_, value);
+
+    // update the sketch
+    if (value >= min_indexable_value) {
+        positive_bins_.add(this->index(value), 1);
+    } else if (value <= -min_indexable_value) {
+        negative_bins_.add(this->index(-value), 1);
+    } else {
+        ++zero_count_;
+    }
+}
+
+void streaming_statistics::merge(const streaming_statistics &other) {
+    if (relative_accuracy_ != other.relative_accuracy_) {
+        throw std::invalid_argument{ fmt::format("Can't merge summaries with different relative accuracies ({} and {})!", relative_accuracy_, other.relative_accuracy_) };
+    }
+    if (other.count_ == 0) {
+        return;
+    }
+    if (count_ == 0) {
+        *this = other;
+        return;
+    }
+
+    // merge the moments using the parallel algorithm of Chan et al.
+    const auto n_a = static_cast<double>(count_);
+    const auto n_b = static_cast<double>(other.count_);
+    const double n = n_a + n_b;
+    const double delta = other.mean_ - mean_;
+    mean_ += delta * n_b / n;
+    m2_ += other.m2_ + delta * delta * n_a * n_b / n;
+    count_ += other.count_;
+    min_ = std::min(min_, other.min_);
+    max_ = std::max(max_, other.max_);
+
+    // merge the sketches
+    for (std::size_t i = 0; i < other.positive_bins_.bins.size(); ++i) {
+        if (other.positive_bins_.bins[i] != 0) {
+            positive_bins_.add(other.positive_bins_.offset + static_cast<int>(i), other.positive_bins_.bins[i]);
+        }
+    }
+    for (std::size_t i = 0; i < other.negative_bins_.bins.size(); ++i) {
+        if (other.negative_bins_.bins[i] != 0) {
+            negative_bins_.add(other.negative_bins_.offset + static_cast<int>(i), other.negative_bins_.bins[i]);
+        }
+    }
+    zero_count_ += other.zero_count_;
+}
+
+double streaming_statistics::min() const noexcept {
+    return count_ == 0 ? std::numeric_limits<double>::quiet_NaN() : min_;
+}
+
+double streaming_statistics::max() const noexcept {
+    return count_ == 0 ? std::numeric_limits<double>::quiet_NaN() : max_;
+}
+
+double streaming_statistics::mean() const noexcept {
+    return count_ == 0 ? std::numeric_limits<double>::quiet_NaN() : mean_;
+}
+
+double streaming_statistics::variance() const noexcept {
+    return count_ == 0 ? std::numeric_limits<double>::quiet_NaN() : m2_ / static_cast<double>(count_);
+}
+
+double streaming_statistics::standard_deviation() const noexcept {
+    return std::sqrt(this->variance());
+}
+
+double streaming_statistics::quantile(const double q) const {
+    if (!(q >= 0.0 && q <= 1.0)) {
+        throw std::invalid_argument{ fmt::format("The quantile must be in the closed interval [0, 1], but is {}!", q) };
+    }
+    if (count_ == 0) {
+        return std::numeric_limits<double>::quiet_NaN();
+    }
+    // the extremes are tracked exactly
+    if (q == 0.0) {
+        return min_;
+    }
+    if (q == 1.0) {
+        return max_;
+    }
+
+    // walk the bins in ascending order of their values until the rank of the quantile has been reached
+    const double rank = q * static_cast<double>(count_ - 1);
+    double num_seen = 0.0;
+    for (std::size_t i = negative_bins_.bins.size(); i-- > 0;) {
+        num_seen += static_cast<double>(negative_bins_.bins[i]);
+        if (num_seen > rank) {
+            return std::clamp(-this->bin_value(negative_bins_.offset + static_cast<int>(i)), min_, max_);
+        }
+    }
+    num_seen += static_cast<double>(zero_count_);
+    if (num_seen > rank) {
+        return std::clamp(0.0, min_, max_);
+    }
+    for (std::size_t i = 0; i < positive_bins_.bins.size(); ++i) {
+        num_seen += static_cast<double>(positive_bins_.bins[i]);
+        if (num_seen > rank) {
+            return std::clamp(this->bin_value(positive_bins_.offset + static_cast<int>(i)), min_, max_);
+        }
+    }
+    return max_;
+}
+
+std::vector<double> streaming_statistics::serialize() const {
+    // layout: relative accuracy, count, mean, m2, min, max, zero count,
+    //         positive offset, number of positive bins, positive bins..., negative offset, number of negative bins, negative bins...
+    std::vector<double> data{
+        relative_accuracy_, static_cast<double>(count_), mean_, m2_, min_, max_, static_cast<double>(zero_count_)
+    };
+    data.reserve(data.size() + 4 + positive_bins_.bins.size() + negative_bins_.bins.size());
+    for (const bin_store *store : { &positive_bins_, &negative_bins_ }) {
+        data.push_back(static_cast<double>(store->offset));
+        data.push_back(static_cast<double>(store->bins.size()));
+        for (const std::uint64_t num : store->bins) {
+            data.push_back(static_cast<double>(num));
+        }
+    }
+    return data;
+}
+
+streaming_statistics streaming_statistics::deserialize(const std::vector<double> &data) {
+    // all checks are written such that NaN fails them -> no invalid value reaches a conversion to an integer (undefined behavior if out of range)
+    const auto is_count = [](const double value) { return value >= 0.0 && value < static_cast<double>(std::numeric_limits<std::uint64_t>::max()) && std::floor(value) == value; };
+    // the logarithmic indices of all bins of a store must be representable as int
+    const auto is_offset = [](const double value) {
+        return value >= static_cast<double>(std::numeric_limits<int>::min()) && value <= static_cast<double>(std::numeric_limits<int>::max() - static_cast<int>(max_num_bins)) && std::floor(value) == value;
+    };
+    const auto invalid = []() { return std::invalid_argument{ "The data isn't a valid serialized streaming_statistics!" }; };
+
+    if (data.size() < 11 || !is_count(data[1]) || !is_count(data[6])) {
+        throw invalid();
+    }
+    if (!std::isfinite(data[2]) || !(data[3] >= 0.0) || !std::isfinite(data[3]) || !std::isfinite(data[4]) || !std::isfinite(data[5])) {
+        throw invalid();
+    }
+
+    streaming_statistics stats{ data[0] };
+    stats.count_ = static_cast<std::size_t>(data[1]);
+    stats.mean_ = data[2];
+    stats.m2_ = data[3];
+    stats.min_ = data[4];
+    stats.max_ = data[5];
+    stats.zero_count_ = static_cast<std::uint64_t>(data[6]);
+
+    std::size_t pos = 7;
+    double num_binned = static_cast<double>(stats.zero_count_);
+    for (bin_store *store : { &stats.positive_bins_, &stats.negative_bins_ }) {
+        if (pos + 2 > data.size() || !is_offset(data[pos]) || !is_count(data[pos + 1]) || data[pos + 1] > static_cast<double>(max_num_bins) || pos + 2 + static_cast<std::size_t>(data[pos + 1]) > data.size()) {
+            throw invalid();
+        }
+        store->offset = static_cast<int>(data[pos]);
+        const auto num_bins = static_cast<std::size_t>(data[pos + 1]);
+        pos += 2;
+        for (std::size_t i = 0; i < num_bins; ++i, ++pos) {
+            if (!is_count(data[pos])) {
+                throw invalid();
+            }
+            store->bins.push_back(static_cast<std::uint64_t>(data[pos]));
+            num_binned += data[pos];
+        }
+    }
+    // every added value has been counted in exactly one bin
+    if (pos != data.size() || num_binned != data[1]) {
+        throw invalid();
+    }
+    return stats;
+}
+
+std::ostream &operator<<(std::ostream &out, const streaming_statistics &stats) {
+    return out << fmt::format("count: {}\n"
+                              "mean: {}\n"
+                              "standard_deviation: {}\n"
+                              "min: {}\n"
+                              "p50: {}\n"
+                              "p90: {}\n"
+                              "p99: {}\n"
+                              "max: {}",
+                              stats.count(),
+                              stats.mean(),
+                              stats.standard_deviation(),
+                              stats.min(),
+                              stats.quantile(0.5),
+                              stats.quantile(0.9),
+                              stats.quantile(0.99),
+                              stats.max());
+}
+
+}  // namespace hws
@@ -7,6 +7,8 @@
 
 #include "hws/system_hardware_sampler.hpp"
 
+#include "hws/burst_capture.hpp"    // hws::burst_capture
+#include "hws/energy_region.hpp"    // hws::energy_region
 #include "hws/event.hpp"            // hws::event
 #include "hws/sample_category.hpp"  // hws::sample_category
 
@@ -32,21 +34,28 @@
 
 #include "fmt/format.h"  // fmt::format
 
-#include <algorithm>  // std::for_each, std::all_of
-#include <chrono>     // std::chrono::milliseconds
-#include <cstddef>    // std::size_t
-#include <cstdint>    // std::uint32_t
-#include <memory>     // std::unique_ptr, std::make_unique
-#include <numeric>    // std::accumulate
-#include <stdexcept>  // std::out_of_range
-#include <vector>     // std::vector
+#include <algorithm>           // std::for_each, std::all_of, std::any_of, std::min
+#include <chrono>              // std::chrono::{nanoseconds, steady_clock}
+#include <condition_variable>  // std::cv_status
+#include <cstddef>             // std::size_t
+#include <cstdint>             // std::uint32_t
+#include <exception>           // std::exception, std::terminate
+#include <iostream>            // std::cerr, std::endl
+#include <memory>              // std::unique_ptr, std::make_unique, std::make_shared
+#include <mutex>               // std::mutex, std::unique_lock
+#include <numeric>             // std::accumulate
+#include <optional>            // std::optional
+#include <stdexcept>           // std::out_of_range, std::runtime_error
+#include <string>              // std::string
+#include <thread>              // std::thread
+#include <vector>              // std::vector
 
 namespace hws {
 
 system_hardware_sampler::system_hardware_sampler(const sample_category category) :
     system_hardware_sampler{ HWS_SAMPLING_INTERVAL, category } { }
 
-system_hardware_sampler::system_hardware_sampler(const std::chrono::milliseconds sampling_interval, sample_category category) {
+system_hardware_sampler::system_hardware_sampler(const std::chrono::nanoseconds sampling_interval, sample_category category) {
     // create the hardware samplers based on the available hardware
 #if defined(HWS_FOR_CPUS_ENABLED)
     {
@@ -99,12 +108,58 @@ system_hardware_sampler::system_hardware_sampler(const std::chrono::milliseconds
 #endif
 }
 
+system_hardware_sampler::~system_hardware_sampler() {
+    try {
+        // if the shared sampling std::thread is still running, stop it
+        if (sampling_thread_.joinable()) {
+            std::for_each(samplers_.begin(), samplers_.end(), [](auto &ptr) {
+                if (ptr->has_sampling_started() && !ptr->has_sampling_stopped()) {
+                    ptr->stop_sampling();
+                }
+            });
+            sampling_thread_.join();
+        }
+    } catch (const std::exception &e) {
+        std::cerr << e.what() << std::endl;
+        std::terminate();
+    }
+}
+
 void system_hardware_sampler::start_sampling() {
-    std::for_each(samplers_.begin(), samplers_.end(), [](auto &ptr) { ptr->start_sampling(); });
+    const bool marker_only_mode = std::any_of(samplers_.cbegin(), samplers_.cend(), [](const auto &ptr) { return ptr->uses_marker_only_mode(); });
+    if (!shared_sampling_thread_ || marker_only_mode) {
+        // each hardware sampler uses its own std::thread (none in the marker-only mode)
+        std::for_each(samplers_.begin(), samplers_.end(), [](auto &ptr) { ptr->start_sampling(); });
+        return;
+    }
+
+    // start a single sampling loop for all hardware samplers
+    // stopping, pausing, or resuming any hardware sampler must wake up the shared sampling std::thread
+    sampling_wakeup_ = std::make_shared<hardware_sampler::sampling_wakeup>();
+    std::for_each(samplers_.begin(), samplers_.end(), [this](auto &ptr) {
+        ptr->sampling_wakeup_ = sampling_wakeup_;
+        ptr->uses_shared_sampling_thread_ = true;
+    });
+    std::for_each(samplers_.begin(), samplers_.end(), [](auto &ptr) { ptr->mark_sampling_started(); });
+    sampling_thread_ = std::thread{
+        [this]() {
+            try {
+                this->sampling_loop();
+            } catch (const std::exception &e) {
+                // print useful error message
+                std::cerr << e.what() << std::endl;
+                throw;
+            }
+        }
+    };
 }
 
 void system_hardware_sampler::stop_sampling() {
     std::for_each(samplers_.begin(), samplers_.end(), [](auto &ptr) { ptr->stop_sampling(); });
+    // notified via the stopped hardware samplers
+    if (sampling_thread_.joinable()) {
+        sampling_thread_.join();
+    }
 }
 
 void system_hardware_sampler::pause_sampling() {
@@ -139,6 +194,46 @@ void system_hardware_sampler::add_event(decltype(event::name) name) {
     std::for_each(samplers_.begin(), samplers_.end(), [&name](auto &ptr) { ptr->add_event(name); });
 }
 
+void system_hardware_sampler::add_event(decltype(event::name) name, const bool sample_immediately) {
+    std::for_each(samplers_.begin(), samplers_.end(), [&name, sample_immediately](auto &ptr) { ptr->add_event(name, sample_immediately); });
+}
+
+void system_hardware_sampler::sample_now() {
+    std::for_each(samplers_.begin(), samplers_.end(), [](auto &ptr) { ptr->sample_now(); });
+}
+
+void system_hardware_sampler::begin_region(const std::string &name) {
+    std::for_each(samplers_.begin(), samplers_.end(), [&name](auto &ptr) { ptr->begin_region(name); });
+}
+
+void system_hardware_sampler::end_region(const std::string &name) {
+    std::for_each(samplers_.begin(), samplers_.end(), [&name](auto &ptr) { ptr->end_region(name); });
+}
+
+std::vector<std::vector<energy_region>> system_hardware_sampler::energy_regions() const {
+    std::vector<std::vector<energy_region>> energy_regions_per_sampler(this->num_samplers());
+    std::transform(samplers_.cbegin(), samplers_.cend(), energy_regions_per_sampler.begin(), [](const auto &ptr) { return ptr->energy_regions(); });
+    return energy_regions_per_sampler;
+}
+
+void system_hardware_sampler::set_marker_only_mode(const bool enable) {
+    std::for_each(samplers_.begin(), samplers_.end(), [enable](auto &ptr) { ptr->set_marker_only_mode(enable); });
+}
+
+void system_hardware_sampler::set_burst_window(const std::chrono::nanoseconds pre_trigger, const std::chrono::nanoseconds post_trigger, const std::optional<std::chrono::nanoseconds> burst_interval) {
+    std::for_each(samplers_.begin(), samplers_.end(), [pre_trigger, post_trigger, burst_interval](auto &ptr) { ptr->set_burst_window(pre_trigger, post_trigger, burst_interval); });
+}
+
+void system_hardware_sampler::set_sample_metrics(const std::vector<std::string> &metrics) {
+    std::for_each(samplers_.begin(), samplers_.end(), [&metrics](auto &ptr) { ptr->set_sample_metrics(metrics); });
+}
+
+std::vector<std::vector<burst_capture>> system_hardware_sampler::burst_captures() const {
+    std::vector<std::vector<burst_capture>> burst_captures_per_sampler(this->num_samplers());
+    std::transform(samplers_.cbegin(), samplers_.cend(), burst_captures_per_sampler.begin(), [](const auto &ptr) { return ptr->burst_captures(); });
+    return burst_captures_per_sampler;
+}
+
 std::vector<std::size_t> system_hardware_sampler::num_events() const {
     std::vector<std::size_t> num_events_per_sampler(this->num_samplers());
     std::transform(samplers_.cbegin(), samplers_.cend(), num_events_per_sampler.begin(), [](const auto &ptr) { return ptr->num_events(); });
@@ -157,12 +252,73 @@ std::vector<std::vector<std::chrono::steady_clock::time_point>> system_hardware_
     return sampling_time_points_per_sampler;
 }
 
-std::vector<std::chrono::milliseconds> system_hardware_sampler::sampling_interval() const {
-    std::vector<std::chrono::milliseconds> sampling_interval_per_sampler(this->num_samplers());
+std::vector<std::vector<std::chrono::nanoseconds>> system_hardware_sampler::sampling_query_latencies() const {
+    std::vector<std::vector<std::chrono::nanoseconds>> query_latencies_per_sampler(this->num_samplers());
+    std::transform(samplers_.cbegin(), samplers_.cend(), query_latencies_per_sampler.begin(), [](const auto &ptr) { return ptr->sampling_query_latencies(); });
+    return query_latencies_per_sampler;
+}
+
+std::vector<std::chrono::nanoseconds> system_hardware_sampler::sampling_interval() const {
+    std::vector<std::chrono::nanoseconds> sampling_interval_per_sampler(this->num_samplers());
     std::transform(samplers_.cbegin(), samplers_.cend(), sampling_interval_per_sampler.begin(), [](const auto &ptr) { return ptr->sampling_interval(); });
     return sampling_interval_per_sampler;
 }
 
+std::vector<std::chrono::nanoseconds> system_hardware_sampler::sampling_interval(const sample_category category) const {
+    std::vector<std::chrono::nanoseconds> sampling_interval_per_sampler(this->num_samplers());
+    std::transform(samplers_.cbegin(), samplers_.cend(), sampling_interval_per_sampler.begin(), [category](const auto &ptr) { return ptr->sampling_interval(category); });
+    return sampling_interval_per_sampler;
+}
+
+void system_hardware_sampler::set_sampling_interval(const sample_category category, const std::chrono::nanoseconds interval) {
+    std::for_each(samplers_.begin(), samplers_.end(), [category, interval](auto &ptr) { ptr->set_sampling_interval(category, interval); });
+}
+
+void system_hardware_sampler::set_adaptive_sampling(const std::chrono::nanoseconds max_sampling_interval) {
+    std::for_each(samplers_.begin(), samplers_.end(), [max_sampling_interval](auto &ptr) { ptr->set_adaptive_sampling(max_sampling_interval); });
+}
+
+void system_hardware_sampler::set_adaptive_sampling_threshold(const sample_category category, const double threshold) {
+    std::for_each(samplers_.begin(), samplers_.end(), [category, threshold](auto &ptr) { ptr->set_adaptive_sampling_threshold(category, threshold); });
+}
+
+void system_hardware_sampler::set_sample_retention(const std::size_t num_samples) {
+    std::for_each(samplers_.begin(), samplers_.end(), [num_samples](auto &ptr) { ptr->set_sample_retention(num_samples); });
+}
+
+void system_hardware_sampler::set_sample_retention(const std::chrono::nanoseconds duration) {
+    std::for_each(samplers_.begin(), samplers_.end(), [duration](auto &ptr) { ptr->set_sample_retention(duration); });
+}
+
+void system_hardware_sampler::set_sample_compression(const bool enable) {
+    std::for_each(samplers_.begin(), samplers_.end(), [enable](auto &ptr) { ptr->set_sample_compression(enable); });
+}
+
+void system_hardware_sampler::set_streaming_statistics(const bool enable) {
+    std::for_each(samplers_.begin(), samplers_.end(), [enable](auto &ptr) { ptr->set_streaming_statistics(enable); });
+}
+
+void system_hardware_sampler::set_expected_sampling_duration(const std::chrono::nanoseconds duration) {
+    std::for_each(samplers_.begin(), samplers_.end(), [duration](auto &ptr) { ptr->set_expected_sampling_duration(duration); });
+}
+
+void system_hardware_sampler::set_shared_sampling_thread(const bool enable) {
+    if (std::any_of(samplers_.cbegin(), samplers_.cend(), [](const auto &ptr) { return ptr->has_sampling_started(); })) {
+        throw std::runtime_error{ "Can't change the sampling std::thread usage if a hardware sampler has already been started!" };
+    }
+    shared_sampling_thread_ = enable;
+}
+
+void system_hardware_sampler::set_sampling_overrun_policy(const overrun_policy policy) {
+    std::for_each(samplers_.begin(), samplers_.end(), [policy](auto &ptr) { ptr->set_sampling_overrun_policy(policy); });
+}
+
+std::vector<hws::sampling_statistics> system_hardware_sampler::sampling_statistics() const {
+    std::vector<hws::sampling_statistics> sampling_statistics_per_sampler(this->num_samplers());
+    std::transform(samplers_.cbegin(), samplers_.cend(), sampling_statistics_per_sampler.begin(), [](const auto &ptr) { return ptr->sampling_statistics(); });
+    return sampling_statistics_per_sampler;
+}
+
 std::size_t system_hardware_sampler::num_samplers() const noexcept {
     return samplers_.size();
 }
@@ -209,4 +365,102 @@ std::string system_hardware_sampler::samples_only_as_yaml_string() const {
     return std::accumulate(samplers_.cbegin(), samplers_.cend(), std::string{}, [](const std::string str, const auto &ptr) { return str + ptr->samples_only_as_yaml_string(); });
 }
 
+void system_hardware_sampler::sampling_loop() {
+    using clock_type = std::chrono::steady_clock;
+
+    // all hardware samplers use the same reference time point and, therefore, the same sampling grid
+    const clock_type::time_point reference_time_point = clock_type::now();
+    std::for_each(samplers_.begin(), samplers_.end(), [reference_time_point](auto &ptr) { ptr->initialize_sampling(reference_time_point); });
+
+    // finish the sampling of all newly stopped hardware samplers and acknowledge their stop (called with the sampling_wakeup_ mutex held)
+    // -> they aren't accessed by this std::thread anymore and their stop_sampling() may return
+    std::vector<hardware_sampler *> stopped_samplers{};
+    stopped_samplers.reserve(samplers_.size());
+    const auto acknowledge_stopped_samplers = [this, &stopped_samplers](std::unique_lock<std::mutex> &lock) {
+        stopped_samplers.clear();
+        for (auto &ptr : samplers_) {
+            if (ptr->has_sampling_stopped() && !ptr->sampling_stop_acknowledged_) {
+                stopped_samplers.push_back(ptr.get());
+            }
+        }
+        if (stopped_samplers.empty()) {
+            return;
+        }
+        // finishing the sampling may block, e.g., until a subprocess exited -> don't block the threads that want to wake up the sampling std::thread
+        lock.unlock();
+        std::for_each(stopped_samplers.begin(), stopped_samplers.end(), [](hardware_sampler *ptr) { ptr->finish_sampling(); });
+        lock.lock();
+        std::for_each(stopped_samplers.begin(), stopped_samplers.end(), [](hardware_sampler *ptr) { ptr->sampling_stop_acknowledged_ = true; });
+        sampling_wakeup_->cv.notify_all();
+    };
+
+    //
+    // loop until all hardware samplers have been stopped
+    //
+
+    std::vector<hardware_sampler *> requested_samplers{};
+    requested_samplers.reserve(samplers_.size());
+    std::vector<hardware_sampler *> paused_samplers{};
+    paused_samplers.reserve(samplers_.size());
+    while (true) {
+        std::unique_lock lock{ sampling_wakeup_->mutex };
+        acknowledge_stopped_samplers(lock);
+
+        // retrieve all requested on-demand samples using the same time point
+        requested_samplers.clear();
+        for (auto &ptr : samplers_) {
+            if (ptr->sample_requested_.exchange(false)) {
+                requested_samplers.push_back(ptr.get());
+            }
+        }
+        if (!requested_samplers.empty()) {
+            lock.unlock();
+            const clock_type::time_point now = clock_type::now();
+            std::for_each(requested_samplers.begin(), requested_samplers.end(), [now](hardware_sampler *ptr) { ptr->sampling_tick_on_demand(now); });
+            continue;
+        }
+
+        // determine the earliest deadline of all hardware samplers that are currently sampling
+        const clock_type::time_point before = clock_type::now();
+        clock_type::time_point deadline = clock_type::time_point::max();
+        for (auto &ptr : samplers_) {
+            deadline = std::min(deadline, ptr->pending_deadline(before));
+        }
+        if (std::all_of(samplers_.cbegin(), samplers_.cend(), [](const auto &ptr) { return ptr->has_sampling_stopped(); })) {
+            acknowledge_stopped_samplers(lock);
+            break;
+        }
+        // release the resources of all newly paused hardware samplers, but don't block the threads that want to wake up the sampling std::thread
+        paused_samplers.clear();
+        for (auto &ptr : samplers_) {
+            if (ptr->samples_pause_pending()) {
+                paused_samplers.push_back(ptr.get());
+            }
+        }
+        if (!paused_samplers.empty()) {
+            lock.unlock();
+            std::for_each(paused_samplers.begin(), paused_samplers.end(), [](hardware_sampler *ptr) { ptr->pause_pending_samples(); });
+            continue;
+        }
+        if (deadline == clock_type::time_point::max()) {
+            // all hardware samplers are paused -> sleep until any of them is resumed or stopped
+            sampling_wakeup_->cv.wait(lock);
+            continue;
+        }
+        // wait for the next deadline to retrieve the next samples, but wake up immediately if any hardware sampler is stopped, paused, or resumed
+        if (sampling_wakeup_->cv.wait_until(lock, deadline) == std::cv_status::no_timeout) {
+            continue;
+        }
+        lock.unlock();
+
+        // all hardware samplers whose deadline has been reached retrieve their samples using the same time point
+        const clock_type::time_point now = clock_type::now();
+        for (auto &ptr : samplers_) {
+            if (ptr->is_sampling() && ptr->next_deadline() <= now) {
+                ptr->sampling_tick(now);
+            }
+        }
+    }
+}
+
 }  // namespace hws
@@ -0,0 +1,188 @@
+/**
+ * @author Marcel Breyer
+ * @copyright 2024-today All Rights Reserved
+ * @license This file is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Tests for the energy regions using a hardware sampler with a fake energy counter.
+ */
+
+#include "hws/energy_region.hpp"
+
+#include "hws/hardware_sampler.hpp"  // hws::hardware_sampler
+#include "hws/sample_category.hpp"   // hws::sample_category
+#include "hws/scoped_region.hpp"     // hws::scoped_region
+
+#include "gtest/gtest.h"  // TEST, EXPECT_EQ, EXPECT_TRUE, EXPECT_FALSE, EXPECT_GE, EXPECT_GT, EXPECT_LE, EXPECT_DOUBLE_EQ, EXPECT_THROW, ASSERT_EQ, ASSERT_TRUE
+
+#include <atomic>     // std::atomic
+#include <chrono>     // std::chrono::milliseconds
+#include <cstddef>    // std::size_t
+#include <optional>   // std::optional
+#include <stdexcept>  // std::runtime_error
+#include <string>     // std::string
+#include <thread>     // std::this_thread::sleep_for
+#include <vector>     // std::vector
+
+namespace {
+
+/**
+ * @brief A hardware sampler without any hardware backend whose energy counter increases by 1.5 J each time it is read.
+ * @details The power draw retrieved in the n-th tick is n W, the temperature is always 42 °C.
+ */
+class region_hardware_sampler : public hws::hardware_sampler {
+  public:
+    region_hardware_sampler() :
+        hws::hardware_sampler{ std::chrono::milliseconds{ 2 }, hws::sample_category::all } { }
+
+    ~region_hardware_sampler() override {
+        if (this->has_sampling_started() && !this->has_sampling_stopped()) {
+            this->stop_sampling();
+        }
+    }
+
+    [[nodiscard]] std::string device_identification() const override { return "region_device"; }
+
+    [[nodiscard]] std::string samples_only_as_yaml_string() const override { return ""; }
+
+    /// The number of calls to sample().
+    std::atomic<std::size_t> num_samples{ 0 };
+
+  private:
+    void initialize_samples() override { }
+
+    void sample() override { ++num_samples; }
+
+    [[nodiscard]] std::optional<double> read_energy_counter() override {
+        return 1.5 * static_cast<double>(++num_energy_reads_);
+    }
+
+    [[nodiscard]] std::optional<double> latest_power_usage() const override { return static_cast<double>(num_samples); }
+
+    [[nodiscard]] std::optional<double> latest_temperature() const override { return 42.0; }
+
+    /// The number of times the energy counter has been read (regions may be begun and ended from any thread).
+    std::atomic<std::size_t> num_energy_reads_{ 0 };
+};
+
+}  // namespace
+
+TEST(EnergyRegion, MarkerOnlyMode) {
+    region_hardware_sampler sampler{};
+    sampler.set_marker_only_mode(true);
+
+    sampler.start_sampling();
+    static_cast<void>(sampler.begin_region("region"));
+    std::this_thread::sleep_for(std::chrono::milliseconds{ 20 });
+    static_cast<void>(sampler.end_region("region"));
+    sampler.stop_sampling();
+
+    // no sampling std::thread -> only the energy counters at the begin and end of the region are read
+    EXPECT_EQ(sampler.num_samples, 0);
+    EXPECT_TRUE(sampler.sampling_time_points().empty());
+    const std::vector<hws::energy_region> regions = sampler.energy_regions();
+    ASSERT_EQ(regions.size(), 1);
+    EXPECT_EQ(regions.front().name, "region");
+    EXPECT_TRUE(regions.front().finished());
+    EXPECT_GE(regions.front().duration(), std::chrono::milliseconds{ 20 });
+    ASSERT_TRUE(regions.front().energy().has_value());
+    EXPECT_DOUBLE_EQ(regions.front().energy().value(), 1.5);
+}
+
+TEST(EnergyRegion, EndRegionByName) {
+    region_hardware_sampler sampler{};
+    sampler.set_marker_only_mode(true);
+
+    // regions can only be used while the hardware sampler is running
+    EXPECT_THROW(static_cast<void>(sampler.begin_region("early")), std::runtime_error);
+
+    sampler.start_sampling();
+    static_cast<void>(sampler.begin_region("region"));
+    static_cast<void>(sampler.begin_region("other"));
+    static_cast<void>(sampler.begin_region("region"));
+    // ends the most recently begun open region with the given name
+    static_cast<void>(sampler.end_region("region"));
+    EXPECT_THROW(static_cast<void>(sampler.end_region("missing")), std::runtime_error);
+    sampler.stop_sampling();
+    EXPECT_THROW(static_cast<void>(sampler.end_region("region")), std::runtime_error);
+
+    const std::vector<hws::energy_region> regions = sampler.energy_regions();
+    ASSERT_EQ(regions.size(), 3);
+    EXPECT_FALSE(regions[0].finished());
+    EXPECT_FALSE(regions[1].finished());
+    EXPECT_TRUE(regions[2].finished());
+    // unfinished regions have no energy
+    EXPECT_FALSE(regions[0].energy().has_value());
+}
+
+TEST(EnergyRegion, NestedRegions) {
+    region_hardware_sampler sampler{};
+    sampler.set_marker_only_mode(true);
+
+    sampler.start_sampling();
+    {
+        const hws::scoped_region outer{ sampler, "region" };
+        {
+            hws::scoped_region middle{ sampler, "region" };
+            const std::size_t inner = sampler.begin_region("region");
+            // the guard ends exactly the region it has begun, not the innermost one with the same name
+            const std::vector<hws::energy_region> &ended = middle.end();
+            ASSERT_EQ(ended.size(), 1);
+            EXPECT_EQ(ended.front().depth, 1);
+            EXPECT_TRUE(middle.finished());
+            EXPECT_EQ(sampler.end_region(inner).depth, 2);
+        }
+    }
+    sampler.stop_sampling();
+
+    const std::vector<hws::energy_region> regions = sampler.energy_regions();
+    ASSERT_EQ(regions.size(), 3);
+    for (std::size_t i = 0; i < regions.size(); ++i) {
+        EXPECT_EQ(regions[i].depth, i);
+        EXPECT_TRUE(regions[i].finished());
+    }
+    // the middle region ended before the innermost one
+    EXPECT_LE(regions[1].end_time_point.value(), regions[2].end_time_point.value());
+    // the outermost region ended last
+    EXPECT_GE(regions[0].end_time_point.value(), regions[2].end_time_point.value());
+}
+
+TEST(EnergyRegion, OnlineAggregates) {
+    region_hardware_sampler sampler{};
+
+    sampler.start_sampling();
+    const std::size_t outer = sampler.begin_region("outer");
+    std::this_thread::sleep_for(std::chrono::milliseconds{ 20 });
+    const std::size_t inner = sampler.begin_region("inner");
+    std::this_thread::sleep_for(std::chrono::milliseconds{ 40 });
+    const hws::energy_region inner_region = sampler.end_region(inner);
+    std::this_thread::sleep_for(std::chrono::milliseconds{ 20 });
+    const hws::energy_region outer_region = sampler.end_region(outer);
+    sampler.stop_sampling();
+
+    // the ticks retrieved while a region is open are aggregated into all open regions
+    EXPECT_GE(inner_region.num_samples, 1);
+    EXPECT_GT(outer_region.num_samples, inner_region.num_samples);
+    for (const hws::energy_region &region : { inner_region, outer_region }) {
+        EXPECT_EQ(region.num_power_samples, region.num_samples);
+        ASSERT_TRUE(region.mean_power().has_value());
+        ASSERT_TRUE(region.max_power.has_value());
+        EXPECT_DOUBLE_EQ(region.mean_power().value(), region.total_power / static_cast<double>(region.num_power_samples));
+        EXPECT_LE(region.mean_power().value(), region.max_power.value());
+        ASSERT_TRUE(region.max_temperature.has_value());
+        EXPECT_DOUBLE_EQ(region.max_temperature.value(), 42.0);
+        // the energy counter is preferred over the power samples
+        ASSERT_TRUE(region.energy().has_value());
+    }
+    // the power draw increases with each tick -> the outer region ended later and saw a larger maximum
+    EXPECT_LE(inner_region.max_power.value(), outer_region.max_power.value());
+    // the energy counter has been read at the begin and end of both regions
+    EXPECT_DOUBLE_EQ(outer_region.energy().value(), 4.5);
+    EXPECT_DOUBLE_EQ(inner_region.energy().value(), 1.5);
+
+    // the regions returned by end_region are the same as the stored ones
+    const std::vector<hws::energy_region> regions = sampler.energy_regions();
+    ASSERT_EQ(regions.size(), 2);
+    EXPECT_EQ(regions[0].num_samples, outer_region.num_samples);
+    EXPECT_EQ(regions[1].num_samples, inner_region.num_samples);
+}
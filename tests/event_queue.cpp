@@ -0,0 +1,135 @@
+/**
+ * @author Marcel Breyer
+ * @copyright 2024-today All Rights Reserved
+ * @license This file is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Tests for recording events concurrently from multiple threads.
+ */
+
+#include "hws/event_queue.hpp"
+
+#include "hws/event.hpp"             // hws::event
+#include "hws/hardware_sampler.hpp"  // hws::hardware_sampler
+#include "hws/sample_category.hpp"   // hws::sample_category
+
+#include "gtest/gtest.h"  // TEST, EXPECT_EQ, EXPECT_GE, EXPECT_TRUE, ASSERT_EQ, ASSERT_NE
+
+#include <algorithm>  // std::is_sorted, std::find_if
+#include <chrono>     // std::chrono::{milliseconds, steady_clock}
+#include <cstddef>    // std::size_t
+#include <string>     // std::string, std::to_string, std::stoul
+#include <thread>     // std::thread, std::this_thread::sleep_for
+#include <vector>     // std::vector
+
+namespace {
+
+/**
+ * @brief A hardware sampler without any hardware backend.
+ */
+class event_hardware_sampler : public hws::hardware_sampler {
+  public:
+    event_hardware_sampler() :
+        hws::hardware_sampler{ std::chrono::milliseconds{ 5 }, hws::sample_category::all } { }
+
+    ~event_hardware_sampler() override {
+        if (this->has_sampling_started() && !this->has_sampling_stopped()) {
+            this->stop_sampling();
+        }
+    }
+
+    [[nodiscard]] std::string device_identification() const override { return "event_device"; }
+
+    [[nodiscard]] std::string samples_only_as_yaml_string() const override { return ""; }
+
+  private:
+    void initialize_samples() override { }
+
+    void sample() override { }
+};
+
+/// The number of threads recording events concurrently.
+constexpr std::size_t num_threads = 8;
+/// The number of events recorded by each thread.
+constexpr std::size_t num_events_per_thread = 2000;
+
+}  // namespace
+
+TEST(EventQueue, MultipleProducersKeepTheirOrder) {
+    hws::detail::event_queue queue{};
+
+    std::vector<std::thread> producers{};
+    for (std::size_t t = 0; t < num_threads; ++t) {
+        producers.emplace_back([&queue, t]() {
+            for (std::size_t i = 0; i < num_events_per_thread; ++i) {
+                queue.push(hws::event{ std::chrono::steady_clock::now(), std::to_string(t) + "_" + std::to_string(i) });
+            }
+        });
+    }
+    // drain concurrently to the producers
+    std::vector<hws::event> events{};
+    for (int i = 0; i < 100; ++i) {
+        queue.drain(events);
+    }
+    for (std::thread &producer : producers) {
+        producer.join();
+    }
+    queue.drain(events);
+
+    // no event is lost and the events of each producer are drained in the order they have been pushed
+    ASSERT_EQ(events.size(), num_threads * num_events_per_thread);
+    std::vector<std::size_t> next(num_threads, 0);
+    for (const hws::event &e : events) {
+        const std::size_t separator = e.name.find('_');
+        const std::size_t t = std::stoul(e.name.substr(0, separator));
+        EXPECT_EQ(std::stoul(e.name.substr(separator + 1)), next[t]++) << "producer " << t;
+    }
+
+    // the queue is empty afterward
+    std::vector<hws::event> remaining{};
+    queue.drain(remaining);
+    EXPECT_TRUE(remaining.empty());
+}
+
+TEST(EventQueue, ConcurrentAddEvent) {
+    event_hardware_sampler sampler{};
+    sampler.start_sampling();
+
+    // an event with an explicit time point lying before all events recorded by the threads
+    const std::chrono::steady_clock::time_point early = std::chrono::steady_clock::now();
+    std::this_thread::sleep_for(std::chrono::milliseconds{ 1 });
+
+    std::vector<std::thread> producers{};
+    for (std::size_t t = 0; t < num_threads; ++t) {
+        producers.emplace_back([&sampler, t]() {
+            for (std::size_t i = 0; i < num_events_per_thread; ++i) {
+                sampler.add_event("thread_" + std::to_string(t));
+            }
+        });
+    }
+    // read the events concurrently to the recording threads
+    std::size_t num_events = 0;
+    for (int i = 0; i < 20; ++i) {
+        const std::size_t num_merged_events = sampler.num_events();
+        EXPECT_GE(num_merged_events, num_events);
+        num_events = num_merged_events;
+    }
+    for (std::thread &producer : producers) {
+        producer.join();
+    }
+    sampler.add_event(early, "early");
+    sampler.stop_sampling();
+
+    // "sampling_started", all recorded events, "early", and "sampling_stopped"
+    const std::vector<hws::event> events = sampler.get_events();
+    ASSERT_EQ(events.size(), num_threads * num_events_per_thread + 3);
+    EXPECT_TRUE(std::is_sorted(events.cbegin(), events.cend(), [](const hws::event &lhs, const hws::event &rhs) { return lhs.time_point < rhs.time_point; }));
+    EXPECT_EQ(events.front().name, "sampling_started");
+    EXPECT_EQ(events.back().name, "sampling_stopped");
+
+    // the explicit time point has been merged at its chronological position, not at the end
+    const auto it = std::find_if(events.cbegin(), events.cend(), [](const hws::event &e) { return e.name == "early"; });
+    ASSERT_NE(it, events.cend());
+    EXPECT_EQ(it - events.cbegin(), 1);
+    EXPECT_EQ(sampler.get_event(1).name, "early");
+}
@@ -0,0 +1,370 @@
+/**
+ * @author Marcel Breyer
+ * @copyright 2024-today All Rights Reserved
+ * @license This file is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Tests for the hardware sampler base class using a hardware sampler without any hardware backend.
+ */
+
+#include "hws/hardware_sampler.hpp"
+
+#include "hws/burst_capture.hpp"        // hws::burst_capture
+#include "hws/sample_category.hpp"      // hws::sample_category
+#include "hws/sample_column.hpp"        // hws::sample_column
+#include "hws/sampling_statistics.hpp"  // hws::sampling_statistics
+#include "hws/tick_view.hpp"            // hws::tick_view
+
+#include "gtest/gtest.h"  // TEST, EXPECT_EQ, EXPECT_GE, EXPECT_GT, EXPECT_LE, EXPECT_TRUE, EXPECT_FALSE, EXPECT_THROW, EXPECT_DOUBLE_EQ, ASSERT_EQ, ASSERT_GE, ASSERT_NE, ASSERT_TRUE
+
+#include <algorithm>  // std::is_sorted, std::count_if
+#include <array>      // std::array
+#include <chrono>     // std::chrono::{milliseconds, steady_clock}
+#include <cstddef>    // std::size_t
+#include <optional>   // std::optional
+#include <stdexcept>  // std::invalid_argument
+#include <string>     // std::string
+#include <thread>     // std::this_thread::sleep_for
+#include <utility>    // std::pair
+#include <vector>     // std::vector
+
+namespace {
+
+/// The sample categories in the order of their bits.
+constexpr std::array<hws::sample_category, 7> categories{ hws::sample_category::general, hws::sample_category::clock, hws::sample_category::power, hws::sample_category::memory,
+                                                          hws::sample_category::temperature, hws::sample_category::gfx, hws::sample_category::idle_state };
+
+/**
+ * @brief A hardware sampler without any hardware backend recording which sample categories are due in each tick.
+ */
+class test_hardware_sampler : public hws::hardware_sampler {
+  public:
+    /// The base sampling interval used in the tests.
+    constexpr static std::chrono::milliseconds base_interval{ 5 };
+
+    test_hardware_sampler() :
+        hws::hardware_sampler{ base_interval, hws::sample_category::all } { }
+
+    ~test_hardware_sampler() override {
+        if (this->has_sampling_started() && !this->has_sampling_stopped()) {
+            this->stop_sampling();
+        }
+    }
+
+    [[nodiscard]] std::string device_identification() const override { return "test_device"; }
+
+    [[nodiscard]] std::string samples_only_as_yaml_string() const override { return ""; }
+
+    /// The time elapsed since the previous sample of each sample category as reported in each tick the sample category was due.
+    std::array<std::vector<std::chrono::steady_clock::duration>, categories.size()> elapsed{};
+    /// `true` if an unchanged sample should be tracked in each tick to drive the adaptive sampling interval to its maximum.
+    bool track_unchanged_samples{ false };
+    /// `true` if a changing sample should be tracked in each tick to keep the adaptive sampling interval at the base sampling interval.
+    bool track_changing_samples{ false };
+    /// The number of calls to sample(), used as numeric hardware sample in the burst captures.
+    std::size_t num_samples{ 0 };
+    /// The number of calls to sample() in each tick, stored like the hardware samples of a hardware backend.
+    std::optional<hws::sample_column<double>> sample_counts{};
+
+  private:
+    void initialize_samples() override {
+        sample_counts = hws::sample_column<double>{ this->column_config(), { 0.0 } };
+    }
+
+    [[nodiscard]] std::vector<std::string> numeric_sample_names() const override { return { "num_samples" }; }
+
+    void latest_numeric_sample_values(const hws::sample_category sampled, std::vector<double> &values) const override {
+        if ((sampled & hws::sample_category::general) != hws::sample_category{}) {
+            values[0] = static_cast<double>(num_samples);
+        }
+    }
+
+    void sample() override {
+        ++num_samples;
+        sample_counts->push_back(static_cast<double>(num_samples));
+        for (std::size_t idx = 0; idx < categories.size(); ++idx) {
+            if (this->sample_category_due(categories[idx])) {
+                elapsed[idx].push_back(this->time_since_previous_sample(categories[idx]));
+            }
+        }
+        if (track_unchanged_samples) {
+            this->track_sample_change(hws::sample_category::general, 1.0, 1.0);
+        }
+        if (track_changing_samples) {
+            this->track_sample_change(hws::sample_category::general, 1.0, 2.0);
+        }
+    }
+};
+
+/**
+ * @brief Check that the elapsed times reported to the sample categories match their sampling time points.
+ * @param[in] sampler the stopped hardware sampler
+ */
+void expect_consistent_sample_categories(const test_hardware_sampler &sampler) {
+    for (std::size_t idx = 0; idx < categories.size(); ++idx) {
+        const std::vector<std::chrono::steady_clock::time_point> time_points = sampler.sampling_time_points(categories[idx]);
+        // the initial tick samples all enabled sample categories without calling sample()
+        ASSERT_EQ(time_points.size(), sampler.elapsed[idx].size() + 1) << "sample category index " << idx;
+        for (std::size_t i = 1; i < time_points.size(); ++i) {
+            EXPECT_EQ(sampler.elapsed[idx][i - 1], time_points[i] - time_points[i - 1]) << "sample category index " << idx << " sample " << i;
+        }
+    }
+}
+
+}  // namespace
+
+TEST(HardwareSampler, SamplingIntervalStrides) {
+    test_hardware_sampler sampler{};
+    sampler.set_sampling_interval(hws::sample_category::clock, 2 * test_hardware_sampler::base_interval);
+    sampler.set_sampling_interval(hws::sample_category::memory, 3 * test_hardware_sampler::base_interval);
+
+    sampler.start_sampling();
+    std::this_thread::sleep_for(std::chrono::milliseconds{ 200 });
+    sampler.stop_sampling();
+
+    expect_consistent_sample_categories(sampler);
+    // the sample categories with a larger sampling interval are sampled less often
+    EXPECT_GE(sampler.sampling_time_points(hws::sample_category::general).size(), sampler.sampling_time_points(hws::sample_category::clock).size());
+    EXPECT_GE(sampler.sampling_time_points(hws::sample_category::clock).size(), sampler.sampling_time_points(hws::sample_category::memory).size());
+}
+
+TEST(HardwareSampler, AdaptiveSampling) {
+    test_hardware_sampler flat{};
+    EXPECT_FALSE(flat.uses_adaptive_sampling());
+    EXPECT_EQ(flat.max_sampling_interval(), test_hardware_sampler::base_interval);
+    // the maximum sampling interval must be a positive multiple of the base sampling interval
+    EXPECT_THROW(flat.set_adaptive_sampling(std::chrono::milliseconds{ 0 }), std::invalid_argument);
+    EXPECT_THROW(flat.set_adaptive_sampling(test_hardware_sampler::base_interval + std::chrono::milliseconds{ 1 }), std::invalid_argument);
+    // the thresholds are set per sample category
+    EXPECT_DOUBLE_EQ(flat.adaptive_sampling_threshold(hws::sample_category::general), 0.05);
+    EXPECT_THROW(static_cast<void>(flat.adaptive_sampling_threshold(hws::sample_category::general | hws::sample_category::power)), std::invalid_argument);
+    EXPECT_THROW(flat.set_adaptive_sampling_threshold(hws::sample_category::general, -0.1), std::invalid_argument);
+    flat.set_adaptive_sampling_threshold(hws::sample_category::power | hws::sample_category::memory, 0.1);
+    EXPECT_DOUBLE_EQ(flat.adaptive_sampling_threshold(hws::sample_category::power), 0.1);
+    EXPECT_DOUBLE_EQ(flat.adaptive_sampling_threshold(hws::sample_category::memory), 0.1);
+    EXPECT_DOUBLE_EQ(flat.adaptive_sampling_threshold(hws::sample_category::general), 0.05);
+
+    flat.set_adaptive_sampling(8 * test_hardware_sampler::base_interval);
+    EXPECT_TRUE(flat.uses_adaptive_sampling());
+    EXPECT_EQ(flat.max_sampling_interval(), 8 * test_hardware_sampler::base_interval);
+    flat.track_unchanged_samples = true;
+    test_hardware_sampler volatile_samples{};
+    volatile_samples.set_adaptive_sampling(8 * test_hardware_sampler::base_interval);
+    volatile_samples.track_changing_samples = true;
+
+    for (test_hardware_sampler *sampler : { &flat, &volatile_samples }) {
+        sampler->start_sampling();
+        std::this_thread::sleep_for(std::chrono::milliseconds{ 300 });
+        sampler->stop_sampling();
+    }
+
+    // unchanged samples gradually increase the sampling interval up to the maximum sampling interval
+    const std::vector<std::chrono::steady_clock::time_point> flat_ticks = flat.sampling_time_points();
+    ASSERT_GE(flat_ticks.size(), 5);
+    EXPECT_GE(flat_ticks.back() - flat_ticks[flat_ticks.size() - 2], 4 * test_hardware_sampler::base_interval);
+    // changing samples keep the base sampling interval
+    const std::vector<std::chrono::steady_clock::time_point> volatile_ticks = volatile_samples.sampling_time_points();
+    EXPECT_GE(volatile_ticks.size(), 2 * flat_ticks.size());
+}
+
+TEST(HardwareSampler, SamplingIntervalStridesWithAdaptiveSampling) {
+    test_hardware_sampler sampler{};
+    sampler.set_sampling_interval(hws::sample_category::clock, 2 * test_hardware_sampler::base_interval);
+    sampler.set_sampling_interval(hws::sample_category::memory, 3 * test_hardware_sampler::base_interval);
+    // the adaptive sampling interval isn't a multiple of the sampling intervals of the sample categories -> the ticks are shifted against their grids
+    sampler.set_adaptive_sampling(5 * test_hardware_sampler::base_interval);
+    sampler.track_unchanged_samples = true;
+
+    sampler.start_sampling();
+    std::this_thread::sleep_for(std::chrono::milliseconds{ 300 });
+    sampler.stop_sampling();
+
+    expect_consistent_sample_categories(sampler);
+    // the sample categories are still sampled in the ticks reaching their next slot, i.e., in every tick once the adaptive sampling interval is larger
+    const std::vector<std::chrono::steady_clock::time_point> ticks = sampler.sampling_time_points();
+    const std::vector<std::chrono::steady_clock::time_point> memory_ticks = sampler.sampling_time_points(hws::sample_category::memory);
+    ASSERT_GE(ticks.size(), 10);
+    EXPECT_EQ(ticks.back(), memory_ticks.back());
+    EXPECT_EQ(ticks[ticks.size() - 2], memory_ticks[memory_ticks.size() - 2]);
+}
+
+TEST(HardwareSampler, SamplingIntervalStridesWithOnDemandSamples) {
+    test_hardware_sampler sampler{};
+    sampler.set_sampling_interval(hws::sample_category::clock, 4 * test_hardware_sampler::base_interval);
+    sampler.set_sampling_interval(hws::sample_category::memory, 10 * test_hardware_sampler::base_interval);
+
+    sampler.start_sampling();
+    for (int i = 0; i < 50; ++i) {
+        sampler.sample_now();
+        std::this_thread::sleep_for(std::chrono::milliseconds{ 3 });
+    }
+    sampler.stop_sampling();
+
+    expect_consistent_sample_categories(sampler);
+}
+
+TEST(HardwareSampler, OnDemandSamplesDontConsumeSamplingIntervalStrides) {
+    test_hardware_sampler sampler{};
+    sampler.set_sampling_interval(hws::sample_category::memory, 10 * test_hardware_sampler::base_interval);
+    std::vector<std::pair<bool, hws::sample_category>> ticks{};
+    static_cast<void>(sampler.add_tick_callback([&ticks](const hws::tick_view &view) { ticks.emplace_back(view.on_demand, view.sampled_categories); }));
+
+    sampler.start_sampling();
+    // request on-demand samples far more often than the memory samples are due
+    for (int i = 0; i < 100; ++i) {
+        sampler.sample_now();
+        std::this_thread::sleep_for(std::chrono::milliseconds{ 3 });
+    }
+    sampler.stop_sampling();
+
+    expect_consistent_sample_categories(sampler);
+    std::size_t num_on_demand_ticks = 0;
+    std::size_t num_regular_memory_ticks = 0;
+    for (const auto &[on_demand, sampled_categories] : ticks) {
+        if (on_demand) {
+            // an on-demand sample retrieves all enabled sample categories
+            EXPECT_EQ(sampled_categories, hws::sample_category::all);
+            ++num_on_demand_ticks;
+        } else if (static_cast<int>(sampled_categories & hws::sample_category::memory) != 0) {
+            ++num_regular_memory_ticks;
+        }
+    }
+    EXPECT_GE(num_on_demand_ticks, 10);
+    // the regular memory samples are still retrieved on their own grid (~6 in 300ms)
+    EXPECT_GE(num_regular_memory_ticks, 3);
+}
+
+TEST(HardwareSampler, SamplingIntervalStridesWithSampleRetention) {
+    test_hardware_sampler sampler{};
+    sampler.set_sampling_interval(hws::sample_category::memory, 3 * test_hardware_sampler::base_interval);
+    sampler.set_sample_retention(4);
+
+    sampler.start_sampling();
+    std::this_thread::sleep_for(std::chrono::milliseconds{ 200 });
+    sampler.stop_sampling();
+
+    // only the time points of the last retained samples of each sample category are retained
+    const std::vector<std::chrono::steady_clock::time_point> ticks = sampler.sampling_time_points();
+    const std::vector<std::chrono::steady_clock::time_point> memory_ticks = sampler.sampling_time_points(hws::sample_category::memory);
+    ASSERT_EQ(ticks.size(), 4);
+    ASSERT_EQ(memory_ticks.size(), 4);
+    const std::vector<std::chrono::steady_clock::duration> &elapsed = sampler.elapsed[3];
+    for (std::size_t i = 1; i < memory_ticks.size(); ++i) {
+        EXPECT_EQ(elapsed[elapsed.size() - memory_ticks.size() + i], memory_ticks[i] - memory_ticks[i - 1]);
+    }
+}
+
+TEST(HardwareSampler, SampleColumnConfig) {
+    test_hardware_sampler retaining{};
+    retaining.set_sample_retention(4);
+    test_hardware_sampler summarizing{};
+    summarizing.set_streaming_statistics(true);
+
+    for (test_hardware_sampler *sampler : { &retaining, &summarizing }) {
+        sampler->start_sampling();
+        std::this_thread::sleep_for(std::chrono::milliseconds{ 50 });
+        sampler->stop_sampling();
+        ASSERT_TRUE(sampler->sample_counts.has_value());
+    }
+
+    // the sample columns created by the hardware backends use the sample retention of their hardware sampler
+    EXPECT_EQ(retaining.sample_counts->capacity(), 4);
+    EXPECT_EQ(retaining.sample_counts->size(), 4);
+    EXPECT_FALSE(retaining.sample_counts->statistics().has_value());
+    // ... and summarize all samples if the streaming statistics are enabled
+    ASSERT_TRUE(summarizing.sample_counts->statistics().has_value());
+    EXPECT_EQ(summarizing.sample_counts->statistics()->count(), summarizing.num_samples + 1);
+}
+
+TEST(HardwareSampler, SamplingStatisticsWhileSampling) {
+    test_hardware_sampler sampler{};
+
+    sampler.start_sampling();
+    // the statistics can be read while the sampling std::thread updates them
+    std::size_t num_ticks = 0;
+    for (int i = 0; i < 50; ++i) {
+        const hws::sampling_statistics statistics = sampler.sampling_statistics();
+        EXPECT_GE(statistics.num_ticks, num_ticks);
+        num_ticks = statistics.num_ticks;
+        std::this_thread::sleep_for(std::chrono::milliseconds{ 2 });
+    }
+    sampler.stop_sampling();
+
+    EXPECT_GE(sampler.sampling_statistics().num_ticks, num_ticks);
+}
+
+TEST(HardwareSampler, BurstCaptureWindows) {
+    test_hardware_sampler sampler{};
+    constexpr std::chrono::milliseconds pre_trigger{ 20 };
+    constexpr std::chrono::milliseconds post_trigger{ 30 };
+    sampler.set_burst_window(pre_trigger, post_trigger);
+    // the predicate is evaluated in the sampling std::thread after sample() -> fires exactly once
+    sampler.add_trigger("twentieth_sample", [&sampler]() { return sampler.num_samples == 20; });
+
+    sampler.start_sampling();
+    std::this_thread::sleep_for(std::chrono::milliseconds{ 300 });
+    sampler.stop_sampling();
+
+    const std::vector<hws::burst_capture> captures = sampler.burst_captures();
+    ASSERT_EQ(captures.size(), 1);
+    const hws::burst_capture &capture = captures.front();
+    EXPECT_EQ(capture.trigger, "twentieth_sample");
+
+    // the captured ticks lie within the windows around the trigger and the post-trigger window has been fully captured
+    ASSERT_GE(capture.time_points.size(), 2);
+    EXPECT_GE(capture.time_points.front(), capture.trigger_time_point - pre_trigger);
+    EXPECT_GE(capture.time_points.back(), capture.trigger_time_point + post_trigger);
+    EXPECT_TRUE(std::is_sorted(capture.time_points.cbegin(), capture.time_points.cend()));
+
+    // the captured numeric samples belong to the captured ticks
+    ASSERT_EQ(capture.samples.size(), 1);
+    const auto samples = capture.samples.find("num_samples");
+    ASSERT_NE(samples, capture.samples.cend());
+    ASSERT_EQ(samples->second.size(), capture.time_points.size());
+    for (std::size_t i = 0; i < capture.time_points.size(); ++i) {
+        if (capture.time_points[i] == capture.trigger_time_point) {
+            EXPECT_EQ(samples->second[i], 20.0);
+        }
+        if (i > 0) {
+            EXPECT_EQ(samples->second[i], samples->second[i - 1] + 1.0) << "captured tick " << i;
+        }
+    }
+
+    // the regular hardware samples aren't truncated by the burst capture
+    EXPECT_GT(sampler.sampling_time_points().size(), capture.time_points.size());
+    EXPECT_EQ(sampler.sampling_time_points().size(), sampler.num_samples + 1);
+}
+
+TEST(HardwareSampler, BurstSamplingInterval) {
+    test_hardware_sampler sampler{};
+    EXPECT_EQ(sampler.burst_sampling_interval(), test_hardware_sampler::base_interval);
+    // the burst sampling interval must evenly divide the base sampling interval
+    EXPECT_THROW(sampler.set_burst_window(std::chrono::milliseconds{ 20 }, std::chrono::milliseconds{ 30 }, std::chrono::milliseconds{ 0 }), std::invalid_argument);
+    EXPECT_THROW(sampler.set_burst_window(std::chrono::milliseconds{ 20 }, std::chrono::milliseconds{ 30 }, std::chrono::milliseconds{ 3 }), std::invalid_argument);
+
+    constexpr std::chrono::milliseconds post_trigger{ 30 };
+    constexpr std::chrono::milliseconds burst_interval{ 1 };
+    sampler.set_burst_window(std::chrono::milliseconds{ 20 }, post_trigger, burst_interval);
+    EXPECT_EQ(sampler.burst_sampling_interval(), burst_interval);
+    sampler.set_sampling_interval(hws::sample_category::memory, 2 * test_hardware_sampler::base_interval);
+    sampler.add_trigger("tenth_sample", [&sampler]() { return sampler.num_samples == 10; });
+
+    sampler.start_sampling();
+    std::this_thread::sleep_for(std::chrono::milliseconds{ 200 });
+    sampler.stop_sampling();
+
+    const std::vector<hws::burst_capture> captures = sampler.burst_captures();
+    ASSERT_EQ(captures.size(), 1);
+    const hws::burst_capture &capture = captures.front();
+    // the post-trigger window has been sampled with the burst sampling interval instead of the base sampling interval
+    const auto num_post_trigger_ticks = std::count_if(capture.time_points.cbegin(), capture.time_points.cend(), [&capture](const auto time_point) { return time_point > capture.trigger_time_point; });
+    EXPECT_GT(num_post_trigger_ticks, post_trigger / test_hardware_sampler::base_interval + 1);
+    EXPECT_GE(capture.time_points.back(), capture.trigger_time_point + post_trigger);
+
+    // the sample categories with a larger sampling interval aren't retrieved in the additional burst ticks
+    expect_consistent_sample_categories(sampler);
+    EXPECT_EQ(sampler.sampling_time_points(hws::sample_category::general).size(), sampler.sampling_time_points().size());
+    const std::vector<std::chrono::steady_clock::time_point> memory_time_points = sampler.sampling_time_points(hws::sample_category::memory);
+    const auto num_post_trigger_memory_ticks = std::count_if(memory_time_points.cbegin(), memory_time_points.cend(), [&capture](const auto time_point) { return time_point > capture.trigger_time_point && time_point <= capture.time_points.back(); });
+    EXPECT_LE(num_post_trigger_memory_ticks, post_trigger / (2 * test_hardware_sampler::base_interval) + 1);
+}
@@ -0,0 +1,119 @@
+/**
+ * @author Marcel Breyer
+ * @copyright 2024-today All Rights Reserved
+ * @license This file is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Tests for reading the memory information of `/proc/meminfo` using a fake memory information file.
+ */
+
+#include "hws/cpu/meminfo_reader.hpp"
+
+#include "gtest/gtest.h"  // TEST, EXPECT_EQ, EXPECT_TRUE, EXPECT_FALSE, EXPECT_THROW
+
+#include <filesystem>    // std::filesystem::{path, temp_directory_path, remove}
+#include <fstream>       // std::ofstream
+#include <ios>           // std::ios
+#include <stdexcept>     // std::runtime_error
+#include <string>        // std::string, std::to_string
+#include <system_error>  // std::error_code
+#include <unistd.h>      // ::getpid
+
+namespace {
+
+/**
+ * @brief A fake memory information file in the temporary directory, removed on destruction.
+ */
+class fake_meminfo {
+  public:
+    explicit fake_meminfo(const std::string &content) :
+        path_{ std::filesystem::temp_directory_path() / ("hws_test_meminfo_" + std::to_string(::getpid())) } {
+        this->write(content);
+    }
+
+    fake_meminfo(const fake_meminfo &) = delete;
+    fake_meminfo &operator=(const fake_meminfo &) = delete;
+
+    ~fake_meminfo() {
+        std::error_code ec{};
+        std::filesystem::remove(path_, ec);
+    }
+
+    /**
+     * @brief Overwrite the content of the file in-place with @p content since the reader keeps the file descriptor open.
+     * @param[in] content the new content
+     */
+    void write(const std::string &content) const {
+        std::ofstream out{ path_, std::ios::trunc };
+        out << content;
+    }
+
+    /**
+     * @brief Return the path to the fake memory information file.
+     * @return the path (`[[nodiscard]]`)
+     */
+    [[nodiscard]] const std::filesystem::path &path() const noexcept { return path_; }
+
+  private:
+    /// The path to the fake memory information file.
+    std::filesystem::path path_;
+};
+
+}  // namespace
+
+TEST(MeminfoReader, ReadFile) {
+    const fake_meminfo file{ "MemTotal:       16000000 kB\n"
+                             "MemFree:         2000000 kB\n"
+                             "MemAvailable:   10000000 kB\n"
+                             "Buffers:          500000 kB\n"
+                             "Cached:          6000000 kB\n"
+                             "SwapCached:            0 kB\n"
+                             "SwapTotal:       4000000 kB\n"
+                             "SwapFree:        3000000 kB\n"
+                             "HugePages_Total:       0\n" };
+    hws::detail::meminfo_reader reader{ file.path().string() };
+
+    hws::detail::meminfo info = reader.read();
+    // the values are converted from kB to Byte
+    EXPECT_EQ(info.mem_total, 16000000ull * 1024ull);
+    EXPECT_EQ(info.mem_free, 2000000ull * 1024ull);
+    EXPECT_TRUE(info.has_mem_available);
+    EXPECT_EQ(info.mem_used(), 6000000ull * 1024ull);
+    EXPECT_EQ(info.swap_used(), 1000000ull * 1024ull);
+    // not reported
+    EXPECT_EQ(info.dirty, 0);
+
+    // the file is reread on each call
+    file.write("MemTotal:       16000000 kB\n"
+               "MemAvailable:    8000000 kB\n");
+    info = reader.read();
+    EXPECT_EQ(info.mem_used(), 8000000ull * 1024ull);
+    EXPECT_EQ(info.mem_free, 0);
+}
+
+TEST(MeminfoReader, ParseWithoutMemAvailable) {
+    // kernels older than Linux 3.14 don't report MemAvailable
+    const hws::detail::meminfo info = hws::detail::meminfo_reader::parse("MemTotal:       16000000 kB\n"
+                                                                         "MemFree:         2000000 kB\n"
+                                                                         "Buffers:          500000 kB\n"
+                                                                         "Cached:          6000000 kB\n"
+                                                                         "SReclaimable:     500000 kB\n");
+    EXPECT_FALSE(info.has_mem_available);
+    EXPECT_EQ(info.mem_used(), 7000000ull * 1024ull);
+}
+
+TEST(MeminfoReader, ParseIgnoresUnknownKeysAndIncompleteLines) {
+    const hws::detail::meminfo info = hws::detail::meminfo_reader::parse("MemTotalX:      1 kB\n"
+                                                                         "no colon\n"
+                                                                         "Dirty:          42 kB\n"
+                                                                         "AnonPages:      invalid kB\n"
+                                                                         "MemTotal:       16000000 kB");
+    EXPECT_EQ(info.dirty, 42ull * 1024ull);
+    EXPECT_EQ(info.anon_pages, 0);
+    // the last line isn't terminated by a newline
+    EXPECT_EQ(info.mem_total, 0);
+}
+
+TEST(MeminfoReader, MissingFile) {
+    EXPECT_THROW(hws::detail::meminfo_reader{ "/nonexistent/meminfo" }, std::runtime_error);
+}
@@ -0,0 +1,41 @@
+## Authors: Marcel Breyer
+## Copyright (C): 2024-today All Rights Reserved
+## License: This file is released under the MIT license.
+##          See the LICENSE.md file in the project root for full license information.
+########################################################################################################################
+
+# tests for parsing the HWS_SAMPLING_INTERVAL, run in CMake script mode: cmake -P parse_sampling_interval.cmake
+
+include(${CMAKE_CURRENT_LIST_DIR}/../cmake/parse_sampling_interval.cmake)
+
+# check that parsing the sampling interval <interval> results in the value <expected_value> and unit <expected_unit>
+function (hws_expect_sampling_interval interval expected_value expected_unit)
+    hws_parse_sampling_interval("${interval}" PARSED)
+    if (NOT PARSED_VALID OR NOT "${PARSED_VALUE}" STREQUAL "${expected_value}" OR NOT "${PARSED_UNIT}" STREQUAL "${expected_unit}")
+        message(FATAL_ERROR "Expected the sampling interval \"${interval}\" to be parsed as ${expected_value}${expected_unit}, but got \"${PARSED_VALUE}${PARSED_UNIT}\"!")
+    endif ()
+endfunction ()
+
+# check that the sampling interval <interval> is rejected
+function (hws_expect_invalid_sampling_interval interval)
+    hws_parse_sampling_interval("${interval}" PARSED)
+    if (PARSED_VALID)
+        message(FATAL_ERROR "Expected the sampling interval \"${interval}\" to be invalid, but got ${PARSED_VALUE}${PARSED_UNIT}!")
+    endif ()
+endfunction ()
+
+# milliseconds are the default unit
+hws_expect_sampling_interval("100" 100 ms)
+hws_expect_sampling_interval("5ms" 5 ms)
+# sub-millisecond sampling intervals
+hws_expect_sampling_interval("250us" 250 us)
+hws_expect_sampling_interval("500ns" 500 ns)
+
+hws_expect_invalid_sampling_interval("")
+hws_expect_invalid_sampling_interval("0")
+hws_expect_invalid_sampling_interval("0us")
+hws_expect_invalid_sampling_interval("-1")
+hws_expect_invalid_sampling_interval("1.5ms")
+hws_expect_invalid_sampling_interval("ms")
+hws_expect_invalid_sampling_interval("10s")
+hws_expect_invalid_sampling_interval("10 ms")
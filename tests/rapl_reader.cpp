@@ -0,0 +1,291 @@
+/**
+ * @author Marcel Breyer
+ * @copyright 2024-today All Rights Reserved
+ * @license This file is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Tests for reading the RAPL energy counters of the Linux powercap interface using a fake powercap directory tree.
+ */
+
+#include "hws/cpu/rapl_reader.hpp"
+
+#include "hws/cpu/hardware_sampler.hpp"  // hws::cpu_hardware_sampler
+#include "hws/energy_region.hpp"         // hws::energy_region
+#include "hws/sample_category.hpp"       // hws::sample_category
+#include "hws/scoped_region.hpp"         // hws::scoped_region
+
+#include "gtest/gtest.h"  // TEST, EXPECT_EQ, EXPECT_TRUE, EXPECT_FALSE, EXPECT_DOUBLE_EQ, EXPECT_THROW, ASSERT_TRUE, ASSERT_EQ
+
+#include <chrono>        // std::chrono::milliseconds
+#include <cstddef>       // std::size_t
+#include <filesystem>    // std::filesystem::{path, temp_directory_path, create_directories, remove_all, remove}
+#include <fstream>       // std::ofstream
+#include <ios>           // std::ios
+#include <stdexcept>     // std::runtime_error
+#include <string>        // std::string, std::to_string
+#include <system_error>  // std::error_code
+#include <thread>        // std::thread, std::this_thread::sleep_for
+#include <unistd.h>      // ::getpid
+#include <vector>        // std::vector
+
+namespace {
+
+/**
+ * @brief A fake powercap directory tree in the temporary directory, removed on destruction.
+ */
+class fake_powercap {
+  public:
+    fake_powercap() :
+        root_{ std::filesystem::temp_directory_path() / ("hws_test_powercap_" + std::to_string(::getpid()) + "_" + std::to_string(num_instances_++)) } {
+        std::filesystem::create_directories(root_);
+    }
+
+    fake_powercap(const fake_powercap &) = delete;
+    fake_powercap &operator=(const fake_powercap &) = delete;
+
+    ~fake_powercap() {
+        std::error_code ec{};
+        std::filesystem::remove_all(root_, ec);
+    }
+
+    /**
+     * @brief Add the zone @p zone with the `name` file content @p name, the energy counter @p energy_uj, and the wraparound value @p max_energy_range_uj.
+     * @param[in] zone the directory name of the zone, e.g., "intel-rapl:0"
+     * @param[in] name the name of the zone, e.g., "package-0"
+     * @param[in] energy_uj the initial value of the energy counter in µJ
+     * @param[in] max_energy_range_uj the value after which the energy counter wraps around in µJ
+     */
+    void add_zone(const std::string &zone, const std::string &name, const unsigned long long energy_uj, const unsigned long long max_energy_range_uj = 262143328850ull) const {
+        std::filesystem::create_directories(root_ / zone);
+        write(root_ / zone / "name", name);
+        write(root_ / zone / "max_energy_range_uj", std::to_string(max_energy_range_uj));
+        this->set_energy(zone, energy_uj);
+    }
+
+    /**
+     * @brief Overwrite the energy counter of the zone @p zone with @p energy_uj.
+     * @param[in] zone the directory name of the zone
+     * @param[in] energy_uj the new value of the energy counter in µJ
+     */
+    void set_energy(const std::string &zone, const unsigned long long energy_uj) const {
+        // rewrite the file in-place: the reader keeps the file descriptor open
+        write(root_ / zone / "energy_uj", std::to_string(energy_uj));
+    }
+
+    /**
+     * @brief Remove the energy counter of the zone @p zone such that it can't be opened.
+     * @param[in] zone the directory name of the zone
+     */
+    void remove_energy(const std::string &zone) const { std::filesystem::remove(root_ / zone / "energy_uj"); }
+
+    /**
+     * @brief Return the root directory of the fake powercap interface.
+     * @return the root directory (`[[nodiscard]]`)
+     */
+    [[nodiscard]] const std::filesystem::path &root() const noexcept { return root_; }
+
+  private:
+    /**
+     * @brief Overwrite the file @p path with the @p content followed by a newline (as sysfs does).
+     * @param[in] path the path to the file
+     * @param[in] content the new content
+     */
+    static void write(const std::filesystem::path &path, const std::string &content) {
+        std::ofstream file{ path, std::ios::out | std::ios::trunc };
+        file << content << '\n';
+    }
+
+    /// The number of fake powercap trees created by this process (used to create unique directory names).
+    inline static int num_instances_{ 0 };
+    /// The root directory of the fake powercap interface.
+    std::filesystem::path root_;
+};
+
+}  // namespace
+
+TEST(RaplReader, ClassifiesZones) {
+    const fake_powercap powercap{};
+    powercap.add_zone("intel-rapl:0", "package-0", 0);
+    powercap.add_zone("intel-rapl:0:0", "core", 0);
+    powercap.add_zone("intel-rapl:0:1", "uncore", 0);
+    powercap.add_zone("intel-rapl:0:2", "dram", 0);
+    // zones not covering a single socket and the duplicated MMIO zones are ignored
+    powercap.add_zone("intel-rapl:1", "psys", 0);
+    powercap.add_zone("intel-rapl-mmio:0", "package-0", 0);
+
+    hws::detail::rapl_reader reader{ powercap.root() };
+    EXPECT_TRUE(reader.has_domain(hws::detail::rapl_domain_type::package));
+    EXPECT_TRUE(reader.has_domain(hws::detail::rapl_domain_type::core));
+    EXPECT_TRUE(reader.has_domain(hws::detail::rapl_domain_type::uncore));
+    EXPECT_TRUE(reader.has_domain(hws::detail::rapl_domain_type::dram));
+    EXPECT_EQ(reader.num_sockets(), 1);
+
+    // the psys and MMIO zones don't contribute to the energy of the package
+    powercap.set_energy("intel-rapl:0", 1000000);
+    powercap.set_energy("intel-rapl:1", 5000000);
+    powercap.set_energy("intel-rapl-mmio:0", 7000000);
+    EXPECT_DOUBLE_EQ(reader.read().package, 1.0);
+}
+
+TEST(RaplReader, SumsAcrossSockets) {
+    const fake_powercap powercap{};
+    powercap.add_zone("intel-rapl:0", "package-0", 100);
+    powercap.add_zone("intel-rapl:0:0", "dram", 200);
+    powercap.add_zone("intel-rapl:1", "package-1", 300);
+    powercap.add_zone("intel-rapl:1:0", "dram", 400);
+
+    hws::detail::rapl_reader reader{ powercap.root() };
+    EXPECT_EQ(reader.num_sockets(), 2);
+    EXPECT_FALSE(reader.has_domain(hws::detail::rapl_domain_type::core));
+
+    // the energy is accumulated since the construction of the reader
+    powercap.set_energy("intel-rapl:0", 1000100);
+    powercap.set_energy("intel-rapl:0:0", 500200);
+    powercap.set_energy("intel-rapl:1", 2000300);
+    powercap.set_energy("intel-rapl:1:0", 250400);
+    const hws::detail::rapl_energy energy = reader.read();
+    EXPECT_DOUBLE_EQ(energy.package, 3.0);
+    EXPECT_DOUBLE_EQ(energy.dram, 0.75);
+    EXPECT_DOUBLE_EQ(energy.core, 0.0);
+    EXPECT_DOUBLE_EQ(energy.uncore, 0.0);
+}
+
+TEST(RaplReader, WrapAround) {
+    const fake_powercap powercap{};
+    powercap.add_zone("intel-rapl:0", "package-0", 900000, 1000000);
+
+    hws::detail::rapl_reader reader{ powercap.root() };
+    powercap.set_energy("intel-rapl:0", 950000);
+    EXPECT_DOUBLE_EQ(reader.read().package, 0.05);
+    // the counter wrapped around at max_energy_range_uj
+    powercap.set_energy("intel-rapl:0", 100000);
+    EXPECT_DOUBLE_EQ(reader.read().package, 0.2);
+    powercap.set_energy("intel-rapl:0", 400000);
+    EXPECT_DOUBLE_EQ(reader.read().package, 0.5);
+}
+
+TEST(RaplReader, UnusableTrees) {
+    // no package zone at all
+    const fake_powercap without_package{};
+    without_package.add_zone("intel-rapl:0:0", "dram", 0);
+    EXPECT_THROW(hws::detail::rapl_reader{ without_package.root() }, std::runtime_error);
+
+    // an energy counter that can't be opened (e.g., missing root privileges)
+    const fake_powercap unreadable{};
+    unreadable.add_zone("intel-rapl:0", "package-0", 0);
+    unreadable.add_zone("intel-rapl:0:0", "core", 0);
+    unreadable.remove_energy("intel-rapl:0:0");
+    EXPECT_THROW(hws::detail::rapl_reader{ unreadable.root() }, std::runtime_error);
+
+    // a missing powercap interface
+    EXPECT_THROW(hws::detail::rapl_reader{ unreadable.root() / "missing" }, std::runtime_error);
+}
+
+#if defined(HWS_VIA_POWERCAP_ENABLED)
+TEST(RaplReader, CpuHardwareSamplerFallsBackIfZoneCantBeOpened) {
+    const fake_powercap powercap{};
+    powercap.add_zone("intel-rapl:0", "package-0", 0);
+    powercap.add_zone("intel-rapl:0:0", "dram", 0);
+    powercap.remove_energy("intel-rapl:0:0");
+
+    hws::cpu_hardware_sampler sampler{ std::chrono::milliseconds{ 10 }, hws::sample_category::power };
+    sampler.set_powercap_root(powercap.root());
+    sampler.start_sampling();
+    std::this_thread::sleep_for(std::chrono::milliseconds{ 50 });
+    sampler.stop_sampling();
+
+    // the power samples aren't read from the RAPL energy counters (but via turbostat if available)
+    EXPECT_FALSE(sampler.uses_powercap());
+}
+
+TEST(RaplReader, CpuHardwareSamplerReadsPowerUsage) {
+    const fake_powercap powercap{};
+    powercap.add_zone("intel-rapl:0", "package-0", 0);
+    powercap.add_zone("intel-rapl:1", "package-1", 0);
+
+    hws::cpu_hardware_sampler sampler{ std::chrono::milliseconds{ 10 }, hws::sample_category::power };
+    sampler.set_powercap_root(powercap.root());
+    sampler.start_sampling();
+    std::this_thread::sleep_for(std::chrono::milliseconds{ 50 });
+    sampler.stop_sampling();
+
+    EXPECT_TRUE(sampler.uses_powercap());
+    ASSERT_TRUE(sampler.power_samples().get_power_usage().has_value());
+    EXPECT_EQ(sampler.power_samples().get_power_usage()->size(), sampler.sampling_time_points(hws::sample_category::power).size());
+    // the fake energy counters never change
+    for (const double power : sampler.power_samples().get_power_usage().value()) {
+        EXPECT_DOUBLE_EQ(power, 0.0);
+    }
+}
+
+TEST(RaplReader, CpuHardwareSamplerRegionEnergy) {
+    const fake_powercap powercap{};
+    powercap.add_zone("intel-rapl:0", "package-0", 1000000);
+    powercap.add_zone("intel-rapl:0:0", "core", 0);
+    powercap.add_zone("intel-rapl:0:1", "dram", 0);
+
+    hws::cpu_hardware_sampler sampler{ std::chrono::milliseconds{ 10 }, hws::sample_category::power };
+    sampler.set_powercap_root(powercap.root());
+    sampler.set_marker_only_mode(true);
+    sampler.start_sampling();
+    static_cast<void>(sampler.begin_region("region"));
+    powercap.set_energy("intel-rapl:0", 3000000);
+    powercap.set_energy("intel-rapl:0:0", 1500000);
+    powercap.set_energy("intel-rapl:0:1", 500000);
+    const hws::energy_region region = sampler.end_region("region");
+    sampler.stop_sampling();
+
+    // the energy of the region is the energy of the package and DRAM domains (the core domain is part of the package domain)
+    ASSERT_TRUE(region.energy().has_value());
+    EXPECT_DOUBLE_EQ(region.energy().value(), 2.5);
+}
+
+TEST(RaplReader, CpuHardwareSamplerRegionsConcurrentToSampling) {
+    const fake_powercap powercap{};
+    powercap.add_zone("intel-rapl:0", "package-0", 0);
+    powercap.add_zone("intel-rapl:0:0", "dram", 0);
+
+    hws::cpu_hardware_sampler sampler{ std::chrono::milliseconds{ 1 }, hws::sample_category::power };
+    sampler.set_powercap_root(powercap.root());
+    sampler.start_sampling();
+    // the regions read the energy counters from other threads while the sampling std::thread reads them for the power samples
+    std::vector<std::thread> threads{};
+    for (std::size_t t = 0; t < 4; ++t) {
+        threads.emplace_back([&sampler, t]() {
+            for (std::size_t i = 0; i < 50; ++i) {
+                const hws::scoped_region region{ sampler, "region_" + std::to_string(t) };
+            }
+        });
+    }
+    for (std::thread &thread : threads) {
+        thread.join();
+    }
+    sampler.stop_sampling();
+
+    EXPECT_TRUE(sampler.uses_powercap());
+    const std::vector<hws::energy_region> regions = sampler.energy_regions();
+    ASSERT_EQ(regions.size(), 4 * 50);
+    // the fake energy counters never change
+    for (const hws::energy_region &region : regions) {
+        ASSERT_TRUE(region.energy().has_value());
+        EXPECT_DOUBLE_EQ(region.energy().value(), 0.0);
+    }
+}
+
+TEST(RaplReader, CpuHardwareSamplerRegionWithoutEnergyCounter) {
+    const fake_powercap powercap{};
+
+    hws::cpu_hardware_sampler sampler{ std::chrono::milliseconds{ 10 }, hws::sample_category::power };
+    sampler.set_powercap_root(powercap.root() / "missing");
+    sampler.set_marker_only_mode(true);
+    sampler.start_sampling();
+    static_cast<void>(sampler.begin_region("region"));
+    const hws::energy_region region = sampler.end_region("region");
+    sampler.stop_sampling();
+
+    // neither an energy counter nor power samples are available
+    EXPECT_TRUE(region.finished());
+    EXPECT_FALSE(region.begin_energy.has_value());
+    EXPECT_FALSE(region.energy().has_value());
+}
+#endif
@@ -0,0 +1,153 @@
+/**
+ * @author Marcel Breyer
+ * @copyright 2024-today All Rights Reserved
+ * @license This file is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Tests for the codecs compressing blocks of sampled values.
+ */
+
+#include "hws/sample_compression.hpp"
+
+#include "hws/sample_column.hpp"  // hws::sample_column
+
+#include "gtest/gtest.h"  // TEST, EXPECT_EQ, EXPECT_TRUE, EXPECT_LT, ASSERT_EQ
+
+#include <chrono>   // std::chrono::{steady_clock, nanoseconds, microseconds, seconds}
+#include <cmath>    // std::sin
+#include <cstddef>  // std::size_t
+#include <cstdint>  // std::uint8_t, std::int32_t, std::int64_t, std::uint64_t
+#include <cstring>  // std::memcmp
+#include <limits>   // std::numeric_limits
+#include <memory>   // std::unique_ptr, std::make_unique
+#include <vector>   // std::vector
+
+namespace {
+
+/**
+ * @brief Compress and decompress the @p num_values @p values and check that the decompressed values are bitwise identical to the original ones.
+ * @tparam T the type of the values
+ * @param[in] values the values to compress
+ * @param[in] num_values the number of values
+ * @return the size of the compressed values in bytes
+ */
+template <typename T>
+std::size_t expect_round_trip(const T *values, const std::size_t num_values) {
+    std::vector<std::uint8_t> buffer{};
+    hws::detail::sample_codec<T>::encode(values, num_values, buffer);
+    // the decoder may read the bits of the last partially used byte -> no padding necessary
+    const std::unique_ptr<T[]> decoded = std::make_unique<T[]>(num_values);
+    hws::detail::sample_codec<T>::decode(buffer.data(), num_values, decoded.get());
+    for (std::size_t i = 0; i < num_values; ++i) {
+        // compare the bits such that NaN and -0.0 are handled correctly
+        EXPECT_EQ(std::memcmp(&values[i], &decoded[i], sizeof(T)), 0) << "value " << i;
+    }
+    return buffer.size();
+}
+
+/**
+ * @copydoc expect_round_trip(const T *, std::size_t)
+ */
+template <typename T>
+std::size_t expect_round_trip(const std::vector<T> &values) {
+    return expect_round_trip(values.data(), values.size());
+}
+
+}  // namespace
+
+TEST(SampleCompression, ZigzagEncoding) {
+    for (const std::int64_t value : { std::int64_t{ 0 }, std::int64_t{ 1 }, std::int64_t{ -1 }, std::int64_t{ 42 }, std::numeric_limits<std::int64_t>::min(), std::numeric_limits<std::int64_t>::max() }) {
+        EXPECT_EQ(hws::detail::zigzag_decode(hws::detail::zigzag_encode(value)), value);
+    }
+    // values with a small magnitude result in small integers
+    EXPECT_EQ(hws::detail::zigzag_encode(0), 0);
+    EXPECT_EQ(hws::detail::zigzag_encode(-1), 1);
+    EXPECT_EQ(hws::detail::zigzag_encode(1), 2);
+}
+
+TEST(SampleCompression, Doubles) {
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    const double inf = std::numeric_limits<double>::infinity();
+    // the first value is XORed with zero, repeated values and sign changes of zero
+    expect_round_trip<double>({ 0.0, -0.0, 0.0, 0.0, 1.0, -1.0, nan, nan, -nan, inf, -inf, std::numeric_limits<double>::denorm_min(), std::numeric_limits<double>::max(),
+                                std::numeric_limits<double>::lowest(), std::numeric_limits<double>::epsilon(), 3.14159, 3.14159, 3.14160 });
+    expect_round_trip<double>({ nan });
+    expect_round_trip<double>({ -0.0 });
+    expect_round_trip<double>({});
+
+    // slowly changing values need less space than the uncompressed values
+    std::vector<double> values{};
+    for (int i = 0; i < 1024; ++i) {
+        values.push_back(i % 4 == 0 ? 100.0 + std::sin(i / 64.0) : values.back());
+    }
+    EXPECT_LT(expect_round_trip(values), values.size() * sizeof(double) / 4);
+}
+
+TEST(SampleCompression, Floats) {
+    const float nan = std::numeric_limits<float>::quiet_NaN();
+    expect_round_trip<float>({ 0.0f, -0.0f, nan, 1.0f, 1.0f, -1.5f, std::numeric_limits<float>::denorm_min(), std::numeric_limits<float>::max(), std::numeric_limits<float>::infinity(), 0.0f });
+    expect_round_trip<float>({ std::numeric_limits<float>::denorm_min() });
+}
+
+TEST(SampleCompression, Integers) {
+    expect_round_trip<std::int64_t>({ std::numeric_limits<std::int64_t>::max(), std::numeric_limits<std::int64_t>::min(), 0, -1, 1, 1, 1 });
+    expect_round_trip<std::uint64_t>({ std::numeric_limits<std::uint64_t>::max(), 0, std::numeric_limits<std::uint64_t>::max() });
+    expect_round_trip<std::int32_t>({ -5, std::numeric_limits<std::int32_t>::min(), std::numeric_limits<std::int32_t>::max() });
+    // std::vector<bool> doesn't store its values contiguously
+    const bool flags[] = { true, false, false, true, true };
+    expect_round_trip(flags, 5);
+    expect_round_trip(flags + 1, 1);
+
+    // an unchanged value needs a single byte
+    const std::vector<std::uint64_t> values(100, 123456789u);
+    EXPECT_EQ(expect_round_trip(values), 4 + 99);
+}
+
+TEST(SampleCompression, TimePoints) {
+    using time_point = std::chrono::steady_clock::time_point;
+    // the first value is encoded as delta to the epoch
+    expect_round_trip<time_point>({ time_point{} });
+    expect_round_trip<time_point>({ time_point{ std::chrono::seconds{ 123456 } } });
+
+    // cover all buckets: unchanged delta, small, medium, large, and arbitrary jitter, and time points going backwards
+    const time_point start{ std::chrono::seconds{ 1000000 } };
+    std::vector<time_point> values{ start };
+    for (const std::chrono::nanoseconds jitter : { std::chrono::nanoseconds{ 0 }, std::chrono::nanoseconds{ 0 }, std::chrono::nanoseconds{ 3 }, std::chrono::nanoseconds{ -8000 },
+                                                   std::chrono::nanoseconds{ 400000 }, std::chrono::nanoseconds{ -2000000000 }, std::chrono::nanoseconds{ 3000000000000 },
+                                                   std::chrono::nanoseconds{ -7 } }) {
+        values.push_back(values.back() + std::chrono::milliseconds{ 100 } + jitter);
+    }
+    values.push_back(start);
+    expect_round_trip(values);
+
+    // equidistant time points need roughly a single bit per value
+    std::vector<time_point> equidistant{};
+    for (int i = 0; i < 1024; ++i) {
+        equidistant.push_back(start + i * std::chrono::microseconds{ 500 });
+    }
+    EXPECT_LT(expect_round_trip(equidistant), 1024 / 8 + 32);
+}
+
+TEST(SampleCompression, CompressedSampleColumn) {
+    // more values than fit into a single compressed block, the last block isn't full
+    hws::sample_column<double> column{};
+    column.set_compressed(true);
+    ASSERT_TRUE(column.compressed());
+    std::vector<double> values{};
+    for (int i = 0; i < 2500; ++i) {
+        values.push_back(i % 7 == 0 ? -0.0 : 0.5 * i);
+        column.push_back(values.back());
+    }
+
+    ASSERT_EQ(column.size(), values.size());
+    const std::vector<double> decompressed = column.to_vector();
+    ASSERT_EQ(decompressed.size(), values.size());
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        EXPECT_EQ(std::memcmp(&values[i], &decompressed[i], sizeof(double)), 0) << "value " << i;
+    }
+    // random access switches between the compressed blocks
+    EXPECT_EQ(column[2499], values[2499]);
+    EXPECT_EQ(column[3], values[3]);
+    EXPECT_EQ(column[1500], values[1500]);
+    EXPECT_EQ(column.back(), values.back());
+}
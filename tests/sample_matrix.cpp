@@ -0,0 +1,183 @@
+/**
+ * @author Marcel Breyer
+ * @copyright 2024-today All Rights Reserved
+ * @license This file is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Tests for the append-only matrix storing the values of a hardware sample per logical CPU.
+ */
+
+#include "hws/sample_matrix.hpp"
+
+#include "hws/sample_category.hpp"  // hws::sample_category
+#include "hws/sample_metric.hpp"    // hws::{sample_metric, make_sample_metric_table}, hws::detail::{sample_metrics_yaml_string, append_numeric_sample_names, append_latest_numeric_sample_values}
+
+#include "gtest/gtest.h"  // TEST, EXPECT_EQ, EXPECT_TRUE, EXPECT_NE, EXPECT_DOUBLE_EQ, ASSERT_EQ
+
+#include <atomic>    // std::atomic
+#include <cmath>     // std::isnan
+#include <cstddef>   // std::size_t
+#include <optional>  // std::optional
+#include <string>    // std::string
+#include <thread>    // std::thread
+#include <vector>    // std::vector
+
+namespace {
+
+/**
+ * @brief A sample class with two per logical CPU hardware samples whose rows belong to different logical CPUs.
+ */
+class per_cpu_samples {
+  public:
+    /**
+     * @brief Return the descriptors of all hardware samples.
+     * @return the descriptors (`[[nodiscard]]`)
+     */
+    [[nodiscard]] static constexpr auto metrics() noexcept {
+        return hws::make_sample_metric_table(hws::sample_category::clock,
+                                              hws::sample_metric{ "per_cpu_frequency", &per_cpu_samples::per_cpu_frequency_, "MHz", "the frequency of each logical CPU" },
+                                              hws::sample_metric{ "per_cpu_idle", &per_cpu_samples::per_cpu_idle_, "%", "the idle time of each logical CPU" });
+    }
+
+    /// The frequencies of the logical CPUs.
+    std::optional<hws::sample_matrix<double>> per_cpu_frequency_{};
+    /// The idle times of the logical CPUs.
+    std::optional<hws::sample_matrix<double>> per_cpu_idle_{};
+};
+
+}  // namespace
+
+TEST(SampleMatrix, DefaultConstructed) {
+    const hws::sample_matrix<double> matrix{};
+    EXPECT_EQ(matrix.num_rows(), 0);
+    EXPECT_EQ(matrix.num_columns(), 0);
+    EXPECT_TRUE(matrix.empty());
+    EXPECT_TRUE(matrix.row_ids().empty());
+    EXPECT_TRUE(matrix.to_vector().empty());
+}
+
+TEST(SampleMatrix, RowIds) {
+    // without explicit IDs, the IDs are the row indices
+    const hws::sample_matrix<double> contiguous{ 3 };
+    EXPECT_EQ(contiguous.num_rows(), 3);
+    EXPECT_EQ(contiguous.row_ids(), (std::vector<std::size_t>{ 0, 1, 2 }));
+
+    // e.g., the logical CPU 1 is offline
+    const hws::sample_matrix<double> with_gaps{ std::vector<std::size_t>{ 0, 2, 3 } };
+    EXPECT_EQ(with_gaps.num_rows(), 3);
+    EXPECT_EQ(with_gaps.row_ids(), (std::vector<std::size_t>{ 0, 2, 3 }));
+    EXPECT_TRUE(with_gaps.empty());
+}
+
+TEST(SampleMatrix, ColumnMajorAccess) {
+    hws::sample_matrix<int> matrix{ 2 };
+    for (int column = 0; column < 3; ++column) {
+        matrix.push_back(column);
+        matrix.push_back(10 + column);
+    }
+    ASSERT_EQ(matrix.num_columns(), 3);
+    EXPECT_EQ(matrix(0, 2), 2);
+    EXPECT_EQ(matrix(1, 0), 10);
+    EXPECT_EQ(matrix.row(1), (std::vector<int>{ 10, 11, 12 }));
+    EXPECT_EQ(matrix.column(1), (std::vector<int>{ 1, 11 }));
+    EXPECT_EQ(matrix.to_vector(), (std::vector<std::vector<int>>{ { 0, 1, 2 }, { 10, 11, 12 } }));
+    // the values of all time points are stored contiguously
+    EXPECT_EQ(matrix.values().size(), 6);
+
+    // an incomplete time point isn't published
+    matrix.push_back(3);
+    EXPECT_EQ(matrix.num_columns(), 3);
+    EXPECT_EQ(matrix.row(0), (std::vector<int>{ 0, 1, 2 }));
+    matrix.push_back(13);
+    EXPECT_EQ(matrix.num_columns(), 4);
+
+    matrix.clear();
+    EXPECT_TRUE(matrix.empty());
+    EXPECT_EQ(matrix.num_rows(), 2);
+}
+
+TEST(SampleMatrix, ConcurrentReaderSeesCompleteColumns) {
+    constexpr std::size_t num_rows = 8;
+    constexpr std::size_t num_columns = 20000;
+    hws::sample_matrix<std::size_t> matrix{ num_rows };
+
+    std::atomic<bool> done{ false };
+    std::thread writer{ [&]() {
+        for (std::size_t column = 0; column < num_columns; ++column) {
+            for (std::size_t row = 0; row < num_rows; ++row) {
+                matrix.push_back(column);
+            }
+        }
+        done = true;
+    } };
+
+    // all rows of a published time point must have been written
+    std::size_t num_incomplete = 0;
+    while (!done) {
+        const std::size_t published = matrix.num_columns();
+        if (published > 0) {
+            for (const std::size_t value : matrix.column(published - 1)) {
+                num_incomplete += value == published - 1 ? 0 : 1;
+            }
+        }
+    }
+    writer.join();
+
+    EXPECT_EQ(num_incomplete, 0);
+    EXPECT_EQ(matrix.num_columns(), num_columns);
+}
+
+TEST(SampleMatrix, YamlOutputContainsRowIds) {
+    per_cpu_samples samples{};
+    samples.per_cpu_frequency_.emplace(std::vector<std::size_t>{ 0, 2, 3 });
+    samples.per_cpu_idle_.emplace(std::vector<std::size_t>{ 1 });
+    for (const double value : { 1000.0, 1200.0, 1400.0 }) {
+        samples.per_cpu_frequency_->push_back(value);
+    }
+    samples.per_cpu_idle_->push_back(50.0);
+
+    const std::string yaml = hws::detail::sample_metrics_yaml_string(samples, "clock");
+    EXPECT_NE(yaml.find("  per_cpu_frequency:\n"
+                        "    unit: \"MHz\"\n"
+                        "    row_ids: [0, 2, 3]\n"
+                        "    values: [[1000], [1200], [1400]]\n"),
+              std::string::npos)
+        << yaml;
+    EXPECT_NE(yaml.find("  per_cpu_idle:\n"
+                        "    unit: \"percentage\"\n"
+                        "    row_ids: [1]\n"
+                        "    values: [[50]]\n"),
+              std::string::npos)
+        << yaml;
+}
+
+TEST(SampleMatrix, NumericSampleNamesUseRowIds) {
+    per_cpu_samples samples{};
+    samples.per_cpu_frequency_.emplace(std::vector<std::size_t>{ 0, 2, 3 });
+    samples.per_cpu_idle_.emplace(std::vector<std::size_t>{ 1 });
+
+    std::vector<std::string> names{};
+    hws::detail::append_numeric_sample_names(samples, names);
+    EXPECT_EQ(names, (std::vector<std::string>{ "per_cpu_frequency_0", "per_cpu_frequency_2", "per_cpu_frequency_3", "per_cpu_idle_1" }));
+
+    // the latest values are written in the same order
+    for (const double value : { 1000.0, 1200.0, 1400.0, 1100.0, 1300.0, 1500.0 }) {
+        samples.per_cpu_frequency_->push_back(value);
+    }
+    samples.per_cpu_idle_->push_back(50.0);
+    std::vector<double> values(names.size());
+    std::size_t pos = 0;
+    hws::detail::append_latest_numeric_sample_values(samples, hws::sample_category::clock, values, pos);
+    EXPECT_EQ(pos, names.size());
+    EXPECT_DOUBLE_EQ(values[0], 1100.0);
+    EXPECT_DOUBLE_EQ(values[1], 1300.0);
+    EXPECT_DOUBLE_EQ(values[2], 1500.0);
+    EXPECT_DOUBLE_EQ(values[3], 50.0);
+
+    // not sampled in the current tick
+    pos = 0;
+    hws::detail::append_latest_numeric_sample_values(samples, hws::sample_category::power, values, pos);
+    for (const double value : values) {
+        EXPECT_TRUE(std::isnan(value));
+    }
+}
@@ -0,0 +1,152 @@
+/**
+ * @author Marcel Breyer
+ * @copyright 2024-today All Rights Reserved
+ * @license This file is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Tests for selecting the queried hardware samples using a hardware sampler without any hardware backend.
+ */
+
+#include "hws/hardware_sampler.hpp"  // hws::hardware_sampler
+#include "hws/sample_category.hpp"   // hws::sample_category
+#include "hws/sample_column.hpp"     // hws::sample_column
+#include "hws/sample_metric.hpp"     // hws::{sample_metric, make_sample_metric_table}
+
+#include "gtest/gtest.h"  // TEST, EXPECT_EQ, EXPECT_TRUE, EXPECT_FALSE, EXPECT_THROW
+
+#include <chrono>     // std::chrono::milliseconds
+#include <optional>   // std::optional
+#include <stdexcept>  // std::runtime_error
+#include <string>     // std::string
+#include <thread>     // std::this_thread::sleep_for
+#include <vector>     // std::vector
+
+namespace {
+
+/**
+ * @brief A sample class with a hardware sample that is only retrieved once, two independent hardware samples, and one derived hardware sample.
+ */
+class selection_samples {
+  public:
+    /**
+     * @brief Return the descriptors of all hardware samples.
+     * @return the descriptors (`[[nodiscard]]`)
+     */
+    [[nodiscard]] static constexpr auto metrics() noexcept {
+        return hws::make_sample_metric_table(hws::sample_category::power,
+                                              hws::sample_metric{ "name", &selection_samples::name_, "string", "the name of the device" },
+                                              hws::sample_metric{ "frequency", &selection_samples::frequency_, "MHz", "the current frequency" },
+                                              hws::sample_metric{ "power_usage", &selection_samples::power_usage_, "W", "the current power draw" },
+                                              hws::sample_metric{ "energy", &selection_samples::energy_, "J", "the consumed energy" }.derived_from("power_usage"));
+    }
+
+    /// The name of the device.
+    std::optional<std::string> name_{};
+    /// The current frequency.
+    std::optional<hws::sample_column<double>> frequency_{};
+    /// The current power draw.
+    std::optional<hws::sample_column<double>> power_usage_{};
+    /// The consumed energy calculated from the power draw.
+    std::optional<hws::sample_column<double>> energy_{};
+};
+
+/**
+ * @brief A hardware sampler without any hardware backend applying the selected hardware samples to a selection_samples object.
+ */
+class selecting_hardware_sampler : public hws::hardware_sampler {
+  public:
+    selecting_hardware_sampler() :
+        hws::hardware_sampler{ std::chrono::milliseconds{ 5 }, hws::sample_category::all } { }
+
+    ~selecting_hardware_sampler() override {
+        if (this->has_sampling_started() && !this->has_sampling_stopped()) {
+            this->stop_sampling();
+        }
+    }
+
+    [[nodiscard]] std::string device_identification() const override { return "selecting_device"; }
+
+    [[nodiscard]] std::string samples_only_as_yaml_string() const override { return ""; }
+
+    /**
+     * @brief Start and stop the sampling such that the samples have been initialized.
+     */
+    void run() {
+        this->start_sampling();
+        std::this_thread::sleep_for(std::chrono::milliseconds{ 10 });
+        this->stop_sampling();
+    }
+
+    /// The hardware samples.
+    selection_samples samples{};
+    /// The value returned by apply_sample_metric_selection.
+    bool any_sample{ false };
+
+  private:
+    void initialize_samples() override {
+        samples.name_ = "selecting_device";
+        samples.frequency_ = hws::sample_column<double>{ this->column_config(), { 1000.0 } };
+        samples.power_usage_ = hws::sample_column<double>{ this->column_config(), { 100.0 } };
+        samples.energy_ = hws::sample_column<double>{ this->column_config(), { 0.0 } };
+        any_sample = this->apply_sample_metric_selection(samples);
+    }
+
+    void sample() override { }
+};
+
+}  // namespace
+
+TEST(SampleMetricSelection, AllSelectedByDefault) {
+    selecting_hardware_sampler sampler{};
+    EXPECT_FALSE(sampler.uses_sample_metric_selection());
+    EXPECT_TRUE(sampler.sample_metric_selected("frequency"));
+
+    sampler.run();
+    EXPECT_TRUE(sampler.any_sample);
+    EXPECT_TRUE(sampler.samples.frequency_.has_value());
+    EXPECT_TRUE(sampler.samples.power_usage_.has_value());
+    EXPECT_TRUE(sampler.samples.energy_.has_value());
+}
+
+TEST(SampleMetricSelection, DropUnselectedSamples) {
+    selecting_hardware_sampler sampler{};
+    sampler.set_sample_metrics({ "unknown", "frequency", "frequency" });
+    EXPECT_TRUE(sampler.uses_sample_metric_selection());
+    // the names are sorted and unique
+    EXPECT_EQ(sampler.sample_metrics(), (std::vector<std::string>{ "frequency", "unknown" }));
+    EXPECT_TRUE(sampler.sample_metric_selected("frequency"));
+    EXPECT_FALSE(sampler.sample_metric_selected("power_usage"));
+
+    sampler.run();
+    EXPECT_TRUE(sampler.any_sample);
+    EXPECT_TRUE(sampler.samples.frequency_.has_value());
+    EXPECT_FALSE(sampler.samples.power_usage_.has_value());
+    EXPECT_FALSE(sampler.samples.energy_.has_value());
+    // the hardware samples that are only retrieved once are always kept
+    EXPECT_TRUE(sampler.samples.name_.has_value());
+
+    // the selection can't be changed anymore
+    EXPECT_THROW(sampler.set_sample_metrics({ "power_usage" }), std::runtime_error);
+}
+
+TEST(SampleMetricSelection, DerivedSampleKeepsItsSource) {
+    selecting_hardware_sampler sampler{};
+    sampler.set_sample_metrics({ "energy" });
+
+    sampler.run();
+    EXPECT_TRUE(sampler.any_sample);
+    EXPECT_FALSE(sampler.samples.frequency_.has_value());
+    EXPECT_TRUE(sampler.samples.power_usage_.has_value());
+    EXPECT_TRUE(sampler.samples.energy_.has_value());
+}
+
+TEST(SampleMetricSelection, NoSampleSelected) {
+    selecting_hardware_sampler sampler{};
+    sampler.set_sample_metrics({ "unknown" });
+
+    sampler.run();
+    // the sample category can be disabled
+    EXPECT_FALSE(sampler.any_sample);
+    EXPECT_FALSE(sampler.samples.frequency_.has_value());
+    EXPECT_TRUE(sampler.samples.name_.has_value());
+}
@@ -0,0 +1,250 @@
+/**
+ * @author Marcel Breyer
+ * @copyright 2024-today All Rights Reserved
+ * @license This file is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Tests for the timing of the sampling loop using a hardware sampler whose queries take a configurable amount of time.
+ */
+
+#include "hws/event.hpp"                // hws::event
+#include "hws/hardware_sampler.hpp"     // hws::hardware_sampler
+#include "hws/overrun_policy.hpp"       // hws::overrun_policy
+#include "hws/sample_category.hpp"      // hws::sample_category
+#include "hws/sampling_statistics.hpp"  // hws::sampling_statistics
+
+#include "gtest/gtest.h"  // TEST, EXPECT_EQ, EXPECT_GE, EXPECT_LE, EXPECT_LT, EXPECT_TRUE, ASSERT_EQ, ASSERT_GE
+
+#include <algorithm>  // std::is_sorted
+#include <atomic>     // std::atomic
+#include <chrono>     // std::chrono::{nanoseconds, microseconds, milliseconds, seconds, steady_clock, duration_cast}
+#include <cstddef>    // std::size_t
+#include <string>     // std::string
+#include <thread>     // std::this_thread::sleep_for
+#include <vector>     // std::vector
+
+namespace {
+
+/**
+ * @brief A hardware sampler without any hardware backend whose queries sleep for a configurable amount of time.
+ */
+class sleeping_hardware_sampler : public hws::hardware_sampler {
+  public:
+    explicit sleeping_hardware_sampler(const std::chrono::nanoseconds sampling_interval) :
+        hws::hardware_sampler{ sampling_interval, hws::sample_category::all } { }
+
+    ~sleeping_hardware_sampler() override {
+        if (this->has_sampling_started() && !this->has_sampling_stopped()) {
+            this->stop_sampling();
+        }
+    }
+
+    [[nodiscard]] std::string device_identification() const override { return "sleeping_device"; }
+
+    [[nodiscard]] std::string samples_only_as_yaml_string() const override { return ""; }
+
+    /// The time each query takes.
+    std::chrono::nanoseconds query_duration{ 0 };
+    /// The number of the query (starting at one) that takes `overrun_duration` instead of `query_duration`.
+    std::size_t overrun_query{ 0 };
+    /// The time the overrunning query takes.
+    std::chrono::nanoseconds overrun_duration{ 0 };
+    /// The number of calls to sample().
+    std::atomic<std::size_t> num_samples{ 0 };
+
+  private:
+    void initialize_samples() override { }
+
+    void sample() override {
+        if (++num_samples == overrun_query) {
+            std::this_thread::sleep_for(overrun_duration);
+        } else if (query_duration > std::chrono::nanoseconds{ 0 }) {
+            std::this_thread::sleep_for(query_duration);
+        }
+    }
+};
+
+/**
+ * @brief Return the distances between all consecutive time points in @p time_points.
+ * @param[in] time_points the sorted time points
+ * @return the distances (`[[nodiscard]]`)
+ */
+[[nodiscard]] std::vector<std::chrono::steady_clock::duration> spacings(const std::vector<std::chrono::steady_clock::time_point> &time_points) {
+    std::vector<std::chrono::steady_clock::duration> result{};
+    for (std::size_t i = 1; i < time_points.size(); ++i) {
+        result.push_back(time_points[i] - time_points[i - 1]);
+    }
+    return result;
+}
+
+/**
+ * @brief Run @p sampler with a sampling interval of 10ms where the third query takes 35ms, i.e., the deadlines of three further ticks are missed.
+ * @param[in,out] sampler the hardware sampler
+ * @param[in] policy the overrun policy used
+ */
+void run_with_overrun(sleeping_hardware_sampler &sampler, const hws::overrun_policy policy) {
+    sampler.set_sampling_overrun_policy(policy);
+    sampler.overrun_query = 3;
+    sampler.overrun_duration = std::chrono::milliseconds{ 35 };
+
+    sampler.start_sampling();
+    std::this_thread::sleep_for(std::chrono::milliseconds{ 150 });
+    sampler.stop_sampling();
+}
+
+}  // namespace
+
+TEST(SamplingLoop, DeadlinesDontDrift) {
+    constexpr std::chrono::milliseconds interval{ 10 };
+    sleeping_hardware_sampler sampler{ interval };
+    // the queries take a large fraction of the sampling interval -> sleeping a fixed interval after each query would drift
+    sampler.query_duration = std::chrono::milliseconds{ 4 };
+
+    sampler.start_sampling();
+    std::this_thread::sleep_for(std::chrono::milliseconds{ 300 });
+    sampler.stop_sampling();
+
+    const std::vector<std::chrono::steady_clock::time_point> time_points = sampler.sampling_time_points();
+    ASSERT_GE(time_points.size(), 10);
+    // the ticks lie on the grid given by the first time point (up to the scheduling jitter)
+    std::size_t num_on_grid = 0;
+    for (const std::chrono::steady_clock::time_point time_point : time_points) {
+        const std::chrono::nanoseconds offset = std::chrono::duration_cast<std::chrono::nanoseconds>(time_point - time_points.front()) % interval;
+        num_on_grid += offset < interval / 4 ? 1 : 0;
+    }
+    EXPECT_GE(num_on_grid * 5, time_points.size() * 4);
+
+    const hws::sampling_statistics statistics = sampler.sampling_statistics();
+    EXPECT_EQ(statistics.num_ticks + 1, time_points.size());
+    // a tick is never sampled before its deadline
+    EXPECT_GE(statistics.min_jitter, std::chrono::nanoseconds{ 0 });
+    EXPECT_LE(statistics.min_jitter, statistics.max_jitter);
+}
+
+TEST(SamplingLoop, OverrunPolicySkip) {
+    sleeping_hardware_sampler sampler{ std::chrono::milliseconds{ 10 } };
+    run_with_overrun(sampler, hws::overrun_policy::skip);
+
+    // the missed deadlines are dropped -> no ticks are sampled back-to-back
+    EXPECT_GE(sampler.sampling_statistics().num_missed_ticks, 3);
+    for (const std::chrono::steady_clock::duration spacing : spacings(sampler.sampling_time_points())) {
+        EXPECT_GE(spacing, std::chrono::microseconds{ 2500 });
+    }
+}
+
+TEST(SamplingLoop, OverrunPolicyCatchUp) {
+    sleeping_hardware_sampler sampler{ std::chrono::milliseconds{ 10 } };
+    run_with_overrun(sampler, hws::overrun_policy::catch_up);
+
+    // the missed deadlines are sampled back-to-back directly after the overrunning query
+    std::size_t num_back_to_back = 0;
+    for (const std::chrono::steady_clock::duration spacing : spacings(sampler.sampling_time_points())) {
+        num_back_to_back += spacing < std::chrono::microseconds{ 2500 } ? 1 : 0;
+    }
+    EXPECT_GE(num_back_to_back, 2);
+}
+
+TEST(SamplingLoop, SubMillisecondSamplingInterval) {
+    EXPECT_EQ(hws::sample_category::high_frequency, hws::sample_category::clock | hws::sample_category::power);
+
+    constexpr std::chrono::microseconds interval{ 250 };
+    sleeping_hardware_sampler sampler{ interval };
+    EXPECT_EQ(sampler.sampling_interval(), interval);
+
+    sampler.start_sampling();
+    std::this_thread::sleep_for(std::chrono::milliseconds{ 50 });
+    sampler.stop_sampling();
+
+    // the sampling interval isn't rounded to milliseconds
+    const std::vector<std::chrono::steady_clock::time_point> time_points = sampler.sampling_time_points();
+    ASSERT_GE(time_points.size(), 20);
+    EXPECT_GE((time_points.back() - time_points.front()) / (time_points.size() - 1), interval);
+}
+
+TEST(SamplingLoop, StopDoesntWaitForTheSamplingInterval) {
+    sleeping_hardware_sampler sampler{ std::chrono::seconds{ 1 } };
+
+    sampler.start_sampling();
+    std::this_thread::sleep_for(std::chrono::milliseconds{ 20 });
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    sampler.stop_sampling();
+
+    // the sampling std::thread is woken up instead of sleeping until the next deadline
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::milliseconds{ 500 });
+}
+
+TEST(SamplingLoop, PauseAndResume) {
+    sleeping_hardware_sampler sampler{ std::chrono::milliseconds{ 5 } };
+
+    sampler.start_sampling();
+    std::this_thread::sleep_for(std::chrono::milliseconds{ 20 });
+    sampler.pause_sampling();
+    // a query running while pausing finishes
+    std::this_thread::sleep_for(std::chrono::milliseconds{ 10 });
+    const std::size_t num_samples_paused = sampler.num_samples;
+    std::this_thread::sleep_for(std::chrono::milliseconds{ 50 });
+    EXPECT_EQ(sampler.num_samples, num_samples_paused);
+
+    sampler.resume_sampling();
+    std::this_thread::sleep_for(std::chrono::milliseconds{ 50 });
+    sampler.stop_sampling();
+    EXPECT_GE(sampler.num_samples, num_samples_paused + 3);
+}
+
+TEST(SamplingLoop, SampleNowIsPlacedInTheTimePoints) {
+    sleeping_hardware_sampler sampler{ std::chrono::seconds{ 1 } };
+
+    sampler.start_sampling();
+    std::this_thread::sleep_for(std::chrono::milliseconds{ 20 });
+    sampler.add_event("on_demand", true);
+    std::this_thread::sleep_for(std::chrono::milliseconds{ 20 });
+    sampler.stop_sampling();
+
+    // the initial time point and the on-demand one, no regular tick has been due
+    const std::vector<std::chrono::steady_clock::time_point> time_points = sampler.sampling_time_points();
+    ASSERT_EQ(time_points.size(), 2);
+    EXPECT_TRUE(std::is_sorted(time_points.cbegin(), time_points.cend()));
+    EXPECT_EQ(sampler.sampling_statistics().num_on_demand_ticks, 1);
+
+    // the on-demand sample is retrieved directly after the event
+    const hws::event e = sampler.get_event(1);
+    EXPECT_EQ(e.name, "on_demand");
+    EXPECT_GE(time_points.back(), e.time_point);
+    EXPECT_LT(time_points.back() - e.time_point, std::chrono::milliseconds{ 20 });
+}
+
+TEST(SamplingLoop, QueryBeginAndEndTimePoints) {
+    constexpr std::chrono::milliseconds query_duration{ 2 };
+    sleeping_hardware_sampler sampler{ std::chrono::milliseconds{ 5 } };
+    sampler.query_duration = query_duration;
+    sampler.set_sampling_interval(hws::sample_category::memory, std::chrono::milliseconds{ 10 });
+
+    sampler.start_sampling();
+    std::this_thread::sleep_for(std::chrono::milliseconds{ 100 });
+    sampler.stop_sampling();
+
+    const std::vector<std::chrono::steady_clock::time_point> time_points = sampler.sampling_time_points();
+    const std::vector<std::chrono::steady_clock::time_point> begin = sampler.sampling_query_begin_time_points();
+    const std::vector<std::chrono::steady_clock::time_point> end = sampler.sampling_query_end_time_points();
+    const std::vector<std::chrono::nanoseconds> latencies = sampler.sampling_query_latencies();
+    ASSERT_GE(time_points.size(), 5);
+    ASSERT_EQ(begin.size(), time_points.size());
+    ASSERT_EQ(end.size(), time_points.size());
+    ASSERT_EQ(latencies.size(), time_points.size());
+    // the initial samples are retrieved without calling sample()
+    for (std::size_t i = 0; i < time_points.size(); ++i) {
+        EXPECT_LE(time_points[i], begin[i]) << "tick " << i;
+        EXPECT_LE(begin[i], end[i]) << "tick " << i;
+        EXPECT_EQ(latencies[i], end[i] - begin[i]) << "tick " << i;
+        if (i > 0) {
+            EXPECT_GE(latencies[i], query_duration) << "tick " << i;
+        }
+    }
+
+    // the query time points of a sample category belong to its sampling time points
+    const std::size_t num_memory_ticks = sampler.sampling_time_points(hws::sample_category::memory).size();
+    EXPECT_LT(num_memory_ticks, time_points.size());
+    EXPECT_EQ(sampler.sampling_query_begin_time_points(hws::sample_category::memory).size(), num_memory_ticks);
+    EXPECT_EQ(sampler.sampling_query_end_time_points(hws::sample_category::memory).size(), num_memory_ticks);
+    EXPECT_EQ(sampler.sampling_query_latencies(hws::sample_category::memory).size(), num_memory_ticks);
+}
@@ -0,0 +1,231 @@
+/**
+ * @author Marcel Breyer
+ * @copyright 2024-today All Rights Reserved
+ * @license This file is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Tests for the mergeable streaming summaries.
+ */
+
+#include "hws/streaming_statistics.hpp"
+
+#include "gtest/gtest.h"  // TEST, EXPECT_EQ, EXPECT_NEAR, EXPECT_TRUE, EXPECT_THROW, ASSERT_EQ
+
+#include <algorithm>  // std::sort
+#include <cmath>      // std::isnan, std::abs, std::pow
+#include <cstddef>    // std::size_t, std::ptrdiff_t
+#include <limits>     // std::numeric_limits
+#include <stdexcept>  // std::invalid_argument
+#include <vector>     // std::vector
+
+namespace {
+
+/**
+ * @brief Return values spanning multiple orders of magnitude, including negative values and zeros.
+ * @param[in] num_values the number of values
+ * @param[in] seed the seed of the pseudo random values
+ * @return the values
+ */
+std::vector<double> test_values(const std::size_t num_values, unsigned seed) {
+    std::vector<double> values{};
+    for (std::size_t i = 0; i < num_values; ++i) {
+        // a simple linear congruential generator to be independent of the standard library implementation
+        seed = seed * 1103515245u + 12345u;
+        const double magnitude = std::pow(10.0, static_cast<double>(seed % 7000u) / 1000.0 - 2.0);
+        values.push_back(i % 10 == 0 ? 0.0 : (i % 3 == 0 ? -magnitude : magnitude));
+    }
+    return values;
+}
+
+/**
+ * @brief Return the exact @p q quantile of the sorted @p values using the same rank definition as the streaming_statistics.
+ * @param[in] values the sorted values
+ * @param[in] q the quantile
+ * @return the quantile
+ */
+double exact_quantile(const std::vector<double> &values, const double q) {
+    return values[static_cast<std::size_t>(q * static_cast<double>(values.size() - 1))];
+}
+
+}  // namespace
+
+TEST(StreamingStatistics, Empty) {
+    const hws::streaming_statistics stats{};
+    EXPECT_EQ(stats.count(), 0);
+    EXPECT_TRUE(std::isnan(stats.min()));
+    EXPECT_TRUE(std::isnan(stats.max()));
+    EXPECT_TRUE(std::isnan(stats.mean()));
+    EXPECT_TRUE(std::isnan(stats.variance()));
+    EXPECT_TRUE(std::isnan(stats.quantile(0.5)));
+    EXPECT_THROW(static_cast<void>(stats.quantile(1.5)), std::invalid_argument);
+    EXPECT_THROW(static_cast<void>(stats.quantile(std::numeric_limits<double>::quiet_NaN())), std::invalid_argument);
+    EXPECT_THROW(hws::streaming_statistics{ 0.0 }, std::invalid_argument);
+    EXPECT_THROW(hws::streaming_statistics{ std::numeric_limits<double>::quiet_NaN() }, std::invalid_argument);
+}
+
+TEST(StreamingStatistics, MomentsAndQuantiles) {
+    hws::streaming_statistics stats{};
+    std::vector<double> values = test_values(10000, 42);
+    for (const double value : values) {
+        stats.add(value);
+    }
+    // non-finite values are ignored
+    stats.add(std::numeric_limits<double>::quiet_NaN());
+    stats.add(std::numeric_limits<double>::infinity());
+
+    double mean = 0.0;
+    for (const double value : values) {
+        mean += value / static_cast<double>(values.size());
+    }
+    double variance = 0.0;
+    for (const double value : values) {
+        variance += (value - mean) * (value - mean) / static_cast<double>(values.size());
+    }
+    std::sort(values.begin(), values.end());
+
+    ASSERT_EQ(stats.count(), values.size());
+    EXPECT_EQ(stats.min(), values.front());
+    EXPECT_EQ(stats.max(), values.back());
+    EXPECT_NEAR(stats.mean(), mean, 1e-9 * std::abs(values.front()));
+    EXPECT_NEAR(stats.variance(), variance, 1e-9 * variance);
+    // the quantiles are accurate up to the relative accuracy
+    for (const double q : { 0.01, 0.1, 0.25, 0.5, 0.75, 0.9, 0.95, 0.99 }) {
+        const double expected = exact_quantile(values, q);
+        EXPECT_NEAR(stats.quantile(q), expected, stats.relative_accuracy() * std::abs(expected) + 1e-12) << "quantile " << q;
+    }
+}
+
+TEST(StreamingStatistics, MergeEqualsSequentialAdd) {
+    const std::vector<double> first = test_values(5000, 1);
+    const std::vector<double> second = test_values(3000, 2);
+
+    hws::streaming_statistics sequential{};
+    hws::streaming_statistics lhs{};
+    hws::streaming_statistics rhs{};
+    for (const double value : first) {
+        sequential.add(value);
+        lhs.add(value);
+    }
+    for (const double value : second) {
+        sequential.add(value);
+        rhs.add(value);
+    }
+    hws::streaming_statistics merged = lhs;
+    merged.merge(rhs);
+
+    EXPECT_EQ(merged.count(), sequential.count());
+    EXPECT_EQ(merged.min(), sequential.min());
+    EXPECT_EQ(merged.max(), sequential.max());
+    EXPECT_NEAR(merged.mean(), sequential.mean(), 1e-9 * std::abs(sequential.max()));
+    EXPECT_NEAR(merged.variance(), sequential.variance(), 1e-9 * sequential.variance());
+    // the sketches are merged exactly
+    for (const double q : { 0.0, 0.01, 0.1, 0.5, 0.9, 0.99, 1.0 }) {
+        EXPECT_EQ(merged.quantile(q), sequential.quantile(q)) << "quantile " << q;
+    }
+
+    // merging with an empty summary is a no-op in both directions
+    hws::streaming_statistics empty{};
+    empty.merge(lhs);
+    EXPECT_EQ(empty.serialize(), lhs.serialize());
+    lhs.merge(hws::streaming_statistics{});
+    EXPECT_EQ(empty.serialize(), lhs.serialize());
+
+    // summaries with different relative accuracies can't be merged
+    EXPECT_THROW(merged.merge(hws::streaming_statistics{ 0.05 }), std::invalid_argument);
+}
+
+TEST(StreamingStatistics, MergeWithCollapsedBins) {
+    // the values need more than max_num_bins bins -> the lowest bins are collapsed, the upper quantiles stay accurate
+    hws::streaming_statistics sequential{};
+    hws::streaming_statistics lhs{};
+    hws::streaming_statistics rhs{};
+    std::vector<double> values{};
+    for (int i = 0; i < 6000; ++i) {
+        const double value = std::pow(1.02, i) * 1e-6;
+        values.push_back(value);
+        sequential.add(value);
+        (i % 2 == 0 ? lhs : rhs).add(value);
+    }
+    lhs.merge(rhs);
+
+    EXPECT_EQ(lhs.count(), sequential.count());
+    for (const double q : { 0.9, 0.95, 0.99 }) {
+        const double expected = exact_quantile(values, q);
+        EXPECT_NEAR(lhs.quantile(q), expected, lhs.relative_accuracy() * expected) << "quantile " << q;
+        EXPECT_NEAR(sequential.quantile(q), expected, sequential.relative_accuracy() * expected) << "quantile " << q;
+    }
+}
+
+TEST(StreamingStatistics, SerializeRoundTrip) {
+    hws::streaming_statistics stats{ 0.02 };
+    for (const double value : test_values(1000, 7)) {
+        stats.add(value);
+    }
+    const std::vector<double> data = stats.serialize();
+    const hws::streaming_statistics deserialized = hws::streaming_statistics::deserialize(data);
+    EXPECT_EQ(deserialized.serialize(), data);
+    EXPECT_EQ(deserialized.relative_accuracy(), stats.relative_accuracy());
+    EXPECT_EQ(deserialized.quantile(0.5), stats.quantile(0.5));
+
+    const std::vector<double> empty_data = hws::streaming_statistics{}.serialize();
+    EXPECT_EQ(hws::streaming_statistics::deserialize(empty_data).count(), 0);
+}
+
+TEST(StreamingStatistics, DeserializeMalformedData) {
+    hws::streaming_statistics stats{};
+    for (const double value : { -2.0, 0.0, 1.0, 3.0 }) {
+        stats.add(value);
+    }
+    const std::vector<double> data = stats.serialize();
+    // layout: relative accuracy, count, mean, m2, min, max, zero count, positive offset, number of positive bins, positive bins...
+    const std::size_t positive_offset = 7;
+    const std::size_t negative_offset = positive_offset + 2 + static_cast<std::size_t>(data[positive_offset + 1]);
+    ASSERT_EQ(hws::streaming_statistics::deserialize(data).count(), 4);
+
+    const auto expect_invalid = [&data](const std::size_t idx, const double value) {
+        std::vector<double> malformed = data;
+        malformed[idx] = value;
+        EXPECT_THROW(static_cast<void>(hws::streaming_statistics::deserialize(malformed)), std::invalid_argument) << "index " << idx << " value " << value;
+    };
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    const double inf = std::numeric_limits<double>::infinity();
+    for (const double value : { nan, inf, -1.0, 0.5, 0.0, 1.0 }) {
+        // the relative accuracy must be in (0, 1)
+        if (!(value > 0.0 && value < 1.0)) {
+            expect_invalid(0, value);
+        }
+    }
+    for (const double value : { nan, inf, -1.0, 2.5, 1e30, 5.0 }) {
+        // the counts must be integers fitting into 64 bits and consistent with the bins
+        expect_invalid(1, value);
+        expect_invalid(6, value);
+    }
+    for (const double value : { nan, inf, -inf }) {
+        expect_invalid(2, value);
+        expect_invalid(3, value);
+        expect_invalid(4, value);
+        expect_invalid(5, value);
+    }
+    expect_invalid(3, -1.0);
+    for (const double value : { nan, inf, -inf, 0.5, 1e10, -1e10, static_cast<double>(std::numeric_limits<int>::max()) }) {
+        // the bin offsets must be integers such that all bin indices fit into an int
+        expect_invalid(positive_offset, value);
+        expect_invalid(negative_offset, value);
+    }
+    for (const double value : { nan, inf, -1.0, 0.5, 1e30, static_cast<double>(hws::streaming_statistics::max_num_bins + 1) }) {
+        // invalid numbers of bins
+        expect_invalid(positive_offset + 1, value);
+        expect_invalid(negative_offset + 1, value);
+    }
+    for (const double value : { nan, -1.0, 0.5, 1e30 }) {
+        expect_invalid(positive_offset + 2, value);
+    }
+
+    // truncated data or trailing values
+    for (std::size_t size = 0; size < data.size(); ++size) {
+        EXPECT_THROW(static_cast<void>(hws::streaming_statistics::deserialize(std::vector<double>(data.cbegin(), data.cbegin() + static_cast<std::ptrdiff_t>(size)))), std::invalid_argument) << "size " << size;
+    }
+    std::vector<double> trailing = data;
+    trailing.push_back(0.0);
+    EXPECT_THROW(static_cast<void>(hws::streaming_statistics::deserialize(trailing)), std::invalid_argument);
+}
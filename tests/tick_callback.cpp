@@ -0,0 +1,151 @@
+/**
+ * @author Marcel Breyer
+ * @copyright 2024-today All Rights Reserved
+ * @license This file is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Tests for the tick callbacks using a hardware sampler without any hardware backend.
+ */
+
+#include "hws/hardware_sampler.hpp"  // hws::hardware_sampler
+#include "hws/sample_category.hpp"   // hws::sample_category
+#include "hws/tick_view.hpp"         // hws::tick_view
+
+#include "gtest/gtest.h"  // TEST, EXPECT_EQ, EXPECT_GE, EXPECT_TRUE, EXPECT_FALSE, EXPECT_DOUBLE_EQ, ASSERT_EQ, ASSERT_GE
+
+#include <atomic>   // std::atomic
+#include <chrono>   // std::chrono::milliseconds
+#include <cmath>    // std::isnan
+#include <cstddef>  // std::size_t
+#include <string>   // std::string
+#include <thread>   // std::this_thread::{sleep_for, yield}
+#include <vector>   // std::vector
+
+namespace {
+
+/**
+ * @brief A hardware sampler without any hardware backend providing two numeric hardware samples.
+ */
+class tick_hardware_sampler : public hws::hardware_sampler {
+  public:
+    /// The base sampling interval used in the tests.
+    constexpr static std::chrono::milliseconds base_interval{ 2 };
+
+    tick_hardware_sampler() :
+        hws::hardware_sampler{ base_interval, hws::sample_category::all } { }
+
+    ~tick_hardware_sampler() override {
+        if (this->has_sampling_started() && !this->has_sampling_stopped()) {
+            this->stop_sampling();
+        }
+    }
+
+    [[nodiscard]] std::string device_identification() const override { return "tick_device"; }
+
+    [[nodiscard]] std::string samples_only_as_yaml_string() const override { return ""; }
+
+  private:
+    void initialize_samples() override { }
+
+    void sample() override { ++num_samples_; }
+
+    [[nodiscard]] std::vector<std::string> numeric_sample_names() const override { return { "num_samples", "temperature" }; }
+
+    void latest_numeric_sample_values(const hws::sample_category sampled, std::vector<double> &values) const override {
+        if ((sampled & hws::sample_category::general) != hws::sample_category{}) {
+            values[0] = static_cast<double>(num_samples_);
+        }
+        if ((sampled & hws::sample_category::temperature) != hws::sample_category{}) {
+            values[1] = 42.0;
+        }
+    }
+
+    /// The number of calls to sample(), i.e., the index of the current tick.
+    std::size_t num_samples_{ 0 };
+};
+
+}  // namespace
+
+TEST(TickCallback, NumericSampleValues) {
+    tick_hardware_sampler sampler{};
+    sampler.set_sampling_interval(hws::sample_category::temperature, 2 * tick_hardware_sampler::base_interval);
+
+    std::vector<std::string> names{};
+    std::vector<std::vector<double>> values{};
+    std::vector<bool> temperature_sampled{};
+    static_cast<void>(sampler.add_tick_callback([&](const hws::tick_view &view) {
+        names = view.numeric_sample_names;
+        values.push_back(view.numeric_sample_values);
+        temperature_sampled.push_back(view.sampled(hws::sample_category::temperature));
+    }));
+
+    sampler.start_sampling();
+    std::this_thread::sleep_for(std::chrono::milliseconds{ 50 });
+    sampler.stop_sampling();
+
+    EXPECT_EQ(names, (std::vector<std::string>{ "num_samples", "temperature" }));
+    ASSERT_GE(values.size(), 3);
+    for (std::size_t tick = 0; tick < values.size(); ++tick) {
+        ASSERT_EQ(values[tick].size(), 2);
+        // the general samples are retrieved in every tick
+        EXPECT_DOUBLE_EQ(values[tick][0], static_cast<double>(tick));
+        // the temperature samples only in every second tick -> NaN in the other ticks
+        if (temperature_sampled[tick]) {
+            EXPECT_DOUBLE_EQ(values[tick][1], 42.0) << "tick " << tick;
+        } else {
+            EXPECT_TRUE(std::isnan(values[tick][1])) << "tick " << tick;
+        }
+    }
+}
+
+TEST(TickCallback, AddAndRemoveFromWithinCallback) {
+    tick_hardware_sampler sampler{};
+
+    std::size_t num_self_removing_calls = 0;
+    std::size_t num_added_calls = 0;
+    std::size_t self_removing_id{};
+    self_removing_id = sampler.add_tick_callback([&](const hws::tick_view &) {
+        if (++num_self_removing_calls == 1) {
+            // the callbacks are called without holding a lock -> adding and removing callbacks can't deadlock
+            static_cast<void>(sampler.add_tick_callback([&num_added_calls](const hws::tick_view &) { ++num_added_calls; }));
+        } else if (num_self_removing_calls == 3) {
+            sampler.remove_tick_callback(self_removing_id);
+        }
+    });
+
+    sampler.start_sampling();
+    std::this_thread::sleep_for(std::chrono::milliseconds{ 50 });
+    sampler.stop_sampling();
+
+    // the changes only affect the following ticks
+    EXPECT_EQ(num_self_removing_calls, 3);
+    EXPECT_EQ(num_added_calls + 1, sampler.sampling_time_points().size());
+}
+
+TEST(TickCallback, RemoveWaitsForRunningCallback) {
+    tick_hardware_sampler sampler{};
+
+    std::atomic<bool> running{ false };
+    std::atomic<std::size_t> num_calls{ 0 };
+    const std::size_t id = sampler.add_tick_callback([&](const hws::tick_view &) {
+        running = true;
+        std::this_thread::sleep_for(std::chrono::milliseconds{ 20 });
+        ++num_calls;
+        running = false;
+    });
+
+    sampler.start_sampling();
+    while (!running) {
+        std::this_thread::yield();
+    }
+    // the callback is currently running in the sampling std::thread
+    sampler.remove_tick_callback(id);
+    EXPECT_FALSE(running);
+    const std::size_t num_calls_after_removal = num_calls;
+    EXPECT_GE(num_calls_after_removal, 1);
+    std::this_thread::sleep_for(std::chrono::milliseconds{ 20 });
+    sampler.stop_sampling();
+
+    // the removed callback hasn't been called anymore
+    EXPECT_EQ(num_calls, num_calls_after_removal);
+}
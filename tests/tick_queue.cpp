@@ -0,0 +1,155 @@
+/**
+ * @author Marcel Breyer
+ * @copyright 2024-today All Rights Reserved
+ * @license This file is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Tests for the lock-free single-producer single-consumer queue and the tick consumer built on top of it.
+ */
+
+#include "hws/tick_queue.hpp"
+
+#include "hws/hardware_sampler.hpp"  // hws::hardware_sampler
+#include "hws/sample_category.hpp"   // hws::sample_category
+#include "hws/tick_consumer.hpp"     // hws::tick_consumer
+#include "hws/tick_view.hpp"         // hws::tick_view
+
+#include "gtest/gtest.h"  // TEST, EXPECT_EQ, EXPECT_TRUE, EXPECT_FALSE, EXPECT_THROW, EXPECT_GT, ASSERT_TRUE, ASSERT_EQ
+
+#include <chrono>     // std::chrono::milliseconds
+#include <cstddef>    // std::size_t
+#include <stdexcept>  // std::invalid_argument
+#include <string>     // std::string
+#include <thread>     // std::thread, std::this_thread::{sleep_for, yield}
+#include <vector>     // std::vector
+
+namespace {
+
+/**
+ * @brief A hardware sampler without any hardware backend driving the tick callbacks.
+ */
+class tick_hardware_sampler : public hws::hardware_sampler {
+  public:
+    tick_hardware_sampler() :
+        hws::hardware_sampler{ std::chrono::milliseconds{ 1 }, hws::sample_category::all } { }
+
+    ~tick_hardware_sampler() override {
+        if (this->has_sampling_started() && !this->has_sampling_stopped()) {
+            this->stop_sampling();
+        }
+    }
+
+    [[nodiscard]] std::string device_identification() const override { return "test_device"; }
+
+    [[nodiscard]] std::string samples_only_as_yaml_string() const override { return ""; }
+
+  private:
+    void initialize_samples() override { }
+
+    void sample() override { }
+};
+
+}  // namespace
+
+TEST(TickQueue, ZeroCapacity) {
+    EXPECT_THROW(hws::detail::tick_queue<int>{ 0 }, std::invalid_argument);
+}
+
+TEST(TickQueue, FullAndEmpty) {
+    hws::detail::tick_queue<int> queue{ 3 };
+    EXPECT_EQ(queue.capacity(), 3);
+    EXPECT_TRUE(queue.empty());
+
+    int value{};
+    EXPECT_FALSE(queue.try_pop(value));
+    EXPECT_TRUE(queue.try_push(1));
+    EXPECT_TRUE(queue.try_push(2));
+    EXPECT_TRUE(queue.try_push(3));
+    EXPECT_FALSE(queue.empty());
+    // a full queue rejects the value instead of overwriting the oldest one
+    EXPECT_FALSE(queue.try_push(4));
+
+    ASSERT_TRUE(queue.try_pop(value));
+    EXPECT_EQ(value, 1);
+    // popping a single value frees exactly one slot
+    EXPECT_TRUE(queue.try_push(4));
+    EXPECT_FALSE(queue.try_push(5));
+}
+
+TEST(TickQueue, FifoOrderAcrossWrapAround) {
+    hws::detail::tick_queue<int> queue{ 4 };
+    int next_push = 0;
+    int next_pop = 0;
+    // push and pop in uneven batches such that the positions wrap around the slots multiple times
+    for (int round = 0; round < 50; ++round) {
+        for (int i = 0; i < 1 + round % 4 && queue.try_push(next_push); ++i) {
+            ++next_push;
+        }
+        int value{};
+        for (int i = 0; i < 1 + round % 3 && queue.try_pop(value); ++i) {
+            EXPECT_EQ(value, next_pop);
+            ++next_pop;
+        }
+    }
+    int value{};
+    while (queue.try_pop(value)) {
+        EXPECT_EQ(value, next_pop);
+        ++next_pop;
+    }
+    EXPECT_EQ(next_pop, next_push);
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST(TickQueue, ConcurrentProducerAndConsumer) {
+    constexpr std::size_t num_values = 100000;
+    hws::detail::tick_queue<std::size_t> queue{ 16 };
+
+    std::thread producer{ [&queue]() {
+        for (std::size_t i = 0; i < num_values; ++i) {
+            while (!queue.try_push(i)) {
+                std::this_thread::yield();
+            }
+        }
+    } };
+
+    // the consumer must see every value exactly once and in order
+    std::size_t expected = 0;
+    std::size_t num_out_of_order = 0;
+    while (expected < num_values) {
+        std::size_t value{};
+        if (queue.try_pop(value)) {
+            num_out_of_order += value == expected ? 0 : 1;
+            ++expected;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+    producer.join();
+
+    EXPECT_EQ(num_out_of_order, 0);
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST(TickConsumer, ConsumesOrDropsEveryTick) {
+    tick_hardware_sampler sampler{};
+    std::vector<std::size_t> ticks{};
+    std::size_t num_dropped = 0;
+    {
+        // a tiny queue and a slow consumer -> some ticks are dropped
+        hws::tick_consumer<std::size_t> consumer{ sampler, 2, [](const hws::tick_view &view) { return view.tick; }, [&ticks](const std::size_t &tick) {
+                                                     ticks.push_back(tick);
+                                                     std::this_thread::sleep_for(std::chrono::milliseconds{ 3 });
+                                                 } };
+        sampler.start_sampling();
+        std::this_thread::sleep_for(std::chrono::milliseconds{ 100 });
+        sampler.stop_sampling();
+        num_dropped = consumer.num_dropped();
+    }
+
+    // the destructor consumes all values still queued -> every tick has either been consumed or dropped
+    EXPECT_GT(num_dropped, 0);
+    ASSERT_EQ(ticks.size() + num_dropped, sampler.sampling_time_points().size());
+    for (std::size_t i = 1; i < ticks.size(); ++i) {
+        EXPECT_GT(ticks[i], ticks[i - 1]);
+    }
+}
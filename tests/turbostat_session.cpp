@@ -0,0 +1,179 @@
+/**
+ * @author Marcel Breyer
+ * @copyright 2024-today All Rights Reserved
+ * @license This file is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Tests for reading the rows of the long-lived turbostat process using fake shell scripts instead of turbostat.
+ */
+
+#include "hws/cpu/turbostat_session.hpp"
+
+#include "gtest/gtest.h"  // TEST, EXPECT_EQ, EXPECT_TRUE, EXPECT_FALSE, EXPECT_THROW, ASSERT_TRUE, FAIL
+
+#include <chrono>        // std::chrono::{steady_clock, milliseconds, seconds}
+#include <cstddef>       // std::size_t
+#include <filesystem>    // std::filesystem::{path, temp_directory_path, remove}
+#include <fstream>       // std::ofstream
+#include <stdexcept>     // std::invalid_argument, std::runtime_error
+#include <string>        // std::string, std::to_string
+#include <string_view>   // std::string_view
+#include <system_error>  // std::error_code
+#include <thread>        // std::this_thread::sleep_for
+#include <unistd.h>      // ::getpid
+#include <utility>       // std::move
+#include <vector>        // std::vector
+
+namespace {
+
+/**
+ * @brief Assemble the command line of a turbostat session running the shell script @p script instead of turbostat.
+ * @param[in] script the shell script printing the fake turbostat output
+ * @return the command line (`[[nodiscard]]`)
+ */
+[[nodiscard]] std::vector<std::string> fake_turbostat(std::string script) {
+    return { "sh", "-c", std::move(script) };
+}
+
+/**
+ * @brief Poll the @p session until @p done returns `true` or a timeout of five seconds elapsed.
+ * @tparam Predicate the type of the predicate
+ * @param[in,out] session the turbostat session to poll
+ * @param[in] done the predicate checking whether the expected output has been read
+ * @return `true` if @p done returned `true` before the timeout, otherwise `false` (`[[nodiscard]]`)
+ */
+template <typename Predicate>
+[[nodiscard]] bool poll_until(hws::detail::turbostat_session &session, const Predicate &done) {
+    const std::chrono::steady_clock::time_point timeout = std::chrono::steady_clock::now() + std::chrono::seconds{ 5 };
+    while (std::chrono::steady_clock::now() < timeout) {
+        session.poll();
+        if (done()) {
+            return true;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds{ 1 });
+    }
+    return false;
+}
+
+}  // namespace
+
+TEST(TurbostatSession, InvalidCommandLine) {
+    EXPECT_THROW(hws::detail::turbostat_session{ std::vector<std::string>{} }, std::invalid_argument);
+    EXPECT_THROW(hws::detail::turbostat_session{ std::vector<std::string>{ "hws_turbostat_does_not_exist" } }, std::runtime_error);
+}
+
+TEST(TurbostatSession, PartialLinesAcrossReads) {
+    // the script never prints anything -> only the manually parsed output is used
+    hws::detail::turbostat_session session{ fake_turbostat("exec sleep 60") };
+
+    EXPECT_FALSE(session.parse("Avg_MHz\tBu"));
+    EXPECT_EQ(session.num_headers(), 0);
+    EXPECT_FALSE(session.parse("sy%\tPkgWatt\n1000\t2"));
+    EXPECT_EQ(session.num_headers(), 1);
+    EXPECT_EQ(session.header(), (std::vector<std::string>{ "Avg_MHz", "Busy%", "PkgWatt" }));
+    EXPECT_EQ(session.num_rows(), 0);
+
+    // the row is only complete with its newline
+    EXPECT_FALSE(session.parse(".5\t1"));
+    EXPECT_TRUE(session.parse("5.25\n1001\t3"));
+    EXPECT_EQ(session.num_rows(), 1);
+    EXPECT_EQ(session.latest_row(), std::string_view{ "1000\t2.5\t15.25" });
+
+    // multiple rows in a single read -> only the latest one is kept
+    EXPECT_TRUE(session.parse(".5\t16\n1002\t4.5\t17\n"));
+    EXPECT_EQ(session.num_rows(), 3);
+    EXPECT_EQ(session.latest_row(), std::string_view{ "1002\t4.5\t17" });
+}
+
+TEST(TurbostatSession, ReprintedHeader) {
+    hws::detail::turbostat_session session{ fake_turbostat("exec sleep 60") };
+
+    EXPECT_TRUE(session.parse("Avg_MHz\tBusy%\n1000\t2.5\n"));
+    EXPECT_EQ(session.num_headers(), 1);
+
+    // e.g., after a CPU has been hot-plugged, turbostat prints a new header with other columns
+    EXPECT_FALSE(session.parse("Avg_MHz\tBusy%\tPkgWatt\n"));
+    EXPECT_EQ(session.num_headers(), 2);
+    EXPECT_EQ(session.header(), (std::vector<std::string>{ "Avg_MHz", "Busy%", "PkgWatt" }));
+    // rows matching the previous header are ignored
+    EXPECT_FALSE(session.parse("1001\t3.5\n"));
+    EXPECT_TRUE(session.parse("1002\t4.5\t17\n"));
+    EXPECT_EQ(session.num_rows(), 2);
+    EXPECT_EQ(session.latest_row(), std::string_view{ "1002\t4.5\t17" });
+}
+
+TEST(TurbostatSession, CarriageReturns) {
+    hws::detail::turbostat_session session{ fake_turbostat("exec sleep 60") };
+
+    EXPECT_TRUE(session.parse("Avg_MHz\tBusy%\r\n1000\t2.5\r\n"));
+    EXPECT_EQ(session.header(), (std::vector<std::string>{ "Avg_MHz", "Busy%" }));
+    EXPECT_EQ(session.latest_row(), std::string_view{ "1000\t2.5" });
+    // the carriage return may be split from its newline
+    EXPECT_FALSE(session.parse("1001\t3.5\r"));
+    EXPECT_TRUE(session.parse("\n"));
+    EXPECT_EQ(session.latest_row(), std::string_view{ "1001\t3.5" });
+}
+
+TEST(TurbostatSession, IgnoresMalformedLines) {
+    hws::detail::turbostat_session session{ fake_turbostat("exec sleep 60") };
+
+    // rows before the first header and warnings (e.g., printed to stderr) aren't part of the table
+    EXPECT_FALSE(session.parse("1000\t2.5\n"));
+    EXPECT_FALSE(session.parse("turbostat: cpu0: msr offset 0x611 read failed\n\n"));
+    EXPECT_EQ(session.num_headers(), 0);
+    EXPECT_EQ(session.num_rows(), 0);
+
+    EXPECT_TRUE(session.parse("Avg_MHz\tBusy%\tPkgWatt\n1000\t2.5\t15\n"));
+    // rows with too few or too many cells are ignored -> the previous row is kept
+    EXPECT_FALSE(session.parse("1001\t3.5\n"));
+    EXPECT_FALSE(session.parse("1001\t3.5\t16\t0\n"));
+    EXPECT_FALSE(session.parse("1001 3.5 16\n"));
+    EXPECT_EQ(session.num_rows(), 1);
+    EXPECT_EQ(session.latest_row(), std::string_view{ "1000\t2.5\t15" });
+}
+
+TEST(TurbostatSession, PollsRowsSplitAcrossReads) {
+    // the fake turbostat prints the second half of its row only after the marker file has been created
+    const std::filesystem::path marker = std::filesystem::temp_directory_path() / ("hws_test_turbostat_" + std::to_string(::getpid()));
+    std::error_code ec{};
+    std::filesystem::remove(marker, ec);
+    hws::detail::turbostat_session session{ fake_turbostat("printf 'warning on stderr\\n' >&2; printf 'Avg_MHz\\tBusy%%\\n1000\\t'; "
+                                                           "while [ ! -e '"
+                                                           + marker.string() + "' ]; do sleep 0.01; done; printf '2.5\\r\\n'; exec sleep 60") };
+
+    ASSERT_TRUE(poll_until(session, [&session]() { return session.num_headers() == 1; }));
+    EXPECT_EQ(session.header(), (std::vector<std::string>{ "Avg_MHz", "Busy%" }));
+    // the first half of the row has been read, but the row isn't complete yet
+    std::this_thread::sleep_for(std::chrono::milliseconds{ 50 });
+    EXPECT_FALSE(session.poll());
+    EXPECT_EQ(session.num_rows(), 0);
+
+    std::ofstream{ marker };
+    ASSERT_TRUE(poll_until(session, [&session]() { return session.num_rows() == 1; }));
+    EXPECT_EQ(session.latest_row(), std::string_view{ "1000\t2.5" });
+    // no new output -> no new row
+    EXPECT_FALSE(session.poll());
+
+    std::filesystem::remove(marker, ec);
+}
+
+TEST(TurbostatSession, ChildProcessExitsEarly) {
+    hws::detail::turbostat_session session{ fake_turbostat("printf 'Avg_MHz\\tBusy%%\\n1000\\t2.5\\n'") };
+
+    // the output printed before the exit is still read, afterward polling throws
+    std::size_t num_polls = 0;
+    const std::chrono::steady_clock::time_point timeout = std::chrono::steady_clock::now() + std::chrono::seconds{ 5 };
+    try {
+        while (std::chrono::steady_clock::now() < timeout) {
+            session.poll();
+            ++num_polls;
+            std::this_thread::sleep_for(std::chrono::milliseconds{ 1 });
+        }
+        FAIL() << "The turbostat session didn't notice the exit of its child process after " << num_polls << " polls!";
+    } catch (const std::runtime_error &) {
+        // expected
+    }
+    EXPECT_EQ(session.num_rows(), 1);
+    EXPECT_EQ(session.latest_row(), std::string_view{ "1000\t2.5" });
+    EXPECT_THROW(session.poll(), std::runtime_error);
+}